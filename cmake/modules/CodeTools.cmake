@@ -38,3 +38,16 @@ FetchContent_MakeAvailable(googletest)
   message(VERBOSE "GTest binaries are present at ${googletest_BINARY_DIR}")
 endfunction()
 
+# Fetches google benchmark version 1.8.3
+function(fetch_googlebenchmark)
+  include(FetchContent)
+  set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+  FetchContent_Declare(
+    googlebenchmark
+    GIT_REPOSITORY https://github.com/google/benchmark.git
+    GIT_TAG v1.8.3)
+FetchContent_MakeAvailable(googlebenchmark)
+  message(VERBOSE "Google Benchmark binaries are present at ${googlebenchmark_BINARY_DIR}")
+endfunction()
+
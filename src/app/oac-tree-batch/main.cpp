@@ -0,0 +1,250 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <oac_tree_gui/components/custom_meta_types.h>
+#include <oac_tree_gui/components/load_resources.h>
+#include <oac_tree_gui/core/version.h>
+#include <oac_tree_gui/domain/domain_helper.h>
+#include <oac_tree_gui/domain/domain_library_loader.h>
+#include <oac_tree_gui/jobsystem/batch_job_runner.h>
+#include <oac_tree_gui/jobsystem/scripted_user_responder.h>
+
+#include <QCommandLineOption>
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDir>
+#include <QFileInfo>
+#include <QThread>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+
+const QString kJobsOption = "jobs";
+const QString kRepeatOption = "repeat";
+const QString kOutputOption = "output";
+const QString kTickTimeoutOption = "tick-timeout";
+const QString kJobTimeoutOption = "job-timeout";
+const QString kSeverityOption = "severity";
+const QString kLogRateOption = "log-rate";
+const QString kMaxLogsOption = "max-logs";
+const QString kPluginOption = "plugin";
+const QString kResponsesOption = "responses";
+
+/**
+ * @brief The BatchOptions struct contains the result of command line option parsing.
+ */
+struct BatchOptions
+{
+  std::vector<std::string> file_names;  //!< procedure files, repetitions included
+  std::string output;                   //!< JSON lines output, empty means standard output
+  std::vector<std::string> plugins;     //!< plugins to load in addition to the basic ones
+  oac_tree_gui::BatchJobOptions job_options;
+};
+
+void PopulateOptions(QCommandLineParser& parser)
+{
+  parser.setApplicationDescription(
+      "Runs oac-tree procedures without the GUI and reports every job as a JSON line.");
+  parser.addHelpOption();
+  parser.addVersionOption();
+  parser.addPositionalArgument("files",
+                               "Procedure files, or folders to take all *.xml files from.",
+                               "files...");
+
+  parser.addOption({{"j", kJobsOption}, "Number of jobs running concurrently.", "n"});
+  parser.addOption({{"r", kRepeatOption}, "Number of times to run every procedure.", "n", "1"});
+  parser.addOption({{"o", kOutputOption}, "Write JSON lines to a file instead of stdout.", "file"});
+  parser.addOption(
+      {kTickTimeoutOption, "Target interval between ticks of a job, microseconds.", "usec", "0"});
+  parser.addOption(
+      {kJobTimeoutOption, "Halt the job running longer than this, 0 means no limit.", "msec", "0"});
+  parser.addOption(
+      {kSeverityOption, "Drop log messages less important than this, e.g. INFO.", "name", "TRACE"});
+  parser.addOption(
+      {kLogRateOption, "Maximum number of log messages per second, 0 means no limit.", "n", "0"});
+  parser.addOption(
+      {kMaxLogsOption, "Number of most recent log messages kept per job, 0 means no limit.", "n",
+       "1000"});
+  parser.addOption({kPluginOption, "Additional plugin library to load.", "name"});
+  parser.addOption(
+      {kResponsesOption, "JSON file with rules to answer user input and choice requests.", "file"});
+}
+
+/**
+ * @brief Returns the value of the option as a non-negative number, exits on invalid value.
+ */
+std::size_t GetNumber(QCommandLineParser& parser, const QString& option_name)
+{
+  bool is_valid{false};
+  const auto result = parser.value(option_name).toULongLong(&is_valid);
+  if (!is_valid)
+  {
+    std::cerr << "Invalid value of --" << option_name.toStdString() << "\n";
+    parser.showHelp(1);
+  }
+  return static_cast<std::size_t>(result);
+}
+
+/**
+ * @brief Returns procedure file names from positional arguments, folders are expanded.
+ */
+std::vector<std::string> GetFileNames(const QStringList& arguments)
+{
+  std::vector<std::string> result;
+  for (const auto& argument : arguments)
+  {
+    const QFileInfo info(argument);
+    if (info.isDir())
+    {
+      const QDir dir(argument);
+      for (const auto& entry : dir.entryInfoList({"*.xml"}, QDir::Files, QDir::Name))
+      {
+        result.push_back(entry.absoluteFilePath().toStdString());
+      }
+    }
+    else
+    {
+      result.push_back(argument.toStdString());
+    }
+  }
+  return result;
+}
+
+BatchOptions ParseOptions(QCommandLineParser& parser)
+{
+  BatchOptions result;
+
+  const auto file_names = GetFileNames(parser.positionalArguments());
+  if (file_names.empty())
+  {
+    std::cerr << "No procedure files given\n";
+    parser.showHelp(1);
+  }
+
+  const auto repeat_count = GetNumber(parser, kRepeatOption);
+  for (std::size_t index = 0; index < repeat_count; ++index)
+  {
+    result.file_names.insert(result.file_names.end(), file_names.begin(), file_names.end());
+  }
+
+  auto& job_options = result.job_options;
+  job_options.worker_count = static_cast<std::size_t>(std::max(1, QThread::idealThreadCount()));
+  if (parser.isSet(kJobsOption))
+  {
+    job_options.worker_count = GetNumber(parser, kJobsOption);
+  }
+  if (job_options.worker_count == 0)
+  {
+    std::cerr << "Number of jobs should be positive\n";
+    parser.showHelp(1);
+  }
+  job_options.tick_timeout = std::chrono::microseconds(GetNumber(parser, kTickTimeoutOption));
+  job_options.job_timeout = std::chrono::milliseconds(GetNumber(parser, kJobTimeoutOption));
+  job_options.log_flood_options.max_message_rate = GetNumber(parser, kLogRateOption);
+  job_options.max_log_count = GetNumber(parser, kMaxLogsOption);
+  try
+  {
+    job_options.log_flood_options.severity_threshold =
+        oac_tree_gui::GetSeverity(parser.value(kSeverityOption).toUpper().toStdString());
+  }
+  catch (const std::exception& ex)
+  {
+    std::cerr << ex.what() << "\n";
+    parser.showHelp(1);
+  }
+
+  if (parser.isSet(kResponsesOption))
+  {
+    try
+    {
+      job_options.user_context =
+          oac_tree_gui::CreateScriptedUserContext(parser.value(kResponsesOption).toStdString());
+    }
+    catch (const std::exception& ex)
+    {
+      std::cerr << ex.what() << "\n";
+      parser.showHelp(1);
+    }
+  }
+
+  result.output = parser.value(kOutputOption).toStdString();
+  for (const auto& plugin : parser.values(kPluginOption))
+  {
+    result.plugins.push_back(plugin.toStdString());
+  }
+
+  return result;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  oac_tree_gui::RegisterCustomMetaTypes();
+
+  const QCoreApplication app(argc, argv);
+  QCoreApplication::setApplicationName("oac-tree-batch");
+  QCoreApplication::setApplicationVersion(QString::fromStdString(oac_tree_gui::ProjectVersion()));
+
+  QCommandLineParser parser;
+  PopulateOptions(parser);
+  parser.process(app);
+  const auto options = ParseOptions(parser);
+
+  oac_tree_gui::DomainLibraryLoader loader(oac_tree_gui::GetBasicPluginFileNames());
+  for (const auto& plugin : options.plugins)
+  {
+    loader.LoadLibrary(plugin);
+  }
+  oac_tree_gui::LoadOacTreeItems();
+
+  std::ofstream output_file;
+  if (!options.output.empty())
+  {
+    output_file.open(options.output);
+    if (!output_file)
+    {
+      std::cerr << "Can't open output file " << options.output << "\n";
+      return 1;
+    }
+  }
+  std::ostream& output = options.output.empty() ? std::cout : output_file;
+
+  auto on_result = [&output](const oac_tree_gui::BatchJobResult& result)
+  { output << oac_tree_gui::ToJsonLine(result) << std::endl; };
+
+  const auto start_time = std::chrono::steady_clock::now();
+  oac_tree_gui::BatchJobRunner runner(options.job_options, on_result);
+  const auto results = runner.Run(options.file_names);
+  const std::chrono::duration<double> wall_time = std::chrono::steady_clock::now() - start_time;
+
+  const auto succeeded_count = std::count_if(results.begin(), results.end(),
+                                             [](const auto& result)
+                                             { return oac_tree_gui::IsSucceeded(result); });
+
+  std::cerr << "Jobs: " << results.size() << ", succeeded: " << succeeded_count
+            << ", wall time: " << wall_time.count() << " s, throughput: "
+            << static_cast<double>(results.size()) / wall_time.count() << " jobs/s\n";
+
+  return succeeded_count == static_cast<std::ptrdiff_t>(results.size()) ? 0 : 1;
+}
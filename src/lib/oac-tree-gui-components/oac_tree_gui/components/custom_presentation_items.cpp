@@ -67,4 +67,21 @@ QVector<int> ChannelPresentationItem::GetQtRoles(mvvm::role_t data_role) const
   return result;
 }
 
+ComputedPresentationItem::ComputedPresentationItem(mvvm::SessionItem* item, get_value_t get_value)
+    : mvvm::DataPresentationItem(item, mvvm::DataRole::kDisplay), m_get_value(std::move(get_value))
+{
+}
+
+QVariant ComputedPresentationItem::Data(mvvm::role_t qt_role) const
+{
+  return qt_role == Qt::DisplayRole ? m_get_value() : QVariant();
+}
+
+bool ComputedPresentationItem::SetData(const QVariant& data, mvvm::role_t qt_role)
+{
+  (void)data;
+  (void)qt_role;
+  return false;
+}
+
 }  // namespace oac_tree_gui
@@ -23,6 +23,8 @@
 
 #include <mvvm/providers/standard_presentation_items.h>
 
+#include <functional>
+
 namespace oac_tree_gui
 {
 
@@ -50,6 +52,34 @@ private:
   QString m_channel_name;
 };
 
+/**
+ * @brief The ComputedPresentationItem class shows a read-only value which is computed on request,
+ * rather than stored in the item.
+ *
+ * Used to show data kept outside of the model, e.g. the execution profile of instructions. The
+ * viewmodel should report changes of such data itself.
+ */
+class ComputedPresentationItem : public mvvm::DataPresentationItem
+{
+public:
+  using get_value_t = std::function<QVariant()>;
+
+  /**
+   * @brief Main constructor.
+   *
+   * @param item The item the value belongs to.
+   * @param get_value The callback to compute the value for the display role.
+   */
+  ComputedPresentationItem(mvvm::SessionItem* item, get_value_t get_value);
+
+  QVariant Data(mvvm::role_t qt_role) const override;
+
+  bool SetData(const QVariant& data, mvvm::role_t qt_role) override;
+
+private:
+  get_value_t m_get_value;
+};
+
 }  // namespace oac_tree_gui
 
 #endif  // OAC_TREE_GUI_COMPONENTS_CUSTOM_PRESENTATION_ITEMS_H_
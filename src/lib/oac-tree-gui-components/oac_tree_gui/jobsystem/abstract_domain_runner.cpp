@@ -22,6 +22,7 @@
 
 #include "domain_event_dispatcher_context.h"
 #include "domain_event_helper.h"
+#include "domain_event_trace.h"
 #include "domain_job_observer.h"
 #include "domain_job_service.h"
 #include "user_context.h"
@@ -31,6 +32,7 @@
 #include <sup/oac-tree/i_job.h>
 #include <sup/oac-tree/instruction_info.h>
 #include <sup/oac-tree/job_info.h>
+#include <sup/oac-tree/job_info_utils.h>
 #include <sup/oac-tree/job_states.h>
 
 #include <set>
@@ -39,13 +41,18 @@ namespace oac_tree_gui
 {
 
 AbstractDomainRunner::AbstractDomainRunner(DomainEventDispatcherContext dispatcher_context,
-                                           UserContext user_context)
-    : m_domain_job_service(std::make_unique<DomainJobService>(std::move(dispatcher_context),
-                                                              std::move(user_context)))
+                                           UserContext user_context,
+                                           const DomainEventQueueOptions& queue_options)
+    : m_domain_job_service(std::make_unique<DomainJobService>(
+          std::move(dispatcher_context), std::move(user_context), queue_options))
 {
 }
 
-AbstractDomainRunner::~AbstractDomainRunner() = default;
+AbstractDomainRunner::~AbstractDomainRunner()
+{
+  // the domain job will be destroyed first, it shouldn't wait for the GUI to free the event queue
+  m_domain_job_service->CloseEventQueue();
+}
 
 bool AbstractDomainRunner::Start()
 {
@@ -131,7 +138,7 @@ bool AbstractDomainRunner::IsBusy() const
   return busy_states.find(GetJobState()) != busy_states.end();
 }
 
-void AbstractDomainRunner::SetTickTimeout(std::chrono::milliseconds timeout)
+void AbstractDomainRunner::SetTickTimeout(std::chrono::microseconds timeout)
 {
   m_domain_job_service->SetTickTimeout(timeout);
 }
@@ -141,6 +148,102 @@ std::size_t AbstractDomainRunner::GetEventCount() const
   return m_domain_job_service->GetEventCount();
 }
 
+DomainEventStatistics AbstractDomainRunner::GetEventStatistics() const
+{
+  return m_domain_job_service->GetEventStatistics();
+}
+
+void AbstractDomainRunner::SetDispatchBudget(std::size_t max_event_count,
+                                             std::chrono::milliseconds max_duration)
+{
+  m_domain_job_service->SetDispatchBudget(max_event_count, max_duration);
+}
+
+void AbstractDomainRunner::SetEventConflationEnabled(bool value)
+{
+  m_domain_job_service->SetEventConflationEnabled(value);
+}
+
+std::size_t AbstractDomainRunner::GetConflatedEventCount() const
+{
+  return m_domain_job_service->GetConflatedEventCount();
+}
+
+void AbstractDomainRunner::SetEventPacingEnabled(bool value)
+{
+  m_domain_job_service->SetEventPacingEnabled(value);
+}
+
+void AbstractDomainRunner::ProcessEvents(std::chrono::steady_clock::time_point deadline)
+{
+  m_domain_job_service->ProcessEvents(deadline);
+}
+
+bool AbstractDomainRunner::WaitForEvents(std::chrono::milliseconds duration)
+{
+  return m_domain_job_service->WaitForEvents(duration);
+}
+
+void AbstractDomainRunner::SetActiveInstructionDeltaEnabled(bool value)
+{
+  m_domain_job_service->SetActiveInstructionDeltaEnabled(value);
+}
+
+void AbstractDomainRunner::SetLogFloodOptions(const LogFloodOptions& options)
+{
+  m_domain_job_service->SetLogFloodOptions(options);
+}
+
+void AbstractDomainRunner::SetUserRequestTimeout(std::chrono::milliseconds timeout)
+{
+  m_domain_job_service->SetUserRequestTimeout(timeout);
+}
+
+std::vector<PendingRequest<UserInputArgs>> AbstractDomainRunner::GetPendingUserInputRequests() const
+{
+  return m_domain_job_service->GetPendingUserInputRequests();
+}
+
+std::vector<PendingRequest<UserChoiceArgs>> AbstractDomainRunner::GetPendingUserChoiceRequests()
+    const
+{
+  return m_domain_job_service->GetPendingUserChoiceRequests();
+}
+
+bool AbstractDomainRunner::SendUserInput(std::uint64_t id, const UserInputResult& result)
+{
+  return m_domain_job_service->SendUserInput(id, result);
+}
+
+bool AbstractDomainRunner::SendUserChoice(std::uint64_t id, const UserChoiceResult& result)
+{
+  return m_domain_job_service->SendUserChoice(id, result);
+}
+
+void AbstractDomainRunner::StartEventRecording(const std::string& file_name)
+{
+  StopEventRecording();
+
+  m_trace_writer = std::make_shared<DomainEventTraceWriter>(
+      file_name, sup::oac_tree::utils::ToAnyValue(GetJobInfo()));
+  m_domain_job_service->SetEventTraceWriter(m_trace_writer);
+}
+
+void AbstractDomainRunner::StopEventRecording()
+{
+  if (m_trace_writer)
+  {
+    m_domain_job_service->SetEventTraceWriter({});
+    m_trace_writer->Flush();
+    m_trace_writer.reset();
+  }
+}
+
+bool AbstractDomainRunner::IsEventRecording() const
+{
+  return m_trace_writer != nullptr;
+}
+
 const sup::oac_tree::JobInfo& AbstractDomainRunner::GetJobInfo() const
 {
   ValidateJob();
@@ -156,6 +259,12 @@ void AbstractDomainRunner::SetDomainJob(std::unique_ptr<sup::oac_tree::IJob> job
   m_domain_job_service->SetInstructionActiveFilter(filter);
 }
 
+void AbstractDomainRunner::ResetDomainJob()
+{
+  m_domain_job_service->CloseEventQueue();
+  m_domain_job.reset();
+}
+
 void AbstractDomainRunner::ValidateJob() const
 {
   if (!m_domain_job)
@@ -22,17 +22,25 @@
 #define OAC_TREE_GUI_JOBSYSTEM_ABSTRACT_DOMAIN_RUNNER_H_
 
 #include <oac_tree_gui/domain/sequencer_types_fwd.h>
+#include <oac_tree_gui/jobsystem/domain_event_queue_options.h>
+#include <oac_tree_gui/jobsystem/domain_event_statistics.h>
+#include <oac_tree_gui/jobsystem/request_handler_queue.h>
+#include <oac_tree_gui/jobsystem/request_types.h>
 
 #include <sup/oac-tree/job_states.h>
 
 #include <chrono>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace oac_tree_gui
 {
 
 class DomainJobService;
 struct DomainEventDispatcherContext;
+class DomainEventTraceWriter;
+struct LogFloodOptions;
 struct UserContext;
 
 /**
@@ -44,7 +52,8 @@ class AbstractDomainRunner
 {
 public:
   explicit AbstractDomainRunner(DomainEventDispatcherContext dispatcher_context,
-                                UserContext user_context);
+                                UserContext user_context,
+                                const DomainEventQueueOptions& queue_options = {});
 
   virtual ~AbstractDomainRunner();
 
@@ -119,9 +128,9 @@ public:
   bool IsBusy() const;
 
   /**
-   * @brief Sets sleep time on every tick.
+   * @brief Sets the target interval between procedure ticks, zero means full speed.
    */
-  void SetTickTimeout(std::chrono::milliseconds timeout);
+  void SetTickTimeout(std::chrono::microseconds timeout);
 
   /**
    * @brief Returns number of events in a queue.
@@ -130,6 +139,99 @@ public:
    */
   std::size_t GetEventCount() const;
 
+  /**
+   * @brief Returns diagnostics of domain events delivery to the GUI.
+   */
+  DomainEventStatistics GetEventStatistics() const;
+
+  /**
+   * @brief Sets the budget for a single pass of event processing in the GUI thread.
+   *
+   * @param max_event_count Maximum number of events to process in one pass, 0 means no limit.
+   * @param max_duration Maximum time to spend in one pass, 0 means no limit.
+   */
+  void SetDispatchBudget(std::size_t max_event_count, std::chrono::milliseconds max_duration);
+
+  /**
+   * @brief Enables conflation of instruction state and variable updates.
+   */
+  void SetEventConflationEnabled(bool value);
+
+  /**
+   * @brief Returns number of domain events dropped by the conflation.
+   */
+  std::size_t GetConflatedEventCount() const;
+
+  /**
+   * @brief Enables paced processing of domain events, see DomainJobService::SetEventPacingEnabled.
+   */
+  void SetEventPacingEnabled(bool value);
+
+  /**
+   * @brief Processes pending domain events within the dispatch budget, and until the deadline.
+   */
+  void ProcessEvents(std::chrono::steady_clock::time_point deadline =
+                         std::chrono::steady_clock::time_point::max());
+
+  /**
+   * @brief Blocks until there are domain events to process, see DomainJobService::WaitForEvents.
+   */
+  bool WaitForEvents(std::chrono::milliseconds duration);
+
+  /**
+   * @brief Enables delta encoding of active instruction notifications.
+   */
+  void SetActiveInstructionDeltaEnabled(bool value);
+
+  /**
+   * @brief Sets options to suppress excessive log messages, see DomainJobObserver.
+   */
+  void SetLogFloodOptions(const LogFloodOptions& options);
+
+  /**
+   * @brief Sets the time to wait for the user's answer to each input or choice request, zero
+   * means no timeout.
+   */
+  void SetUserRequestTimeout(std::chrono::milliseconds timeout);
+
+  /**
+   * @brief Returns user input requests waiting for the answer, in the order of their arrival.
+   */
+  std::vector<PendingRequest<UserInputArgs>> GetPendingUserInputRequests() const;
+
+  /**
+   * @brief Returns user choice requests waiting for the answer, in the order of their arrival.
+   */
+  std::vector<PendingRequest<UserChoiceArgs>> GetPendingUserChoiceRequests() const;
+
+  /**
+   * @brief Answers the pending user input request with the given id, in any order.
+   */
+  bool SendUserInput(std::uint64_t id, const UserInputResult& result);
+
+  /**
+   * @brief Answers the pending user choice request with the given id, in any order.
+   */
+  bool SendUserChoice(std::uint64_t id, const UserChoiceResult& result);
+
+  /**
+   * @brief Starts recording of all domain events of the job into the trace file.
+   *
+   * The trace can be replayed later with ReplayDomainRunner. Throws RuntimeException if the file
+   * can't be opened.
+   */
+  void StartEventRecording(const std::string& file_name);
+
+  /**
+   * @brief Stops recording of domain events and closes the trace file.
+   */
+  void StopEventRecording();
+
+  /**
+   * @brief Checks if domain events are being recorded.
+   */
+  bool IsEventRecording() const;
+
   /**
    * @brief Returns sequencer job info.
    */
@@ -140,11 +242,17 @@ public:
    */
   void SetDomainJob(std::unique_ptr<sup::oac_tree::IJob> job);
 
+  /**
+   * @brief Destroys sequencer Job, without waiting for the GUI to process remaining events.
+   */
+  void ResetDomainJob();
+
 private:
   void ValidateJob() const;
 
   std::unique_ptr<DomainJobService> m_domain_job_service;
   std::unique_ptr<sup::oac_tree::IJob> m_domain_job;
+  std::shared_ptr<DomainEventTraceWriter> m_trace_writer;
 };
 
 }  // namespace oac_tree_gui
@@ -29,6 +29,8 @@
 #include <sup/oac-tree-server/exceptions.h>
 #include <sup/oac-tree/job_info.h>
 
+#include <optional>
+
 namespace oac_tree_gui
 {
 
@@ -57,18 +59,86 @@ std::string AutomationClient::GetServerName() const
 
 std::size_t AutomationClient::GetJobCount() const
 {
+  const std::scoped_lock lock{m_job_manager_mutex};
   return m_automation_job_manager->GetNumberOfJobs();
 }
 
 std::string AutomationClient::GetProcedureName(std::uint32_t job_index) const
 {
+  const std::scoped_lock lock{m_job_manager_mutex};
   return m_automation_job_manager->GetJobInfo(job_index).GetProcedureName();
 }
 
+void AutomationClient::PrepareJob(std::uint32_t job_index)
+{
+  PreparedRemoteJob prepared_job;
+  {
+    // the store of prepared jobs remains accessible while connecting
+    const std::scoped_lock manager_lock{m_job_manager_mutex};
+    prepared_job = PrepareRemoteJob(*m_automation_job_manager, job_index);
+  }
+
+  std::optional<PreparedRemoteJob> replaced_job;
+  {
+    const std::scoped_lock lock{m_mutex};
+    if (auto pos = m_prepared_jobs.find(job_index); pos != m_prepared_jobs.end())
+    {
+      replaced_job = std::move(pos->second);
+      pos->second = std::move(prepared_job);
+    }
+    else
+    {
+      (void)m_prepared_jobs.emplace(job_index, std::move(prepared_job));
+    }
+  }
+
+  // the job prepared earlier for the same index is replaced, its connection is closed
+  if (replaced_job.has_value())
+  {
+    replaced_job->job_io->Close();
+  }
+}
+
+void AutomationClient::DiscardPreparedJob(std::uint32_t job_index)
+{
+  std::optional<PreparedRemoteJob> prepared_job;
+  {
+    const std::scoped_lock lock{m_mutex};
+    if (auto pos = m_prepared_jobs.find(job_index); pos != m_prepared_jobs.end())
+    {
+      prepared_job = std::move(m_prepared_jobs.extract(pos).mapped());
+    }
+  }
+
+  // disconnecting outside of the lock, reports stored so far are dropped
+  if (prepared_job.has_value())
+  {
+    prepared_job->job_io->Close();
+  }
+}
+
 std::unique_ptr<AbstractJobHandler> AutomationClient::CreateJobHandler(
     RemoteJobItem* job_item, const UserContext& user_context)
 {
   auto job_index = job_item->GetRemoteJobIndex();
+
+  std::optional<PreparedRemoteJob> prepared_job;
+  {
+    const std::scoped_lock lock{m_mutex};
+    if (auto pos = m_prepared_jobs.find(static_cast<std::uint32_t>(job_index));
+        pos != m_prepared_jobs.end())
+    {
+      prepared_job = std::move(m_prepared_jobs.extract(pos).mapped());
+    }
+  }
+
+  if (prepared_job.has_value())
+  {
+    return std::make_unique<RemoteJobHandler>(job_item, std::move(prepared_job.value()),
+                                              user_context);
+  }
+
+  const std::scoped_lock manager_lock{m_job_manager_mutex};
   return std::make_unique<RemoteJobHandler>(job_item, *m_automation_job_manager, job_index,
                                             user_context);
 }
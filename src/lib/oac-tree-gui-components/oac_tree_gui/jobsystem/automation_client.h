@@ -25,8 +25,11 @@
 
 #include <oac_tree_gui/domain/sequencer_types_fwd.h>
 #include <oac_tree_gui/jobsystem/i_automation_client.h>
+#include <oac_tree_gui/jobsystem/remote_domain_runner.h>
 
+#include <map>
 #include <memory>
+#include <mutex>
 
 namespace sup::oac_tree_server
 {
@@ -41,6 +44,9 @@ class AbstractJobHandler;
 /**
  * @brief The AutomationClient class is a simple wrapper around automation server machinery to hide
  * its API.
+ *
+ * Calls to the job manager are serialized, since it is not known to be thread-safe. Jobs of
+ * different servers are still prepared in parallel.
  */
 class AutomationClient : public IAutomationClient
 {
@@ -59,12 +65,20 @@ public:
 
   std::string GetProcedureName(std::uint32_t job_index) const override;
 
+  void PrepareJob(std::uint32_t job_index) override;
+
+  void DiscardPreparedJob(std::uint32_t job_index) override;
+
   std::unique_ptr<AbstractJobHandler> CreateJobHandler(RemoteJobItem* job_item,
                                                        const UserContext& user_context) override;
 
 private:
   std::string m_server_name;
   std::unique_ptr<sup::oac_tree_server::IJobManager> m_automation_job_manager;
+  mutable std::mutex m_job_manager_mutex;  //!< serializes calls to the job manager
+
+  mutable std::mutex m_mutex;
+  std::map<std::uint32_t, PreparedRemoteJob> m_prepared_jobs;  //!< job index to prepared job
 };
 
 }  // namespace oac_tree_gui
@@ -0,0 +1,144 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "background_executor.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+
+namespace oac_tree_gui
+{
+
+BackgroundExecutor::BackgroundExecutor(std::size_t max_thread_count)
+    : m_max_thread_count(max_thread_count)
+{
+  if (max_thread_count == 0)
+  {
+    throw RuntimeException("Executor should have at least one thread");
+  }
+}
+
+BackgroundExecutor::~BackgroundExecutor()
+{
+  {
+    const std::scoped_lock lock{m_mutex};
+    m_tasks.clear();
+    m_is_stopping = true;
+  }
+  m_task_condition.notify_all();
+
+  for (auto& thread : m_threads)
+  {
+    thread.join();
+  }
+}
+
+std::size_t BackgroundExecutor::GetMaxThreadCount() const
+{
+  return m_max_thread_count;
+}
+
+void BackgroundExecutor::Submit(task_t task)
+{
+  if (!task)
+  {
+    throw RuntimeException("Task is not initialised");
+  }
+
+  {
+    const std::scoped_lock lock{m_mutex};
+    m_tasks.push_back(std::move(task));
+
+    // starting a new thread only when all existing threads are busy
+    if (m_idle_thread_count < m_tasks.size() && m_threads.size() < m_max_thread_count)
+    {
+      m_threads.emplace_back([this]() { RunWorker(); });
+    }
+  }
+  m_task_condition.notify_one();
+}
+
+std::size_t BackgroundExecutor::CancelPending()
+{
+  std::size_t result{0};
+  {
+    const std::scoped_lock lock{m_mutex};
+    result = m_tasks.size();
+    m_tasks.clear();
+  }
+  m_idle_condition.notify_all();
+  return result;
+}
+
+std::size_t BackgroundExecutor::GetPendingCount() const
+{
+  const std::scoped_lock lock{m_mutex};
+  return m_tasks.size();
+}
+
+std::size_t BackgroundExecutor::GetRunningCount() const
+{
+  const std::scoped_lock lock{m_mutex};
+  return m_running_count;
+}
+
+void BackgroundExecutor::WaitForIdle() const
+{
+  std::unique_lock lock{m_mutex};
+  m_idle_condition.wait(lock, [this]() { return m_tasks.empty() && m_running_count == 0; });
+}
+
+void BackgroundExecutor::RunWorker()
+{
+  std::unique_lock lock{m_mutex};
+  while (true)
+  {
+    ++m_idle_thread_count;
+    m_task_condition.wait(lock, [this]() { return m_is_stopping || !m_tasks.empty(); });
+    --m_idle_thread_count;
+
+    if (m_is_stopping)
+    {
+      return;
+    }
+
+    auto task = std::move(m_tasks.front());
+    m_tasks.pop_front();
+    ++m_running_count;
+    lock.unlock();
+
+    try
+    {
+      task();
+    }
+    catch (const std::exception&)
+    {
+      // the task reports its own errors, the worker should survive
+    }
+
+    // the task is destroyed outside of the lock, it might hold resources with heavy destructors
+    task = nullptr;
+
+    lock.lock();
+    --m_running_count;
+    m_idle_condition.notify_all();
+  }
+}
+
+}  // namespace oac_tree_gui
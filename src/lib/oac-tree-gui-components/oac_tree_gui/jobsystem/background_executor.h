@@ -0,0 +1,108 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_BACKGROUND_EXECUTOR_H_
+#define OAC_TREE_GUI_JOBSYSTEM_BACKGROUND_EXECUTOR_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+/**
+ * @brief The BackgroundExecutor class runs tasks on a pool of background threads.
+ *
+ * Threads are started on demand, up to the given maximum, and stay idle between tasks. Tasks are
+ * taken in the order of submission. Pending tasks can be cancelled, while tasks which have already
+ * started always run to the end: the executor can't interrupt a blocking call. The destructor
+ * discards pending tasks and waits for running ones.
+ */
+class BackgroundExecutor
+{
+public:
+  using task_t = std::function<void()>;
+
+  /**
+   * @brief Main c-tor.
+   *
+   * @param max_thread_count Maximum number of threads running tasks in parallel.
+   */
+  explicit BackgroundExecutor(std::size_t max_thread_count);
+  ~BackgroundExecutor();
+
+  BackgroundExecutor(const BackgroundExecutor&) = delete;
+  BackgroundExecutor& operator=(const BackgroundExecutor&) = delete;
+  BackgroundExecutor(BackgroundExecutor&&) = delete;
+  BackgroundExecutor& operator=(BackgroundExecutor&&) = delete;
+
+  std::size_t GetMaxThreadCount() const;
+
+  /**
+   * @brief Adds the task to the queue.
+   *
+   * Exceptions thrown by the task are swallowed, the task is responsible to report its errors.
+   */
+  void Submit(task_t task);
+
+  /**
+   * @brief Removes all tasks which haven't started yet.
+   *
+   * @return The number of removed tasks.
+   */
+  std::size_t CancelPending();
+
+  /**
+   * @brief Returns the number of tasks which haven't started yet.
+   */
+  std::size_t GetPendingCount() const;
+
+  /**
+   * @brief Returns the number of tasks which are running now.
+   */
+  std::size_t GetRunningCount() const;
+
+  /**
+   * @brief Waits till there are no pending and running tasks.
+   */
+  void WaitForIdle() const;
+
+private:
+  void RunWorker();
+
+  std::size_t m_max_thread_count{0};
+  mutable std::mutex m_mutex;
+  mutable std::condition_variable m_task_condition;  //!< notifies workers about new tasks
+  mutable std::condition_variable m_idle_condition;  //!< notifies waiters about completed tasks
+  std::deque<task_t> m_tasks;
+  std::size_t m_running_count{0};
+  std::size_t m_idle_thread_count{0};
+  bool m_is_stopping{false};
+  std::vector<std::thread> m_threads;
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_BACKGROUND_EXECUTOR_H_
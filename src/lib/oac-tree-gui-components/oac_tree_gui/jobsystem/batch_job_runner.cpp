@@ -0,0 +1,251 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "batch_job_runner.h"
+
+#include "domain_event_dispatcher_context.h"
+#include "local_domain_runner.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/model/procedure_item.h>
+#include <oac_tree_gui/model/xml_utils.h>
+#include <oac_tree_gui/transform/domain_procedure_builder.h>
+#include <oac_tree_gui/transform/transform_from_domain.h>
+
+#include <sup/oac-tree/job_states.h>
+#include <sup/oac-tree/procedure.h>
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <thread>
+
+namespace oac_tree_gui
+{
+
+namespace
+{
+
+//! Longest wait for domain events, a safety net in case of a missed notification.
+const std::chrono::milliseconds kMaxEventWaitTime(1000);
+
+std::int64_t GetMillisecondsSinceEpoch()
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+double ToMilliseconds(std::chrono::microseconds duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+std::size_t GetProcessedEventCount(const DomainEventStatistics& statistics)
+{
+  std::size_t result{0};
+  for (const auto& event_type : statistics.event_types)
+  {
+    result += event_type.event_count;
+  }
+  return result;
+}
+
+QJsonObject ToJson(const LogEvent& log_event)
+{
+  QJsonObject result;
+  result["timestamp"] = static_cast<qint64>(log_event.timestamp);
+  result["severity"] = QString::fromStdString(ToString(log_event.severity));
+  result["source"] = QString::fromStdString(log_event.source);
+  result["message"] = QString::fromStdString(log_event.message);
+  return result;
+}
+
+}  // namespace
+
+BatchJobRunner::BatchJobRunner(const BatchJobOptions& options, result_callback_t result_callback)
+    : m_options(options), m_result_callback(std::move(result_callback))
+{
+  if (m_options.worker_count == 0)
+  {
+    throw RuntimeException("Number of workers should be positive");
+  }
+}
+
+std::vector<BatchJobResult> BatchJobRunner::Run(const std::vector<std::string>& file_names)
+{
+  std::vector<BatchJobResult> result(file_names.size());
+  std::atomic<std::size_t> next_job_index{0};
+  std::mutex result_mutex;
+
+  auto worker = [&]()
+  {
+    for (auto job_index = next_job_index++; job_index < file_names.size();
+         job_index = next_job_index++)
+    {
+      auto job_result = RunJob(job_index, file_names[job_index]);
+
+      const std::lock_guard<std::mutex> lock(result_mutex);
+      if (m_result_callback)
+      {
+        m_result_callback(job_result);
+      }
+      result[job_index] = std::move(job_result);
+    }
+  };
+
+  const auto worker_count = std::min(m_options.worker_count, file_names.size());
+  std::vector<std::thread> workers;
+  workers.reserve(worker_count);
+  for (std::size_t index = 0; index < worker_count; ++index)
+  {
+    workers.emplace_back(worker);
+  }
+
+  for (auto& thread : workers)
+  {
+    thread.join();
+  }
+
+  return result;
+}
+
+BatchJobResult BatchJobRunner::RunJob(std::size_t job_index, const std::string& file_name) const
+{
+  BatchJobResult result;
+  result.job_index = job_index;
+  result.file_name = file_name;
+  result.start_time = GetMillisecondsSinceEpoch();
+
+  // the final state is taken from the event, so all events before it are already processed
+  auto job_state = sup::oac_tree::JobState::kInitial;
+  std::deque<LogEvent> logs;
+
+  DomainEventDispatcherContext dispatcher_context;
+  dispatcher_context.process_job_state_changed = [&job_state](const JobStateChangedEvent& event)
+  { job_state = event.state; };
+  dispatcher_context.process_log_event = [this, &logs, &result](const LogEvent& event)
+  {
+    logs.push_back(event);
+    if (m_options.max_log_count > 0 && logs.size() > m_options.max_log_count)
+    {
+      logs.pop_front();
+      ++result.dropped_log_count;
+    }
+  };
+
+  // import, transformation and domain setup errors are reported as submission failure
+  const auto setup_start = std::chrono::steady_clock::now();
+  std::unique_ptr<LocalDomainRunner> runner;
+  try
+  {
+    auto procedure_item = ImportFromFile(file_name);
+    runner = std::make_unique<LocalDomainRunner>(dispatcher_context, m_options.user_context,
+                                                 CreateDomainProcedure(*procedure_item));
+  }
+  catch (const std::exception& ex)
+  {
+    result.status = RunnerStatus::kSubmitFailure;
+    result.error = ex.what();
+    return result;
+  }
+  result.setup_time = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - setup_start);
+
+  // there is no event loop in the worker thread, the worker waits for events and processes them
+  runner->SetEventPacingEnabled(true);
+  runner->SetTickTimeout(m_options.tick_timeout);
+  runner->SetLogFloodOptions(m_options.log_flood_options);
+
+  const auto run_start = std::chrono::steady_clock::now();
+  (void)runner->Start();
+  while (!sup::oac_tree::IsFinishedJobState(job_state))
+  {
+    auto wait_time = kMaxEventWaitTime;
+    if (m_options.job_timeout.count() > 0 && !result.timed_out)
+    {
+      const auto elapsed = std::chrono::steady_clock::now() - run_start;
+      if (elapsed > m_options.job_timeout)
+      {
+        (void)runner->Stop();
+        result.timed_out = true;
+      }
+      else
+      {
+        wait_time = std::min(wait_time, std::chrono::ceil<std::chrono::milliseconds>(
+                                            m_options.job_timeout - elapsed));
+      }
+    }
+    (void)runner->WaitForEvents(wait_time);
+    runner->ProcessEvents();
+  }
+  result.run_time = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - run_start);
+
+  // picking up events reported right before the finished state
+  while (runner->GetEventCount() > 0)
+  {
+    runner->ProcessEvents();
+  }
+
+  result.status = GetRunnerStatusFromDomain(job_state);
+  result.event_count = GetProcessedEventCount(runner->GetEventStatistics());
+  result.logs.assign(std::make_move_iterator(logs.begin()), std::make_move_iterator(logs.end()));
+  return result;
+}
+
+std::string ToJsonLine(const BatchJobResult& result)
+{
+  QJsonObject json;
+  json["job"] = static_cast<qint64>(result.job_index);
+  json["file"] = QString::fromStdString(result.file_name);
+  json["status"] = QString::fromStdString(ToString(result.status));
+  if (!result.error.empty())
+  {
+    json["error"] = QString::fromStdString(result.error);
+  }
+  json["timed_out"] = result.timed_out;
+  json["start_time"] = static_cast<qint64>(result.start_time);
+  json["setup_ms"] = ToMilliseconds(result.setup_time);
+  json["run_ms"] = ToMilliseconds(result.run_time);
+  json["event_count"] = static_cast<qint64>(result.event_count);
+
+  QJsonArray logs;
+  for (const auto& log_event : result.logs)
+  {
+    logs.append(ToJson(log_event));
+  }
+  json["logs"] = logs;
+  json["dropped_log_count"] = static_cast<qint64>(result.dropped_log_count);
+
+  return QJsonDocument(json).toJson(QJsonDocument::Compact).toStdString();
+}
+
+bool IsSucceeded(const BatchJobResult& result)
+{
+  return result.status == RunnerStatus::kSucceeded;
+}
+
+}  // namespace oac_tree_gui
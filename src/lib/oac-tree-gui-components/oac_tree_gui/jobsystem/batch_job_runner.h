@@ -0,0 +1,117 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_BATCH_JOB_RUNNER_H_
+#define OAC_TREE_GUI_JOBSYSTEM_BATCH_JOB_RUNNER_H_
+
+#include <oac_tree_gui/jobsystem/log_event.h>
+#include <oac_tree_gui/jobsystem/log_flood_filter.h>
+#include <oac_tree_gui/jobsystem/user_context.h>
+#include <oac_tree_gui/model/runner_status.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+/**
+ * @brief The BatchJobOptions struct holds options to run procedures without the GUI.
+ */
+struct BatchJobOptions
+{
+  std::size_t worker_count{1};                //!< number of jobs running concurrently
+  std::chrono::microseconds tick_timeout{0};  //!< target interval between ticks, 0 for full speed
+  std::chrono::milliseconds job_timeout{0};   //!< job is halted after this time, 0 means no limit
+  LogFloodOptions log_flood_options;          //!< suppression of excessive logging
+  std::size_t max_log_count{1000};  //!< most recent log messages kept per job, 0 means no limit
+  UserContext user_context;  //!< answers to user input and choice requests, none by default
+};
+
+/**
+ * @brief The BatchJobResult struct holds the outcome of a single procedure run in batch mode.
+ */
+struct BatchJobResult
+{
+  std::size_t job_index{0};  //!< index of the job in the list of submitted files
+  std::string file_name;     //!< procedure file
+  RunnerStatus status{RunnerStatus::kUndefined};  //!< final status, kSubmitFailure on error
+  std::string error;      //!< import or setup error, the job didn't run if not empty
+  bool timed_out{false};  //!< the job was halted because of the job timeout
+
+  std::int64_t start_time{0};               //!< start of the job, msec since epoch
+  std::chrono::microseconds setup_time{0};  //!< time to import and build the domain procedure
+  std::chrono::microseconds run_time{0};    //!< time from start till the finished state
+  std::size_t event_count{0};               //!< number of domain events processed
+  std::vector<LogEvent> logs;               //!< most recent log messages reported by the job
+  std::size_t dropped_log_count{0};         //!< older log messages beyond the limit, not kept
+};
+
+/**
+ * @brief The BatchJobRunner class executes procedure files on a pool of worker threads without
+ * the GUI.
+ *
+ * Every worker takes the next file from the list, imports it with ImportFromFile, creates the
+ * domain procedure, and runs it with LocalDomainRunner. Domain events are processed in paced
+ * mode by the worker itself, so no Qt event loop is required. The result of every job is reported
+ * to the callback as soon as the job finishes. Calls to the callback are serialized.
+ *
+ * Jobs asking for user input or user choice don't get an answer, and normally fail, unless the
+ * user context is given in options. The context should answer on the calling thread, e.g. the one
+ * created by CreateScriptedUserContext.
+ */
+class BatchJobRunner
+{
+public:
+  using result_callback_t = std::function<void(const BatchJobResult&)>;
+
+  explicit BatchJobRunner(const BatchJobOptions& options, result_callback_t result_callback = {});
+
+  /**
+   * @brief Runs all given procedure files and returns when all of them have finished.
+   *
+   * @return Results in the order of files.
+   */
+  std::vector<BatchJobResult> Run(const std::vector<std::string>& file_names);
+
+private:
+  BatchJobResult RunJob(std::size_t job_index, const std::string& file_name) const;
+
+  BatchJobOptions m_options;
+  result_callback_t m_result_callback;
+};
+
+/**
+ * @brief Returns compact JSON representation of the result, to be written as a single line.
+ */
+std::string ToJsonLine(const BatchJobResult& result);
+
+/**
+ * @brief Checks if the job has run and succeeded.
+ */
+bool IsSucceeded(const BatchJobResult& result);
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_BATCH_JOB_RUNNER_H_
@@ -0,0 +1,165 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "domain_event_conflator.h"
+
+#include <algorithm>
+
+namespace oac_tree_gui
+{
+
+namespace
+{
+
+/**
+ * @brief Checks if the event prevents conflation of updates reported before and after it.
+ */
+bool IsConflationBarrier(const domain_event_t& event)
+{
+  return std::holds_alternative<JobStateChangedEvent>(event)
+         || std::holds_alternative<BreakpointHitEvent>(event);
+}
+
+}  // namespace
+
+std::vector<domain_event_t> DomainEventConflator::Conflate(std::vector<domain_event_t> events)
+{
+  for (auto& event : events)
+  {
+    PushEvent(std::move(event));
+  }
+  return TakeEvents();
+}
+
+void DomainEventConflator::PushEvent(domain_event_t event)
+{
+  if (!IsValid(event))
+  {
+    return;
+  }
+
+  const std::size_t position = m_events.size();
+
+  if (const auto* instruction_event = std::get_if<InstructionStateUpdatedEvent>(&event);
+      instruction_event)
+  {
+    if (ReplacePreviousUpdate(m_instruction_positions, instruction_event->index, position))
+    {
+      ++m_conflated_instruction_state_count;
+    }
+  }
+  else if (const auto* variable_event = std::get_if<VariableUpdatedEvent>(&event); variable_event)
+  {
+    if (ReplacePreviousUpdate(m_variable_positions, variable_event->index, position))
+    {
+      ++m_conflated_variable_count;
+    }
+  }
+  else if (IsConflationBarrier(event))
+  {
+    m_instruction_positions.clear();
+    m_variable_positions.clear();
+  }
+
+  m_events.push_back(std::move(event));
+
+  // removed events are kept as empty placeholders, prevent the window from growing without limit
+  if (m_removed_count > m_events.size() / 2)
+  {
+    Compact();
+  }
+}
+
+std::vector<domain_event_t> DomainEventConflator::TakeEvents()
+{
+  Compact();
+  m_instruction_positions.clear();
+  m_variable_positions.clear();
+
+  std::vector<domain_event_t> result;
+  std::swap(result, m_events);
+  return result;
+}
+
+std::size_t DomainEventConflator::GetEventCount() const
+{
+  return m_events.size() - m_removed_count;
+}
+
+std::size_t DomainEventConflator::GetConflatedInstructionStateCount() const
+{
+  return m_conflated_instruction_state_count;
+}
+
+std::size_t DomainEventConflator::GetConflatedVariableCount() const
+{
+  return m_conflated_variable_count;
+}
+
+void DomainEventConflator::Compact()
+{
+  if (m_removed_count == 0)
+  {
+    return;
+  }
+
+  auto is_removed = [](const domain_event_t& event) { return !IsValid(event); };
+  m_events.erase(std::remove_if(m_events.begin(), m_events.end(), is_removed), m_events.end());
+  m_removed_count = 0;
+
+  m_instruction_positions.clear();
+  m_variable_positions.clear();
+  for (std::size_t position = 0; position < m_events.size(); ++position)
+  {
+    const auto& event = m_events[position];
+    if (const auto* instruction_event = std::get_if<InstructionStateUpdatedEvent>(&event);
+        instruction_event)
+    {
+      m_instruction_positions[instruction_event->index] = position;
+    }
+    else if (const auto* variable_event = std::get_if<VariableUpdatedEvent>(&event);
+             variable_event)
+    {
+      m_variable_positions[variable_event->index] = position;
+    }
+    else if (IsConflationBarrier(event))
+    {
+      m_instruction_positions.clear();
+      m_variable_positions.clear();
+    }
+  }
+}
+
+bool DomainEventConflator::ReplacePreviousUpdate(position_map_t& positions,
+                                                 std::size_t domain_index, std::size_t position)
+{
+  auto [iter, is_inserted] = positions.try_emplace(domain_index, position);
+  if (is_inserted)
+  {
+    return false;
+  }
+
+  m_events[iter->second] = std::monostate{};
+  ++m_removed_count;
+  iter->second = position;
+  return true;
+}
+
+}  // namespace oac_tree_gui
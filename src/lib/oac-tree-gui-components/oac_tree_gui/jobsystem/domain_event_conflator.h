@@ -0,0 +1,109 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_DOMAIN_EVENT_CONFLATOR_H_
+#define OAC_TREE_GUI_JOBSYSTEM_DOMAIN_EVENT_CONFLATOR_H_
+
+#include <oac_tree_gui/jobsystem/domain_events.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+/**
+ * @brief The DomainEventConflator class removes domain events superseded by later events of the
+ * same kind within a window of events.
+ *
+ * Only the latest InstructionStateUpdatedEvent per instruction index, and the latest
+ * VariableUpdatedEvent per variable index are kept. JobStateChangedEvent and BreakpointHitEvent
+ * act as barriers: updates are never conflated across them, so the GUI observes the same
+ * instruction/variable state at the moment of job state change, or breakpoint hit, as it would
+ * without conflation. All other events are passed as they are. The relative order of remaining
+ * events is preserved.
+ *
+ * Events can be conflated either as a whole window at once (Conflate), or incrementally
+ * (PushEvent/TakeEvents).
+ */
+class DomainEventConflator
+{
+public:
+  /**
+   * @brief Conflates the given window of events.
+   *
+   * @param events Events in the order they have been reported by the domain.
+   * @return Events with superseded updates removed.
+   */
+  std::vector<domain_event_t> Conflate(std::vector<domain_event_t> events);
+
+  /**
+   * @brief Adds event to the current window, removing the update it supersedes, if any.
+   */
+  void PushEvent(domain_event_t event);
+
+  /**
+   * @brief Takes all events accumulated in the current window, and starts a new window.
+   */
+  std::vector<domain_event_t> TakeEvents();
+
+  /**
+   * @brief Returns number of events in the current window.
+   */
+  std::size_t GetEventCount() const;
+
+  /**
+   * @brief Returns number of InstructionStateUpdatedEvent dropped since the beginning.
+   */
+  std::size_t GetConflatedInstructionStateCount() const;
+
+  /**
+   * @brief Returns number of VariableUpdatedEvent dropped since the beginning.
+   */
+  std::size_t GetConflatedVariableCount() const;
+
+private:
+  using position_map_t = std::unordered_map<std::size_t, std::size_t>;
+
+  /**
+   * @brief Removes superseded events from the window and rebuilds position maps.
+   */
+  void Compact();
+
+  /**
+   * @brief Registers the update at the given position in the window and removes the superseded
+   * one.
+   *
+   * @return True if the superseded update has been removed.
+   */
+  bool ReplacePreviousUpdate(position_map_t& positions, std::size_t domain_index,
+                             std::size_t position);
+
+  std::vector<domain_event_t> m_events;    //!< current window, including removed events
+  std::size_t m_removed_count{0};          //!< number of removed events in the window
+  position_map_t m_instruction_positions;  //!< instruction index to position in the window
+  position_map_t m_variable_positions;     //!< variable index to position in the window
+  std::size_t m_conflated_instruction_state_count{0};
+  std::size_t m_conflated_variable_count{0};
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_DOMAIN_EVENT_CONFLATOR_H_
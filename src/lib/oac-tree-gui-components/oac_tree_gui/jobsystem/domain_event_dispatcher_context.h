@@ -24,6 +24,7 @@
 #include <oac_tree_gui/jobsystem/domain_events.h>
 
 #include <functional>
+#include <vector>
 
 namespace oac_tree_gui
 {
@@ -50,6 +51,12 @@ struct DomainEventDispatcherContext
 
   //! a callback to process breakpoint hit event
   std::function<void(const BreakpointHitEvent&)> breakpoint_hit_updated;
+
+  //! a callback to report that all events of the current batch have been processed
+  std::function<void()> batch_processed;
+
+  //! a callback to observe every window of events taken from the queue, before the conflation
+  std::function<void(const std::vector<domain_event_t>&)> events_fetched;
 };
 
 }  // namespace sequencergui
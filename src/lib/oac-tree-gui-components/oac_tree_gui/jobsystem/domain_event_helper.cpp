@@ -29,6 +29,7 @@
 #include <sup/oac-tree/instruction_info_utils.h>
 
 #include <sstream>
+#include <type_traits>
 
 namespace oac_tree_gui
 {
@@ -51,7 +52,8 @@ std::string DomainEventToStringVisitor::operator()(const InstructionStateUpdated
 std::string DomainEventToStringVisitor::operator()(const VariableUpdatedEvent& event) const
 {
   std::ostringstream ostr;
-  ostr << std::string("VariableUpdatedEvent") << " " << ::sup::dto::PrintAnyValue(event.value);
+  ostr << std::string("VariableUpdatedEvent") << " "
+       << ::sup::dto::PrintAnyValue(event.value.Get());
   ostr << " connected:" << event.connected;
   return ostr.str();
 }
@@ -72,6 +74,21 @@ std::string DomainEventToStringVisitor::operator()(const JobStateChangedEvent& e
 std::string DomainEventToStringVisitor::operator()(const ActiveInstructionChangedEvent& event) const
 {
   std::ostringstream ostr;
+  if (event.is_delta)
+  {
+    ostr << std::string("ActiveInstructionChanged") << " added:";
+    for (auto instr_index : event.added)
+    {
+      ostr << instr_index << " ";
+    }
+    ostr << "removed:";
+    for (auto instr_index : event.removed)
+    {
+      ostr << instr_index << " ";
+    }
+    return ostr.str();
+  }
+
   ostr << std::string("ActiveInstructionChanged") << " size: " << event.instr_idx.size()
        << " indx:";
   for (auto instr_index : event.instr_idx)
@@ -88,6 +105,46 @@ std::string DomainEventToStringVisitor::operator()(const BreakpointHitEvent& eve
   return ostr.str();
 }
 
+void SetPostTime(domain_event_t& event, std::chrono::steady_clock::time_point post_time)
+{
+  auto on_event = [post_time](auto& concrete_event)
+  {
+    using event_type = std::decay_t<decltype(concrete_event)>;
+    if constexpr (!std::is_same_v<event_type, std::monostate>)
+    {
+      concrete_event.post_time = post_time;
+    }
+  };
+  std::visit(on_event, event);
+}
+
+std::chrono::steady_clock::time_point GetPostTime(const domain_event_t& event)
+{
+  auto on_event = [](const auto& concrete_event)
+  {
+    using event_type = std::decay_t<decltype(concrete_event)>;
+    if constexpr (std::is_same_v<event_type, std::monostate>)
+    {
+      return std::chrono::steady_clock::time_point{};
+    }
+    else
+    {
+      return concrete_event.post_time;
+    }
+  };
+  return std::visit(on_event, event);
+}
+
+std::string GetEventTypeName(std::size_t type_index)
+{
+  static const std::vector<std::string> kEventTypeNames = {
+      "Empty", "InstructionState", "Variable", "JobState", "Log", "ActiveInstruction",
+      "BreakpointHit"};
+  static_assert(std::variant_size_v<domain_event_t> == 7, "Update the list of event type names");
+
+  return type_index < kEventTypeNames.size() ? kEventTypeNames[type_index] : std::string("Unknown");
+}
+
 active_filter_t CreateInstructionAncestorFilter(const sup::oac_tree::InstructionInfo& info)
 {
   auto parent_indices = sup::oac_tree::utils::GetParentIndices(info);
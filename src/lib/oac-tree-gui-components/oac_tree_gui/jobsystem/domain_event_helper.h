@@ -51,6 +51,23 @@ struct DomainEventToStringVisitor
   std::string operator()(const ::oac_tree_gui::BreakpointHitEvent& event) const;
 };
 
+/**
+ * @brief Sets the moment of posting to the given event. Empty event is left untouched.
+ */
+void SetPostTime(domain_event_t& event, std::chrono::steady_clock::time_point post_time);
+
+/**
+ * @brief Returns the moment of posting of the given event.
+ *
+ * Empty event, or event which has never been posted, has a default-constructed time point.
+ */
+std::chrono::steady_clock::time_point GetPostTime(const domain_event_t& event);
+
+/**
+ * @brief Returns human readable name of the event type with the given index in domain_event_t.
+ */
+std::string GetEventTypeName(std::size_t type_index);
+
 /**
  * @brief Creates a filter to removes active instructions if not all of their ancestors are
  * active too.
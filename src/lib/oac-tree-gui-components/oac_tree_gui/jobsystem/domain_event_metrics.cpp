@@ -0,0 +1,162 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "domain_event_metrics.h"
+
+#include "domain_event_helper.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+
+#include <algorithm>
+
+namespace oac_tree_gui
+{
+
+namespace
+{
+
+/**
+ * @brief Duration of the window to calculate event rates.
+ */
+const std::chrono::seconds kRateWindow{1};
+
+/**
+ * @brief Returns the value below which the given fraction of sorted samples fall.
+ */
+std::chrono::microseconds GetPercentile(const std::vector<std::chrono::nanoseconds>& sorted_samples,
+                                        double fraction)
+{
+  if (sorted_samples.empty())
+  {
+    return std::chrono::microseconds(0);
+  }
+  const auto last_index = static_cast<double>(sorted_samples.size() - 1);
+  const auto index = static_cast<std::size_t>(fraction * last_index);
+  return std::chrono::duration_cast<std::chrono::microseconds>(sorted_samples[index]);
+}
+
+/**
+ * @brief Returns number of events per second.
+ */
+double GetRate(std::size_t event_count, std::chrono::steady_clock::duration elapsed)
+{
+  const double seconds = std::chrono::duration<double>(elapsed).count();
+  return seconds > 0.0 ? static_cast<double>(event_count) / seconds : 0.0;
+}
+
+}  // namespace
+
+DomainEventMetrics::DomainEventMetrics(std::size_t latency_sample_count)
+    : m_window_start(std::chrono::steady_clock::now()), m_max_sample_count(latency_sample_count)
+{
+  if (latency_sample_count == 0)
+  {
+    throw RuntimeException("Number of latency samples should be positive");
+  }
+  m_latency_samples.reserve(latency_sample_count);
+}
+
+void DomainEventMetrics::RecordEvent(const domain_event_t& event, time_point_t apply_start,
+                                     time_point_t apply_end)
+{
+  UpdateRateWindow(apply_end);
+
+  auto& metrics = m_type_metrics[event.index()];
+  ++metrics.event_count;
+  ++metrics.window_event_count;
+  const auto handler_time = apply_end - apply_start;
+  metrics.handler_time += handler_time;
+  metrics.max_handler_time = std::max(
+      metrics.max_handler_time, std::chrono::duration_cast<std::chrono::nanoseconds>(handler_time));
+
+  // events created outside of DomainJobObserver are not timestamped
+  const auto post_time = GetPostTime(event);
+  if (post_time == time_point_t{})
+  {
+    return;
+  }
+
+  const auto latency =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(apply_start - post_time);
+  if (m_latency_samples.size() < m_max_sample_count)
+  {
+    m_latency_samples.push_back(latency);
+  }
+  else
+  {
+    m_latency_samples[m_next_sample_index] = latency;
+    m_next_sample_index = (m_next_sample_index + 1) % m_latency_samples.size();
+  }
+}
+
+DomainEventStatistics DomainEventMetrics::GetStatistics(time_point_t now) const
+{
+  DomainEventStatistics result;
+
+  auto sorted_samples = m_latency_samples;
+  std::sort(sorted_samples.begin(), sorted_samples.end());
+  result.latency_sample_count = sorted_samples.size();
+  result.latency_p50 = GetPercentile(sorted_samples, 0.5);
+  result.latency_p90 = GetPercentile(sorted_samples, 0.9);
+  result.latency_p99 = GetPercentile(sorted_samples, 0.99);
+  result.latency_max = GetPercentile(sorted_samples, 1.0);
+
+  // when no events have arrived for a while, the last completed window is outdated
+  const auto window_duration = now - m_window_start;
+  const bool is_window_outdated = window_duration >= kRateWindow;
+
+  // skipping std::monostate
+  for (std::size_t type_index = 1; type_index < kEventTypeCount; ++type_index)
+  {
+    const auto& metrics = m_type_metrics[type_index];
+
+    EventTypeStatistics statistics;
+    statistics.name = GetEventTypeName(type_index);
+    statistics.event_count = metrics.event_count;
+    statistics.event_rate = is_window_outdated
+                                ? GetRate(metrics.window_event_count, window_duration)
+                                : metrics.event_rate;
+    statistics.handler_time =
+        std::chrono::duration_cast<std::chrono::microseconds>(metrics.handler_time);
+    statistics.max_handler_time =
+        std::chrono::duration_cast<std::chrono::microseconds>(metrics.max_handler_time);
+    result.event_types.push_back(statistics);
+  }
+
+  return result;
+}
+
+void DomainEventMetrics::UpdateRateWindow(time_point_t now)
+{
+  const auto window_duration = now - m_window_start;
+  if (window_duration < kRateWindow)
+  {
+    return;
+  }
+
+  for (auto& metrics : m_type_metrics)
+  {
+    metrics.event_rate = GetRate(metrics.window_event_count, window_duration);
+    metrics.window_event_count = 0;
+  }
+  m_window_start = now;
+}
+
+}  // namespace oac_tree_gui
@@ -0,0 +1,96 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_DOMAIN_EVENT_METRICS_H_
+#define OAC_TREE_GUI_JOBSYSTEM_DOMAIN_EVENT_METRICS_H_
+
+#include <oac_tree_gui/jobsystem/domain_event_statistics.h>
+#include <oac_tree_gui/jobsystem/domain_events.h>
+
+#include <array>
+#include <chrono>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+/**
+ * @brief The DomainEventMetrics class accumulates statistics of domain events applied to the GUI.
+ *
+ * It keeps the number of events and the time spent in handlers per event type, the rate of events
+ * over the last second, and a bounded set of recent push-to-apply latencies. It is intended to be
+ * used from the GUI thread only.
+ */
+class DomainEventMetrics
+{
+public:
+  using time_point_t = std::chrono::steady_clock::time_point;
+
+  /**
+   * @brief Main c-tor.
+   *
+   * @param latency_sample_count Number of recent events used to calculate latency percentiles.
+   */
+  explicit DomainEventMetrics(std::size_t latency_sample_count = 1024);
+
+  /**
+   * @brief Records event which has been applied to the GUI.
+   *
+   * @param event The event, its post time is used to calculate latency.
+   * @param apply_start The moment the handler has been called.
+   * @param apply_end The moment the handler has returned.
+   */
+  void RecordEvent(const domain_event_t& event, time_point_t apply_start, time_point_t apply_end);
+
+  /**
+   * @brief Returns statistics accumulated so far.
+   *
+   * Queue related fields are left zero, they are filled by the owner of the queue.
+   */
+  DomainEventStatistics GetStatistics(time_point_t now = std::chrono::steady_clock::now()) const;
+
+private:
+  static constexpr std::size_t kEventTypeCount = std::variant_size_v<domain_event_t>;
+
+  struct TypeMetrics
+  {
+    std::size_t event_count{0};
+    std::size_t window_event_count{0};  //!< number of events in the current rate window
+    double event_rate{0.0};             //!< rate over the last completed window
+    std::chrono::nanoseconds handler_time{0};
+    std::chrono::nanoseconds max_handler_time{0};
+  };
+
+  /**
+   * @brief Completes the current rate window, if it is older than one second.
+   */
+  void UpdateRateWindow(time_point_t now);
+
+  std::array<TypeMetrics, kEventTypeCount> m_type_metrics;
+  time_point_t m_window_start;
+
+  std::size_t m_max_sample_count{0};
+  std::vector<std::chrono::nanoseconds> m_latency_samples;  //!< circular storage of latencies
+  std::size_t m_next_sample_index{0};
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_DOMAIN_EVENT_METRICS_H_
@@ -0,0 +1,72 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_DOMAIN_EVENT_QUEUE_OPTIONS_H_
+#define OAC_TREE_GUI_JOBSYSTEM_DOMAIN_EVENT_QUEUE_OPTIONS_H_
+
+//! @file
+//! Contains options to configure the transport of domain events from the sequencer to the GUI.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace oac_tree_gui
+{
+
+/**
+ * @brief The ProducerMode enum defines how many threads are allowed to push events in the queue.
+ */
+enum class ProducerMode : std::uint8_t
+{
+  kSingle = 0,  //!< only one thread is pushing events, no locks are used
+  kMultiple     //!< several threads are pushing, producers are serialized between each other
+};
+
+/**
+ * @brief The OverflowPolicy enum defines the behavior of the queue when its buffer is full.
+ *
+ * With kDropOldest, ActiveInstructionChangedEvent and JobStateChangedEvent are never dropped:
+ * active instruction deltas are only meaningful in sequence, and the job state is reported once.
+ * When the overflow area holds nothing else, the producer waits for the GUI as with kBlock.
+ */
+enum class OverflowPolicy : std::uint8_t
+{
+  kBlock = 0,   //!< producer waits until the GUI takes events from the buffer
+  kDropOldest,  //!< overflowing events are kept in a bounded area, where the oldest are dropped
+  kConflate     //!< overflowing instruction and variable updates are conflated per index
+};
+
+/**
+ * @brief The DomainEventQueueOptions struct holds options for DomainEventQueue.
+ *
+ * Several producers is the safe default. A local job posts from the sequencer thread, from
+ * threads of parallel instructions, and from variable update callbacks. Runners which post from a
+ * single thread only, like the replay of a recorded trace, should use ProducerMode::kSingle.
+ */
+struct DomainEventQueueOptions
+{
+  std::size_t capacity{4096};  //!< capacity of the ring buffer
+  ProducerMode producer_mode{ProducerMode::kMultiple};
+  OverflowPolicy overflow_policy{OverflowPolicy::kConflate};
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_DOMAIN_EVENT_QUEUE_OPTIONS_H_
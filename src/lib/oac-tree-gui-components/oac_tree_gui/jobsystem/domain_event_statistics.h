@@ -0,0 +1,91 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_DOMAIN_EVENT_STATISTICS_H_
+#define OAC_TREE_GUI_JOBSYSTEM_DOMAIN_EVENT_STATISTICS_H_
+
+//! @file
+//! Contains diagnostics of the pipeline delivering domain events of a single job to the GUI.
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+/**
+ * @brief The EventTypeStatistics struct holds processing statistics of one type of domain events.
+ */
+struct EventTypeStatistics
+{
+  std::string name;                               //!< name of the event type
+  std::size_t event_count{0};                     //!< number of events applied to the GUI
+  double event_rate{0.0};                         //!< number of events applied per second
+  std::chrono::microseconds handler_time{0};      //!< total time spent in the handler
+  std::chrono::microseconds max_handler_time{0};  //!< longest single call of the handler
+};
+
+/**
+ * @brief The TickStatistics struct holds pacing diagnostics of procedure ticks.
+ */
+struct TickStatistics
+{
+  std::size_t tick_count{0};       //!< number of ticks since the start of the job
+  std::size_t late_tick_count{0};  //!< ticks too late to catch up with the schedule
+  double tick_rate{0.0};           //!< measured number of ticks per second
+  double target_tick_rate{0.0};    //!< requested number of ticks per second, 0 for full speed
+};
+
+/**
+ * @brief The DomainEventStatistics struct holds diagnostics of domain events delivery from the
+ * sequencer to the GUI.
+ *
+ * Latency is measured from the moment the event was posted by DomainJobObserver, till the moment
+ * its handler has been called in the GUI thread. Percentiles are calculated over recent events.
+ */
+struct DomainEventStatistics
+{
+  std::size_t queue_depth{0};            //!< number of events waiting to be applied
+  std::size_t queue_high_water_mark{0};  //!< largest number of events ever waiting in the queue
+  std::size_t dropped_event_count{0};    //!< number of events dropped on queue overflow
+  std::size_t conflated_event_count{0};  //!< number of updates superseded by later ones
+
+  std::size_t log_below_threshold_count{0};   //!< log messages below the severity threshold
+  std::size_t log_rate_limited_count{0};      //!< log messages exceeding the rate limit
+  std::size_t log_folded_duplicate_count{0};  //!< log messages folded into repetition count
+
+  std::size_t duplicate_user_request_count{0};  //!< user requests rejected, same id was pending
+
+  std::size_t latency_sample_count{0};  //!< number of recent events used for percentiles
+  std::chrono::microseconds latency_p50{0};
+  std::chrono::microseconds latency_p90{0};
+  std::chrono::microseconds latency_p99{0};
+  std::chrono::microseconds latency_max{0};
+
+  std::vector<EventTypeStatistics> event_types;  //!< statistics per event type
+
+  TickStatistics ticks;  //!< pacing of procedure ticks in the sequencer thread
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_DOMAIN_EVENT_STATISTICS_H_
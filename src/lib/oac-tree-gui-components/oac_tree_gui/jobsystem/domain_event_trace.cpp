@@ -0,0 +1,344 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "domain_event_trace.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/domain_event_helper.h>
+
+#include <sup/gui/model/anyvalue_utils.h>
+
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace oac_tree_gui
+{
+
+namespace
+{
+
+//! Marker at the beginning of each trace file, contains format version.
+const std::uint32_t kTraceFileMarker = 0x54524301;
+
+/**
+ * @brief Returns the index of the event type in domain_event_t variant, used as a record tag.
+ */
+template <typename T, std::size_t index = 0>
+constexpr std::size_t GetEventTypeIndex()
+{
+  if constexpr (std::is_same_v<T, std::variant_alternative_t<index, domain_event_t>>)
+  {
+    return index;
+  }
+  else
+  {
+    return GetEventTypeIndex<T, index + 1>();
+  }
+}
+
+template <typename T>
+void WriteValue(std::ofstream& stream, T value)
+{
+  (void)stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void WriteString(std::ofstream& stream, std::string_view str)
+{
+  WriteValue(stream, static_cast<std::uint32_t>(str.size()));
+  (void)stream.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+void WriteIndices(std::ofstream& stream, const std::vector<sup::dto::uint32>& indices)
+{
+  WriteValue(stream, static_cast<std::uint32_t>(indices.size()));
+  for (auto index : indices)
+  {
+    WriteValue(stream, index);
+  }
+}
+
+template <typename T>
+T ReadValue(std::ifstream& stream)
+{
+  T result{};
+  (void)stream.read(reinterpret_cast<char*>(&result), sizeof(T));
+  return result;
+}
+
+std::string ReadString(std::ifstream& stream)
+{
+  const auto size = ReadValue<std::uint32_t>(stream);
+  std::string result(size, '\0');
+  (void)stream.read(result.data(), static_cast<std::streamsize>(size));
+  return result;
+}
+
+std::vector<sup::dto::uint32> ReadIndices(std::ifstream& stream)
+{
+  const auto size = ReadValue<std::uint32_t>(stream);
+  std::vector<sup::dto::uint32> result;
+  for (std::uint32_t index = 0; index < size && stream; ++index)
+  {
+    result.push_back(ReadValue<sup::dto::uint32>(stream));
+  }
+  return result;
+}
+
+/**
+ * @brief Returns type and value JSON strings of the given value, both are empty for empty value.
+ */
+std::pair<std::string, std::string> ToJSONStrings(const sup::dto::AnyValue& value)
+{
+  if (sup::dto::IsEmptyValue(value))
+  {
+    return {};
+  }
+  return {sup::gui::AnyTypeToJSONString(value), sup::gui::ValuesToJSONString(value)};
+}
+
+sup::dto::AnyValue FromJSONStrings(const std::string& type_str, const std::string& value_str)
+{
+  if (type_str.empty())
+  {
+    return {};
+  }
+  return sup::gui::AnyValueFromJSONString(sup::gui::AnyTypeFromJSONString(type_str), value_str);
+}
+
+/**
+ * @brief Reads the event of the given type from the stream.
+ *
+ * @param variable_types The last type of each variable, updated when the record carries the type.
+ */
+domain_event_t ReadEvent(std::ifstream& stream, std::size_t type_index,
+                         std::map<std::size_t, std::string>& variable_types)
+{
+  switch (type_index)
+  {
+  case GetEventTypeIndex<InstructionStateUpdatedEvent>():
+  {
+    InstructionStateUpdatedEvent event;
+    event.index = ReadValue<sup::dto::uint32>(stream);
+    event.state.m_breakpoint_set = ReadValue<std::uint8_t>(stream) != 0;
+    event.state.m_execution_status =
+        static_cast<sup::oac_tree::ExecutionStatus>(ReadValue<std::uint8_t>(stream));
+    return event;
+  }
+  case GetEventTypeIndex<VariableUpdatedEvent>():
+  {
+    VariableUpdatedEvent event;
+    event.index = ReadValue<sup::dto::uint32>(stream);
+    event.connected = ReadValue<std::uint8_t>(stream) != 0;
+    if (ReadValue<std::uint8_t>(stream) != 0)
+    {
+      variable_types[event.index] = ReadString(stream);
+    }
+    const auto value_str = ReadString(stream);
+    event.value = FromJSONStrings(variable_types[event.index], value_str);
+    return event;
+  }
+  case GetEventTypeIndex<JobStateChangedEvent>():
+  {
+    const auto state = static_cast<sup::oac_tree::JobState>(ReadValue<std::uint8_t>(stream));
+    return JobStateChangedEvent{state};
+  }
+  case GetEventTypeIndex<LogEvent>():
+  {
+    LogEvent event;
+    event.timestamp = ReadValue<std::int64_t>(stream);
+    event.severity = static_cast<Severity>(ReadValue<std::uint8_t>(stream));
+    event.source = ReadString(stream);
+    event.message = ReadString(stream);
+    event.date = ReadString(stream);
+    event.time = ReadString(stream);
+    return event;
+  }
+  case GetEventTypeIndex<ActiveInstructionChangedEvent>():
+  {
+    ActiveInstructionChangedEvent event;
+    event.is_delta = ReadValue<std::uint8_t>(stream) != 0;
+    event.instr_idx = ReadIndices(stream);
+    event.added = ReadIndices(stream);
+    event.removed = ReadIndices(stream);
+    return event;
+  }
+  case GetEventTypeIndex<BreakpointHitEvent>():
+    return BreakpointHitEvent{ReadValue<sup::dto::uint32>(stream)};
+  default:
+    throw RuntimeException("Unknown domain event type [" + std::to_string(type_index) + "]");
+  }
+}
+
+}  // namespace
+
+DomainEventTraceWriter::DomainEventTraceWriter(const std::string& file_name,
+                                               const sup::dto::AnyValue& job_info)
+    : m_stream(file_name, std::ios::binary | std::ios::trunc)
+{
+  if (!m_stream)
+  {
+    throw RuntimeException("Can't open trace file [" + file_name + "] for writing");
+  }
+
+  WriteValue(m_stream, kTraceFileMarker);
+  const auto [type_str, value_str] = ToJSONStrings(job_info);
+  WriteString(m_stream, type_str);
+  WriteString(m_stream, value_str);
+}
+
+void DomainEventTraceWriter::Record(const domain_event_t& event)
+{
+  if (!IsValid(event))
+  {
+    return;
+  }
+
+  auto post_time = GetPostTime(event);
+  if (post_time == std::chrono::steady_clock::time_point{})
+  {
+    post_time = std::chrono::steady_clock::now();
+  }
+
+  const std::scoped_lock lock{m_mutex};
+  if (!m_stream)
+  {
+    return;  // recording has stopped on the write error
+  }
+
+  if (m_record_count == 0)
+  {
+    m_start_time = post_time;
+  }
+
+  const auto time_offset =
+      std::chrono::duration_cast<std::chrono::microseconds>(post_time - m_start_time);
+  WriteValue(m_stream, static_cast<std::int64_t>(time_offset.count()));
+  WriteValue(m_stream, static_cast<std::uint8_t>(event.index()));
+
+  if (const auto* instruction_event = std::get_if<InstructionStateUpdatedEvent>(&event))
+  {
+    WriteValue(m_stream, static_cast<sup::dto::uint32>(instruction_event->index));
+    WriteValue(m_stream, static_cast<std::uint8_t>(instruction_event->state.m_breakpoint_set));
+    WriteValue(m_stream,
+               static_cast<std::uint8_t>(instruction_event->state.m_execution_status));
+  }
+  else if (const auto* variable_event = std::get_if<VariableUpdatedEvent>(&event))
+  {
+    WriteVariableUpdated(*variable_event);
+  }
+  else if (const auto* state_event = std::get_if<JobStateChangedEvent>(&event))
+  {
+    WriteValue(m_stream, static_cast<std::uint8_t>(state_event->state));
+  }
+  else if (const auto* log_event = std::get_if<LogEvent>(&event))
+  {
+    WriteValue(m_stream, log_event->timestamp);
+    WriteValue(m_stream, static_cast<std::uint8_t>(log_event->severity));
+    WriteString(m_stream, log_event->source);
+    WriteString(m_stream, log_event->message);
+    WriteString(m_stream, log_event->date);
+    WriteString(m_stream, log_event->time);
+  }
+  else if (const auto* active_event = std::get_if<ActiveInstructionChangedEvent>(&event))
+  {
+    WriteValue(m_stream, static_cast<std::uint8_t>(active_event->is_delta));
+    WriteIndices(m_stream, active_event->instr_idx);
+    WriteIndices(m_stream, active_event->added);
+    WriteIndices(m_stream, active_event->removed);
+  }
+  else if (const auto* breakpoint_event = std::get_if<BreakpointHitEvent>(&event))
+  {
+    WriteValue(m_stream, static_cast<sup::dto::uint32>(breakpoint_event->index));
+  }
+
+  if (m_stream)
+  {
+    ++m_record_count;
+  }
+}
+
+std::size_t DomainEventTraceWriter::GetRecordCount() const
+{
+  const std::scoped_lock lock{m_mutex};
+  return m_record_count;
+}
+
+void DomainEventTraceWriter::Flush()
+{
+  const std::scoped_lock lock{m_mutex};
+  (void)m_stream.flush();
+}
+
+void DomainEventTraceWriter::WriteVariableUpdated(const VariableUpdatedEvent& event)
+{
+  const auto [type_str, value_str] = ToJSONStrings(event.value.Get());
+
+  WriteValue(m_stream, static_cast<sup::dto::uint32>(event.index));
+  WriteValue(m_stream, static_cast<std::uint8_t>(event.connected));
+
+  auto& last_type = m_variable_types[event.index];
+  const bool type_changed = last_type != type_str;
+  WriteValue(m_stream, static_cast<std::uint8_t>(type_changed));
+  if (type_changed)
+  {
+    WriteString(m_stream, type_str);
+    last_type = type_str;
+  }
+  WriteString(m_stream, value_str);
+}
+
+DomainEventTrace ReadDomainEventTrace(const std::string& file_name)
+{
+  std::ifstream stream(file_name, std::ios::binary);
+  if (!stream)
+  {
+    throw RuntimeException("Can't open trace file [" + file_name + "] for reading");
+  }
+
+  if (ReadValue<std::uint32_t>(stream) != kTraceFileMarker)
+  {
+    throw RuntimeException("Unexpected format of trace file [" + file_name + "]");
+  }
+
+  DomainEventTrace result;
+  const auto type_str = ReadString(stream);
+  const auto value_str = ReadString(stream);
+  result.job_info = FromJSONStrings(type_str, value_str);
+
+  std::map<std::size_t, std::string> variable_types;
+  while (stream && stream.peek() != std::ifstream::traits_type::eof())
+  {
+    DomainEventTraceRecord record;
+    record.time_offset = std::chrono::microseconds(ReadValue<std::int64_t>(stream));
+    const auto type_index = ReadValue<std::uint8_t>(stream);
+    record.event = ReadEvent(stream, type_index, variable_types);
+    result.records.push_back(std::move(record));
+  }
+
+  if (!stream)
+  {
+    throw RuntimeException("Error while reading trace file [" + file_name + "]");
+  }
+
+  return result;
+}
+
+}  // namespace oac_tree_gui
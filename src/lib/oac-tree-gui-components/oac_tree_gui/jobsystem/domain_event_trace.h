@@ -0,0 +1,126 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_DOMAIN_EVENT_TRACE_H_
+#define OAC_TREE_GUI_JOBSYSTEM_DOMAIN_EVENT_TRACE_H_
+
+//! @file
+//! Classes to record domain events of a job into a binary trace file and to read them back.
+
+#include <oac_tree_gui/jobsystem/domain_events.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+/**
+ * @brief The DomainEventTraceRecord struct holds a single domain event of the trace.
+ */
+struct DomainEventTraceRecord
+{
+  std::chrono::microseconds time_offset{0};  //!< moment of posting relative to the first event
+  domain_event_t event;
+};
+
+/**
+ * @brief The DomainEventTrace struct holds the content of a trace file.
+ */
+struct DomainEventTrace
+{
+  //!< job info of the recorded job, as given by sup::oac_tree::utils::ToAnyValue
+  sup::dto::AnyValue job_info;
+
+  //!< domain events in the order of posting
+  std::vector<DomainEventTraceRecord> records;
+};
+
+/**
+ * @brief The DomainEventTraceWriter class records domain events of a job into a binary trace file.
+ *
+ * The file starts with the job info, followed by one record per event. Every record carries the
+ * moment of posting of the event relative to the first recorded event. The type of a variable is
+ * stored only when it differs from the type of the previous value of the same variable.
+ *
+ * Events are written as they come, the class is thread-safe.
+ */
+class DomainEventTraceWriter
+{
+public:
+  /**
+   * @brief Main c-tor.
+   *
+   * Existing file will be overwritten. Throws RuntimeException if the file can't be opened.
+   *
+   * @param file_name The name of the trace file.
+   * @param job_info Job info in AnyValue form.
+   */
+  DomainEventTraceWriter(const std::string& file_name, const sup::dto::AnyValue& job_info);
+
+  /**
+   * @brief Appends event to the trace.
+   *
+   * The moment of posting is taken from the event itself, events without the timestamp are
+   * recorded at the current moment. The method doesn't throw, since it is called from the
+   * sequencer thread. After a write error all following events are ignored.
+   */
+  void Record(const domain_event_t& event);
+
+  /**
+   * @brief Returns number of events successfully recorded so far.
+   */
+  std::size_t GetRecordCount() const;
+
+  /**
+   * @brief Writes buffered records to the disk.
+   */
+  void Flush();
+
+private:
+  void WriteVariableUpdated(const VariableUpdatedEvent& event);
+
+  mutable std::mutex m_mutex;
+  std::ofstream m_stream;
+  std::size_t m_record_count{0};
+
+  //!< moment of posting of the first event, all offsets are counted from it
+  std::chrono::steady_clock::time_point m_start_time{};
+
+  //!< JSON representation of the last recorded type of each variable
+  std::map<std::size_t, std::string> m_variable_types;
+};
+
+/**
+ * @brief Reads the whole content of the trace file.
+ *
+ * Throws RuntimeException if the file can't be read, or has unexpected format.
+ */
+DomainEventTrace ReadDomainEventTrace(const std::string& file_name);
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_DOMAIN_EVENT_TRACE_H_
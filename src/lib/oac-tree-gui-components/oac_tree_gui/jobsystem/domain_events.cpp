@@ -37,7 +37,8 @@ bool operator!=(const JobStateChangedEvent& lhs, const JobStateChangedEvent& rhs
 
 bool operator==(const ActiveInstructionChangedEvent& lhs, const ActiveInstructionChangedEvent& rhs)
 {
-  return lhs.instr_idx == rhs.instr_idx;
+  return (lhs.instr_idx == rhs.instr_idx) && (lhs.added == rhs.added)
+         && (lhs.removed == rhs.removed) && (lhs.is_delta == rhs.is_delta);
 }
 
 bool operator!=(const ActiveInstructionChangedEvent& lhs, const ActiveInstructionChangedEvent& rhs)
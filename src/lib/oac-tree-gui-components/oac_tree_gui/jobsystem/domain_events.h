@@ -24,15 +24,20 @@
 //! @file
 //! Contains a collection of classes representing various events happening on the domain side during
 //! sequencer execution.
+//!
+//! Each event carries the moment of its posting by DomainJobObserver (steady clock), to measure
+//! the latency of the GUI. The timestamp doesn't participate in comparison operators.
 
 #include <oac_tree_gui/domain/sequencer_types_fwd.h>
 #include <oac_tree_gui/jobsystem/log_event.h>
+#include <oac_tree_gui/jobsystem/shared_anyvalue.h>
 
 #include <sup/dto/anyvalue.h>
 #include <sup/oac-tree/execution_status.h>
 #include <sup/oac-tree/instruction_state.h>
 #include <sup/oac-tree/job_states.h>
 
+#include <chrono>
 #include <set>
 #include <string>
 #include <variant>
@@ -52,17 +57,22 @@ struct InstructionStateUpdatedEvent
 {
   std::size_t index{0};
   sup::oac_tree::InstructionState state{false, sup::oac_tree::ExecutionStatus::NOT_STARTED};
+  std::chrono::steady_clock::time_point post_time{};  //!< moment of posting by the observer
 };
 
 /**
  * @brief The VariableUpdatedEvent class represents automation server event when variable value has
  * changed.
+ *
+ * The value is shared between copies of the event, it is deep-copied only once, when the event is
+ * created by the observer in the sequencer thread.
  */
 struct VariableUpdatedEvent
 {
   std::size_t index{0};
-  sup::dto::AnyValue value;
+  SharedAnyValue value;
   bool connected{false};
+  std::chrono::steady_clock::time_point post_time{};  //!< moment of posting by the observer
 };
 
 /**
@@ -72,22 +82,30 @@ struct VariableUpdatedEvent
 struct JobStateChangedEvent
 {
   sup::oac_tree::JobState state;
+  std::chrono::steady_clock::time_point post_time{};  //!< moment of posting by the observer
 };
 
 /**
  * @brief The ActiveInstructionChangedEvent struct represents an event when list of domain's active
  * instructions change.
  *
- * Active instructions are those that are currently running or has unfinised state
+ * Active instructions are those that are currently running or has unfinised state. The event
+ * either carries the full list of active instructions, or, when is_delta is set, the change
+ * relative to the previous event of the same job.
  */
 struct ActiveInstructionChangedEvent
 {
-  std::vector<sup::dto::uint32> instr_idx;
+  std::vector<sup::dto::uint32> instr_idx;  //!< all active instructions, when not a delta
+  std::vector<sup::dto::uint32> added;      //!< instructions activated since the previous event
+  std::vector<sup::dto::uint32> removed;    //!< instructions deactivated since the previous event
+  bool is_delta{false};
+  std::chrono::steady_clock::time_point post_time{};  //!< moment of posting by the observer
 };
 
 struct BreakpointHitEvent
 {
   std::size_t index{0};
+  std::chrono::steady_clock::time_point post_time{};  //!< moment of posting by the observer
 };
 
 bool operator==(const InstructionStateUpdatedEvent& lhs, const InstructionStateUpdatedEvent& rhs);
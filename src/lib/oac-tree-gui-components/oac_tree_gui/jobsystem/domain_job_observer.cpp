@@ -23,6 +23,8 @@
 #include "user_context.h"
 
 #include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/domain_event_helper.h>
+#include <oac_tree_gui/jobsystem/domain_event_trace.h>
 #include <oac_tree_gui/jobsystem/objects/user_choice_provider.h>
 #include <oac_tree_gui/jobsystem/objects/user_input_provider.h>
 
@@ -33,23 +35,43 @@
 #include <sup/oac-tree/active_instruction_monitor.h>
 #include <sup/oac-tree/instruction.h>
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <sstream>
-#include <thread>
 
 namespace oac_tree_gui
 {
 
+namespace
+{
+
+/**
+ * @brief Every n-th active instruction notification carries the full list of active instructions.
+ */
+const std::size_t kActiveInstructionSnapshotInterval = 100;
+
+}  // namespace
+
 DomainJobObserver::DomainJobObserver(post_event_callback_t post_event_callback,
                                      const UserContext& user_context)
     : m_post_event_callback(std::move(post_event_callback))
     , m_active_instruction_monitor(CreateActiveInstructionMonitor({}))
+    , m_log_flood_filter([this](Severity severity, const std::string& message)
+                         { PostEvent(CreateLogEvent(severity, message)); })
 {
   if (!m_post_event_callback)
   {
     throw RuntimeException("Callback is not initialised");
   }
 
+  if (user_context.answer_on_calling_thread)
+  {
+    m_direct_input_callback = user_context.user_input_callback;
+    m_direct_choice_callback = user_context.user_choice_callback;
+    return;
+  }
+
   if (user_context.user_choice_callback)
   {
     m_choice_provider = std::make_unique<UserChoiceProvider>(user_context.user_choice_callback);
@@ -71,31 +93,45 @@ void DomainJobObserver::InitNumberOfInstructions(sup::dto::uint32 n_instr)
 void DomainJobObserver::InstructionStateUpdated(sup::dto::uint32 instr_idx,
                                                 sup::oac_tree::InstructionState state)
 {
-  m_post_event_callback(InstructionStateUpdatedEvent{instr_idx, state});
+  PostEvent(InstructionStateUpdatedEvent{instr_idx, state});
 
   {
-    const std::scoped_lock lock{m_mutex};
+    const std::scoped_lock lock{m_monitor_mutex};
     m_active_instruction_monitor->InstructionStatusUpdated(instr_idx, state.m_execution_status);
   }
 }
 
 void DomainJobObserver::BreakpointInstructionUpdated(sup::dto::uint32 instr_idx)
 {
-  m_post_event_callback(BreakpointHitEvent{instr_idx});
+  PostEvent(BreakpointHitEvent{instr_idx});
 }
 
 void DomainJobObserver::VariableUpdated(sup::dto::uint32 var_idx, const sup::dto::AnyValue& value,
                                         bool connected)
 {
-  m_post_event_callback(VariableUpdatedEvent{var_idx, value, connected});
+  PostEvent(VariableUpdatedEvent{var_idx, value, connected});
 }
 
 void DomainJobObserver::JobStateUpdated(sup::oac_tree::JobState state)
 {
+  if (sup::oac_tree::IsFinishedJobState(state))
+  {
+    // reporting messages folded at the end of the run before the final state
+    m_log_flood_filter.Flush();
+  }
+
+  if (sup::oac_tree::IsFinishedJobState(state))
+  {
+    // nobody is going to use answers to requests left behind
+    InterruptUserRequests();
+  }
+
+  // posting outside of the lock, since the event queue might wait for the GUI thread
+  PostEvent(JobStateChangedEvent{state});
+
   {
     const std::scoped_lock lock{m_mutex};
     m_state = state;
-    m_post_event_callback(JobStateChangedEvent{state});
   }
   m_cv.notify_one();
 }
@@ -105,70 +141,101 @@ void DomainJobObserver::PutValue(const sup::dto::AnyValue& value, const std::str
   auto value_string = sup::gui::ValuesToJSONString(value);
   std::ostringstream ostr;
   ostr << "Put value request > " << description << " " << value_string;
-  m_post_event_callback(CreateLogEvent(Severity::kInfo, ostr.str()));
+  PostEvent(CreateLogEvent(Severity::kInfo, ostr.str()));
 }
 
 bool DomainJobObserver::GetUserValue(sup::dto::uint64 id, sup::dto::AnyValue& value,
                                      const std::string& description)
 {
-  (void)id;  // TODO send this id to the GUI
+  if (m_direct_input_callback)
+  {
+    auto result = m_direct_input_callback({value, description});
+    value = result.value;
+    return result.processed;
+  }
 
   if (m_input_provider)
   {
-    auto result = m_input_provider->GetUserInput({value, description});
+    auto result = m_input_provider->GetUserInput(id, {value, description});
     value = result.value;
     return result.processed;
   }
 
-  m_post_event_callback(CreateLogEvent(Severity::kWarning, "User input callback is not set"));
+  PostEvent(CreateLogEvent(Severity::kWarning, "User input callback is not set"));
   return false;
 }
 
 int DomainJobObserver::GetUserChoice(sup::dto::uint64 id, const std::vector<std::string>& options,
                                      const sup::dto::AnyValue& metadata)
 {
-  (void)id;  // TODO send this id to the GUI
+  if (m_direct_choice_callback)
+  {
+    auto result = m_direct_choice_callback({options, metadata});
+    return result.processed ? result.index : -1;
+  }
 
   if (m_choice_provider)
   {
-    auto result = m_choice_provider->GetUserChoice({options, metadata});
+    auto result = m_choice_provider->GetUserChoice(id, {options, metadata});
     return result.processed ? result.index : -1;
   }
 
-  m_post_event_callback(CreateLogEvent(Severity::kWarning, "User choice callback is not set"));
+  PostEvent(CreateLogEvent(Severity::kWarning, "User choice callback is not set"));
   return -1;
 }
 
 void DomainJobObserver::Interrupt(sup::dto::uint64 id)
 {
-  // TODO What to do here?
-  (void)id;
+  if (m_input_provider)
+  {
+    (void)m_input_provider->Interrupt(id);
+  }
+
+  if (m_choice_provider)
+  {
+    (void)m_choice_provider->Interrupt(id);
+  }
 }
 
 void DomainJobObserver::Message(const std::string& message)
 {
-  m_post_event_callback(CreateLogEvent(Severity::kInfo, message));
+  if (m_log_flood_filter.AcceptSeverity(Severity::kInfo))
+  {
+    m_log_flood_filter.ProcessMessage(Severity::kInfo, message);
+  }
 }
 
 void DomainJobObserver::Log(int severity, const std::string& message)
 {
   // assuming sequencer severity is the same as GUI severity
-  m_post_event_callback(CreateLogEvent(static_cast<Severity>(severity), message));
+  const auto gui_severity = static_cast<Severity>(severity);
+
+  // threshold is checked first, to make suppressed messages cheap for the sequencer thread
+  if (m_log_flood_filter.AcceptSeverity(gui_severity))
+  {
+    m_log_flood_filter.ProcessMessage(gui_severity, message);
+  }
 }
 
 void DomainJobObserver::NextInstructionsUpdated(const std::vector<sup::dto::uint32>& instr_indices)
 {
-  m_post_event_callback(ActiveInstructionChangedEvent{instr_indices});
+  if (!m_active_instruction_delta_enabled.load())
+  {
+    PostEvent(ActiveInstructionChangedEvent{instr_indices});
+    return;
+  }
+
+  auto event = CreateActiveInstructionDelta(instr_indices);
+  if (event.is_delta && event.added.empty() && event.removed.empty())
+  {
+    return;  // nothing has changed
+  }
+  PostEvent(std::move(event));
 }
 
 void DomainJobObserver::ProcedureTicked()
 {
-  std::unique_lock<std::mutex> lock{m_mutex};
-  if (m_tick_timeout.count() > 0)
-  {
-    lock.unlock();
-    std::this_thread::sleep_for(m_tick_timeout);
-  }
+  m_tick_pacer.Tick();
 }
 
 sup::oac_tree::JobState DomainJobObserver::GetCurrentState() const
@@ -192,16 +259,107 @@ sup::oac_tree::JobState DomainJobObserver::WaitForFinished() const
   return m_state;
 }
 
-void DomainJobObserver::SetTickTimeout(std::chrono::milliseconds timeout)
+void DomainJobObserver::SetTickTimeout(std::chrono::microseconds timeout)
+{
+  m_tick_pacer.SetTickPeriod(timeout);
+}
+
+TickStatistics DomainJobObserver::GetTickStatistics() const
 {
-  const std::unique_lock<std::mutex> lock{m_mutex};
-  m_tick_timeout = timeout;
+  return m_tick_pacer.GetStatistics();
+}
+
+void DomainJobObserver::SetUserRequestTimeout(std::chrono::milliseconds timeout)
+{
+  if (m_input_provider)
+  {
+    m_input_provider->SetTimeout(timeout);
+  }
+
+  if (m_choice_provider)
+  {
+    m_choice_provider->SetTimeout(timeout);
+  }
+}
+
+std::vector<PendingRequest<UserInputArgs>> DomainJobObserver::GetPendingUserInputRequests() const
+{
+  return m_input_provider ? m_input_provider->GetPendingRequests()
+                          : std::vector<PendingRequest<UserInputArgs>>{};
+}
+
+std::vector<PendingRequest<UserChoiceArgs>> DomainJobObserver::GetPendingUserChoiceRequests() const
+{
+  return m_choice_provider ? m_choice_provider->GetPendingRequests()
+                           : std::vector<PendingRequest<UserChoiceArgs>>{};
+}
+
+std::size_t DomainJobObserver::GetDuplicateUserRequestCount() const
+{
+  std::size_t result{0};
+  if (m_input_provider)
+  {
+    result += m_input_provider->GetDuplicateRequestCount();
+  }
+  if (m_choice_provider)
+  {
+    result += m_choice_provider->GetDuplicateRequestCount();
+  }
+  return result;
+}
+
+bool DomainJobObserver::SendUserInput(std::uint64_t id, const UserInputResult& result)
+{
+  return m_input_provider ? m_input_provider->SendUserInput(id, result) : false;
+}
+
+bool DomainJobObserver::SendUserChoice(std::uint64_t id, const UserChoiceResult& result)
+{
+  return m_choice_provider ? m_choice_provider->SendUserChoice(id, result) : false;
+}
+
+void DomainJobObserver::InterruptUserRequests()
+{
+  if (m_input_provider)
+  {
+    m_input_provider->InterruptAll();
+  }
+
+  if (m_choice_provider)
+  {
+    m_choice_provider->InterruptAll();
+  }
 }
 
 void DomainJobObserver::SetInstructionActiveFilter(const active_filter_t& filter)
 {
-  const std::unique_lock<std::mutex> lock{m_mutex};
+  const std::unique_lock<std::mutex> lock{m_monitor_mutex};
   m_active_instruction_monitor = CreateActiveInstructionMonitor(filter);
+  m_delta_resync_requested.store(true);  // new monitor starts from the full list
+}
+
+void DomainJobObserver::SetActiveInstructionDeltaEnabled(bool value)
+{
+  // the first event after enabling carries the full list
+  m_delta_resync_requested.store(true);
+  m_active_instruction_delta_enabled.store(value);
+}
+
+void DomainJobObserver::SetLogFloodOptions(const LogFloodOptions& options)
+{
+  m_log_flood_filter.SetOptions(options);
+}
+
+LogFloodStatistics DomainJobObserver::GetLogFloodStatistics() const
+{
+  return m_log_flood_filter.GetStatistics();
+}
+
+void DomainJobObserver::SetEventTraceWriter(std::shared_ptr<DomainEventTraceWriter> writer)
+{
+  const std::scoped_lock lock{m_trace_mutex};
+  m_trace_writer = std::move(writer);
+  m_is_tracing = m_trace_writer != nullptr;
 }
 
 std::unique_ptr<DomainJobObserver::active_monitor_t>
@@ -221,4 +379,56 @@ DomainJobObserver::CreateActiveInstructionMonitor(const active_filter_t& filter)
   return std::make_unique<sup::oac_tree::ActiveInstructionMonitor>(callback);
 }
 
+ActiveInstructionChangedEvent DomainJobObserver::CreateActiveInstructionDelta(
+    const std::vector<sup::dto::uint32>& instr_indices)
+{
+  std::vector<sup::dto::uint32> active_instructions(instr_indices);
+  std::sort(active_instructions.begin(), active_instructions.end());
+
+  if (m_delta_resync_requested.exchange(false))
+  {
+    m_delta_event_count = 0;
+  }
+
+  ActiveInstructionChangedEvent result;
+  if (m_delta_event_count == 0)
+  {
+    result.instr_idx = instr_indices;
+  }
+  else
+  {
+    result.is_delta = true;
+    std::set_difference(active_instructions.begin(), active_instructions.end(),
+                        m_last_active_instructions.begin(), m_last_active_instructions.end(),
+                        std::back_inserter(result.added));
+    std::set_difference(m_last_active_instructions.begin(), m_last_active_instructions.end(),
+                        active_instructions.begin(), active_instructions.end(),
+                        std::back_inserter(result.removed));
+  }
+
+  m_delta_event_count = (m_delta_event_count + 1) % kActiveInstructionSnapshotInterval;
+  m_last_active_instructions = std::move(active_instructions);
+  return result;
+}
+
+void DomainJobObserver::PostEvent(domain_event_t event)
+{
+  SetPostTime(event, std::chrono::steady_clock::now());
+
+  if (m_is_tracing)
+  {
+    std::shared_ptr<DomainEventTraceWriter> trace_writer;
+    {
+      const std::scoped_lock lock{m_trace_mutex};
+      trace_writer = m_trace_writer;
+    }
+    if (trace_writer)
+    {
+      trace_writer->Record(event);
+    }
+  }
+
+  m_post_event_callback(std::move(event));
+}
+
 }  // namespace oac_tree_gui
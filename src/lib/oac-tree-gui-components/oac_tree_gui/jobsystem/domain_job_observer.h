@@ -22,12 +22,18 @@
 #define OAC_TREE_GUI_JOBSYSTEM_DOMAIN_JOB_OBSERVER_H_
 
 #include <oac_tree_gui/jobsystem/domain_events.h>
+#include <oac_tree_gui/jobsystem/log_flood_filter.h>
+#include <oac_tree_gui/jobsystem/request_handler_queue.h>
+#include <oac_tree_gui/jobsystem/request_types.h>
+#include <oac_tree_gui/jobsystem/tick_pacer.h>
 
 #include <sup/oac-tree/i_job_info_io.h>
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <functional>
+#include <memory>
 #include <mutex>
 
 namespace sup::oac_tree
@@ -39,6 +45,7 @@ namespace oac_tree_gui
 {
 
 struct UserContext;
+class DomainEventTraceWriter;
 class UserChoiceProvider;
 class UserInputProvider;
 
@@ -49,7 +56,7 @@ class UserInputProvider;
 class DomainJobObserver : public sup::oac_tree::IJobInfoIO
 {
 public:
-  using post_event_callback_t = std::function<void(const domain_event_t& event)>;
+  using post_event_callback_t = std::function<void(domain_event_t&& event)>;
   using active_monitor_t = sup::oac_tree::ActiveInstructionMonitor;
 
   /**
@@ -113,27 +120,143 @@ public:
   sup::oac_tree::JobState WaitForFinished() const;
 
   /**
-   * @brief Sets sleep time on every tick.
+   * @brief Sets the target interval between procedure ticks, zero means full speed.
+   *
+   * The time spent in the tick itself is compensated. The change interrupts the current wait.
+   */
+  void SetTickTimeout(std::chrono::microseconds timeout);
+
+  /**
+   * @brief Returns the number of ticks and the measured tick rate.
+   */
+  TickStatistics GetTickStatistics() const;
+
+  /**
+   * @brief Sets the time to wait for the user's answer to each input or choice request.
+   *
+   * The request without an answer is reported to the job as not processed. Zero timeout means
+   * waiting till the answer, or the interruption.
    */
-  void SetTickTimeout(std::chrono::milliseconds timeout);
+  void SetUserRequestTimeout(std::chrono::milliseconds timeout);
+
+  /**
+   * @brief Returns user input requests waiting for the answer, in the order of their arrival.
+   */
+  std::vector<PendingRequest<UserInputArgs>> GetPendingUserInputRequests() const;
+
+  /**
+   * @brief Returns user choice requests waiting for the answer, in the order of their arrival.
+   */
+  std::vector<PendingRequest<UserChoiceArgs>> GetPendingUserChoiceRequests() const;
+
+  /**
+   * @brief Returns number of user input and choice requests rejected, since the request with the
+   * same id was pending.
+   */
+  std::size_t GetDuplicateUserRequestCount() const;
+
+  /**
+   * @brief Answers the pending user input request with the given id.
+   *
+   * @return True if the request was waiting for the answer.
+   */
+  bool SendUserInput(std::uint64_t id, const UserInputResult& result);
+
+  /**
+   * @brief Answers the pending user choice request with the given id.
+   *
+   * @return True if the request was waiting for the answer.
+   */
+  bool SendUserChoice(std::uint64_t id, const UserChoiceResult& result);
 
   /**
    * @brief Sets filter to suppress active instruction notifications.
    */
   void SetInstructionActiveFilter(const active_filter_t& filter);
 
+  /**
+   * @brief Enables delta encoding of active instruction notifications.
+   *
+   * When enabled, ActiveInstructionChangedEvent carries only instructions added to and removed
+   * from the previous list. The full list is still sent periodically, to let the receiver recover
+   * from lost events.
+   */
+  void SetActiveInstructionDeltaEnabled(bool value);
+
+  /**
+   * @brief Sets options to suppress excessive log messages coming from the procedure.
+   */
+  void SetLogFloodOptions(const LogFloodOptions& options);
+
+  /**
+   * @brief Returns the number of log messages suppressed so far.
+   */
+  LogFloodStatistics GetLogFloodStatistics() const;
+
+  /**
+   * @brief Sets the writer to record all posted events into the trace file.
+   *
+   * Empty pointer stops the recording.
+   */
+  void SetEventTraceWriter(std::shared_ptr<DomainEventTraceWriter> writer);
+
 private:
   std::unique_ptr<active_monitor_t> CreateActiveInstructionMonitor(const active_filter_t& filter);
 
+  /**
+   * @brief Creates an event with the change of active instructions relative to the previous call.
+   *
+   * Returns the full list of active instructions if it is time for the next snapshot.
+   */
+  ActiveInstructionChangedEvent CreateActiveInstructionDelta(
+      const std::vector<sup::dto::uint32>& instr_indices);
+
+  /**
+   * @brief Stamps the event with the current time and posts it.
+   */
+  void PostEvent(domain_event_t event);
+
+  /**
+   * @brief Releases all threads waiting for the user's answer.
+   */
+  void InterruptUserRequests();
+
   post_event_callback_t m_post_event_callback;
   std::unique_ptr<UserChoiceProvider> m_choice_provider;
   std::unique_ptr<UserInputProvider> m_input_provider;
+
+  //!< callbacks answering on the calling thread, used instead of providers
+  std::function<UserInputResult(const UserInputArgs&)> m_direct_input_callback;
+  std::function<UserChoiceResult(const UserChoiceArgs&)> m_direct_choice_callback;
   std::unique_ptr<active_monitor_t> m_active_instruction_monitor;
+  LogFloodFilter m_log_flood_filter;
+  TickPacer m_tick_pacer;
 
   sup::oac_tree::JobState m_state{sup::oac_tree::JobState::kInitial};
+
+  //!< protects job state, shared with the GUI thread
   mutable std::mutex m_mutex;
+
+  //!< protects active instruction monitor, never held while GUI thread is waiting for it
+  std::mutex m_monitor_mutex;
   mutable std::condition_variable m_cv;
-  std::chrono::milliseconds m_tick_timeout{0};
+
+  std::atomic<bool> m_active_instruction_delta_enabled{false};
+
+  //!< protects trace writer, which is set from the GUI thread
+  std::mutex m_trace_mutex;
+  std::shared_ptr<DomainEventTraceWriter> m_trace_writer;
+  std::atomic<bool> m_is_tracing{false};  //!< lets posting skip the lock when not recording
+
+  //!< set from the GUI thread to start the next delta sequence from the full list
+  std::atomic<bool> m_delta_resync_requested{false};
+
+  //!< sorted list of active instructions reported last time, used for delta encoding, accessed
+  //!< from the thread reporting active instructions only
+  std::vector<sup::dto::uint32> m_last_active_instructions;
+
+  //!< number of delta events since the last full list of active instructions
+  std::size_t m_delta_event_count{0};
 };
 
 }  // namespace oac_tree_gui
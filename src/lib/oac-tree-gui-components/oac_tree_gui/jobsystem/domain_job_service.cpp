@@ -30,16 +30,29 @@ namespace oac_tree_gui
 {
 
 DomainJobService::DomainJobService(DomainEventDispatcherContext dispatcher_context,
-                                   UserContext user_context)
-    : m_event_queue(std::make_unique<DomainEventQueue>())
+                                   UserContext user_context,
+                                   const DomainEventQueueOptions& queue_options)
+    : m_event_queue(std::make_unique<DomainEventQueue>(queue_options))
     , m_event_dispatcher(std::make_unique<DomainEventDispatcher>(CreateGetEventCallback(),
                                                                  std::move(dispatcher_context)))
     , m_job_observer(
           std::make_unique<DomainJobObserver>(CreatePostEventCallback(), std::move(user_context)))
 {
-  // connecting event queue with event dispatcher using queued connection
+  // connecting event queue with event dispatcher using queued connection, the queue notifies once
+  // per burst of events, the dispatcher drains them in batches
   (void)QObject::connect(m_event_queue.get(), &DomainEventQueue::NewEvent, m_event_dispatcher.get(),
-                         &DomainEventDispatcher::OnNewEvent, Qt::QueuedConnection);
+                         &DomainEventDispatcher::OnNewEvents, Qt::QueuedConnection);
+
+  // wakes up threads waiting for events, the notification is re-armed when the queue is drained
+  auto on_new_event = [this]()
+  {
+    {
+      const std::scoped_lock lock{m_wait_mutex};
+    }
+    m_wait_cv.notify_all();
+  };
+  (void)QObject::connect(m_event_queue.get(), &DomainEventQueue::NewEvent, m_event_queue.get(),
+                         on_new_event, Qt::DirectConnection);
 }
 
 DomainJobService::~DomainJobService() = default;
@@ -65,14 +78,58 @@ bool DomainJobService::WaitForState(sup::oac_tree::JobState state,
   return m_job_observer->WaitForState(state, duration);
 }
 
-void DomainJobService::SetTickTimeout(std::chrono::milliseconds timeout)
+void DomainJobService::SetTickTimeout(std::chrono::microseconds timeout)
 {
   m_job_observer->SetTickTimeout(timeout);
 }
 
 std::size_t DomainJobService::GetEventCount() const
 {
-  return m_event_queue->GetEventCount();
+  return m_event_queue->GetEventCount() + m_event_dispatcher->GetPendingEventCount();
+}
+
+std::size_t DomainJobService::GetDroppedEventCount() const
+{
+  return m_event_queue->GetDroppedEventCount();
+}
+
+DomainEventStatistics DomainJobService::GetEventStatistics() const
+{
+  auto result = m_event_dispatcher->GetStatistics();
+  result.queue_depth = GetEventCount();
+  result.queue_high_water_mark = m_event_queue->GetHighWaterMark();
+  result.dropped_event_count = GetDroppedEventCount();
+
+  const auto log_statistics = m_job_observer->GetLogFloodStatistics();
+  result.log_below_threshold_count = log_statistics.below_threshold_count;
+  result.log_rate_limited_count = log_statistics.rate_limited_count;
+  result.log_folded_duplicate_count = log_statistics.folded_duplicate_count;
+  result.duplicate_user_request_count = m_job_observer->GetDuplicateUserRequestCount();
+
+  result.ticks = m_job_observer->GetTickStatistics();
+  return result;
+}
+
+void DomainJobService::CloseEventQueue()
+{
+  m_event_queue->Close();
+}
+
+void DomainJobService::SetDispatchBudget(std::size_t max_event_count,
+                                         std::chrono::milliseconds max_duration)
+{
+  m_event_dispatcher->SetDispatchBudget(max_event_count, max_duration);
+}
+
+void DomainJobService::SetEventConflationEnabled(bool value)
+{
+  m_event_dispatcher->SetConflationEnabled(value);
+}
+
+std::size_t DomainJobService::GetConflatedEventCount() const
+{
+  return m_event_dispatcher->GetConflatedInstructionStateCount()
+         + m_event_dispatcher->GetConflatedVariableCount();
 }
 
 void DomainJobService::SetInstructionActiveFilter(const active_filter_t& filter)
@@ -80,14 +137,88 @@ void DomainJobService::SetInstructionActiveFilter(const active_filter_t& filter)
   m_job_observer->SetInstructionActiveFilter(filter);
 }
 
-std::function<void(const domain_event_t&)> DomainJobService::CreatePostEventCallback() const
+void DomainJobService::SetActiveInstructionDeltaEnabled(bool value)
+{
+  m_job_observer->SetActiveInstructionDeltaEnabled(value);
+}
+
+void DomainJobService::SetLogFloodOptions(const LogFloodOptions& options)
+{
+  m_job_observer->SetLogFloodOptions(options);
+}
+
+void DomainJobService::SetEventTraceWriter(std::shared_ptr<DomainEventTraceWriter> writer)
+{
+  m_job_observer->SetEventTraceWriter(std::move(writer));
+}
+
+void DomainJobService::SetUserRequestTimeout(std::chrono::milliseconds timeout)
+{
+  m_job_observer->SetUserRequestTimeout(timeout);
+}
+
+std::vector<PendingRequest<UserInputArgs>> DomainJobService::GetPendingUserInputRequests() const
+{
+  return m_job_observer->GetPendingUserInputRequests();
+}
+
+std::vector<PendingRequest<UserChoiceArgs>> DomainJobService::GetPendingUserChoiceRequests() const
+{
+  return m_job_observer->GetPendingUserChoiceRequests();
+}
+
+bool DomainJobService::SendUserInput(std::uint64_t id, const UserInputResult& result)
+{
+  return m_job_observer->SendUserInput(id, result);
+}
+
+bool DomainJobService::SendUserChoice(std::uint64_t id, const UserChoiceResult& result)
+{
+  return m_job_observer->SendUserChoice(id, result);
+}
+
+void DomainJobService::SetEventPacingEnabled(bool value)
+{
+  if (m_event_pacing_enabled == value)
+  {
+    return;
+  }
+
+  m_event_pacing_enabled = value;
+  if (m_event_pacing_enabled)
+  {
+    (void)QObject::disconnect(m_event_queue.get(), &DomainEventQueue::NewEvent,
+                              m_event_dispatcher.get(), &DomainEventDispatcher::OnNewEvents);
+  }
+  else
+  {
+    (void)QObject::connect(m_event_queue.get(), &DomainEventQueue::NewEvent,
+                           m_event_dispatcher.get(), &DomainEventDispatcher::OnNewEvents,
+                           Qt::QueuedConnection);
+    // picking up events accumulated while pacing was on
+    m_event_dispatcher->OnNewEvents();
+  }
+}
+
+void DomainJobService::ProcessEvents(std::chrono::steady_clock::time_point deadline)
+{
+  (void)m_event_dispatcher->ProcessEvents(deadline);
+}
+
+bool DomainJobService::WaitForEvents(std::chrono::milliseconds duration)
+{
+  std::unique_lock lock{m_wait_mutex};
+  return m_wait_cv.wait_for(lock, duration, [this]() { return GetEventCount() > 0; });
+}
+
+std::function<void(domain_event_t&&)> DomainJobService::CreatePostEventCallback() const
 {
-  return [this](const domain_event_t& event) { m_event_queue->PushEvent(event); };
+  return [this](domain_event_t&& event) { m_event_queue->PushEvent(std::move(event)); };
 }
 
 std::function<domain_event_t()> DomainJobService::CreateGetEventCallback() const
 {
-  return [this]() -> domain_event_t { return m_event_queue->PopEvent(); };
+  return [this]() -> domain_event_t { return m_event_queue->TryPopEvent(); };
 }
 
 }  // namespace oac_tree_gui
@@ -21,10 +21,19 @@
 #ifndef OAC_TREE_GUI_JOBSYSTEM_DOMAIN_JOB_SERVICE_H_
 #define OAC_TREE_GUI_JOBSYSTEM_DOMAIN_JOB_SERVICE_H_
 
+#include <oac_tree_gui/jobsystem/domain_event_queue_options.h>
+#include <oac_tree_gui/jobsystem/domain_event_statistics.h>
 #include <oac_tree_gui/jobsystem/domain_events.h>
+#include <oac_tree_gui/jobsystem/log_flood_filter.h>
+#include <oac_tree_gui/jobsystem/request_handler_queue.h>
+#include <oac_tree_gui/jobsystem/request_types.h>
 
 #include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <vector>
+
 
 namespace oac_tree_gui
 {
@@ -32,6 +41,7 @@ namespace oac_tree_gui
 class DomainEventQueue;
 class DomainEventDispatcher;
 struct DomainEventDispatcherContext;
+class DomainEventTraceWriter;
 class DomainJobObserver;
 struct UserContext;
 
@@ -42,7 +52,8 @@ struct UserContext;
 class DomainJobService
 {
 public:
-  DomainJobService(DomainEventDispatcherContext dispatcher_context, UserContext user_context);
+  DomainJobService(DomainEventDispatcherContext dispatcher_context, UserContext user_context,
+                   const DomainEventQueueOptions& queue_options = {});
   virtual ~DomainJobService();
 
   DomainJobService(const DomainJobService&) = delete;
@@ -68,34 +79,141 @@ public:
   bool WaitForState(sup::oac_tree::JobState state, std::chrono::milliseconds duration) const;
 
   /**
-   * @brief Sets sleep time on every tick.
+   * @brief Sets the target interval between procedure ticks, zero means full speed.
    */
-  void SetTickTimeout(std::chrono::milliseconds timeout);
+  void SetTickTimeout(std::chrono::microseconds timeout);
 
   /**
    * @brief Returns number of events in a queue.
+   *
+   * Includes events taken from the queue by the dispatcher, but not yet processed.
    */
   std::size_t GetEventCount() const;
 
+  /**
+   * @brief Returns number of events dropped by the event queue because of the overflow.
+   */
+  std::size_t GetDroppedEventCount() const;
+
+  /**
+   * @brief Returns diagnostics of domain events delivery to the GUI.
+   */
+  DomainEventStatistics GetEventStatistics() const;
+
+  /**
+   * @brief Stops accepting new domain events.
+   *
+   * Releases the sequencer thread, if it is waiting for the free space in the event queue.
+   */
+  void CloseEventQueue();
+
+  /**
+   * @brief Sets the budget for a single pass of event processing in the GUI thread.
+   *
+   * @param max_event_count Maximum number of events to process in one pass, 0 means no limit.
+   * @param max_duration Maximum time to spend in one pass, 0 means no limit.
+   */
+  void SetDispatchBudget(std::size_t max_event_count, std::chrono::milliseconds max_duration);
+
+  /**
+   * @brief Enables conflation of instruction state and variable updates.
+   *
+   * When enabled, only the latest instruction state, and the latest variable value, collected
+   * within one dispatch window, are reported to the GUI.
+   */
+  void SetEventConflationEnabled(bool value);
+
+  /**
+   * @brief Returns number of domain events dropped by the conflation.
+   */
+  std::size_t GetConflatedEventCount() const;
+
   /**
    * @brief Sets filter to suppress active instruction notifications.
    */
   void SetInstructionActiveFilter(const active_filter_t& filter);
 
+  /**
+   * @brief Enables delta encoding of active instruction notifications.
+   */
+  void SetActiveInstructionDeltaEnabled(bool value);
+
+  /**
+   * @brief Sets options to suppress excessive log messages at the source.
+   */
+  void SetLogFloodOptions(const LogFloodOptions& options);
+
+  /**
+   * @brief Sets the writer to record all domain events, empty pointer stops the recording.
+   */
+  void SetEventTraceWriter(std::shared_ptr<DomainEventTraceWriter> writer);
+
+  /**
+   * @brief Sets the time to wait for the user's answer to each input or choice request, zero
+   * means no timeout.
+   */
+  void SetUserRequestTimeout(std::chrono::milliseconds timeout);
+
+  /**
+   * @brief Returns user input requests waiting for the answer, in the order of their arrival.
+   */
+  std::vector<PendingRequest<UserInputArgs>> GetPendingUserInputRequests() const;
+
+  /**
+   * @brief Returns user choice requests waiting for the answer, in the order of their arrival.
+   */
+  std::vector<PendingRequest<UserChoiceArgs>> GetPendingUserChoiceRequests() const;
+
+  /**
+   * @brief Answers the pending user input request with the given id, in any order.
+   */
+  bool SendUserInput(std::uint64_t id, const UserInputResult& result);
+
+  /**
+   * @brief Answers the pending user choice request with the given id, in any order.
+   */
+  bool SendUserChoice(std::uint64_t id, const UserChoiceResult& result);
+
+  /**
+   * @brief Enables paced processing of domain events.
+   *
+   * When enabled, the arrival of new events doesn't trigger their processing. Events are
+   * processed only on explicit calls to ProcessEvents, e.g. from GuiUpdateScheduler.
+   */
+  void SetEventPacingEnabled(bool value);
+
+  /**
+   * @brief Processes pending domain events within the dispatch budget, and until the deadline.
+   */
+  void ProcessEvents(std::chrono::steady_clock::time_point deadline =
+                         std::chrono::steady_clock::time_point::max());
+
+  /**
+   * @brief Blocks until there are domain events to process, or the duration has elapsed.
+   *
+   * Meant for threads without an event loop, processing events with paced processing enabled.
+   *
+   * @return True if there are events to process.
+   */
+  bool WaitForEvents(std::chrono::milliseconds duration);
+
 private:
   /**
    * @brief Creates a callback to publish domain events.
    */
-  std::function<void(const domain_event_t& event)> CreatePostEventCallback() const;
+  std::function<void(domain_event_t&& event)> CreatePostEventCallback() const;
 
   /**
    * @brief Creates a callback to get events from event queue.
    */
   std::function<domain_event_t()> CreateGetEventCallback() const;
 
+  std::mutex m_wait_mutex;
+  std::condition_variable m_wait_cv;  //!< notified on the arrival of new events, outlives the queue
   std::unique_ptr<DomainEventQueue> m_event_queue;
   std::unique_ptr<DomainEventDispatcher> m_event_dispatcher;
   std::unique_ptr<DomainJobObserver> m_job_observer;
+  bool m_event_pacing_enabled{false};
 };
 
 }  // namespace oac_tree_gui
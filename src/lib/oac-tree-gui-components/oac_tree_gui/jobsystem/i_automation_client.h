@@ -63,10 +63,29 @@ public:
    */
   virtual std::string GetProcedureName(std::uint32_t job_index) const = 0;
 
+  /**
+   * @brief Connects with the remote job in advance, so the following creation of the job handler
+   * for this job index doesn't block.
+   *
+   * Can be called from any thread. The prepared job is kept till the job handler is created, or
+   * till it is discarded. A job prepared again for the same job index replaces the previous one,
+   * which gets closed.
+   */
+  virtual void PrepareJob(std::uint32_t job_index) = 0;
+
+  /**
+   * @brief Drops the job prepared in advance for this job index, if any, and closes its
+   * connection.
+   *
+   * Can be called from any thread.
+   */
+  virtual void DiscardPreparedJob(std::uint32_t job_index) = 0;
+
   /**
    * @brief Creates job handler.
    *
-   * Job handler is a GUI object intended to run jobs represented by the remote job item.
+   * Job handler is a GUI object intended to run jobs represented by the remote job item. Uses the
+   * job prepared in advance, if any.
    *
    * @param job_item Remote job item.
    * @param user_context The user context to handle user interactions.
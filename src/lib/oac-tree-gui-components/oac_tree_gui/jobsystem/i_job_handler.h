@@ -21,6 +21,7 @@
 #ifndef OAC_TREE_GUI_JOBSYSTEM_I_JOB_HANDLER_H_
 #define OAC_TREE_GUI_JOBSYSTEM_I_JOB_HANDLER_H_
 
+#include <oac_tree_gui/jobsystem/domain_event_statistics.h>
 #include <oac_tree_gui/model/runner_status.h>
 
 namespace oac_tree_gui
@@ -107,6 +108,13 @@ public:
    * @brief Returns expanded ProcedureItem.
    */
   virtual ProcedureItem* GetExpandedProcedure() const = 0;
+
+  /**
+   * @brief Returns diagnostics of domain events delivery to the GUI.
+   *
+   * Allows to find out whether the GUI is lagging behind the real procedure.
+   */
+  virtual DomainEventStatistics GetEventStatistics() const = 0;
 };
 
 }  // namespace oac_tree_gui
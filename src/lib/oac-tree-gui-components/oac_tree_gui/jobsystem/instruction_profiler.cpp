@@ -0,0 +1,177 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "instruction_profiler.h"
+
+#include <algorithm>
+
+namespace oac_tree_gui
+{
+
+InstructionProfiler::InstructionProfiler(std::size_t max_call_record_count)
+    : m_max_call_record_count(max_call_record_count)
+{
+}
+
+void InstructionProfiler::InstructionStatusUpdated(std::size_t instr_idx,
+                                                   sup::oac_tree::ExecutionStatus status,
+                                                   clock_t::time_point timestamp)
+{
+  using sup::oac_tree::ExecutionStatus;
+
+  auto& data = GetData(instr_idx);
+  switch (status)
+  {
+  case ExecutionStatus::NOT_FINISHED:
+  case ExecutionStatus::RUNNING:
+    StartExecution(data, timestamp);
+    break;
+  case ExecutionStatus::SUCCESS:
+  case ExecutionStatus::FAILURE:
+    FinishExecution(data, timestamp);
+    break;
+  default:
+    data.is_running = false;
+    break;
+  }
+}
+
+std::vector<InstructionProfileEntry> InstructionProfiler::TakeUpdatedEntries()
+{
+  std::vector<InstructionProfileEntry> result;
+  result.reserve(m_updated_indexes.size());
+  for (auto instr_idx : m_updated_indexes)
+  {
+    auto& data = m_data[instr_idx];
+    result.push_back(data.entry);
+    data.is_updated = false;
+  }
+  m_updated_indexes.clear();
+  return result;
+}
+
+std::vector<InstructionProfileEntry> InstructionProfiler::GetEntries() const
+{
+  std::vector<InstructionProfileEntry> result;
+  for (const auto& data : m_data)
+  {
+    if (data.entry.call_count > 0)
+    {
+      result.push_back(data.entry);
+    }
+  }
+  return result;
+}
+
+std::vector<InstructionCallRecord> InstructionProfiler::GetCallRecords() const
+{
+  return m_call_records;
+}
+
+std::size_t InstructionProfiler::GetDroppedCallRecordCount() const
+{
+  return m_dropped_call_record_count;
+}
+
+void InstructionProfiler::Reset()
+{
+  // instructions reported before are updated once more, to let the GUI clear their values
+  for (auto& data : m_data)
+  {
+    if (data.entry.call_count > 0 && !data.is_updated)
+    {
+      m_updated_indexes.push_back(data.entry.instr_idx);
+      data.is_updated = true;
+    }
+    data.entry = InstructionProfileEntry{data.entry.instr_idx};
+    data.is_running = false;
+  }
+  m_call_records.clear();
+  m_dropped_call_record_count = 0;
+  m_has_origin = false;
+}
+
+InstructionProfiler::InstructionData& InstructionProfiler::GetData(std::size_t instr_idx)
+{
+  if (instr_idx >= m_data.size())
+  {
+    const auto previous_size = m_data.size();
+    m_data.resize(instr_idx + 1);
+    for (auto index = previous_size; index < m_data.size(); ++index)
+    {
+      m_data[index].entry.instr_idx = index;
+    }
+  }
+  return m_data[instr_idx];
+}
+
+void InstructionProfiler::StartExecution(InstructionData& data, clock_t::time_point timestamp)
+{
+  if (data.is_running)
+  {
+    return;  // RUNNING might follow NOT_FINISHED within the same execution
+  }
+
+  data.is_running = true;
+  data.start_time = timestamp;
+  if (!m_has_origin)
+  {
+    m_has_origin = true;
+    m_origin = timestamp;
+  }
+}
+
+void InstructionProfiler::FinishExecution(InstructionData& data, clock_t::time_point timestamp)
+{
+  // instruction finished without reporting the start is counted with zero duration
+  const auto start_time = data.is_running ? data.start_time : timestamp;
+  data.is_running = false;
+  if (!m_has_origin)
+  {
+    m_has_origin = true;
+    m_origin = start_time;
+  }
+
+  const auto duration =
+      std::chrono::duration_cast<std::chrono::microseconds>(timestamp - start_time);
+  auto& entry = data.entry;
+  ++entry.call_count;
+  entry.total_time += duration;
+  entry.max_time = std::max(entry.max_time, duration);
+
+  if (!data.is_updated)
+  {
+    m_updated_indexes.push_back(entry.instr_idx);
+    data.is_updated = true;
+  }
+
+  if (m_call_records.size() < m_max_call_record_count)
+  {
+    const auto start_offset =
+        std::chrono::duration_cast<std::chrono::microseconds>(start_time - m_origin);
+    m_call_records.push_back({entry.instr_idx, start_offset, duration});
+  }
+  else
+  {
+    ++m_dropped_call_record_count;
+  }
+}
+
+}  // namespace oac_tree_gui
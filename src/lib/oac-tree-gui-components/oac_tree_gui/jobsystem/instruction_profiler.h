@@ -0,0 +1,141 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_INSTRUCTION_PROFILER_H_
+#define OAC_TREE_GUI_JOBSYSTEM_INSTRUCTION_PROFILER_H_
+
+#include <sup/oac-tree/execution_status.h>
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+/**
+ * @brief The InstructionProfileEntry struct holds accumulated execution times of a single
+ * instruction.
+ *
+ * Times are inclusive, i.e. contain the time spent in children. Self time is derived later, when
+ * the instruction hierarchy is known.
+ */
+struct InstructionProfileEntry
+{
+  std::size_t instr_idx{0};                 //!< domain instruction index
+  std::size_t call_count{0};                //!< number of finished executions
+  std::chrono::microseconds total_time{0};  //!< accumulated duration of all executions
+  std::chrono::microseconds max_time{0};    //!< longest single execution
+};
+
+/**
+ * @brief The InstructionCallRecord struct holds a single execution of an instruction, to build
+ * the timeline.
+ */
+struct InstructionCallRecord
+{
+  std::size_t instr_idx{0};                 //!< domain instruction index
+  std::chrono::microseconds start_time{0};  //!< since the first recorded execution start
+  std::chrono::microseconds duration{0};
+};
+
+/**
+ * @brief The InstructionProfiler class measures how long instructions stay in running state.
+ *
+ * The execution starts when the instruction reports NOT_FINISHED or RUNNING, and finishes when it
+ * reports SUCCESS or FAILURE. The instruction reset to NOT_STARTED abandons the execution in
+ * progress.
+ *
+ * The profiler is not thread-safe. It lives in the GUI thread, and is fed with timestamps taken by
+ * DomainJobObserver in the sequencer thread, when the status change was posted. So the sequencer
+ * thread doesn't pay for profiling, while measured times don't depend on the GUI load.
+ *
+ * The number of stored call records is limited, further records are counted as dropped.
+ * Accumulated times are not affected by the limit.
+ */
+class InstructionProfiler
+{
+public:
+  using clock_t = std::chrono::steady_clock;
+
+  static constexpr std::size_t kDefaultMaxCallRecordCount = 100000;
+
+  explicit InstructionProfiler(std::size_t max_call_record_count = kDefaultMaxCallRecordCount);
+
+  /**
+   * @brief Processes instruction status change.
+   *
+   * @param instr_idx Domain instruction index.
+   * @param status New execution status.
+   * @param timestamp The moment of the status change.
+   */
+  void InstructionStatusUpdated(std::size_t instr_idx, sup::oac_tree::ExecutionStatus status,
+                                clock_t::time_point timestamp);
+
+  /**
+   * @brief Returns entries of instructions finished since the last call.
+   */
+  std::vector<InstructionProfileEntry> TakeUpdatedEntries();
+
+  /**
+   * @brief Returns entries of all instructions executed at least once.
+   */
+  std::vector<InstructionProfileEntry> GetEntries() const;
+
+  /**
+   * @brief Returns recorded executions in the order of their completion.
+   */
+  std::vector<InstructionCallRecord> GetCallRecords() const;
+
+  /**
+   * @brief Returns the number of executions which didn't fit into the call record storage.
+   */
+  std::size_t GetDroppedCallRecordCount() const;
+
+  /**
+   * @brief Forgets all measurements, e.g. before the next run of the same job.
+   */
+  void Reset();
+
+private:
+  struct InstructionData
+  {
+    InstructionProfileEntry entry;
+    clock_t::time_point start_time;
+    bool is_running{false};
+    bool is_updated{false};
+  };
+
+  InstructionData& GetData(std::size_t instr_idx);
+  void StartExecution(InstructionData& data, clock_t::time_point timestamp);
+  void FinishExecution(InstructionData& data, clock_t::time_point timestamp);
+
+  std::size_t m_max_call_record_count{0};
+  std::vector<InstructionData> m_data;         //!< indexed by domain instruction index
+  std::vector<std::size_t> m_updated_indexes;  //!< instructions finished since the last take
+  std::vector<InstructionCallRecord> m_call_records;
+  std::size_t m_dropped_call_record_count{0};
+  bool m_has_origin{false};
+  clock_t::time_point m_origin;  //!< start of the first execution, the timeline origin
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_INSTRUCTION_PROFILER_H_
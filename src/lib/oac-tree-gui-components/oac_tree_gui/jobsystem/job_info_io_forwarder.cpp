@@ -0,0 +1,216 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "job_info_io_forwarder.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+
+namespace oac_tree_gui
+{
+
+JobInfoIOForwarder::~JobInfoIOForwarder()
+{
+  Close();
+}
+
+void JobInfoIOForwarder::SetTarget(sup::oac_tree::IJobInfoIO* target)
+{
+  if (target == nullptr)
+  {
+    throw RuntimeException("Target is not initialised");
+  }
+
+  const std::scoped_lock lock{m_mutex};
+  if (m_target != nullptr)
+  {
+    throw RuntimeException("Target is already attached");
+  }
+  if (m_is_closed)
+  {
+    return;
+  }
+
+  m_target = target;
+  if (m_pending_reports.empty())
+  {
+    m_target_condition.notify_all();
+    return;
+  }
+
+  // reports coming meanwhile are stored, so they don't overtake those being replayed
+  m_is_replaying = true;
+  m_replay_thread = std::thread(&JobInfoIOForwarder::ReplayReports, this);
+}
+
+void JobInfoIOForwarder::Close()
+{
+  std::thread replay_thread;
+  {
+    const std::scoped_lock lock{m_mutex};
+    m_is_closed = true;
+    m_pending_reports.clear();
+    replay_thread = std::move(m_replay_thread);
+  }
+  m_target_condition.notify_all();
+
+  if (replay_thread.joinable())
+  {
+    replay_thread.join();
+  }
+}
+
+std::size_t JobInfoIOForwarder::GetPendingCount() const
+{
+  const std::scoped_lock lock{m_mutex};
+  return m_pending_reports.size();
+}
+
+void JobInfoIOForwarder::InitNumberOfInstructions(sup::dto::uint32 n_instr)
+{
+  Forward([n_instr](auto& target) { target.InitNumberOfInstructions(n_instr); });
+}
+
+void JobInfoIOForwarder::InstructionStateUpdated(sup::dto::uint32 instr_idx,
+                                                 sup::oac_tree::InstructionState state)
+{
+  Forward([instr_idx, state](auto& target) { target.InstructionStateUpdated(instr_idx, state); });
+}
+
+void JobInfoIOForwarder::BreakpointInstructionUpdated(sup::dto::uint32 instr_idx)
+{
+  Forward([instr_idx](auto& target) { target.BreakpointInstructionUpdated(instr_idx); });
+}
+
+void JobInfoIOForwarder::VariableUpdated(sup::dto::uint32 var_idx, const sup::dto::AnyValue& value,
+                                         bool connected)
+{
+  Forward([var_idx, value, connected](auto& target)
+          { target.VariableUpdated(var_idx, value, connected); });
+}
+
+void JobInfoIOForwarder::JobStateUpdated(sup::oac_tree::JobState state)
+{
+  Forward([state](auto& target) { target.JobStateUpdated(state); });
+}
+
+void JobInfoIOForwarder::PutValue(const sup::dto::AnyValue& value, const std::string& description)
+{
+  Forward([value, description](auto& target) { target.PutValue(value, description); });
+}
+
+bool JobInfoIOForwarder::GetUserValue(sup::dto::uint64 id, sup::dto::AnyValue& value,
+                                      const std::string& description)
+{
+  auto target = WaitForTarget();
+  return target != nullptr ? target->GetUserValue(id, value, description) : false;
+}
+
+int JobInfoIOForwarder::GetUserChoice(sup::dto::uint64 id, const std::vector<std::string>& options,
+                                      const sup::dto::AnyValue& metadata)
+{
+  auto target = WaitForTarget();
+  return target != nullptr ? target->GetUserChoice(id, options, metadata) : -1;
+}
+
+void JobInfoIOForwarder::Interrupt(sup::dto::uint64 id)
+{
+  Forward([id](auto& target) { target.Interrupt(id); });
+}
+
+void JobInfoIOForwarder::Message(const std::string& message)
+{
+  Forward([message](auto& target) { target.Message(message); });
+}
+
+void JobInfoIOForwarder::Log(int severity, const std::string& message)
+{
+  Forward([severity, message](auto& target) { target.Log(severity, message); });
+}
+
+void JobInfoIOForwarder::ProcedureTicked()
+{
+  // pacing of ticks makes sense only for the attached target
+  sup::oac_tree::IJobInfoIO* target{nullptr};
+  {
+    const std::scoped_lock lock{m_mutex};
+    target = m_is_closed ? nullptr : m_target;
+  }
+
+  if (target != nullptr)
+  {
+    target->ProcedureTicked();
+  }
+}
+
+void JobInfoIOForwarder::Forward(report_t report)
+{
+  sup::oac_tree::IJobInfoIO* target{nullptr};
+  {
+    const std::scoped_lock lock{m_mutex};
+    if (m_is_closed)
+    {
+      return;
+    }
+
+    if (m_target == nullptr || m_is_replaying)
+    {
+      m_pending_reports.push_back(std::move(report));
+      return;
+    }
+    target = m_target;
+  }
+
+  report(*target);
+}
+
+sup::oac_tree::IJobInfoIO* JobInfoIOForwarder::WaitForTarget()
+{
+  std::unique_lock lock{m_mutex};
+  m_target_condition.wait(
+      lock, [this]() { return m_is_closed || (m_target != nullptr && !m_is_replaying); });
+  return m_is_closed ? nullptr : m_target;
+}
+
+void JobInfoIOForwarder::ReplayReports()
+{
+  std::vector<report_t> reports;
+  while (true)
+  {
+    {
+      const std::scoped_lock lock{m_mutex};
+      if (m_is_closed || m_pending_reports.empty())
+      {
+        m_is_replaying = false;
+        break;
+      }
+      reports.swap(m_pending_reports);
+    }
+
+    // replaying outside of the lock, the target might wait for the GUI thread
+    for (const auto& report : reports)
+    {
+      report(*m_target);
+    }
+    reports.clear();
+  }
+  m_target_condition.notify_all();
+}
+
+}  // namespace oac_tree_gui
@@ -0,0 +1,137 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_JOB_INFO_IO_FORWARDER_H_
+#define OAC_TREE_GUI_JOBSYSTEM_JOB_INFO_IO_FORWARDER_H_
+
+#include <sup/oac-tree/i_job_info_io.h>
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+/**
+ * @brief The JobInfoIOForwarder class forwards reports of the domain job to the target
+ * IJobInfoIO, which can be attached later than the job was created.
+ *
+ * It allows creating a domain job on a background thread, before the GUI objects listening to it
+ * exist. Reports received before the target is attached are stored, and replayed in the original
+ * order on a dedicated thread after attachment. The attaching thread doesn't replay reports itself,
+ * since the target might wait for it, as DomainJobObserver waits for the GUI thread when its event
+ * queue is full. Requests to the user wait till stored reports are replayed, or for the forwarder
+ * to close.
+ *
+ * All methods are thread-safe.
+ */
+class JobInfoIOForwarder : public sup::oac_tree::IJobInfoIO
+{
+public:
+  JobInfoIOForwarder() = default;
+  ~JobInfoIOForwarder() override;
+
+  JobInfoIOForwarder(const JobInfoIOForwarder&) = delete;
+  JobInfoIOForwarder& operator=(const JobInfoIOForwarder&) = delete;
+  JobInfoIOForwarder(JobInfoIOForwarder&&) = delete;
+  JobInfoIOForwarder& operator=(JobInfoIOForwarder&&) = delete;
+
+  /**
+   * @brief Attaches the target, and starts replaying stored reports to it.
+   *
+   * The target should be kept alive till the forwarder is closed.
+   */
+  void SetTarget(sup::oac_tree::IJobInfoIO* target);
+
+  /**
+   * @brief Drops stored reports and releases requests to the user waiting for the target. Further
+   * requests are answered as not processed.
+   *
+   * Waits for the replay of reports already taken from the store. Whatever the target might be
+   * waiting for during the replay should be released beforehand, see DomainEventQueue::Close.
+   */
+  void Close();
+
+  /**
+   * @brief Returns the number of stored reports waiting for the replay.
+   */
+  std::size_t GetPendingCount() const;
+
+  void InitNumberOfInstructions(sup::dto::uint32 n_instr) override;
+
+  void InstructionStateUpdated(sup::dto::uint32 instr_idx,
+                               sup::oac_tree::InstructionState state) override;
+
+  void BreakpointInstructionUpdated(sup::dto::uint32 instr_idx) override;
+
+  void VariableUpdated(sup::dto::uint32 var_idx, const sup::dto::AnyValue& value,
+                       bool connected) override;
+
+  void JobStateUpdated(sup::oac_tree::JobState state) override;
+
+  void PutValue(const sup::dto::AnyValue& value, const std::string& description) override;
+
+  bool GetUserValue(sup::dto::uint64 id, sup::dto::AnyValue& value,
+                    const std::string& description) override;
+
+  int GetUserChoice(sup::dto::uint64 id, const std::vector<std::string>& options,
+                    const sup::dto::AnyValue& metadata) override;
+
+  void Interrupt(sup::dto::uint64 id) override;
+
+  void Message(const std::string& message) override;
+
+  void Log(int severity, const std::string& message) override;
+
+  void ProcedureTicked() override;
+
+private:
+  using report_t = std::function<void(sup::oac_tree::IJobInfoIO&)>;
+
+  /**
+   * @brief Forwards the report to the target, or stores it till the target is attached.
+   */
+  void Forward(report_t report);
+
+  /**
+   * @brief Waits for the target, returns nullptr if the forwarder was closed.
+   */
+  sup::oac_tree::IJobInfoIO* WaitForTarget();
+
+  /**
+   * @brief Passes stored reports to the target till there are no more. Runs on the replay thread.
+   */
+  void ReplayReports();
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_target_condition;
+  sup::oac_tree::IJobInfoIO* m_target{nullptr};
+  std::vector<report_t> m_pending_reports;
+  bool m_is_replaying{false};  //!< new reports are stored while stored ones are being replayed
+  bool m_is_closed{false};
+  std::thread m_replay_thread;
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_JOB_INFO_IO_FORWARDER_H_
@@ -69,4 +69,18 @@ std::string ToString(Severity severity)
   return iter->second;
 }
 
+Severity GetSeverity(const std::string& name)
+{
+  static const auto severity_map = CreateSeverityMap();
+  for (const auto& [severity, severity_name] : severity_map)
+  {
+    if (severity_name == name)
+    {
+      return severity;
+    }
+  }
+
+  throw RuntimeException("Unknown severity name [" + name + "]");
+}
+
 }  // namespace oac_tree_gui
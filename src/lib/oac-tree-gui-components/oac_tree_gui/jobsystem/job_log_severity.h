@@ -23,6 +23,7 @@
 
 //! Provide log severity levels and accompanying utility functions.
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -44,8 +45,14 @@ enum class Severity : std::uint8_t
   kTrace
 };
 
+//! Number of severity levels.
+constexpr std::size_t kSeverityCount = static_cast<std::size_t>(Severity::kTrace) + 1;
+
 std::string ToString(Severity severity);
 
+//! Returns severity from its string representation. Throws if the name is unknown.
+Severity GetSeverity(const std::string& name);
+
 }  // namespace oac_tree_gui
 
 #endif  // OAC_TREE_GUI_JOBSYSTEM_JOB_LOG_SEVERITY_H_
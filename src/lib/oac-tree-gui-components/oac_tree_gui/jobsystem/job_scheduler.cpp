@@ -0,0 +1,143 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "job_scheduler.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace oac_tree_gui
+{
+
+std::size_t GetDefaultMaxRunningJobCount()
+{
+  // hardware_concurrency may return 0 if the value is not computable
+  return std::max(1U, std::thread::hardware_concurrency());
+}
+
+JobScheduler::JobScheduler(std::size_t max_running_count) : m_max_running_count(max_running_count)
+{
+}
+
+std::size_t JobScheduler::GetMaxRunningCount() const
+{
+  return m_max_running_count;
+}
+
+void JobScheduler::SetMaxRunningCount(std::size_t max_running_count)
+{
+  m_max_running_count = max_running_count;
+}
+
+bool JobScheduler::RequestStart(IJobHandler* job, int priority)
+{
+  if (IsAdmitted(job))
+  {
+    return true;
+  }
+
+  if (IsQueued(job))
+  {
+    return false;
+  }
+
+  if (HasFreeSlot())
+  {
+    (void)m_admitted_jobs.insert(job);
+    return true;
+  }
+
+  // negated priority puts more important jobs at the beginning of the map
+  m_queue_index[job] = m_queue.emplace(queue_key_t{-priority, m_request_count++}, job).first;
+  return false;
+}
+
+bool JobScheduler::Release(IJobHandler* job)
+{
+  (void)Cancel(job);
+  return m_admitted_jobs.erase(job) > 0;
+}
+
+bool JobScheduler::Cancel(IJobHandler* job)
+{
+  auto pos = m_queue_index.find(job);
+  if (pos == m_queue_index.end())
+  {
+    return false;
+  }
+
+  (void)m_queue.erase(pos->second);
+  (void)m_queue_index.erase(pos);
+  return true;
+}
+
+std::vector<IJobHandler*> JobScheduler::CancelAll()
+{
+  std::vector<IJobHandler*> result;
+  result.reserve(m_queue.size());
+  for (const auto& element : m_queue)
+  {
+    result.push_back(element.second);
+  }
+
+  m_queue.clear();
+  m_queue_index.clear();
+  return result;
+}
+
+std::vector<IJobHandler*> JobScheduler::TakeReadyJobs()
+{
+  std::vector<IJobHandler*> result;
+  while (!m_queue.empty() && HasFreeSlot())
+  {
+    auto job = m_queue.begin()->second;
+    (void)Cancel(job);
+    (void)m_admitted_jobs.insert(job);
+    result.push_back(job);
+  }
+  return result;
+}
+
+bool JobScheduler::IsAdmitted(const IJobHandler* job) const
+{
+  return m_admitted_jobs.find(job) != m_admitted_jobs.end();
+}
+
+bool JobScheduler::IsQueued(const IJobHandler* job) const
+{
+  return m_queue_index.find(job) != m_queue_index.end();
+}
+
+std::size_t JobScheduler::GetRunningCount() const
+{
+  return m_admitted_jobs.size();
+}
+
+std::size_t JobScheduler::GetQueuedCount() const
+{
+  return m_queue.size();
+}
+
+bool JobScheduler::HasFreeSlot() const
+{
+  return m_max_running_count == 0 || m_admitted_jobs.size() < m_max_running_count;
+}
+
+}  // namespace oac_tree_gui
@@ -0,0 +1,126 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_JOB_SCHEDULER_H_
+#define OAC_TREE_GUI_JOBSYSTEM_JOB_SCHEDULER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+class IJobHandler;
+
+/**
+ * @brief Returns the default number of concurrently running jobs, which is the number of cores.
+ */
+std::size_t GetDefaultMaxRunningJobCount();
+
+/**
+ * @brief The JobScheduler class limits the number of concurrently running jobs.
+ *
+ * A job requesting to start is either admitted immediately, when the number of admitted jobs is
+ * below the limit, or queued. Queued jobs with higher priority are admitted first, jobs with equal
+ * priority are admitted in the order of requests. The scheduler doesn't start jobs itself: the
+ * owner starts admitted jobs, and releases them when they finish, taking the next ready jobs from
+ * the queue.
+ */
+class JobScheduler
+{
+public:
+  /**
+   * @brief Main c-tor.
+   *
+   * @param max_running_count Maximum number of admitted jobs, 0 means no limit.
+   */
+  explicit JobScheduler(std::size_t max_running_count = GetDefaultMaxRunningJobCount());
+
+  std::size_t GetMaxRunningCount() const;
+
+  /**
+   * @brief Sets maximum number of admitted jobs.
+   *
+   * Raising the limit doesn't admit queued jobs, call TakeReadyJobs for that.
+   */
+  void SetMaxRunningCount(std::size_t max_running_count);
+
+  /**
+   * @brief Requests the job to start.
+   *
+   * @return True if the job is admitted and can be started now, false if it has been queued.
+   */
+  bool RequestStart(IJobHandler* job, int priority = 0);
+
+  /**
+   * @brief Removes the job from the scheduler, whether it was admitted or queued.
+   *
+   * @return True if the job has freed the slot of an admitted job.
+   */
+  bool Release(IJobHandler* job);
+
+  /**
+   * @brief Removes the job from the queue.
+   *
+   * @return True if the job was queued.
+   */
+  bool Cancel(IJobHandler* job);
+
+  /**
+   * @brief Removes all jobs from the queue and returns them in the order they would be admitted.
+   */
+  std::vector<IJobHandler*> CancelAll();
+
+  /**
+   * @brief Admits queued jobs while there are free slots, and returns them in the order of
+   * admission.
+   */
+  std::vector<IJobHandler*> TakeReadyJobs();
+
+  bool IsAdmitted(const IJobHandler* job) const;
+
+  bool IsQueued(const IJobHandler* job) const;
+
+  std::size_t GetRunningCount() const;
+
+  std::size_t GetQueuedCount() const;
+
+private:
+  bool HasFreeSlot() const;
+
+  //!< queue order: higher priority first, then order of requests
+  using queue_key_t = std::pair<int, std::uint64_t>;
+  using queue_t = std::map<queue_key_t, IJobHandler*>;
+
+  std::size_t m_max_running_count{0};
+  std::uint64_t m_request_count{0};  //!< sequence number of the next request
+  std::unordered_set<const IJobHandler*> m_admitted_jobs;
+  queue_t m_queue;
+  std::unordered_map<const IJobHandler*, queue_t::iterator> m_queue_index;
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_JOB_SCHEDULER_H_
@@ -20,6 +20,8 @@
 
 #include "job_utils.h"
 
+#include <oac_tree_gui/model/job_item.h>
+
 #include <numeric>
 
 namespace oac_tree_gui
@@ -34,4 +36,13 @@ std::string GetRegExpPattern(const std::vector<std::string>& data)
              : "(" + std::accumulate(std::next(data.begin()), data.end(), data[0], fold) + ")";
 }
 
+LogFloodOptions CreateLogFloodOptions(const JobItem& job_item)
+{
+  LogFloodOptions result;
+  result.severity_threshold = GetSeverity(job_item.GetLogSeverityThreshold());
+  result.max_message_rate = job_item.GetLogRateLimit();
+  result.fold_duplicates = job_item.IsLogFoldDuplicates();
+  return result;
+}
+
 }  // namespace oac_tree_gui
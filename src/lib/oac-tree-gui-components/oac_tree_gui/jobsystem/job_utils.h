@@ -24,16 +24,23 @@
 //! @file
 //! Collection of various utility functions for job execution.
 
+#include <oac_tree_gui/jobsystem/log_flood_filter.h>
+
 #include <string>
 #include <vector>
 
 namespace oac_tree_gui
 {
 
+class JobItem;
+
 //! Returns reg-exp pattern for vector with labels.
 //! example: {"INFO", "DEBUG"} -> "(INFO|DEBUG)"
 std::string GetRegExpPattern(const std::vector<std::string>& data);
 
+//! Returns options to suppress excessive log messages, as defined by the job.
+LogFloodOptions CreateLogFloodOptions(const JobItem& job_item);
+
 }  // namespace oac_tree_gui
 
 #endif  // OAC_TREE_GUI_JOBSYSTEM_JOB_UTILS_H_
@@ -28,10 +28,29 @@
 namespace oac_tree_gui
 {
 
+namespace
+{
+
+/**
+ * @brief Returns options of the event queue.
+ *
+ * Several producers are required: besides the sequencer thread, events are posted by threads of
+ * parallel instructions, and by workspace callbacks reporting variable updates.
+ */
+DomainEventQueueOptions CreateQueueOptions()
+{
+  DomainEventQueueOptions result;
+  result.producer_mode = ProducerMode::kMultiple;
+  return result;
+}
+
+}  // namespace
+
 LocalDomainRunner::LocalDomainRunner(DomainEventDispatcherContext dispatcher_context,
                                      UserContext user_context,
                                      std::unique_ptr<procedure_t> procedure)
-    : AbstractDomainRunner(std::move(dispatcher_context), std::move(user_context))
+    : AbstractDomainRunner(std::move(dispatcher_context), std::move(user_context),
+                           CreateQueueOptions())
 {
   SetDomainJob(std::make_unique<sup::oac_tree::LocalJob>(std::move(procedure), *GetJobInfoIO()));
 }
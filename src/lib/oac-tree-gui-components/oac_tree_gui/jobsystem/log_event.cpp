@@ -20,8 +20,7 @@
 
 #include "log_event.h"
 
-#include <QDate>
-#include <QTime>
+#include <QDateTime>
 
 namespace oac_tree_gui
 {
@@ -29,7 +28,7 @@ namespace oac_tree_gui
 bool LogEvent::operator==(const LogEvent& other) const
 {
   return (source == other.source) && (severity == other.severity) && (date == other.date)
-         && (time == other.time) && (message == other.message);
+         && (time == other.time) && (message == other.message) && (timestamp == other.timestamp);
 }
 
 bool LogEvent::operator!=(const LogEvent& other) const
@@ -39,10 +38,34 @@ bool LogEvent::operator!=(const LogEvent& other) const
 
 LogEvent CreateLogEvent(Severity severity, const std::string& message)
 {
-  auto date = QDate::currentDate().toString("yyyy.MM.dd").toStdString();
-  auto time = QTime::currentTime().toString("hh:mm:ss.zzz").toStdString();
+  // date and time strings are formatted later, when the message is about to be shown
+  LogEvent result;
+  result.severity = severity;
+  result.message = message;
+  result.timestamp = QDateTime::currentMSecsSinceEpoch();
+  return result;
+}
 
-  return {date, time, severity, std::string(), message};
+std::string GetLogEventDate(const LogEvent& log_event)
+{
+  if (!log_event.date.empty())
+  {
+    return log_event.date;
+  }
+  return QDateTime::fromMSecsSinceEpoch(log_event.timestamp)
+      .toString(QString::fromStdString(GetLogEventDateFormat()))
+      .toStdString();
+}
+
+std::string GetLogEventTime(const LogEvent& log_event)
+{
+  if (!log_event.time.empty())
+  {
+    return log_event.time;
+  }
+  return QDateTime::fromMSecsSinceEpoch(log_event.timestamp)
+      .toString(QString::fromStdString(GetLogEventTimeFormat()))
+      .toStdString();
 }
 
 std::string GetLogEventDateFormat()
@@ -23,12 +23,16 @@
 
 #include <oac_tree_gui/jobsystem/job_log_severity.h>
 
+#include <chrono>
+#include <cstdint>
 #include <string>
 
 namespace oac_tree_gui
 {
 
 //! Represents a log event during sequencer procedure execution.
+//! Events created during job execution carry the timestamp only, date and time strings are
+//! empty and are formatted on demand. Explicitly provided date and time take precedence.
 struct LogEvent
 {
   std::string date;                       //!< date of the message in the format yyyy-mm-dd
@@ -36,6 +40,10 @@ struct LogEvent
   Severity severity = Severity::kNotice;  //!< log message severity level
   std::string source;                     //!< source of the message
   std::string message;                    //!< text of the message
+  std::int64_t timestamp{0};              //!< moment of the message, msec since epoch
+
+  //!< moment of posting by the observer, doesn't participate in comparison
+  std::chrono::steady_clock::time_point post_time{};
 
   bool operator==(const LogEvent& other) const;
   bool operator!=(const LogEvent& other) const;
@@ -44,6 +52,12 @@ struct LogEvent
 //! Creates log event for the current moment of time with a given severity level and message text.
 LogEvent CreateLogEvent(Severity severity, const std::string& message);
 
+//! Returns date of the log event. Formats timestamp, if the date string is empty.
+std::string GetLogEventDate(const LogEvent& log_event);
+
+//! Returns time of the log event. Formats timestamp, if the time string is empty.
+std::string GetLogEventTime(const LogEvent& log_event);
+
 //! Returns format used for the date accross the wphole app.
 //! For the moment using "yyyy.MM.dd".
 std::string GetLogEventDateFormat();
@@ -0,0 +1,183 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "log_flood_filter.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+
+namespace oac_tree_gui
+{
+
+namespace
+{
+
+/**
+ * @brief Duration of the rate limit window, and the interval between reports of repetitions of
+ * the same message.
+ */
+const std::chrono::seconds kReportInterval{1};
+
+}  // namespace
+
+LogFloodFilter::LogFloodFilter(post_message_callback_t post_message_callback,
+                               const LogFloodOptions& options)
+    : m_post_message_callback(std::move(post_message_callback))
+{
+  if (!m_post_message_callback)
+  {
+    throw RuntimeException("Callback is not initialised");
+  }
+  SetOptions(options);
+}
+
+void LogFloodFilter::SetOptions(const LogFloodOptions& options)
+{
+  const std::scoped_lock lock{m_mutex};
+  m_options = options;
+  m_severity_threshold.store(static_cast<int>(options.severity_threshold));
+}
+
+LogFloodOptions LogFloodFilter::GetOptions() const
+{
+  const std::scoped_lock lock{m_mutex};
+  return m_options;
+}
+
+bool LogFloodFilter::AcceptSeverity(Severity severity)
+{
+  if (static_cast<int>(severity) > m_severity_threshold.load(std::memory_order_relaxed))
+  {
+    m_below_threshold_count.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+void LogFloodFilter::ProcessMessage(Severity severity, const std::string& message,
+                                    clock_t::time_point now)
+{
+  message_list_t messages;
+
+  {
+    const std::scoped_lock lock{m_mutex};
+
+    if (m_options.fold_duplicates && m_has_last_message && severity == m_last_severity
+        && message == m_last_message)
+    {
+      ++m_repeat_count;
+      ++m_statistics.folded_duplicate_count;
+
+      // endless repetition is reported periodically, not only when another message arrives
+      if (now - m_last_post_time >= kReportInterval)
+      {
+        ReportRepeatCount(messages);
+        m_last_post_time = now;
+      }
+    }
+    else
+    {
+      ReportRepeatCount(messages);
+
+      if (now - m_window_start >= kReportInterval)
+      {
+        ReportRateLimitedCount(messages);
+        m_window_start = now;
+        m_window_message_count = 0;
+      }
+
+      if (m_options.max_message_rate > 0 && m_window_message_count >= m_options.max_message_rate)
+      {
+        ++m_window_suppressed_count;
+        ++m_statistics.rate_limited_count;
+      }
+      else
+      {
+        ++m_window_message_count;
+        messages.emplace_back(severity, message);
+
+        m_has_last_message = m_options.fold_duplicates;
+        if (m_has_last_message)
+        {
+          m_last_severity = severity;
+          m_last_message = message;
+        }
+        m_last_post_time = now;
+      }
+    }
+  }
+
+  // posting outside of the lock, since the event queue might wait for the GUI thread
+  PostMessages(messages);
+}
+
+void LogFloodFilter::Flush()
+{
+  message_list_t messages;
+
+  {
+    const std::scoped_lock lock{m_mutex};
+    ReportRepeatCount(messages);
+    ReportRateLimitedCount(messages);
+  }
+
+  PostMessages(messages);
+}
+
+LogFloodStatistics LogFloodFilter::GetStatistics() const
+{
+  const std::scoped_lock lock{m_mutex};
+  auto result = m_statistics;
+  result.below_threshold_count = m_below_threshold_count.load();
+  return result;
+}
+
+void LogFloodFilter::ReportRepeatCount(message_list_t& messages)
+{
+  if (m_repeat_count == 0)
+  {
+    return;
+  }
+
+  messages.emplace_back(m_last_severity,
+                        "Last message repeated " + std::to_string(m_repeat_count) + " times");
+  m_repeat_count = 0;
+}
+
+void LogFloodFilter::ReportRateLimitedCount(message_list_t& messages)
+{
+  if (m_window_suppressed_count == 0)
+  {
+    return;
+  }
+
+  messages.emplace_back(Severity::kWarning, std::to_string(m_window_suppressed_count)
+                                                + " log messages suppressed by rate limit");
+  m_window_suppressed_count = 0;
+}
+
+void LogFloodFilter::PostMessages(const message_list_t& messages)
+{
+  for (const auto& [severity, message] : messages)
+  {
+    m_post_message_callback(severity, message);
+  }
+}
+
+}  // namespace oac_tree_gui
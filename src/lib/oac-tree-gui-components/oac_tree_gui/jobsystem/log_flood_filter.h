@@ -0,0 +1,147 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_LOG_FLOOD_FILTER_H_
+#define OAC_TREE_GUI_JOBSYSTEM_LOG_FLOOD_FILTER_H_
+
+#include <oac_tree_gui/jobsystem/job_log_severity.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+/**
+ * @brief The LogFloodOptions struct holds options to protect the GUI from excessive logging.
+ */
+struct LogFloodOptions
+{
+  Severity severity_threshold{Severity::kTrace};  //!< less important messages are dropped
+  std::size_t max_message_rate{0};                //!< messages per second, 0 means no limit
+  bool fold_duplicates{false};  //!< consecutive identical messages are reported once with count
+};
+
+/**
+ * @brief The LogFloodStatistics struct holds the number of log messages suppressed by
+ * LogFloodFilter.
+ */
+struct LogFloodStatistics
+{
+  std::size_t below_threshold_count{0};   //!< messages less important than the threshold
+  std::size_t rate_limited_count{0};      //!< messages exceeding the rate limit
+  std::size_t folded_duplicate_count{0};  //!< messages identical to the previous one
+};
+
+/**
+ * @brief The LogFloodFilter class suppresses log messages coming from the sequencer at a too high
+ * rate.
+ *
+ * Accepted messages are reported to the callback. Messages below the severity threshold are
+ * dropped. Consecutive identical messages are folded and reported once with the number of
+ * repetitions. Messages exceeding the rate limit within a one-second window are dropped, and the
+ * number of dropped messages is reported when the next window begins.
+ *
+ * The severity check is lock free, to make suppressed messages cheap for the calling thread. The
+ * callback is called outside of the lock, since posting might wait for the GUI thread, which
+ * might be asking for statistics at the same time.
+ */
+class LogFloodFilter
+{
+public:
+  using clock_t = std::chrono::steady_clock;
+  using post_message_callback_t = std::function<void(Severity, const std::string&)>;
+
+  explicit LogFloodFilter(post_message_callback_t post_message_callback,
+                          const LogFloodOptions& options = {});
+
+  void SetOptions(const LogFloodOptions& options);
+
+  LogFloodOptions GetOptions() const;
+
+  /**
+   * @brief Checks if the message with the given severity passes the threshold.
+   *
+   * Rejected messages are counted, no further processing is required for them.
+   */
+  bool AcceptSeverity(Severity severity);
+
+  /**
+   * @brief Applies duplicate folding and rate limiting to the message, and reports it if it is
+   * accepted.
+   *
+   * The severity threshold has to be checked beforehand with AcceptSeverity.
+   */
+  void ProcessMessage(Severity severity, const std::string& message,
+                      clock_t::time_point now = clock_t::now());
+
+  /**
+   * @brief Reports summaries of all messages suppressed so far.
+   */
+  void Flush();
+
+  LogFloodStatistics GetStatistics() const;
+
+private:
+  using message_list_t = std::vector<std::pair<Severity, std::string>>;
+
+  /**
+   * @brief Adds the report about the number of repetitions of the last message, if any.
+   */
+  void ReportRepeatCount(message_list_t& messages);
+
+  /**
+   * @brief Adds the report about the number of messages suppressed by rate limit, if any.
+   */
+  void ReportRateLimitedCount(message_list_t& messages);
+
+  /**
+   * @brief Passes collected messages to the callback. Must be called without the lock.
+   */
+  void PostMessages(const message_list_t& messages);
+
+  post_message_callback_t m_post_message_callback;
+  std::atomic<int> m_severity_threshold{0};
+  std::atomic<std::size_t> m_below_threshold_count{0};
+
+  mutable std::mutex m_mutex;  //!< protects everything below
+  LogFloodOptions m_options;
+  LogFloodStatistics m_statistics;
+
+  bool m_has_last_message{false};  //!< the last reported message is stored for folding
+  Severity m_last_severity{Severity::kInfo};
+  std::string m_last_message;
+  std::size_t m_repeat_count{0};         //!< repetitions of the last message not reported yet
+  clock_t::time_point m_last_post_time;  //!< time when the last message or summary was reported
+
+  clock_t::time_point m_window_start;        //!< start of the current rate limit window
+  std::size_t m_window_message_count{0};     //!< messages reported within the current window
+  std::size_t m_window_suppressed_count{0};  //!< messages suppressed within the current window
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_LOG_FLOOD_FILTER_H_
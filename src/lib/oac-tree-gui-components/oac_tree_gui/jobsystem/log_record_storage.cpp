@@ -0,0 +1,152 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "log_record_storage.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace oac_tree_gui
+{
+
+namespace
+{
+
+//! Size of a single memory chunk of the message arena. Longer messages get their own chunk.
+const std::size_t kArenaChunkSize = 64 * 1024;
+
+}  // namespace
+
+LogEvent ToLogEvent(const LogRecordView& record)
+{
+  LogEvent result;
+  result.date = std::string(record.date);
+  result.time = std::string(record.time);
+  result.severity = record.severity;
+  result.source = std::string(record.source);
+  result.message = std::string(record.message);
+  result.timestamp = record.timestamp;
+  return result;
+}
+
+LogRecordStorage::LogRecordStorage()
+{
+  Clear();
+}
+
+LogRecordStorage::~LogRecordStorage() = default;
+
+void LogRecordStorage::Append(const LogEvent& log_event)
+{
+  Record record;
+  record.timestamp = log_event.timestamp;
+  record.message = CopyToArena(log_event.message);
+  record.message_size = static_cast<std::uint32_t>(log_event.message.size());
+  record.source_id = GetStringId(log_event.source);
+  record.date_id = GetStringId(log_event.date);
+  record.time_id = GetStringId(log_event.time);
+  record.severity = log_event.severity;
+  m_records.push_back(record);
+}
+
+void LogRecordStorage::Clear()
+{
+  m_records.clear();
+  m_records.shrink_to_fit();
+  m_string_ids.clear();
+  m_strings.clear();
+  m_chunks.clear();
+  m_chunk_sizes.clear();
+  m_chunk_used = 0;
+
+  (void)GetStringId(std::string());
+}
+
+std::size_t LogRecordStorage::GetSize() const
+{
+  return m_records.size();
+}
+
+LogRecordView LogRecordStorage::GetRecord(std::size_t index) const
+{
+  const auto& record = m_records.at(index);
+  return {record.timestamp,
+          record.severity,
+          *m_strings[record.source_id],
+          std::string_view(record.message, record.message_size),
+          *m_strings[record.date_id],
+          *m_strings[record.time_id]};
+}
+
+LogEvent LogRecordStorage::GetEvent(std::size_t index) const
+{
+  return ToLogEvent(GetRecord(index));
+}
+
+std::size_t LogRecordStorage::GetAllocatedSize() const
+{
+  std::size_t result = m_records.capacity() * sizeof(Record);
+  for (const auto& str : m_strings)
+  {
+    result += sizeof(std::string) + str->capacity();
+  }
+  for (auto chunk_size : m_chunk_sizes)
+  {
+    result += chunk_size;
+  }
+  return result;
+}
+
+std::uint32_t LogRecordStorage::GetStringId(const std::string& str)
+{
+  auto iter = m_string_ids.find(str);
+  if (iter != m_string_ids.end())
+  {
+    return iter->second;
+  }
+
+  const auto result = static_cast<std::uint32_t>(m_strings.size());
+  m_strings.push_back(std::make_unique<std::string>(str));
+  m_string_ids.emplace(*m_strings.back(), result);
+  return result;
+}
+
+const char* LogRecordStorage::CopyToArena(const std::string& text)
+{
+  if (text.empty())
+  {
+    return nullptr;
+  }
+
+  if (m_chunks.empty() || m_chunk_used + text.size() > m_chunk_sizes.back())
+  {
+    const auto chunk_size = std::max(kArenaChunkSize, text.size());
+    m_chunks.push_back(std::make_unique<char[]>(chunk_size));
+    m_chunk_sizes.push_back(chunk_size);
+    m_chunk_used = 0;
+  }
+
+  char* result = m_chunks.back().get() + m_chunk_used;
+  std::memcpy(result, text.data(), text.size());
+  m_chunk_used += text.size();
+  return result;
+}
+
+}  // namespace oac_tree_gui
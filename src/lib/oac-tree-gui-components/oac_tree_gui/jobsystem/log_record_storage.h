@@ -0,0 +1,138 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_LOG_RECORD_STORAGE_H_
+#define OAC_TREE_GUI_JOBSYSTEM_LOG_RECORD_STORAGE_H_
+
+#include <oac_tree_gui/jobsystem/log_event.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+/**
+ * @brief The LogRecordView struct gives read-only access to a single record of LogRecordStorage.
+ *
+ * String views remain valid until the storage is cleared.
+ */
+struct LogRecordView
+{
+  std::int64_t timestamp{0};              //!< moment of the message, msec since epoch
+  Severity severity = Severity::kNotice;  //!< log message severity level
+  std::string_view source;                //!< source of the message
+  std::string_view message;               //!< text of the message
+  std::string_view date;                  //!< explicitly provided date, normally empty
+  std::string_view time;                  //!< explicitly provided time, normally empty
+};
+
+/**
+ * @brief Creates log event from the record view.
+ */
+LogEvent ToLogEvent(const LogRecordView& record);
+
+/**
+ * @brief The LogRecordStorage class holds log events in a compact form.
+ *
+ * Each record is stored as a timestamp, a severity byte and identifiers of interned strings for
+ * the source. The message text is copied into large memory chunks shared by many records, so
+ * there is no per-message heap allocation. Explicitly provided date and time strings are interned
+ * as well, events created during job execution don't have them.
+ */
+class LogRecordStorage
+{
+public:
+  LogRecordStorage();
+  ~LogRecordStorage();
+
+  LogRecordStorage(const LogRecordStorage&) = delete;
+  LogRecordStorage& operator=(const LogRecordStorage&) = delete;
+
+  /**
+   * @brief Appends log event at the end of the storage.
+   */
+  void Append(const LogEvent& log_event);
+
+  /**
+   * @brief Removes all records and releases memory.
+   */
+  void Clear();
+
+  /**
+   * @brief Returns number of records.
+   */
+  std::size_t GetSize() const;
+
+  /**
+   * @brief Returns the view on the record with the given index.
+   */
+  LogRecordView GetRecord(std::size_t index) const;
+
+  /**
+   * @brief Reconstructs the log event with the given index.
+   */
+  LogEvent GetEvent(std::size_t index) const;
+
+  /**
+   * @brief Returns the number of bytes allocated for records, strings and message text.
+   */
+  std::size_t GetAllocatedSize() const;
+
+private:
+  struct Record
+  {
+    std::int64_t timestamp{0};
+    const char* message{nullptr};
+    std::uint32_t message_size{0};
+    std::uint32_t source_id{0};
+    std::uint32_t date_id{0};
+    std::uint32_t time_id{0};
+    Severity severity = Severity::kNotice;
+  };
+
+  /**
+   * @brief Returns identifier of the given string, registers the string if necessary.
+   *
+   * Identifier 0 always corresponds to the empty string.
+   */
+  std::uint32_t GetStringId(const std::string& str);
+
+  /**
+   * @brief Copies the text into the message arena and returns the pointer to the copy.
+   */
+  const char* CopyToArena(const std::string& text);
+
+  std::vector<Record> m_records;
+  std::vector<std::unique_ptr<std::string>> m_strings;  //!< interned strings, stable addresses
+  std::unordered_map<std::string_view, std::uint32_t> m_string_ids;
+  std::vector<std::unique_ptr<char[]>> m_chunks;  //!< message arena
+  std::vector<std::size_t> m_chunk_sizes;         //!< capacities of arena chunks
+  std::size_t m_chunk_used{0};                    //!< number of bytes used in the last chunk
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_LOG_RECORD_STORAGE_H_
@@ -0,0 +1,167 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "log_search_index.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+
+namespace oac_tree_gui
+{
+
+namespace
+{
+
+char ToLower(char ch)
+{
+  return static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+}
+
+std::uint32_t GetTrigram(std::string_view text, std::size_t pos)
+{
+  return (static_cast<std::uint32_t>(static_cast<unsigned char>(ToLower(text[pos]))) << 16)
+         | (static_cast<std::uint32_t>(static_cast<unsigned char>(ToLower(text[pos + 1]))) << 8)
+         | static_cast<std::uint32_t>(static_cast<unsigned char>(ToLower(text[pos + 2])));
+}
+
+}  // namespace
+
+void LogSearchIndex::AddRecord(int index, std::string_view text)
+{
+  for (std::size_t pos = 0; pos + kMinQueryLength <= text.size(); ++pos)
+  {
+    auto& postings = m_postings[GetTrigram(text, pos)];
+    if (postings.empty() || postings.back() != index)
+    {
+      postings.push_back(index);
+    }
+  }
+}
+
+void LogSearchIndex::RemoveRecordsBefore(int index)
+{
+  for (auto it = m_postings.begin(); it != m_postings.end();)
+  {
+    auto& postings = it->second;
+    postings.erase(postings.begin(), std::lower_bound(postings.begin(), postings.end(), index));
+    if (postings.empty())
+    {
+      it = m_postings.erase(it);
+    }
+    else
+    {
+      if (postings.capacity() > 2 * postings.size())
+      {
+        postings.shrink_to_fit();
+      }
+      ++it;
+    }
+  }
+}
+
+void LogSearchIndex::Clear()
+{
+  m_postings.clear();
+}
+
+std::vector<int> LogSearchIndex::GetCandidates(std::string_view query) const
+{
+  if (query.size() < kMinQueryLength)
+  {
+    return {};
+  }
+
+  std::vector<const std::vector<int>*> lists;
+  for (std::size_t pos = 0; pos + kMinQueryLength <= query.size(); ++pos)
+  {
+    auto iter = m_postings.find(GetTrigram(query, pos));
+    if (iter == m_postings.end())
+    {
+      return {};  // one of trigrams is never seen
+    }
+    lists.push_back(&iter->second);
+  }
+
+  // starting from the shortest list, the rest is checked with binary search
+  std::sort(lists.begin(), lists.end(),
+            [](const auto* lhs, const auto* rhs) { return lhs->size() < rhs->size(); });
+
+  std::vector<int> result;
+  for (auto index : *lists.front())
+  {
+    auto in_list = [index](const auto* list)
+    { return std::binary_search(list->begin(), list->end(), index); };
+    if (std::all_of(std::next(lists.begin()), lists.end(), in_list))
+    {
+      result.push_back(index);
+    }
+  }
+  return result;
+}
+
+std::size_t LogSearchIndex::GetTrigramCount() const
+{
+  return m_postings.size();
+}
+
+LogTrigramFilter LogSearchIndex::CreateTrigramFilter() const
+{
+  LogTrigramFilter result;
+  result.m_trigrams.reserve(m_postings.size());
+  for (const auto& [trigram, postings] : m_postings)
+  {
+    (void)result.m_trigrams.insert(trigram);
+  }
+  return result;
+}
+
+void LogTrigramFilter::AddText(std::string_view text)
+{
+  for (std::size_t pos = 0; pos + LogSearchIndex::kMinQueryLength <= text.size(); ++pos)
+  {
+    (void)m_trigrams.insert(GetTrigram(text, pos));
+  }
+}
+
+bool LogTrigramFilter::MayContain(std::string_view query) const
+{
+  for (std::size_t pos = 0; pos + LogSearchIndex::kMinQueryLength <= query.size(); ++pos)
+  {
+    if (m_trigrams.count(GetTrigram(query, pos)) == 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::size_t LogTrigramFilter::GetTrigramCount() const
+{
+  return m_trigrams.size();
+}
+
+bool ContainsIgnoreCase(std::string_view text, std::string_view query)
+{
+  auto equal = [](char lhs, char rhs) { return ToLower(lhs) == ToLower(rhs); };
+  return std::search(text.begin(), text.end(), query.begin(), query.end(), equal) != text.end();
+}
+
+}  // namespace oac_tree_gui
@@ -0,0 +1,128 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_LOG_SEARCH_INDEX_H_
+#define OAC_TREE_GUI_JOBSYSTEM_LOG_SEARCH_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+class LogTrigramFilter;
+
+/**
+ * @brief The LogSearchIndex class is an inverted trigram index over log messages.
+ *
+ * For every sequence of three characters (case-insensitive) the index holds the list of record
+ * indices containing it. A substring query returns the intersection of lists of all query
+ * trigrams: a small superset of matching records, which has to be verified by the caller.
+ */
+class LogSearchIndex
+{
+public:
+  /**
+   * @brief Minimum query length the index can narrow down.
+   */
+  static constexpr std::size_t kMinQueryLength = 3;
+
+  /**
+   * @brief Adds text of the record with the given index.
+   *
+   * Records are expected to be added in the ascending order of indices.
+   */
+  void AddRecord(int index, std::string_view text);
+
+  /**
+   * @brief Removes all records with indices less than the given one.
+   */
+  void RemoveRecordsBefore(int index);
+
+  /**
+   * @brief Removes all records from the index.
+   */
+  void Clear();
+
+  /**
+   * @brief Returns indices of records which might contain the query, in ascending order.
+   *
+   * The query should have at least kMinQueryLength characters.
+   */
+  std::vector<int> GetCandidates(std::string_view query) const;
+
+  /**
+   * @brief Returns the number of distinct trigrams in the index.
+   */
+  std::size_t GetTrigramCount() const;
+
+  /**
+   * @brief Creates the filter with all trigrams of the index.
+   */
+  LogTrigramFilter CreateTrigramFilter() const;
+
+private:
+  std::unordered_map<std::uint32_t, std::vector<int>> m_postings;
+};
+
+/**
+ * @brief The LogTrigramFilter class holds the set of distinct trigrams of many texts.
+ *
+ * It is a compact summary of records spilled to disk: when some trigram of the query is missing,
+ * none of the texts contains the query, and the records don't have to be read back.
+ */
+class LogTrigramFilter
+{
+public:
+  /**
+   * @brief Adds all trigrams of the text.
+   */
+  void AddText(std::string_view text);
+
+  /**
+   * @brief Checks if some of the texts might contain the query.
+   *
+   * Queries shorter than LogSearchIndex::kMinQueryLength can't be filtered, they always pass.
+   */
+  bool MayContain(std::string_view query) const;
+
+  /**
+   * @brief Returns the number of distinct trigrams.
+   */
+  std::size_t GetTrigramCount() const;
+
+private:
+  friend class LogSearchIndex;
+
+  std::unordered_set<std::uint32_t> m_trigrams;
+};
+
+/**
+ * @brief Checks if the text contains the query, ignoring the case of ASCII letters.
+ */
+bool ContainsIgnoreCase(std::string_view text, std::string_view query);
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_LOG_SEARCH_INDEX_H_
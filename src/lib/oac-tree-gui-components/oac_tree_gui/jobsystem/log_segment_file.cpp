@@ -0,0 +1,128 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "log_segment_file.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/log_record_storage.h>
+
+#include <cstdint>
+#include <fstream>
+#include <string_view>
+
+namespace oac_tree_gui
+{
+
+namespace
+{
+
+//! Marker at the beginning of each segment file, contains format version.
+const std::uint32_t kSegmentFileMarker = 0x4c4f4701;
+
+template <typename T>
+void WriteValue(std::ofstream& stream, T value)
+{
+  (void)stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void WriteString(std::ofstream& stream, std::string_view str)
+{
+  WriteValue(stream, static_cast<std::uint32_t>(str.size()));
+  (void)stream.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+template <typename T>
+T ReadValue(std::ifstream& stream)
+{
+  T result{};
+  (void)stream.read(reinterpret_cast<char*>(&result), sizeof(T));
+  return result;
+}
+
+std::string ReadString(std::ifstream& stream)
+{
+  const auto size = ReadValue<std::uint32_t>(stream);
+  std::string result(size, '\0');
+  (void)stream.read(result.data(), static_cast<std::streamsize>(size));
+  return result;
+}
+
+}  // namespace
+
+void WriteLogSegment(const std::string& file_name, const LogRecordStorage& storage)
+{
+  std::ofstream stream(file_name, std::ios::binary | std::ios::trunc);
+  if (!stream)
+  {
+    throw RuntimeException("Can't open log segment file [" + file_name + "] for writing");
+  }
+
+  WriteValue(stream, kSegmentFileMarker);
+  WriteValue(stream, static_cast<std::uint64_t>(storage.GetSize()));
+  for (std::size_t index = 0; index < storage.GetSize(); ++index)
+  {
+    const auto record = storage.GetRecord(index);
+    WriteValue(stream, record.timestamp);
+    WriteValue(stream, static_cast<std::uint8_t>(record.severity));
+    WriteString(stream, record.source);
+    WriteString(stream, record.message);
+    WriteString(stream, record.date);
+    WriteString(stream, record.time);
+  }
+
+  if (!stream)
+  {
+    throw RuntimeException("Error while writing log segment file [" + file_name + "]");
+  }
+}
+
+void ReadLogSegment(const std::string& file_name, LogRecordStorage& storage)
+{
+  std::ifstream stream(file_name, std::ios::binary);
+  if (!stream)
+  {
+    throw RuntimeException("Can't open log segment file [" + file_name + "] for reading");
+  }
+
+  if (ReadValue<std::uint32_t>(stream) != kSegmentFileMarker)
+  {
+    throw RuntimeException("Unexpected format of log segment file [" + file_name + "]");
+  }
+
+  const auto record_count = ReadValue<std::uint64_t>(stream);
+  for (std::uint64_t index = 0; index < record_count && stream; ++index)
+  {
+    LogEvent event;
+    event.timestamp = ReadValue<std::int64_t>(stream);
+    event.severity = static_cast<Severity>(ReadValue<std::uint8_t>(stream));
+    event.source = ReadString(stream);
+    event.message = ReadString(stream);
+    event.date = ReadString(stream);
+    event.time = ReadString(stream);
+    storage.Append(event);
+  }
+
+  if (!stream)
+  {
+    throw RuntimeException("Error while reading log segment file [" + file_name + "]");
+  }
+}
+
+}  // namespace oac_tree_gui
@@ -0,0 +1,50 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_LOG_SEGMENT_FILE_H_
+#define OAC_TREE_GUI_JOBSYSTEM_LOG_SEGMENT_FILE_H_
+
+//! @file
+//! Helper functions to spill job log records to disk and to read them back.
+
+#include <string>
+
+namespace oac_tree_gui
+{
+
+class LogRecordStorage;
+
+/**
+ * @brief Writes all records of the storage into a binary segment file.
+ *
+ * Existing file will be overwritten. Throws RuntimeException if the file can't be written.
+ */
+void WriteLogSegment(const std::string& file_name, const LogRecordStorage& storage);
+
+/**
+ * @brief Reads records from the segment file and appends them to the storage.
+ *
+ * Throws RuntimeException if the file can't be read, or has unexpected format.
+ */
+void ReadLogSegment(const std::string& file_name, LogRecordStorage& storage);
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_LOG_SEGMENT_FILE_H_
@@ -26,6 +26,7 @@
 #include <oac_tree_gui/domain/domain_helper.h>
 #include <oac_tree_gui/jobsystem/abstract_domain_runner.h>
 #include <oac_tree_gui/jobsystem/domain_event_dispatcher_context.h>
+#include <oac_tree_gui/jobsystem/job_utils.h>
 #include <oac_tree_gui/model/instruction_container_item.h>
 #include <oac_tree_gui/model/instruction_item.h>
 #include <oac_tree_gui/model/iterate_helper.h>
@@ -52,6 +53,7 @@ AbstractJobHandler::AbstractJobHandler(JobItem* job_item)
   {
     throw RuntimeException("JobItem is not initialised");
   }
+  m_job_log->SetCapacity(job_item->GetLogCapacity());
 }
 
 AbstractJobHandler::~AbstractJobHandler() = default;
@@ -125,6 +127,74 @@ ProcedureItem* AbstractJobHandler::GetExpandedProcedure() const
   return m_job_item->GetExpandedProcedure();
 }
 
+DomainEventStatistics AbstractJobHandler::GetEventStatistics() const
+{
+  return m_domain_runner->GetEventStatistics();
+}
+
+void AbstractJobHandler::SetEventConflationEnabled(bool value)
+{
+  m_domain_runner->SetEventConflationEnabled(value);
+}
+
+void AbstractJobHandler::SetEventPacingEnabled(bool value)
+{
+  m_domain_runner->SetEventPacingEnabled(value);
+}
+
+void AbstractJobHandler::ProcessPendingEvents(std::chrono::steady_clock::time_point deadline)
+{
+  m_domain_runner->ProcessEvents(deadline);
+}
+
+bool AbstractJobHandler::IsGuiThrottleRequired() const
+{
+  return m_gui_throttle_required;
+}
+
+std::vector<InstructionItem*> AbstractJobHandler::GetActiveInstructions() const
+{
+  const std::vector<sup::dto::uint32> indices(m_active_instruction_indices.begin(),
+                                              m_active_instruction_indices.end());
+  return GetInstructionItems(indices);
+}
+
+const InstructionProfileEntry* AbstractJobHandler::FindInstructionProfile(
+    const InstructionItem& item) const
+{
+  auto iter = m_instruction_profile.find(&item);
+  return iter == m_instruction_profile.end() ? nullptr : &iter->second;
+}
+
+std::string AbstractJobHandler::CreateInstructionProfile(ProfileFormat format) const
+{
+  if (format == ProfileFormat::kChromeTrace)
+  {
+    auto find_instruction = [this](std::size_t index) -> const InstructionItem*
+    { return m_procedure_item_builder->GetInstruction(index); };
+    return CreateChromeTraceProfile(m_instruction_profiler.GetCallRecords(), find_instruction);
+  }
+
+  if (auto expanded_procedure = GetExpandedProcedure(); expanded_procedure)
+  {
+    auto find_profile = [this](const InstructionItem& item)
+    { return FindInstructionProfile(item); };
+    return CreateCollapsedStackProfile(*expanded_procedure->GetInstructionContainer(),
+                                       find_profile);
+  }
+  return {};
+}
+
+void AbstractJobHandler::StartEventRecording(const std::string& file_name)
+{
+  m_domain_runner->StartEventRecording(file_name);
+}
+
+void AbstractJobHandler::StopEventRecording()
+{
+  m_domain_runner->StopEventRecording();
+}
+
 AbstractDomainRunner* AbstractJobHandler::GetDomainRunner()
 {
   return m_domain_runner.get();
@@ -151,6 +221,11 @@ DomainEventDispatcherContext AbstractJobHandler::CreateEventDispatcherContext()
   result.breakpoint_hit_updated = [this](const BreakpointHitEvent& event)
   { OnBreakpointHitEvent(event); };
 
+  result.batch_processed = [this]() { OnBatchProcessed(); };
+
+  result.events_fetched = [this](const std::vector<domain_event_t>& events)
+  { OnEventsFetched(events); };
+
   return result;
 }
 
@@ -159,6 +234,14 @@ void AbstractJobHandler::Setup(std::unique_ptr<AbstractDomainRunner> runner)
   SetupBreakpointController();
 
   m_domain_runner = std::move(runner);
+  m_domain_runner->SetActiveInstructionDeltaEnabled(true);
+  m_domain_runner->SetLogFloodOptions(CreateLogFloodOptions(*m_job_item));
+  m_active_instruction_indices.clear();
+  m_pending_added_indices.clear();
+  m_pending_removed_indices.clear();
+  m_active_instructions_reset = false;
+  m_instruction_profiler = InstructionProfiler();
+  m_instruction_profile.clear();
 
   SetupExpandedProcedureItem();
 }
@@ -168,6 +251,17 @@ ProcedureItemJobInfoBuilder* AbstractJobHandler::GetItemBuilder()
   return m_procedure_item_builder.get();
 }
 
+void AbstractJobHandler::SetGuiThrottleRequired(bool value)
+{
+  if (m_gui_throttle_required == value)
+  {
+    return;
+  }
+
+  m_gui_throttle_required = value;
+  emit GuiThrottleRequiredChanged();
+}
+
 void AbstractJobHandler::OnInstructionStateUpdated(const InstructionStateUpdatedEvent& event)
 {
   if (auto* item = m_procedure_item_builder->GetInstruction(event.index); item)
@@ -183,30 +277,146 @@ void AbstractJobHandler::OnInstructionStateUpdated(const InstructionStateUpdated
 
 void AbstractJobHandler::OnJobStateChanged(const JobStateChangedEvent& event)
 {
-  m_job_item->SetStatus(GetRunnerStatusFromDomain(event.state));
+  const auto status = GetRunnerStatusFromDomain(event.state);
+  m_job_item->SetStatus(status);
+  emit RunnerStatusChanged(status);
 }
 
 void AbstractJobHandler::onLogEvent(const oac_tree_gui::LogEvent& event)
 {
-  m_job_log->Append(event);
+  m_pending_log_events.push_back(event);
+}
+
+void AbstractJobHandler::OnBatchProcessed()
+{
+  UpdateInstructionProfile();
+  ReportActiveInstructions();
+
+  if (m_pending_log_events.empty())
+  {
+    return;
+  }
+
+  m_job_log->Append(m_pending_log_events);
+  m_pending_log_events.clear();
+}
+
+void AbstractJobHandler::OnEventsFetched(const std::vector<domain_event_t>& events)
+{
+  for (const auto& event : events)
+  {
+    if (const auto* instruction_event = std::get_if<InstructionStateUpdatedEvent>(&event);
+        instruction_event)
+    {
+      // events which didn't pass through the observer, e.g. replayed ones, have no timestamp
+      const bool has_timestamp =
+          instruction_event->post_time != std::chrono::steady_clock::time_point{};
+      m_instruction_profiler.InstructionStatusUpdated(
+          instruction_event->index, instruction_event->state.m_execution_status,
+          has_timestamp ? instruction_event->post_time : std::chrono::steady_clock::now());
+    }
+    else if (const auto* job_event = std::get_if<JobStateChangedEvent>(&event);
+             job_event && job_event->state == sup::oac_tree::JobState::kInitial)
+    {
+      m_instruction_profiler.Reset();
+    }
+  }
+}
+
+void AbstractJobHandler::UpdateInstructionProfile()
+{
+  const auto entries = m_instruction_profiler.TakeUpdatedEntries();
+  if (entries.empty())
+  {
+    return;
+  }
+
+  // self time of the parent depends on total times of its children
+  std::set<InstructionItem*> updated_items;
+  for (const auto& entry : entries)
+  {
+    if (auto* item = m_procedure_item_builder->GetInstruction(entry.instr_idx); item)
+    {
+      if (entry.call_count > 0)
+      {
+        m_instruction_profile[item] = entry;
+      }
+      else
+      {
+        (void)m_instruction_profile.erase(item);
+      }
+
+      (void)updated_items.insert(item);
+      if (auto* parent = dynamic_cast<InstructionItem*>(item->GetParent()); parent)
+      {
+        (void)updated_items.insert(parent);
+      }
+    }
+  }
+
+  emit InstructionProfileUpdated({updated_items.begin(), updated_items.end()});
 }
 
 void AbstractJobHandler::OnActiveInstructionChangedEvent(const ActiveInstructionChangedEvent& event)
 {
-  std::vector<InstructionItem*> items;
-  for (auto instruction_index : event.instr_idx)
+  if (!event.is_delta)
   {
-    if (auto* item = m_procedure_item_builder->GetInstruction(instruction_index); item)
+    m_active_instruction_indices = {event.instr_idx.begin(), event.instr_idx.end()};
+    m_pending_added_indices.clear();
+    m_pending_removed_indices.clear();
+    m_active_instructions_reset = true;
+    return;
+  }
+
+  // instruction activated and deactivated within the same batch is never reported
+  for (auto instruction_index : event.removed)
+  {
+    if (m_active_instruction_indices.erase(instruction_index) == 0)
     {
-      items.push_back(item);
+      continue;
     }
-    else
+    if (m_pending_added_indices.erase(instruction_index) == 0)
     {
-      qWarning() << "Error in AbstractJobHandler: can't find domain instruction counterpart";
+      (void)m_pending_removed_indices.insert(instruction_index);
     }
   }
 
-  emit ActiveInstructionChanged(items);
+  for (auto instruction_index : event.added)
+  {
+    if (!m_active_instruction_indices.insert(instruction_index).second)
+    {
+      continue;
+    }
+    if (m_pending_removed_indices.erase(instruction_index) == 0)
+    {
+      (void)m_pending_added_indices.insert(instruction_index);
+    }
+  }
+}
+
+void AbstractJobHandler::ReportActiveInstructions()
+{
+  if (m_active_instructions_reset)
+  {
+    m_active_instructions_reset = false;
+    m_pending_added_indices.clear();
+    m_pending_removed_indices.clear();
+    emit ActiveInstructionChanged(GetActiveInstructions());
+    return;
+  }
+
+  if (m_pending_added_indices.empty() && m_pending_removed_indices.empty())
+  {
+    return;
+  }
+
+  const std::vector<sup::dto::uint32> added(m_pending_added_indices.begin(),
+                                            m_pending_added_indices.end());
+  const std::vector<sup::dto::uint32> removed(m_pending_removed_indices.begin(),
+                                              m_pending_removed_indices.end());
+  m_pending_added_indices.clear();
+  m_pending_removed_indices.clear();
+  emit ActiveInstructionUpdated(GetInstructionItems(added), GetInstructionItems(removed));
 }
 
 void AbstractJobHandler::OnVariableUpdatedEvent(const VariableUpdatedEvent& event)
@@ -287,4 +497,23 @@ void AbstractJobHandler::PropagateBreakpointsToDomain()
       GetExpandedProcedure()->GetInstructionContainer()->GetInstructions(), func);
 }
 
+std::vector<InstructionItem*> AbstractJobHandler::GetInstructionItems(
+    const std::vector<sup::dto::uint32>& instruction_indices) const
+{
+  std::vector<InstructionItem*> result;
+  result.reserve(instruction_indices.size());
+  for (auto instruction_index : instruction_indices)
+  {
+    if (auto* item = m_procedure_item_builder->GetInstruction(instruction_index); item)
+    {
+      result.push_back(item);
+    }
+    else
+    {
+      qWarning() << "Error in AbstractJobHandler: can't find domain instruction counterpart";
+    }
+  }
+  return result;
+}
+
 }  // namespace oac_tree_gui
@@ -24,11 +24,17 @@
 #include <oac_tree_gui/domain/sequencer_types_fwd.h>
 #include <oac_tree_gui/jobsystem/domain_events.h>
 #include <oac_tree_gui/jobsystem/i_job_handler.h>
+#include <oac_tree_gui/jobsystem/instruction_profiler.h>
 #include <oac_tree_gui/model/instruction_item.h>
 #include <oac_tree_gui/operation/breakpoint_types.h>
+#include <oac_tree_gui/operation/instruction_profile_helper.h>
 
 #include <QObject>
+#include <chrono>
 #include <memory>
+#include <set>
+#include <unordered_map>
+#include <vector>
 
 namespace oac_tree_gui
 {
@@ -85,10 +91,103 @@ public:
 
   ProcedureItem* GetExpandedProcedure() const override;
 
+  DomainEventStatistics GetEventStatistics() const override;
+
+  /**
+   * @brief Enables conflation of domain events.
+   *
+   * When enabled, only the latest state of each instruction and the latest value of each variable
+   * are propagated to the GUI, when domain reports updates faster than the GUI can process them.
+   */
+  void SetEventConflationEnabled(bool value);
+
+  /**
+   * @brief Enables paced processing of domain events.
+   *
+   * When enabled, domain events are propagated to the GUI only on explicit calls to
+   * ProcessPendingEvents. Used by JobManager to update all jobs at a limited refresh rate.
+   */
+  void SetEventPacingEnabled(bool value);
+
+  /**
+   * @brief Propagates pending domain events to the GUI.
+   *
+   * @param deadline Time point at which processing stops, remaining events are left for the next
+   * call.
+   */
+  void ProcessPendingEvents(std::chrono::steady_clock::time_point deadline);
+
+  /**
+   * @brief Checks if GUI updates of the job have to be throttled, since the job runs at full
+   * speed.
+   */
+  bool IsGuiThrottleRequired() const;
+
+  /**
+   * @brief Returns instructions which are currently active in the domain.
+   */
+  std::vector<InstructionItem*> GetActiveInstructions() const;
+
+  /**
+   * @brief Returns the execution profile of the given instruction, or nullptr if the instruction
+   * hasn't finished yet.
+   */
+  const InstructionProfileEntry* FindInstructionProfile(const InstructionItem& item) const;
+
+  /**
+   * @brief Creates a report with the execution profile of instructions in the given format.
+   *
+   * Collapsed stacks are built from accumulated times of instructions, Chrome trace is built from
+   * individual executions recorded since the job start.
+   */
+  std::string CreateInstructionProfile(ProfileFormat format) const;
+
+  /**
+   * @brief Starts recording of domain events into the trace file, to replay them later with
+   * ReplayJobHandler.
+   */
+  void StartEventRecording(const std::string& file_name);
+
+  /**
+   * @brief Stops recording of domain events.
+   */
+  void StopEventRecording();
+
 signals:
   void InstructionStatusChanged(oac_tree_gui::InstructionItem* instruction);
+
+  /**
+   * @brief Reports the job status received from the domain.
+   */
+  void RunnerStatusChanged(oac_tree_gui::RunnerStatus status);
+
+  /**
+   * @brief Reports the full list of active instructions.
+   *
+   * Emitted at most once per batch of domain events, when the batch carries the full list.
+   */
   void ActiveInstructionChanged(const std::vector<oac_tree_gui::InstructionItem*>&);
 
+  /**
+   * @brief Reports instructions activated and deactivated since the last notification.
+   *
+   * Changes of the whole batch of domain events are reported at once.
+   */
+  void ActiveInstructionUpdated(const std::vector<oac_tree_gui::InstructionItem*>& added,
+                                const std::vector<oac_tree_gui::InstructionItem*>& removed);
+
+  /**
+   * @brief Reports instructions with the changed execution profile, once per batch.
+   *
+   * Parents of finished instructions are reported too, since their self time has changed.
+   */
+  void InstructionProfileUpdated(const std::vector<oac_tree_gui::InstructionItem*>& instructions);
+
+  /**
+   * @brief Reports the change of the GUI throttle requirement, see IsGuiThrottleRequired.
+   */
+  void GuiThrottleRequiredChanged();
+
 protected:
   /**
    * @brief Returns domain  runner.
@@ -114,6 +213,11 @@ protected:
    */
   ProcedureItemJobInfoBuilder* GetItemBuilder();
 
+  /**
+   * @brief Sets the GUI throttle requirement, and reports its change.
+   */
+  void SetGuiThrottleRequired(bool value);
+
 private:
   /**
    * @brief Processes instruction status change in the domain, and update InstructionItem's status
@@ -128,14 +232,40 @@ private:
 
   /**
    * @brief Processes log events from the domain, and put them in GUI JobLog.
+   *
+   * Events are accumulated and appended to the log at once, when the batch is processed.
    */
   void onLogEvent(const oac_tree_gui::LogEvent& event);
 
+  /**
+   * @brief Appends accumulated log events to the job log, and updates the execution profile.
+   */
+  void OnBatchProcessed();
+
+  /**
+   * @brief Feeds the profiler with instruction state changes of events taken from the queue.
+   *
+   * Called before the conflation, so the profiler sees every state change even if the GUI doesn't.
+   */
+  void OnEventsFetched(const std::vector<domain_event_t>& events);
+
+  /**
+   * @brief Updates the profile of instructions finished since the last batch, and reports them.
+   */
+  void UpdateInstructionProfile();
+
   /**
    * @brief Handles events reporting for changes in domain's active instructions.
+   *
+   * Changes are accumulated and reported when the batch is processed.
    */
   void OnActiveInstructionChangedEvent(const ActiveInstructionChangedEvent& event);
 
+  /**
+   * @brief Reports active instruction changes accumulated since the last batch.
+   */
+  void ReportActiveInstructions();
+
   /**
    * @brief Handles events reporting update in the domain variable.
    */
@@ -168,6 +298,12 @@ private:
    */
   void PropagateBreakpointsToDomain();
 
+  /**
+   * @brief Returns instruction items corresponding to the given domain indices.
+   */
+  std::vector<InstructionItem*> GetInstructionItems(
+      const std::vector<sup::dto::uint32>& instruction_indices) const;
+
   //!< GUI object builder holding domain/GUI object correspondance
   std::unique_ptr<ProcedureItemJobInfoBuilder> m_procedure_item_builder;
 
@@ -182,6 +318,26 @@ private:
 
   //!< the JobItem being handled
   JobItem* m_job_item{nullptr};
+
+  //!< indices of domain instructions which are currently active
+  std::set<sup::dto::uint32> m_active_instruction_indices;
+
+  //!< net changes of active instructions in the current batch
+  std::set<sup::dto::uint32> m_pending_added_indices;
+  std::set<sup::dto::uint32> m_pending_removed_indices;
+  bool m_active_instructions_reset{false};  //!< the batch carries the full list
+
+  //!< log events of the current batch, waiting to be appended to the job log
+  std::vector<LogEvent> m_pending_log_events;
+
+  //!< measures execution times of domain instructions
+  InstructionProfiler m_instruction_profiler;
+
+  //!< execution profile of instructions finished at least once
+  std::unordered_map<const InstructionItem*, InstructionProfileEntry> m_instruction_profile;
+
+  //!< the job runs at full speed, its GUI updates have to be throttled
+  bool m_gui_throttle_required{false};
 };
 
 }  // namespace oac_tree_gui
@@ -21,16 +21,33 @@
 #include "domain_event_dispatcher.h"
 
 #include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/domain_event_conflator.h>
+#include <oac_tree_gui/jobsystem/domain_event_metrics.h>
+
+#include <algorithm>
+#include <iterator>
 
 namespace oac_tree_gui
 {
 
+namespace
+{
+
+/**
+ * @brief Maximum number of events to take from the queue at once, when there is no count limit.
+ */
+const std::size_t kMaxEventWindowSize = 10000;
+
+}  // namespace
+
 DomainEventDispatcher::DomainEventDispatcher(get_event_callback_t get_event_callback,
                                              DomainEventDispatcherContext context,
                                              QObject* parent_object)
     : QObject(parent_object)
     , m_get_event(std::move(get_event_callback))
     , m_context(std::move(context))
+    , m_conflator(std::make_unique<DomainEventConflator>())
+    , m_metrics(std::make_unique<DomainEventMetrics>())
 {
   if (!m_get_event)
   {
@@ -38,10 +55,87 @@ DomainEventDispatcher::DomainEventDispatcher(get_event_callback_t get_event_call
   }
 }
 
+DomainEventDispatcher::~DomainEventDispatcher() = default;
+
 void DomainEventDispatcher::OnNewEvent()
 {
   auto event = m_get_event();
-  std::visit(*this, event);
+  Dispatch(event);
+  NotifyBatchProcessed();
+}
+
+void DomainEventDispatcher::OnNewEvents()
+{
+  if (ProcessEvents())
+  {
+    // remaining events will be processed on the next event loop iteration
+    (void)QMetaObject::invokeMethod(this, &DomainEventDispatcher::OnNewEvents,
+                                    Qt::QueuedConnection);
+  }
+}
+
+bool DomainEventDispatcher::ProcessEvents(std::chrono::steady_clock::time_point deadline)
+{
+  if (m_max_duration.count() > 0)
+  {
+    deadline = std::min(deadline, std::chrono::steady_clock::now() + m_max_duration);
+  }
+  std::size_t processed_count{0};
+
+  while (!m_pending_events.empty() || FetchEventWindow())
+  {
+    const auto event = std::move(m_pending_events.front());
+    m_pending_events.pop_front();
+
+    Dispatch(event);
+    ++processed_count;
+
+    const bool count_exhausted = m_max_event_count > 0 && processed_count >= m_max_event_count;
+    const bool time_exhausted = std::chrono::steady_clock::now() >= deadline;
+    if (count_exhausted || time_exhausted)
+    {
+      NotifyBatchProcessed();
+      return true;
+    }
+  }
+
+  NotifyBatchProcessed();
+  return false;
+}
+
+void DomainEventDispatcher::SetDispatchBudget(std::size_t max_event_count,
+                                              std::chrono::milliseconds max_duration)
+{
+  m_max_event_count = max_event_count;
+  m_max_duration = max_duration;
+}
+
+std::size_t DomainEventDispatcher::GetPendingEventCount() const
+{
+  return m_pending_events.size();
+}
+
+void DomainEventDispatcher::SetConflationEnabled(bool value)
+{
+  m_conflation_enabled = value;
+}
+
+std::size_t DomainEventDispatcher::GetConflatedInstructionStateCount() const
+{
+  return m_conflator->GetConflatedInstructionStateCount();
+}
+
+std::size_t DomainEventDispatcher::GetConflatedVariableCount() const
+{
+  return m_conflator->GetConflatedVariableCount();
+}
+
+DomainEventStatistics DomainEventDispatcher::GetStatistics() const
+{
+  auto result = m_metrics->GetStatistics();
+  result.queue_depth = GetPendingEventCount();
+  result.conflated_event_count = GetConflatedInstructionStateCount() + GetConflatedVariableCount();
+  return result;
 }
 
 void DomainEventDispatcher::operator()(const std::monostate& event) const
@@ -97,4 +191,54 @@ void DomainEventDispatcher::operator()(const BreakpointHitEvent& event) const
   }
 }
 
+void DomainEventDispatcher::Dispatch(const domain_event_t& event)
+{
+  if (!IsValid(event))
+  {
+    return;
+  }
+
+  const auto apply_start = std::chrono::steady_clock::now();
+  std::visit(*this, event);
+  m_metrics->RecordEvent(event, apply_start, std::chrono::steady_clock::now());
+}
+
+void DomainEventDispatcher::NotifyBatchProcessed() const
+{
+  if (m_context.batch_processed)
+  {
+    m_context.batch_processed();
+  }
+}
+
+bool DomainEventDispatcher::FetchEventWindow()
+{
+  const std::size_t window_size = m_max_event_count > 0 ? m_max_event_count : kMaxEventWindowSize;
+
+  std::vector<domain_event_t> events;
+  while (events.size() < window_size)
+  {
+    auto event = m_get_event();
+    if (!IsValid(event))
+    {
+      break;  // queue is drained
+    }
+    events.push_back(std::move(event));
+  }
+
+  if (m_context.events_fetched && !events.empty())
+  {
+    m_context.events_fetched(events);
+  }
+
+  if (m_conflation_enabled)
+  {
+    events = m_conflator->Conflate(std::move(events));
+  }
+
+  m_pending_events.insert(m_pending_events.end(), std::make_move_iterator(events.begin()),
+                          std::make_move_iterator(events.end()));
+  return !m_pending_events.empty();
+}
+
 }  // namespace oac_tree_gui
@@ -22,16 +22,35 @@
 #define OAC_TREE_GUI_JOBSYSTEM_OBJECTS_DOMAIN_EVENT_DISPATCHER_H_
 
 #include <oac_tree_gui/jobsystem/domain_event_dispatcher_context.h>
+#include <oac_tree_gui/jobsystem/domain_event_statistics.h>
 #include <oac_tree_gui/jobsystem/domain_events.h>
 
 #include <QObject>
+#include <chrono>
+#include <deque>
+#include <memory>
 
 namespace oac_tree_gui
 {
 
+class DomainEventConflator;
+class DomainEventMetrics;
+
 /**
  * @brief The DomainEventDispatcher class processes domain events and calls different callbacks
  * depending on event type.
+ *
+ * Events can be processed one by one (OnNewEvent), or in batches (OnNewEvents). In the latter case
+ * the dispatcher drains all available events within a dispatch budget (maximum number of events
+ * and maximum time spent in one pass). When the budget is exhausted, the processing of remaining
+ * events is rescheduled to the next event loop iteration, so the GUI stays responsive.
+ *
+ * In batch mode events are taken from the queue in windows. Optionally, each window can be
+ * conflated (see DomainEventConflator), so only the latest instruction state and variable value
+ * are applied to the GUI.
+ *
+ * The dispatcher measures the time spent in each handler, and the latency of each event since its
+ * posting by DomainJobObserver (see DomainEventMetrics).
  */
 class DomainEventDispatcher : public QObject
 {
@@ -39,15 +58,93 @@ class DomainEventDispatcher : public QObject
 
 public:
   using get_event_callback_t = std::function<domain_event_t()>;
+
+  /**
+   * @brief Default maximum number of events to process in one pass.
+   */
+  static constexpr std::size_t kDefaultMaxEventCount = 10000;
+
+  /**
+   * @brief Default maximum time to spend in one pass.
+   *
+   * A small fraction of a 60 Hz frame, so the event loop has time left to repaint and to handle
+   * user input even when the procedure floods the GUI with events.
+   */
+  static constexpr std::chrono::milliseconds kDefaultMaxDuration{5};
+
   explicit DomainEventDispatcher(get_event_callback_t get_event_callback,
                                  DomainEventDispatcherContext context,
                                  QObject* parent_object = nullptr);
+  ~DomainEventDispatcher() override;
+
+  DomainEventDispatcher(const DomainEventDispatcher&) = delete;
+  DomainEventDispatcher& operator=(const DomainEventDispatcher&) = delete;
+  DomainEventDispatcher(DomainEventDispatcher&&) = delete;
+  DomainEventDispatcher& operator=(DomainEventDispatcher&&) = delete;
 
   /**
    * @brief Processes new event by calling get_event callback.
    */
   void OnNewEvent();
 
+  /**
+   * @brief Processes all available events by calling get_event callback until it returns an empty
+   * (monostate) event, or until the dispatch budget is exhausted.
+   */
+  void OnNewEvents();
+
+  /**
+   * @brief Processes available events within the dispatch budget without rescheduling.
+   *
+   * Intended for paced processing, when the caller itself decides when to process events next.
+   * The context is notified at the end of each pass, so handlers can flush accumulated data.
+   *
+   * @param deadline Time point at which the pass stops, even if the own budget is not exhausted.
+   * Used by GuiUpdateScheduler to share the frame budget among jobs. At least one event is
+   * processed, if available.
+   *
+   * @return True if the budget has been exhausted, and some events might be left unprocessed.
+   */
+  bool ProcessEvents(std::chrono::steady_clock::time_point deadline =
+                         std::chrono::steady_clock::time_point::max());
+
+  /**
+   * @brief Sets the budget for a single batch processing pass.
+   *
+   * By default the budget is kDefaultMaxEventCount events and kDefaultMaxDuration.
+   *
+   * @param max_event_count Maximum number of events to process in one pass, 0 means no limit.
+   * @param max_duration Maximum time to spend in one pass, 0 means no limit.
+   */
+  void SetDispatchBudget(std::size_t max_event_count, std::chrono::milliseconds max_duration);
+
+  /**
+   * @brief Returns number of events taken from the queue, but not yet processed.
+   */
+  std::size_t GetPendingEventCount() const;
+
+  /**
+   * @brief Enables conflation of instruction state and variable updates in batch mode.
+   */
+  void SetConflationEnabled(bool value);
+
+  /**
+   * @brief Returns number of InstructionStateUpdatedEvent dropped by the conflation.
+   */
+  std::size_t GetConflatedInstructionStateCount() const;
+
+  /**
+   * @brief Returns number of VariableUpdatedEvent dropped by the conflation.
+   */
+  std::size_t GetConflatedVariableCount() const;
+
+  /**
+   * @brief Returns statistics of processed events.
+   *
+   * Queue depth reports events taken from the queue, but not yet processed.
+   */
+  DomainEventStatistics GetStatistics() const;
+
   void operator()(const std::monostate& event) const;
   void operator()(const InstructionStateUpdatedEvent& event) const;
   void operator()(const VariableUpdatedEvent& event) const;
@@ -57,8 +154,33 @@ public:
   void operator()(const BreakpointHitEvent& event) const;
 
 private:
+  /**
+   * @brief Calls the handler of the given event and records its timing.
+   */
+  void Dispatch(const domain_event_t& event);
+
+  /**
+   * @brief Notifies the context that the current batch of events has been processed.
+   */
+  void NotifyBatchProcessed() const;
+
+  /**
+   * @brief Takes the next window of events from the queue and stores them as pending events.
+   *
+   * @return True if there are pending events to process.
+   */
+  bool FetchEventWindow();
+
   get_event_callback_t m_get_event;
   DomainEventDispatcherContext m_context;
+  std::size_t m_max_event_count{kDefaultMaxEventCount};
+  std::chrono::milliseconds m_max_duration{kDefaultMaxDuration};
+  bool m_conflation_enabled{false};
+  std::unique_ptr<DomainEventConflator> m_conflator;
+  std::unique_ptr<DomainEventMetrics> m_metrics;
+
+  //!< events taken from the queue, but not yet processed
+  std::deque<domain_event_t> m_pending_events;
 };
 
 }  // namespace oac_tree_gui
@@ -21,16 +21,90 @@
 #include "domain_event_queue.h"
 
 #include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/domain_event_conflator.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <thread>
 
 namespace oac_tree_gui
 {
 
-DomainEventQueue::DomainEventQueue(QObject* parent_object) : QObject(parent_object) {}
+namespace
+{
+
+/**
+ * @brief Number of attempts to push in the full queue before the producer starts to sleep.
+ */
+const std::size_t kSpinAttemptCount = 64;
+
+/**
+ * @brief Sleep time of the producer waiting for the free space in the queue.
+ */
+const std::chrono::microseconds kProducerSleepTime{50};
+
+/**
+ * @brief Gives the consumer a chance to free some space in the queue.
+ */
+void WaitForConsumer(std::size_t attempt)
+{
+  if (attempt < kSpinAttemptCount)
+  {
+    std::this_thread::yield();
+  }
+  else
+  {
+    std::this_thread::sleep_for(kProducerSleepTime);
+  }
+}
+
+/**
+ * @brief Checks if the event can be dropped on overflow without breaking the GUI state.
+ *
+ * Active instruction deltas are applied on top of each other, and the job state is reported once.
+ */
+bool IsDroppable(const domain_event_t& event)
+{
+  return !std::holds_alternative<ActiveInstructionChangedEvent>(event)
+         && !std::holds_alternative<JobStateChangedEvent>(event);
+}
+
+}  // namespace
+
+/**
+ * @brief The OverflowBuffer struct holds events which didn't fit in the ring buffer.
+ */
+struct DomainEventQueue::OverflowBuffer
+{
+  //!< number of events pushed in the ring buffer before the first event of this buffer
+  std::size_t ring_push_count{0};
+  std::deque<domain_event_t> events;  //!< overflow for kDropOldest policy
+  DomainEventConflator conflator;     //!< overflow for kConflate policy
+};
+
+DomainEventQueue::DomainEventQueue(QObject* parent_object)
+    : DomainEventQueue(DomainEventQueueOptions{}, parent_object)
+{
+}
+
+DomainEventQueue::DomainEventQueue(const DomainEventQueueOptions& options, QObject* parent_object)
+    : QObject(parent_object)
+    , m_options(options)
+    , m_ring_buffer(options.capacity)
+{
+}
+
+DomainEventQueue::~DomainEventQueue()
+{
+  // the buffer is owned by the queue, when published and not taken by the consumer
+  const std::unique_ptr<OverflowBuffer> overflow_buffer(m_overflow_buffer.exchange(nullptr));
+}
 
 domain_event_t DomainEventQueue::PopEvent()
 {
   domain_event_t result;
-  if (!m_domain_events.try_pop(result))
+  if (!PopFromTransport(result))
   {
     // We should warn somehow the user without exaggerating too much. Wouldn't be already enough to
     // print to stderr?
@@ -39,15 +113,203 @@ domain_event_t DomainEventQueue::PopEvent()
   return result;
 }
 
+domain_event_t DomainEventQueue::TryPopEvent()
+{
+  domain_event_t result;
+  if (PopFromTransport(result))
+  {
+    return result;
+  }
+
+  // The queue is drained, the next pushed event should wake up the consumer. We check the queue
+  // once again to catch events pushed after the first attempt, while notification was still
+  // pending.
+  m_notification_pending.store(false);
+  (void)PopFromTransport(result);
+  return result;
+}
+
 void DomainEventQueue::PushEvent(const domain_event_t& event)
 {
-  m_domain_events.push(event);
-  emit NewEvent();
+  PushEvent(domain_event_t(event));
+}
+
+void DomainEventQueue::PushEvent(domain_event_t&& event)
+{
+  std::unique_lock<std::mutex> producer_lock(m_producer_mutex, std::defer_lock);
+  if (m_options.producer_mode == ProducerMode::kMultiple)
+  {
+    producer_lock.lock();
+  }
+
+  if (!PushToTransport(std::move(event)))
+  {
+    return;
+  }
+
+  // producers are serialized, no need in compare-and-swap
+  const std::size_t depth = m_ring_buffer.GetSize() + m_overflow_event_count.load();
+  if (depth > m_high_water_mark.load(std::memory_order_relaxed))
+  {
+    m_high_water_mark.store(depth, std::memory_order_relaxed);
+  }
+
+  if (!m_notification_pending.exchange(true))
+  {
+    emit NewEvent();
+  }
 }
 
 std::size_t DomainEventQueue::GetEventCount() const
 {
-  return m_domain_events.size();
+  return m_ring_buffer.GetSize() + m_overflow_event_count.load() + m_backlog.size();
+}
+
+std::size_t DomainEventQueue::GetDroppedEventCount() const
+{
+  return m_dropped_event_count.load();
+}
+
+std::size_t DomainEventQueue::GetHighWaterMark() const
+{
+  return m_high_water_mark.load(std::memory_order_relaxed);
+}
+
+void DomainEventQueue::Close()
+{
+  m_is_closed.store(true);
+}
+
+bool DomainEventQueue::PushToTransport(domain_event_t&& event)
+{
+  std::size_t attempt{0};
+  while (!m_is_closed.load())
+  {
+    // While the overflow buffer is published, new events go there too to preserve the order.
+    if (m_overflow_buffer.load() == nullptr && m_ring_buffer.TryPush(std::move(event)))
+    {
+      ++m_ring_push_count;
+      return true;
+    }
+
+    if (m_options.overflow_policy != OverflowPolicy::kBlock && PushToOverflow(std::move(event)))
+    {
+      return true;
+    }
+
+    WaitForConsumer(attempt++);
+  }
+
+  return false;
+}
+
+bool DomainEventQueue::PushToOverflow(domain_event_t&& event)
+{
+  // taking the published buffer back, unless the consumer has taken it already
+  std::unique_ptr<OverflowBuffer> buffer(m_overflow_buffer.exchange(nullptr));
+  if (!buffer)
+  {
+    // the consumer might have taken the overflow and freed the ring buffer meanwhile
+    if (m_ring_buffer.TryPush(std::move(event)))
+    {
+      ++m_ring_push_count;
+      return true;
+    }
+    buffer = std::make_unique<OverflowBuffer>();
+    buffer->ring_push_count = m_ring_push_count;
+  }
+
+  bool is_pushed{true};
+  if (m_options.overflow_policy == OverflowPolicy::kDropOldest)
+  {
+    auto& events = buffer->events;
+    const std::size_t count = events.size();
+    if (count >= m_ring_buffer.GetCapacity())
+    {
+      auto oldest = std::find_if(events.begin(), events.end(), IsDroppable);
+      is_pushed = oldest != events.end();  // when nothing can be dropped, wait for the consumer
+      if (is_pushed)
+      {
+        (void)events.erase(oldest);
+        ++m_dropped_event_count;
+      }
+    }
+
+    if (is_pushed)
+    {
+      events.push_back(std::move(event));
+      m_overflow_event_count += events.size() - count;
+    }
+  }
+  else
+  {
+    const std::size_t count = buffer->conflator.GetEventCount();
+    is_pushed = count < m_ring_buffer.GetCapacity();  // nothing left to conflate, wait otherwise
+    if (is_pushed)
+    {
+      buffer->conflator.PushEvent(std::move(event));
+      m_overflow_event_count += buffer->conflator.GetEventCount() - count;
+    }
+  }
+
+  // the buffer holds at least one event, producers are serialized, so the slot is empty
+  m_overflow_buffer.store(buffer.release());
+  return is_pushed;
+}
+
+bool DomainEventQueue::PopFromTransport(domain_event_t& event)
+{
+  // Events in the backlog are older than the events remaining in the ring buffer, since producers
+  // are not allowed to use the ring buffer while the overflow buffer is published.
+  while (m_backlog.empty())
+  {
+    // Events pushed in the ring buffer before the taken overflow buffer go first.
+    const bool is_overflow_due =
+        m_taken_overflow && m_ring_pop_count == m_taken_overflow->ring_push_count;
+    if (!is_overflow_due && m_ring_buffer.TryPop(event))
+    {
+      ++m_ring_pop_count;
+      return true;
+    }
+
+    if (m_taken_overflow)
+    {
+      TakeOverflowEvents();
+    }
+    else
+    {
+      // the ring buffer is empty, it is time to take the overflow
+      m_taken_overflow.reset(m_overflow_buffer.exchange(nullptr));
+      if (!m_taken_overflow)
+      {
+        return false;
+      }
+    }
+  }
+
+  event = std::move(m_backlog.front());
+  m_backlog.pop_front();
+  return true;
+}
+
+void DomainEventQueue::TakeOverflowEvents()
+{
+  std::size_t count{0};
+  if (m_options.overflow_policy == OverflowPolicy::kDropOldest)
+  {
+    auto& events = m_taken_overflow->events;
+    count = events.size();
+    std::move(events.begin(), events.end(), std::back_inserter(m_backlog));
+  }
+  else
+  {
+    auto events = m_taken_overflow->conflator.TakeEvents();
+    count = events.size();
+    std::move(events.begin(), events.end(), std::back_inserter(m_backlog));
+  }
+
+  m_overflow_event_count -= count;
+  m_taken_overflow.reset();
 }
 
 }  // namespace oac_tree_gui
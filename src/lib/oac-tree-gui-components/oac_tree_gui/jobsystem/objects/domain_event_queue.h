@@ -21,11 +21,15 @@
 #ifndef OAC_TREE_GUI_JOBSYSTEM_OBJECTS_DOMAIN_EVENT_QUEUE_H_
 #define OAC_TREE_GUI_JOBSYSTEM_OBJECTS_DOMAIN_EVENT_QUEUE_H_
 
+#include <oac_tree_gui/jobsystem/domain_event_queue_options.h>
 #include <oac_tree_gui/jobsystem/domain_events.h>
-
-#include <mvvm/utils/threadsafe_queue.h>
+#include <oac_tree_gui/jobsystem/spsc_ring_buffer.h>
 
 #include <QObject>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
 
 namespace oac_tree_gui
 {
@@ -35,6 +39,21 @@ namespace oac_tree_gui
  * domain sequencer.
  *
  * It is expected that sequencer's JobInfoIO will post events in this queue.
+ *
+ * Events are transported through a bounded lock-free single-producer/single-consumer ring buffer.
+ * When several sequencer threads are pushing events (ProducerMode::kMultiple), producers are
+ * serialized between each other with a dedicated mutex, which is never taken by the GUI thread.
+ *
+ * When the ring buffer is full, the queue behaves according to the OverflowPolicy. With
+ * kDropOldest and kConflate policies overflowing events are stored in the overflow buffer. The
+ * buffer is published through an atomic pointer: the producer takes it back with an exchange,
+ * adds the event and publishes it again, while the consumer takes it with an exchange when the
+ * ring buffer becomes empty. The producer and the consumer never share a lock.
+ *
+ * Notifications are coalesced: only the first event of a burst emits NewEvent signal. The next
+ * signal is emitted only after the consumer has found the queue empty via TryPopEvent. This
+ * prevents flooding of the Qt event loop with queued signals when the domain produces events at
+ * high rate.
  */
 class DomainEventQueue : public QObject
 {
@@ -42,19 +61,40 @@ class DomainEventQueue : public QObject
 
 public:
   explicit DomainEventQueue(QObject* parent_object = nullptr);
+  explicit DomainEventQueue(const DomainEventQueueOptions& options,
+                            QObject* parent_object = nullptr);
+  ~DomainEventQueue() override;
+
+  DomainEventQueue(const DomainEventQueue&) = delete;
+  DomainEventQueue& operator=(const DomainEventQueue&) = delete;
+  DomainEventQueue(DomainEventQueue&&) = delete;
+  DomainEventQueue& operator=(DomainEventQueue&&) = delete;
 
   /**
    * @brief Pops an event from the queue.
    *
-   * Expected to be executed from a GUI thread. If queue is empty will return empty (monostate)
-   * event.
+   * Expected to be executed from a GUI thread. Will throw if the queue is empty.
    */
   domain_event_t PopEvent();
 
+  /**
+   * @brief Pops an event from the queue, if available.
+   *
+   * Expected to be executed from a GUI thread. If queue is empty will return empty (monostate)
+   * event, and will re-arm notification, so the next pushed event emits NewEvent signal again.
+   */
+  domain_event_t TryPopEvent();
+
   /**
    * @brief Pushes event in a queue.
    *
-   * Expected to be executed from sequencer thread.
+   * Expected to be executed from sequencer thread. Depending on the overflow policy, the call can
+   * block while the queue is full.
+   */
+  void PushEvent(domain_event_t&& event);
+
+  /**
+   * @brief Pushes a copy of the event in a queue.
    */
   void PushEvent(const domain_event_t& event);
 
@@ -63,15 +103,84 @@ public:
    */
   std::size_t GetEventCount() const;
 
+  /**
+   * @brief Returns number of events dropped because of the overflow.
+   */
+  std::size_t GetDroppedEventCount() const;
+
+  /**
+   * @brief Returns the largest number of events ever stored in the queue.
+   */
+  std::size_t GetHighWaterMark() const;
+
+  /**
+   * @brief Stops accepting new events.
+   *
+   * Producers waiting for the free space will be released, all further events will be discarded.
+   * Should be called before the destruction of the domain job, to prevent the sequencer thread
+   * from waiting for the GUI forever.
+   */
+  void Close();
+
 signals:
   /**
    * @brief The signal to notify about new events in a queue. Must be connected with GUI thread via
    * queued connections.
+   *
+   * The signal is emitted once per burst of events, the consumer is expected to drain the queue
+   * using TryPopEvent.
    */
   void NewEvent();
 
 private:
-  mvvm::threadsafe_queue<domain_event_t> m_domain_events;
+  /**
+   * @brief Pushes event in the ring buffer, or in the overflow buffer, according to the policy.
+   *
+   * @return False if the queue has been closed and the event is discarded.
+   */
+  bool PushToTransport(domain_event_t&& event);
+
+  /**
+   * @brief Pushes event in the overflow buffer, and publishes the buffer to the consumer.
+   *
+   * @return False if the event can't be stored at the moment, and the producer should wait.
+   */
+  bool PushToOverflow(domain_event_t&& event);
+
+  /**
+   * @brief Pops event in the order of arrival. Intended for call from the consumer thread.
+   */
+  bool PopFromTransport(domain_event_t& event);
+
+  /**
+   * @brief Moves all events from the overflow buffer taken by the consumer to the backlog.
+   */
+  void TakeOverflowEvents();
+
+  struct OverflowBuffer;
+
+  DomainEventQueueOptions m_options;
+  SpscRingBuffer<domain_event_t> m_ring_buffer;
+
+  //!< serializes producers in multi-producer mode, never locked by the consumer
+  std::mutex m_producer_mutex;
+
+  //!< overflow buffer published by the producer, owned by the one who has exchanged it
+  std::atomic<OverflowBuffer*> m_overflow_buffer{nullptr};
+  std::atomic<std::size_t> m_overflow_event_count{0};
+  std::size_t m_ring_push_count{0};  //!< number of events pushed in the ring buffer by producers
+
+  //!< overflow buffer taken by the consumer, waiting for older events from the ring buffer
+  std::unique_ptr<OverflowBuffer> m_taken_overflow;
+  std::size_t m_ring_pop_count{0};  //!< number of events popped from the ring buffer
+
+  //!< events taken from the overflow buffer, accessed by the consumer only
+  std::deque<domain_event_t> m_backlog;
+
+  std::atomic<bool> m_notification_pending{false};
+  std::atomic<bool> m_is_closed{false};
+  std::atomic<std::size_t> m_dropped_event_count{0};
+  std::atomic<std::size_t> m_high_water_mark{0};
 };
 
 }  // namespace oac_tree_gui
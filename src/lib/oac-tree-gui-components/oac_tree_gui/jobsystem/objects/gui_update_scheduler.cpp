@@ -0,0 +1,283 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "gui_update_scheduler.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+
+#include <QTimer>
+#include <algorithm>
+
+namespace oac_tree_gui
+{
+
+namespace
+{
+
+const int kMillisecondsPerSecond = 1000;
+
+/**
+ * @brief Maximum refresh rate, the frame timer has a resolution of one millisecond.
+ */
+const int kMaxRefreshRate = kMillisecondsPerSecond;
+
+/**
+ * @brief Part of the frame period given to flushing of all jobs, the rest is left to the GUI.
+ */
+const int kFrameBudgetDivider = 2;
+
+/**
+ * @brief Refresh rate of throttled jobs, when the scheduler is disabled.
+ */
+const int kDefaultThrottleRate = 50;
+
+/**
+ * @brief Returns frame period corresponding to the given number of frames per second.
+ */
+std::chrono::milliseconds GetFramePeriod(int rate)
+{
+  return std::chrono::milliseconds(kMillisecondsPerSecond / rate);
+}
+
+}  // namespace
+
+GuiUpdateScheduler::GuiUpdateScheduler(QObject* parent_object)
+    : QObject(parent_object), m_timer(new QTimer(this))
+{
+  m_timer->setTimerType(Qt::PreciseTimer);
+  connect(m_timer, &QTimer::timeout, this, &GuiUpdateScheduler::OnFrame);
+}
+
+GuiUpdateScheduler::~GuiUpdateScheduler() = default;
+
+void GuiUpdateScheduler::SetRefreshRate(int active_rate, int background_rate)
+{
+  if (active_rate < 0)
+  {
+    throw RuntimeException("Refresh rate can't be negative");
+  }
+
+  if (active_rate > 0 && background_rate <= 0)
+  {
+    throw RuntimeException("Background refresh rate should be positive");
+  }
+
+  m_active_rate = std::min(active_rate, kMaxRefreshRate);
+  m_background_rate = std::min(background_rate, m_active_rate);
+  UpdateTimer();
+}
+
+int GuiUpdateScheduler::GetRefreshRate() const
+{
+  return m_active_rate;
+}
+
+int GuiUpdateScheduler::GetBackgroundRefreshRate() const
+{
+  return m_background_rate;
+}
+
+bool GuiUpdateScheduler::IsEnabled() const
+{
+  return m_active_rate > 0;
+}
+
+void GuiUpdateScheduler::RegisterJob(JobItem* job, flush_callback_t flush_callback)
+{
+  if (job == nullptr || !flush_callback)
+  {
+    throw RuntimeException("Attempt to register undefined job");
+  }
+
+  auto on_element = [job](const auto& entry) { return entry.job == job; };
+  if (std::any_of(m_jobs.begin(), m_jobs.end(), on_element))
+  {
+    throw RuntimeException("Attempt to register already existing job");
+  }
+
+  m_jobs.push_back({job, std::move(flush_callback), std::chrono::steady_clock::now(), false});
+  UpdateTimer();
+}
+
+void GuiUpdateScheduler::UnregisterJob(JobItem* job)
+{
+  auto on_element = [job](const auto& entry) { return entry.job == job; };
+  m_jobs.erase(std::remove_if(m_jobs.begin(), m_jobs.end(), on_element), m_jobs.end());
+
+  if (m_active_job == job)
+  {
+    m_active_job = nullptr;
+  }
+  UpdateTimer();
+}
+
+void GuiUpdateScheduler::SetActiveJob(JobItem* job)
+{
+  m_active_job = job;
+}
+
+void GuiUpdateScheduler::SetJobThrottled(JobItem* job, bool value)
+{
+  auto on_element = [job](const auto& entry) { return entry.job == job; };
+  auto iter = std::find_if(m_jobs.begin(), m_jobs.end(), on_element);
+  if (iter == m_jobs.end())
+  {
+    throw RuntimeException("Attempt to throttle unregistered job");
+  }
+
+  iter->is_throttled = value;
+  UpdateTimer();
+}
+
+bool GuiUpdateScheduler::IsJobThrottled(const JobItem* job) const
+{
+  auto on_element = [job](const auto& entry) { return entry.job == job; };
+  auto iter = std::find_if(m_jobs.begin(), m_jobs.end(), on_element);
+  return iter != m_jobs.end() && iter->is_throttled;
+}
+
+int GuiUpdateScheduler::GetThrottleRate() const
+{
+  return IsEnabled() ? m_background_rate : kDefaultThrottleRate;
+}
+
+std::size_t GuiUpdateScheduler::GetJobCount() const
+{
+  return m_jobs.size();
+}
+
+void GuiUpdateScheduler::OnFrame()
+{
+  const int frame_rate = GetFrameRate();
+  if (frame_rate == 0)
+  {
+    return;
+  }
+
+  const auto now = std::chrono::steady_clock::now();
+  const auto deadline = now + GetFramePeriod(frame_rate) / kFrameBudgetDivider;
+
+  auto on_active = [this](const auto& entry) { return entry.job == m_active_job; };
+  if (auto iter = std::find_if(m_jobs.begin(), m_jobs.end(), on_active);
+      iter != m_jobs.end() && IsDue(*iter, now))
+  {
+    FlushJob(m_active_job, now, deadline);
+  }
+
+  // snapshot of job keys in round-robin order, since a callback might change the list of jobs
+  std::vector<JobItem*> jobs;
+  jobs.reserve(m_jobs.size());
+  const std::size_t start_index = m_next_background_index % m_jobs.size();
+  for (std::size_t count = 0; count < m_jobs.size(); ++count)
+  {
+    jobs.push_back(m_jobs[(start_index + count) % m_jobs.size()].job);
+  }
+
+  bool is_flushed_any{false};
+  for (std::size_t position = 0; position < jobs.size(); ++position)
+  {
+    // at least one background job is flushed per frame, so background jobs can't starve
+    if (is_flushed_any && std::chrono::steady_clock::now() >= deadline)
+    {
+      break;
+    }
+
+    auto job = jobs[position];
+    auto on_element = [job](const auto& entry) { return entry.job == job; };
+    auto iter = std::find_if(m_jobs.begin(), m_jobs.end(), on_element);
+    const bool is_removed = iter == m_jobs.end();
+    if (job == m_active_job || is_removed || !IsDue(*iter, now))
+    {
+      continue;
+    }
+
+    FlushJob(job, now, deadline);
+    is_flushed_any = true;
+    m_next_background_index = start_index + position + 1;
+  }
+}
+
+void GuiUpdateScheduler::FlushJob(JobItem* job, std::chrono::steady_clock::time_point now,
+                                  std::chrono::steady_clock::time_point deadline)
+{
+  auto on_element = [job](const auto& entry) { return entry.job == job; };
+  auto iter = std::find_if(m_jobs.begin(), m_jobs.end(), on_element);
+  if (iter == m_jobs.end())
+  {
+    return;
+  }
+
+  iter->last_flush_time = now;
+  // the callback is copied, since it might unregister the job and destroy the stored one
+  const auto flush_callback = iter->flush_callback;
+  flush_callback(deadline);
+}
+
+int GuiUpdateScheduler::GetFrameRate() const
+{
+  if (m_jobs.empty())
+  {
+    return 0;
+  }
+
+  if (IsEnabled())
+  {
+    return m_active_rate;
+  }
+
+  auto on_element = [](const auto& entry) { return entry.is_throttled; };
+  return std::any_of(m_jobs.begin(), m_jobs.end(), on_element) ? kDefaultThrottleRate : 0;
+}
+
+bool GuiUpdateScheduler::IsDue(const JobEntry& entry,
+                               std::chrono::steady_clock::time_point now) const
+{
+  if (entry.is_throttled)
+  {
+    return now - entry.last_flush_time >= GetFramePeriod(GetThrottleRate());
+  }
+
+  // without the scheduler, events of not throttled jobs are processed as they come
+  if (!IsEnabled())
+  {
+    return false;
+  }
+
+  return entry.job == m_active_job
+         || now - entry.last_flush_time >= GetFramePeriod(m_background_rate);
+}
+
+void GuiUpdateScheduler::UpdateTimer()
+{
+  if (const int frame_rate = GetFrameRate(); frame_rate > 0)
+  {
+    const auto period = GetFramePeriod(frame_rate);
+    if (!m_timer->isActive() || m_timer->interval() != period.count())
+    {
+      m_timer->start(static_cast<int>(period.count()));
+    }
+  }
+  else
+  {
+    m_timer->stop();
+  }
+}
+
+}  // namespace oac_tree_gui
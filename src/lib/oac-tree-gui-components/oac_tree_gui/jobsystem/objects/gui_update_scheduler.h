@@ -0,0 +1,181 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_OBJECTS_GUI_UPDATE_SCHEDULER_H_
+#define OAC_TREE_GUI_JOBSYSTEM_OBJECTS_GUI_UPDATE_SCHEDULER_H_
+
+#include <QObject>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+class QTimer;
+
+namespace oac_tree_gui
+{
+
+class JobItem;
+
+/**
+ * @brief The GuiUpdateScheduler class paces GUI updates of all running jobs.
+ *
+ * Each job registers a callback which flushes its pending domain events to the GUI. The scheduler
+ * runs a single timer at the given refresh rate. The active job, the one the user is looking at,
+ * is flushed on every frame, while background jobs are flushed at a lower rate.
+ *
+ * All jobs share the time budget of a frame, half of the frame period. The active job is flushed
+ * first, background jobs which are due are flushed in round-robin order while the budget lasts,
+ * and the rest are continued on the next frame. This caps the GUI thread load regardless of the
+ * number of jobs.
+ *
+ * Jobs running at full speed are throttled: they are flushed at the background rate, even when
+ * active, so the flood of their events doesn't take the whole frame budget.
+ *
+ * The scheduler is disabled, when the refresh rate is zero. Throttled jobs are still flushed then,
+ * at the default throttle rate.
+ */
+class GuiUpdateScheduler : public QObject
+{
+  Q_OBJECT
+
+public:
+  //! Callback to flush pending updates of a job, processing should stop at the given deadline.
+  using flush_callback_t = std::function<void(std::chrono::steady_clock::time_point deadline)>;
+
+  explicit GuiUpdateScheduler(QObject* parent_object = nullptr);
+  ~GuiUpdateScheduler() override;
+
+  GuiUpdateScheduler(const GuiUpdateScheduler&) = delete;
+  GuiUpdateScheduler& operator=(const GuiUpdateScheduler&) = delete;
+  GuiUpdateScheduler(GuiUpdateScheduler&&) = delete;
+  GuiUpdateScheduler& operator=(GuiUpdateScheduler&&) = delete;
+
+  /**
+   * @brief Sets refresh rates of the active job and of background jobs.
+   *
+   * Rates above 1000 updates per second are clamped, since the frame period can't be shorter
+   * than one millisecond.
+   *
+   * @param active_rate Number of updates per second for the active job, 0 disables the scheduler.
+   * @param background_rate Number of updates per second for background jobs, can't exceed the
+   * active rate.
+   */
+  void SetRefreshRate(int active_rate, int background_rate);
+
+  /**
+   * @brief Returns refresh rate of the active job.
+   */
+  int GetRefreshRate() const;
+
+  /**
+   * @brief Returns refresh rate of background jobs.
+   */
+  int GetBackgroundRefreshRate() const;
+
+  /**
+   * @brief Checks if the scheduler is enabled.
+   */
+  bool IsEnabled() const;
+
+  /**
+   * @brief Registers job and the callback to flush its pending updates.
+   */
+  void RegisterJob(JobItem* job, flush_callback_t flush_callback);
+
+  /**
+   * @brief Removes job from the schedule.
+   */
+  void UnregisterJob(JobItem* job);
+
+  /**
+   * @brief Sets the job which gets the highest refresh rate.
+   */
+  void SetActiveJob(JobItem* job);
+
+  /**
+   * @brief Sets the throttling of updates of the given registered job.
+   */
+  void SetJobThrottled(JobItem* job, bool value);
+
+  /**
+   * @brief Checks if updates of the given job are throttled.
+   */
+  bool IsJobThrottled(const JobItem* job) const;
+
+  /**
+   * @brief Returns refresh rate of throttled jobs, the background rate when the scheduler is
+   * enabled.
+   */
+  int GetThrottleRate() const;
+
+  /**
+   * @brief Returns number of registered jobs.
+   */
+  std::size_t GetJobCount() const;
+
+  /**
+   * @brief Flushes pending updates of the active job, and of background jobs which are due,
+   * within the frame budget.
+   *
+   * Called by the timer on every frame. Callbacks are allowed to register and unregister jobs.
+   */
+  void OnFrame();
+
+private:
+  struct JobEntry
+  {
+    JobItem* job{nullptr};
+    flush_callback_t flush_callback;
+    std::chrono::steady_clock::time_point last_flush_time;
+    bool is_throttled{false};
+  };
+
+  /**
+   * @brief Returns rate of the frame timer, zero when no job has to be flushed.
+   */
+  int GetFrameRate() const;
+
+  /**
+   * @brief Checks if the job has to be flushed on the frame starting at the given time.
+   */
+  bool IsDue(const JobEntry& entry, std::chrono::steady_clock::time_point now) const;
+
+  /**
+   * @brief Starts, or stops the timer depending on refresh rate and number of registered jobs.
+   */
+  void UpdateTimer();
+
+  /**
+   * @brief Calls the flush callback of the given job, if the job is still registered.
+   */
+  void FlushJob(JobItem* job, std::chrono::steady_clock::time_point now,
+                std::chrono::steady_clock::time_point deadline);
+
+  QTimer* m_timer{nullptr};
+  int m_active_rate{0};
+  int m_background_rate{0};
+  JobItem* m_active_job{nullptr};
+  std::vector<JobEntry> m_jobs;
+  std::size_t m_next_background_index{0};  //!< round-robin position of the next background job
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_OBJECTS_GUI_UPDATE_SCHEDULER_H_
@@ -20,31 +20,381 @@
 
 #include "job_log.h"
 
+#include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/background_executor.h>
+#include <oac_tree_gui/jobsystem/log_segment_file.h>
+
+#include <QDebug>
+#include <QDir>
+#include <QTemporaryDir>
+#include <algorithm>
+#include <limits>
+
 namespace oac_tree_gui
 {
 
+namespace
+{
+
+//! Number of blocks the in-memory part of the log is split to, when the capacity is set.
+const std::size_t kBlockCountPerCapacity = 4;
+
+//! Number of bytes of segments read back from disk and kept in memory. The most recently read
+//! segment is kept regardless of its size.
+const std::size_t kSegmentCacheSize = 16 * 1024 * 1024;
+
+//! Number of segment files waiting to be written, above which appending waits for the disk.
+const std::size_t kMaxPendingWriteCount = 4;
+
+}  // namespace
+
 JobLog::JobLog(QObject* parent_object) : QObject(parent_object) {}
 
+JobLog::~JobLog() = default;
+
 void JobLog::Append(const LogEvent& log_event)
 {
-  m_records.push_back(log_event);
-  emit LogEventAppended();
+  AppendRecord(log_event);
+  const int index = GetSize() - 1;
+  emit LogEventsAppended(index, index);
+}
+
+void JobLog::Append(const std::vector<LogEvent>& log_events)
+{
+  if (log_events.empty())
+  {
+    return;
+  }
+
+  const int first = GetSize();
+  for (const auto& log_event : log_events)
+  {
+    AppendRecord(log_event);
+  }
+  emit LogEventsAppended(first, GetSize() - 1);
 }
 
 void JobLog::ClearLog()
 {
-  m_records.clear();
+  if (m_segment_writer)
+  {
+    // the directory can be removed only when no file is being written into it
+    (void)m_segment_writer->CancelPending();
+    m_segment_writer->WaitForIdle();
+  }
+
+  m_size = 0;
+  m_blocks.clear();
+  m_segment_offsets.clear();
+  m_segment_severity_counts.clear();
+  m_segment_trigrams.clear();
+  m_unwritten_segments.clear();
+  m_segment_cache.clear();
+  m_segment_cache_size = 0;
+  m_spill_dir.reset();  // removes segment files
+  for (auto& indices : m_severity_indices)
+  {
+    indices.clear();
+  }
   emit LogCleared();
 }
 
 int JobLog::GetSize() const
 {
-  return static_cast<int>(m_records.size());
+  return static_cast<int>(m_size);
+}
+
+LogEvent JobLog::At(int index) const
+{
+  return ToLogEvent(GetRecord(index));
+}
+
+LogRecordView JobLog::GetRecord(int index) const
+{
+  if (index < 0 || static_cast<std::size_t>(index) >= m_size)
+  {
+    throw RuntimeException("Log record index is out of range");
+  }
+
+  const auto pos = static_cast<std::size_t>(index);
+  if (pos >= m_blocks.front().offset)
+  {
+    auto it = std::find_if(m_blocks.rbegin(), m_blocks.rend(),
+                           [pos](const auto& block) { return block.offset <= pos; });
+    return it->records->GetRecord(pos - it->offset);
+  }
+
+  auto it = std::upper_bound(m_segment_offsets.begin(), m_segment_offsets.end(), pos);
+  const auto segment_index = static_cast<std::size_t>(it - m_segment_offsets.begin()) - 1;
+  return GetSegment(segment_index).GetRecord(pos - m_segment_offsets[segment_index]);
+}
+
+std::size_t JobLog::GetCapacity() const
+{
+  return m_capacity;
+}
+
+void JobLog::SetCapacity(std::size_t capacity)
+{
+  m_capacity = capacity;
+}
+
+std::size_t JobLog::GetInMemorySize() const
+{
+  return m_blocks.empty() ? 0 : m_size - m_blocks.front().offset;
+}
+
+void JobLog::WaitForPendingWrites()
+{
+  if (m_segment_writer)
+  {
+    m_segment_writer->WaitForIdle();
+    DropWrittenSegments();
+  }
+}
+
+std::vector<int> JobLog::GetSeverityIndices(Severity severity, int first_index) const
+{
+  const auto severity_index = static_cast<std::size_t>(severity);
+  const auto& indices = m_severity_indices.at(severity_index);
+
+  std::vector<int> result;
+  for (std::size_t segment_index = 0; segment_index < m_segment_offsets.size(); ++segment_index)
+  {
+    const auto segment_offset = static_cast<int>(m_segment_offsets[segment_index]);
+    const auto segment_end = GetSegmentEnd(segment_index);
+    if (segment_end <= first_index || m_segment_severity_counts[segment_index][severity_index] == 0)
+    {
+      continue;
+    }
+
+    const auto& segment = GetSegment(segment_index);
+    for (int index = std::max(first_index, segment_offset); index < segment_end; ++index)
+    {
+      const auto pos = static_cast<std::size_t>(index - segment_offset);
+      if (segment.GetRecord(pos).severity == severity)
+      {
+        result.push_back(index);
+      }
+    }
+  }
+
+  auto it = std::lower_bound(indices.begin(), indices.end(), first_index);
+  result.insert(result.end(), it, indices.end());
+  return result;
+}
+
+std::vector<int> JobLog::FindRecords(const std::string& text, int first_index) const
+{
+  std::vector<int> result;
+  if (text.empty())
+  {
+    return result;
+  }
+
+  // segments on disk are read back only if they might contain the text
+  for (std::size_t segment_index = 0; segment_index < m_segment_offsets.size(); ++segment_index)
+  {
+    const auto segment_offset = static_cast<int>(m_segment_offsets[segment_index]);
+    const auto segment_end = GetSegmentEnd(segment_index);
+    if (segment_end <= first_index || !m_segment_trigrams[segment_index].MayContain(text))
+    {
+      continue;
+    }
+
+    const auto& segment = GetSegment(segment_index);
+    for (int index = std::max(first_index, segment_offset); index < segment_end; ++index)
+    {
+      const auto pos = static_cast<std::size_t>(index - segment_offset);
+      if (ContainsIgnoreCase(segment.GetRecord(pos).message, text))
+      {
+        result.push_back(index);
+      }
+    }
+  }
+
+  // records in memory are narrowed down with block indices, short queries are scanned
+  for (const auto& block : m_blocks)
+  {
+    const auto block_offset = static_cast<int>(block.offset);
+    auto check_record = [&block, block_offset, &text, &result](int index)
+    {
+      const auto pos = static_cast<std::size_t>(index - block_offset);
+      if (ContainsIgnoreCase(block.records->GetRecord(pos).message, text))
+      {
+        result.push_back(index);
+      }
+    };
+
+    const auto first_in_block = std::max(first_index, block_offset);
+    if (text.size() < LogSearchIndex::kMinQueryLength)
+    {
+      const auto block_end = block_offset + static_cast<int>(block.records->GetSize());
+      for (int index = first_in_block; index < block_end; ++index)
+      {
+        check_record(index);
+      }
+      continue;
+    }
+
+    const auto candidates = block.search_index.GetCandidates(text);
+    auto it = std::lower_bound(candidates.begin(), candidates.end(), first_in_block);
+    std::for_each(it, candidates.end(), check_record);
+  }
+  return result;
+}
+
+std::size_t JobLog::GetBlockSize() const
+{
+  if (m_capacity == 0)
+  {
+    return std::numeric_limits<std::size_t>::max();
+  }
+  return std::max<std::size_t>(1, m_capacity / kBlockCountPerCapacity);
+}
+
+int JobLog::GetInMemoryOffset() const
+{
+  return m_blocks.empty() ? GetSize() : static_cast<int>(m_blocks.front().offset);
+}
+
+int JobLog::GetSegmentEnd(std::size_t segment_index) const
+{
+  return segment_index + 1 < m_segment_offsets.size()
+             ? static_cast<int>(m_segment_offsets[segment_index + 1])
+             : GetInMemoryOffset();
+}
+
+void JobLog::AppendRecord(const LogEvent& log_event)
+{
+  if (m_blocks.empty() || m_blocks.back().records->GetSize() >= GetBlockSize())
+  {
+    m_blocks.push_back(Block{m_size, std::make_unique<LogRecordStorage>(), LogSearchIndex()});
+  }
+  m_blocks.back().records->Append(log_event);
+  m_blocks.back().search_index.AddRecord(static_cast<int>(m_size), log_event.message);
+
+  const auto severity_index =
+      std::min(static_cast<std::size_t>(log_event.severity), kSeverityCount - 1);
+  m_severity_indices[severity_index].push_back(static_cast<int>(m_size));
+  ++m_size;
+
+  while (m_capacity > 0 && m_blocks.size() > 1 && GetInMemorySize() > m_capacity)
+  {
+    SpillOldestBlock();
+  }
+}
+
+void JobLog::SpillOldestBlock()
+{
+  if (!m_spill_dir)
+  {
+    m_spill_dir = std::make_unique<QTemporaryDir>(QDir::tempPath() + "/oac-tree-gui-log-XXXXXX");
+    if (!m_spill_dir->isValid())
+    {
+      throw RuntimeException("Can't create directory for job log segments");
+    }
+  }
+
+  auto& block = m_blocks.front();
+  const auto segment_index = m_segment_offsets.size();
+  const auto block_end = static_cast<int>(block.offset + block.records->GetSize());
+  m_segment_offsets.push_back(block.offset);
+  m_segment_trigrams.push_back(block.search_index.CreateTrigramFilter());
+  WriteSegment(segment_index, std::move(block.records));
+  m_blocks.pop_front();
+
+  // dropping index entries of spilled records, only their per-severity counts are kept
+  severity_counts_t counts{};
+  for (std::size_t severity_index = 0; severity_index < kSeverityCount; ++severity_index)
+  {
+    auto& indices = m_severity_indices[severity_index];
+    auto it = std::lower_bound(indices.begin(), indices.end(), block_end);
+    counts[severity_index] = static_cast<std::size_t>(it - indices.begin());
+    indices.erase(indices.begin(), it);
+  }
+  m_segment_severity_counts.push_back(counts);
+}
+
+void JobLog::WriteSegment(std::size_t segment_index,
+                          std::shared_ptr<const LogRecordStorage> records)
+{
+  if (!m_segment_writer)
+  {
+    m_segment_writer = std::make_unique<BackgroundExecutor>(1);
+  }
+
+  DropWrittenSegments();
+  if (m_segment_writer->GetPendingCount() >= kMaxPendingWriteCount)
+  {
+    // the disk can't keep up, unwritten blocks would grow memory beyond the capacity
+    m_segment_writer->WaitForIdle();
+    DropWrittenSegments();
+  }
+
+  auto is_written = std::make_shared<std::atomic<bool>>(false);
+  auto write_task = [file_name = GetSegmentFileName(segment_index), records, is_written]()
+  {
+    try
+    {
+      WriteLogSegment(file_name, *records);
+      is_written->store(true);
+    }
+    catch (const std::exception& ex)
+    {
+      // records of the segment stay in memory, so nothing is lost
+      qWarning() << "Error in JobLog: " << ex.what();
+    }
+  };
+
+  m_unwritten_segments[segment_index] = UnwrittenSegment{std::move(records), is_written};
+  m_segment_writer->Submit(write_task);
+}
+
+void JobLog::DropWrittenSegments()
+{
+  for (auto it = m_unwritten_segments.begin(); it != m_unwritten_segments.end();)
+  {
+    it = it->second.is_written->load() ? m_unwritten_segments.erase(it) : std::next(it);
+  }
+}
+
+const LogRecordStorage& JobLog::GetSegment(std::size_t segment_index) const
+{
+  auto on_index = [segment_index](const auto& entry) { return entry.first == segment_index; };
+  auto it = std::find_if(m_segment_cache.begin(), m_segment_cache.end(), on_index);
+  if (it != m_segment_cache.end())
+  {
+    m_segment_cache.splice(m_segment_cache.begin(), m_segment_cache, it);
+    return *m_segment_cache.front().second;
+  }
+
+  std::shared_ptr<const LogRecordStorage> segment;
+  if (auto unwritten = m_unwritten_segments.find(segment_index);
+      unwritten != m_unwritten_segments.end())
+  {
+    segment = unwritten->second.records;  // still in memory, the file might not exist yet
+  }
+  else
+  {
+    auto storage = std::make_shared<LogRecordStorage>();
+    ReadLogSegment(GetSegmentFileName(segment_index), *storage);
+    segment = std::move(storage);
+  }
+
+  m_segment_cache_size += segment->GetAllocatedSize();
+  m_segment_cache.emplace_front(segment_index, std::move(segment));
+  while (m_segment_cache.size() > 1 && m_segment_cache_size > kSegmentCacheSize)
+  {
+    m_segment_cache_size -= m_segment_cache.back().second->GetAllocatedSize();
+    m_segment_cache.pop_back();
+  }
+  return *m_segment_cache.front().second;
 }
 
-LogEvent& JobLog::At(int index)
+std::string JobLog::GetSegmentFileName(std::size_t segment_index) const
 {
-  return m_records.at(index);
+  return m_spill_dir->filePath(QString("segment_%1.log").arg(segment_index)).toStdString();
 }
 
 }  // namespace oac_tree_gui
@@ -22,15 +22,36 @@
 #define OAC_TREE_GUI_JOBSYSTEM_OBJECTS_JOB_LOG_H_
 
 #include <oac_tree_gui/jobsystem/log_event.h>
+#include <oac_tree_gui/jobsystem/log_record_storage.h>
+#include <oac_tree_gui/jobsystem/log_search_index.h>
 
 #include <QObject>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <list>
+#include <map>
+#include <memory>
 #include <vector>
 
+class QTemporaryDir;
+
 namespace oac_tree_gui
 {
 
+class BackgroundExecutor;
+
 /**
  * @brief The JobLog class holds all messages of running job in chronological order.
+ *
+ * Messages are kept in a compact form, see LogRecordStorage. When the capacity is set, only the
+ * most recent records stay in memory. Older records are written, block by block, into segment
+ * files in a temporary directory, and read back on request. The full history remains
+ * accessible via the same index, while memory consumption stays bounded.
+ *
+ * Segment files are written by a background thread, so appending records doesn't wait for the
+ * disk. The block stays readable from memory until its file is written. Only when the disk falls
+ * behind by several blocks, appending waits for pending writes, to keep memory bounded.
  */
 class JobLog : public QObject
 {
@@ -38,21 +59,135 @@ class JobLog : public QObject
 
 public:
   explicit JobLog(QObject* parent_object = nullptr);
+  ~JobLog() override;
 
   void Append(const LogEvent& log_event);
 
+  /**
+   * @brief Appends all log events at once, and emits a single notification.
+   */
+  void Append(const std::vector<LogEvent>& log_events);
+
   void ClearLog();
 
   int GetSize() const;
 
-  LogEvent& At(int index);
+  /**
+   * @brief Reconstructs the log event with the given index.
+   */
+  LogEvent At(int index) const;
+
+  /**
+   * @brief Returns the view on the record with the given index, without making string copies.
+   *
+   * String views of records spilled to disk remain valid until the next call of this method.
+   */
+  LogRecordView GetRecord(int index) const;
+
+  /**
+   * @brief Returns the maximum number of records kept in memory, 0 means no limit.
+   */
+  std::size_t GetCapacity() const;
+
+  /**
+   * @brief Sets the maximum number of records kept in memory, 0 means no limit.
+   *
+   * The in-memory part can exceed the capacity by one block, which is a quarter of the capacity.
+   */
+  void SetCapacity(std::size_t capacity);
+
+  /**
+   * @brief Returns the number of records currently kept in memory.
+   */
+  std::size_t GetInMemorySize() const;
+
+  /**
+   * @brief Waits till all spilled segments are written to disk, and releases their memory.
+   */
+  void WaitForPendingWrites();
+
+  /**
+   * @brief Returns indices of records with the given severity, in ascending order.
+   *
+   * Records kept in memory are filtered with the index without reading them. Segments spilled to
+   * disk are read back only if they contain records of the given severity.
+   *
+   * @param severity The severity to look for.
+   * @param first_index Index of the record to start from.
+   */
+  std::vector<int> GetSeverityIndices(Severity severity, int first_index = 0) const;
+
+  /**
+   * @brief Returns indices of records whose message contains the given text, ignoring case.
+   *
+   * Queries of three and more characters are narrowed down with trigrams: records in memory with
+   * the trigram index, and segments spilled to disk with their trigram sets, so only segments
+   * which might contain the query are read back. Shorter queries can't be narrowed down, they scan
+   * the whole log, including all segments on disk.
+   *
+   * @param text The text to search.
+   * @param first_index Index of the record to start the search from.
+   */
+  std::vector<int> FindRecords(const std::string& text, int first_index = 0) const;
 
 signals:
-  void LogEventAppended();
+  /**
+   * @brief Reports that records with indices in the range [first, last] have been appended.
+   */
+  void LogEventsAppended(int first, int last);
+
   void LogCleared();
 
 private:
-  std::vector<LogEvent> m_records;
+  struct Block
+  {
+    std::size_t offset{0};  //!< index of the first record of the block in the whole log
+    std::unique_ptr<LogRecordStorage> records;
+    LogSearchIndex search_index;  //!< trigram index of block messages, dropped with the block
+  };
+
+  /**
+   * @brief The UnwrittenSegment struct holds records of the segment while its file is written.
+   */
+  struct UnwrittenSegment
+  {
+    std::shared_ptr<const LogRecordStorage> records;
+    std::shared_ptr<std::atomic<bool>> is_written;  //!< set by the writer thread
+  };
+
+  using severity_counts_t = std::array<std::size_t, kSeverityCount>;
+
+  std::size_t GetBlockSize() const;
+  int GetInMemoryOffset() const;
+  int GetSegmentEnd(std::size_t segment_index) const;
+  void AppendRecord(const LogEvent& log_event);
+  void SpillOldestBlock();
+  void WriteSegment(std::size_t segment_index, std::shared_ptr<const LogRecordStorage> records);
+  void DropWrittenSegments();
+  const LogRecordStorage& GetSegment(std::size_t segment_index) const;
+  std::string GetSegmentFileName(std::size_t segment_index) const;
+
+  std::size_t m_capacity{0};
+  std::size_t m_size{0};                       //!< total number of records
+  std::deque<Block> m_blocks;                  //!< records in memory
+  std::vector<std::size_t> m_segment_offsets;  //!< index of the first record of every segment
+  std::unique_ptr<QTemporaryDir> m_spill_dir;
+  std::vector<severity_counts_t> m_segment_severity_counts;  //!< per-segment record counts
+  std::vector<LogTrigramFilter> m_segment_trigrams;          //!< per-segment message trigrams
+
+  //!< indices of records in memory, entries of spilled records are dropped together with blocks
+  std::array<std::vector<int>, kSeverityCount> m_severity_indices;
+
+  //!< spilled segments whose files might not be written yet
+  std::map<std::size_t, UnwrittenSegment> m_unwritten_segments;
+
+  //!< writes segment files, declared after the directory to finish writing before its removal
+  std::unique_ptr<BackgroundExecutor> m_segment_writer;
+
+  //!< recently read segments, most recent first
+  mutable std::list<std::pair<std::size_t, std::shared_ptr<const LogRecordStorage>>>
+      m_segment_cache;
+  mutable std::size_t m_segment_cache_size{0};  //!< bytes allocated by cached segments
 };
 
 }  // namespace oac_tree_gui
@@ -21,14 +21,19 @@
 #include "job_manager.h"
 
 #include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/job_scheduler.h>
+#include <oac_tree_gui/jobsystem/objects/gui_update_scheduler.h>
 #include <oac_tree_gui/jobsystem/objects/local_job_handler.h>
 #include <oac_tree_gui/model/instruction_item.h>
+#include <oac_tree_gui/model/job_item.h>
 
+#include <mvvm/model/item_utils.h>
 #include <mvvm/utils/container_utils.h>
 
 #include <sup/dto/anyvalue.h>
 
 #include <algorithm>
+#include <iterator>
 
 namespace oac_tree_gui
 {
@@ -47,10 +52,33 @@ bool IsResetRequired(RunnerStatus runner_status)
   return mvvm::utils::Contains(kStatesRequiringReset, runner_status);
 }
 
+/**
+ * @brief Checks if the job with the given status occupies the domain runner.
+ */
+bool IsBusyStatus(RunnerStatus runner_status)
+{
+  return runner_status == RunnerStatus::kRunning || runner_status == RunnerStatus::kPaused
+         || runner_status == RunnerStatus::kStepping;
+}
+
+/**
+ * @brief Checks if the start of the job is subject to the limit of running jobs.
+ *
+ * Only local jobs occupy the cores of this machine. The handler has to report its status to
+ * release the slot when the job finishes.
+ */
+bool IsScheduledJob(const IJobHandler* job_handler)
+{
+  return dynamic_cast<const LocalJobHandler*>(job_handler) != nullptr;
+}
+
 }  // namespace
 
 JobManager::JobManager(create_handler_func_t create_handler_func, QObject* parent_object)
-    : QObject(parent_object), m_create_handler_func(std::move(create_handler_func))
+    : QObject(parent_object)
+    , m_job_scheduler(std::make_unique<JobScheduler>())
+    , m_create_handler_func(std::move(create_handler_func))
+    , m_update_scheduler(std::make_unique<GuiUpdateScheduler>())
 {
   if (!m_create_handler_func)
   {
@@ -86,20 +114,22 @@ void JobManager::SubmitJob(JobItem* job)
 
 IJobHandler* JobManager::GetJobHandler(JobItem* job)
 {
-  auto on_element = [job](const auto& handler) { return handler->GetJobItem() == job; };
-  auto pos = std::find_if(m_job_handlers.begin(), m_job_handlers.end(), on_element);
-  return pos == m_job_handlers.end() ? nullptr : pos->get();
+  auto pos = m_job_handler_index.find(job);
+  return pos == m_job_handler_index.end() ? nullptr : pos->second->get();
 }
 
 void JobManager::Start(JobItem* item)
 {
   if (auto job_handler = GetJobHandler(item); job_handler)
   {
-    if (IsResetRequired(job_handler->GetRunnerStatus()))
+    // resuming a paused job doesn't wait for a free slot
+    if (IsScheduledJob(job_handler) && !IsBusyStatus(job_handler->GetRunnerStatus())
+        && !m_job_scheduler->RequestStart(job_handler, item->GetPriority()))
     {
-      Reset(item);
+      item->SetStatus(RunnerStatus::kQueued);
+      return;
     }
-    job_handler->Start();
+    StartJobHandler(job_handler);
   }
 }
 
@@ -107,6 +137,10 @@ void JobManager::Pause(JobItem* item)
 {
   if (auto job_handler = GetJobHandler(item); job_handler)
   {
+    if (m_job_scheduler->IsQueued(job_handler))
+    {
+      return;
+    }
     job_handler->Pause();
   }
 }
@@ -115,6 +149,10 @@ void JobManager::Stop(JobItem* item)
 {
   if (auto job_handler = GetJobHandler(item); job_handler)
   {
+    if (CancelQueuedJob(job_handler))
+    {
+      return;
+    }
     job_handler->Stop();
   }
 }
@@ -123,10 +161,13 @@ void JobManager::Step(JobItem* item)
 {
   if (auto job_handler = GetJobHandler(item); job_handler)
   {
+    // stepping is interactive, it doesn't wait in the queue
+    (void)CancelQueuedJob(job_handler);
     if (IsResetRequired(job_handler->GetRunnerStatus()))
     {
       Reset(item);
     }
+    (void)m_busy_job_handlers.insert(job_handler);
     job_handler->Step();
   }
 }
@@ -140,27 +181,144 @@ void JobManager::RemoveJobHandler(JobItem* job)
       throw RuntimeException("Attempt to modify running job");
     }
 
-    auto on_element = [job](auto& handler) { return handler->GetJobItem() == job; };
-    m_job_handlers.erase(std::remove_if(m_job_handlers.begin(), m_job_handlers.end(), on_element),
-                         m_job_handlers.end());
+    m_update_scheduler->UnregisterJob(job);
+
+    (void)m_busy_job_handlers.erase(job_handler);
+    const bool is_slot_released = m_job_scheduler->Release(job_handler);
+    auto pos = m_job_handler_index.find(job);
+    (void)m_job_handlers.erase(pos->second);
+    (void)m_job_handler_index.erase(pos);
+
+    if (is_slot_released)
+    {
+      StartQueuedJobs();
+    }
   }
 }
 
 bool JobManager::HasRunningJobs() const
 {
-  return std::any_of(m_job_handlers.begin(), m_job_handlers.end(),
+  // queued jobs will be running soon
+  if (m_job_scheduler->GetQueuedCount() > 0)
+  {
+    return true;
+  }
+
+  // status notifications lag behind the domain, the handler itself has the last word
+  return std::any_of(m_busy_job_handlers.begin(), m_busy_job_handlers.end(),
                      [](const auto& handler) { return handler->IsRunning(); });
 }
 
 void JobManager::StopAllJobs()
 {
-  std::for_each(m_job_handlers.begin(), m_job_handlers.end(),
+  // queued jobs shouldn't take the slots of stopped jobs
+  for (auto job_handler : m_job_scheduler->CancelAll())
+  {
+    job_handler->GetJobItem()->SetStatus(job_handler->GetRunnerStatus());
+  }
+
+  // stopping might trigger status notifications, which modify the set
+  const std::vector<IJobHandler*> busy_job_handlers(m_busy_job_handlers.begin(),
+                                                    m_busy_job_handlers.end());
+  std::for_each(busy_job_handlers.begin(), busy_job_handlers.end(),
                 [](const auto& handler) { handler->Stop(); });
 }
 
 void JobManager::SetActiveJob(JobItem* item)
 {
   m_active_job = item;
+  m_update_scheduler->SetActiveJob(item);
+
+  // changes of active instructions are relative, the view needs the full list to start from
+  if (auto abstract_handler = dynamic_cast<AbstractJobHandler*>(GetJobHandler(item)))
+  {
+    emit ActiveInstructionChanged(abstract_handler->GetActiveInstructions());
+  }
+}
+
+void JobManager::StartJobs(const std::vector<JobItem*>& items)
+{
+  std::for_each(items.begin(), items.end(), [this](auto item) { Start(item); });
+}
+
+void JobManager::StopJobs(const std::vector<JobItem*>& items)
+{
+  std::for_each(items.begin(), items.end(), [this](auto item) { Stop(item); });
+}
+
+void JobManager::ResetJobs(const std::vector<JobItem*>& items)
+{
+  std::for_each(items.begin(), items.end(), [this](auto item) { Reset(item); });
+}
+
+void JobManager::SetGuiRefreshRate(int active_rate, int background_rate)
+{
+  m_update_scheduler->SetRefreshRate(active_rate, background_rate);
+
+  for (const auto& job_handler : m_job_handlers)
+  {
+    if (auto abstract_handler = dynamic_cast<AbstractJobHandler*>(job_handler.get()))
+    {
+      UpdateEventPacing(*abstract_handler);
+    }
+  }
+}
+
+void JobManager::SetMaxRunningJobCount(std::size_t max_running_count)
+{
+  m_job_scheduler->SetMaxRunningCount(max_running_count);
+  StartQueuedJobs();
+}
+
+std::size_t JobManager::GetMaxRunningJobCount() const
+{
+  return m_job_scheduler->GetMaxRunningCount();
+}
+
+std::size_t JobManager::GetQueuedJobCount() const
+{
+  return m_job_scheduler->GetQueuedCount();
+}
+
+const InstructionProfileEntry* JobManager::FindInstructionProfile(const InstructionItem& item)
+{
+  auto job_item = const_cast<JobItem*>(mvvm::utils::FindItemUp<JobItem>(&item));
+  if (job_item == nullptr)
+  {
+    return nullptr;
+  }
+
+  auto abstract_handler = dynamic_cast<AbstractJobHandler*>(GetJobHandler(job_item));
+  return abstract_handler ? abstract_handler->FindInstructionProfile(item) : nullptr;
+}
+
+void JobManager::StartJobHandler(IJobHandler* job_handler)
+{
+  if (IsResetRequired(job_handler->GetRunnerStatus()))
+  {
+    job_handler->Reset();
+  }
+  (void)m_busy_job_handlers.insert(job_handler);
+  job_handler->Start();
+}
+
+void JobManager::StartQueuedJobs()
+{
+  for (auto job_handler : m_job_scheduler->TakeReadyJobs())
+  {
+    StartJobHandler(job_handler);
+  }
+}
+
+bool JobManager::CancelQueuedJob(IJobHandler* job_handler)
+{
+  if (!m_job_scheduler->Cancel(job_handler))
+  {
+    return false;
+  }
+
+  job_handler->GetJobItem()->SetStatus(job_handler->GetRunnerStatus());
+  return true;
 }
 
 void JobManager::OnActiveInstructionChanged(
@@ -175,10 +333,56 @@ void JobManager::OnActiveInstructionChanged(
   }
 }
 
+void JobManager::OnActiveInstructionUpdated(const std::vector<InstructionItem*>& added,
+                                            const std::vector<InstructionItem*>& removed)
+{
+  auto sending_job_handler = qobject_cast<AbstractJobHandler*>(sender());
+
+  if (sending_job_handler->GetJobItem() == m_active_job)
+  {
+    emit ActiveInstructionUpdated(added, removed);
+  }
+}
+
+void JobManager::OnInstructionProfileUpdated(const std::vector<InstructionItem*>& instructions)
+{
+  auto sending_job_handler = qobject_cast<AbstractJobHandler*>(sender());
+
+  if (sending_job_handler->GetJobItem() == m_active_job)
+  {
+    emit InstructionProfileUpdated(instructions);
+  }
+}
+
+void JobManager::OnRunnerStatusChanged(RunnerStatus status)
+{
+  auto sending_job_handler = qobject_cast<AbstractJobHandler*>(sender());
+  if (sending_job_handler == nullptr)
+  {
+    return;
+  }
+
+  if (IsBusyStatus(status))
+  {
+    (void)m_busy_job_handlers.insert(sending_job_handler);
+  }
+  else
+  {
+    (void)m_busy_job_handlers.erase(sending_job_handler);
+  }
+
+  // the finished job gives its slot to the next queued job
+  if (IsResetRequired(status) && m_job_scheduler->Release(sending_job_handler))
+  {
+    StartQueuedJobs();
+  }
+}
+
 void JobManager::Reset(JobItem* item)
 {
   if (auto job_handler = GetJobHandler(item); job_handler)
   {
+    (void)CancelQueuedJob(job_handler);
     job_handler->Reset();
   }
 }
@@ -196,9 +400,32 @@ void JobManager::InsertJobHandler(std::unique_ptr<IJobHandler> job_handler)
   {
     connect(abstract_handler, &AbstractJobHandler::ActiveInstructionChanged, this,
             &JobManager::OnActiveInstructionChanged);
+    connect(abstract_handler, &AbstractJobHandler::ActiveInstructionUpdated, this,
+            &JobManager::OnActiveInstructionUpdated);
+    connect(abstract_handler, &AbstractJobHandler::InstructionProfileUpdated, this,
+            &JobManager::OnInstructionProfileUpdated);
+    connect(abstract_handler, &AbstractJobHandler::RunnerStatusChanged, this,
+            &JobManager::OnRunnerStatusChanged);
+
+    auto process_events = [abstract_handler](auto deadline)
+    { abstract_handler->ProcessPendingEvents(deadline); };
+    m_update_scheduler->RegisterJob(job_item, process_events);
+
+    connect(abstract_handler, &AbstractJobHandler::GuiThrottleRequiredChanged, this,
+            [this, abstract_handler]() { UpdateEventPacing(*abstract_handler); });
+    UpdateEventPacing(*abstract_handler);
   }
 
   m_job_handlers.push_back(std::move(job_handler));
+  m_job_handler_index[job_item] = std::prev(m_job_handlers.end());
+  emit JobSubmitted(job_item);
+}
+
+void JobManager::UpdateEventPacing(AbstractJobHandler& job_handler)
+{
+  const bool is_throttled = job_handler.IsGuiThrottleRequired();
+  m_update_scheduler->SetJobThrottled(job_handler.GetJobItem(), is_throttled);
+  job_handler.SetEventPacingEnabled(m_update_scheduler->IsEnabled() || is_throttled);
 }
 
 }  // namespace oac_tree_gui
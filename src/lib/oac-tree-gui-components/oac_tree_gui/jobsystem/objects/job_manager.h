@@ -24,13 +24,20 @@
 #include <oac_tree_gui/jobsystem/i_job_item_manager.h>
 
 #include <QObject>
+#include <list>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace oac_tree_gui
 {
 
+class AbstractJobHandler;
 class JobModel;
 class InstructionItem;
+struct InstructionProfileEntry;
+class GuiUpdateScheduler;
+class JobScheduler;
 
 /**
  * @brief The JobManager class manages the execution of sequencer jobs.
@@ -40,6 +47,17 @@ class InstructionItem;
  *
  * JobManager holds all jobs, submitted, paused, or running. Only one job at a time, set as the
  * active job, can report its status up.
+ *
+ * Handlers are indexed by their JobItem, and jobs which might be running are tracked using job
+ * state notifications, so managing hundreds of jobs costs constant time per job operation.
+ *
+ * The number of concurrently running local jobs is limited by JobScheduler, by default to the
+ * number of cores. Jobs started above the limit get the "Queued" status, and start one by one, in
+ * the order of their priority, as running jobs finish.
+ *
+ * Optionally, GUI updates of all jobs can be paced by the common GuiUpdateScheduler. Then domain
+ * events of all jobs are propagated to the GUI in one pass at the given refresh rate, with the
+ * active job having priority over background jobs.
  */
 class JobManager : public QObject, public IJobItemManager
 {
@@ -82,8 +100,63 @@ public:
 
   void SetActiveJob(JobItem* item) override;
 
+  /**
+   * @brief Starts all given jobs.
+   */
+  void StartJobs(const std::vector<JobItem*>& items);
+
+  /**
+   * @brief Stops all given jobs.
+   */
+  void StopJobs(const std::vector<JobItem*>& items);
+
+  /**
+   * @brief Resets all given jobs to the initial state.
+   */
+  void ResetJobs(const std::vector<JobItem*>& items);
+
+  /**
+   * @brief Sets the refresh rate of GUI updates.
+   *
+   * @param active_rate Number of updates per second for the active job, 0 means that every job
+   * updates the GUI as soon as domain events arrive.
+   * @param background_rate Number of updates per second for all other jobs.
+   */
+  void SetGuiRefreshRate(int active_rate, int background_rate);
+
+  /**
+   * @brief Sets maximum number of concurrently running local jobs, 0 means no limit.
+   *
+   * Raising the limit starts queued jobs immediately.
+   */
+  void SetMaxRunningJobCount(std::size_t max_running_count);
+
+  /**
+   * @brief Returns maximum number of concurrently running local jobs.
+   */
+  std::size_t GetMaxRunningJobCount() const;
+
+  /**
+   * @brief Returns number of jobs waiting for a free slot to start.
+   */
+  std::size_t GetQueuedJobCount() const;
+
+  /**
+   * @brief Returns the execution profile of the given instruction of an expanded procedure, or
+   * nullptr if there is no profile yet.
+   */
+  const InstructionProfileEntry* FindInstructionProfile(const InstructionItem& item);
+
 signals:
+  /**
+   * @brief Notifies that the handler of the given job has been created and its log is available.
+   */
+  void JobSubmitted(oac_tree_gui::JobItem* job);
+
   void ActiveInstructionChanged(const std::vector<oac_tree_gui::InstructionItem*>&);
+  void ActiveInstructionUpdated(const std::vector<oac_tree_gui::InstructionItem*>& added,
+                                const std::vector<oac_tree_gui::InstructionItem*>& removed);
+  void InstructionProfileUpdated(const std::vector<oac_tree_gui::InstructionItem*>& instructions);
 
 private:
   /**
@@ -91,15 +164,65 @@ private:
    */
   void InsertJobHandler(std::unique_ptr<IJobHandler> job_handler);
 
+  /**
+   * @brief Enables paced processing of events of the given job, when the scheduler is enabled, or
+   * the job requires throttled GUI updates.
+   */
+  void UpdateEventPacing(AbstractJobHandler& job_handler);
+
   /**
    * @brief Process "Active instructions" events from all job handlers, forwards active job
    * notifications up.
    */
   void OnActiveInstructionChanged(const std::vector<oac_tree_gui::InstructionItem*>&);
 
-  std::vector<std::unique_ptr<IJobHandler>> m_job_handlers;
+  /**
+   * @brief Process changes of active instructions from all job handlers, forwards active job
+   * notifications up.
+   */
+  void OnActiveInstructionUpdated(const std::vector<oac_tree_gui::InstructionItem*>& added,
+                                  const std::vector<oac_tree_gui::InstructionItem*>& removed);
+
+  /**
+   * @brief Process profile updates from all job handlers, forwards active job notifications up.
+   */
+  void OnInstructionProfileUpdated(const std::vector<oac_tree_gui::InstructionItem*>& instructions);
+
+  /**
+   * @brief Starts the job, the job is expected to be admitted by the scheduler.
+   */
+  void StartJobHandler(IJobHandler* job_handler);
+
+  /**
+   * @brief Starts queued jobs, while there are free slots.
+   */
+  void StartQueuedJobs();
+
+  /**
+   * @brief Removes the job from the queue, and restores its status.
+   *
+   * @return True if the job was queued.
+   */
+  bool CancelQueuedJob(IJobHandler* job_handler);
+
+  /**
+   * @brief Updates the list of jobs which might be running, on job status change.
+   */
+  void OnRunnerStatusChanged(oac_tree_gui::RunnerStatus status);
+
+  using handler_list_t = std::list<std::unique_ptr<IJobHandler>>;
+
+  handler_list_t m_job_handlers;  //!< handlers in the order of submission
+  std::unordered_map<JobItem*, handler_list_t::iterator> m_job_handler_index;
+
+  //!< handlers which were started, or reported a busy status, and haven't reported finishing yet
+  std::unordered_set<IJobHandler*> m_busy_job_handlers;
   JobItem* m_active_job{nullptr};  //!< job which is allowed to send signals up
+  std::unique_ptr<JobScheduler> m_job_scheduler;  //!< limits the number of running local jobs
   create_handler_func_t m_create_handler_func;
+
+  //!< paces GUI updates of all jobs, declared last to stop calling handlers before they are gone
+  std::unique_ptr<GuiUpdateScheduler> m_update_scheduler;
 };
 
 }  // namespace oac_tree_gui
@@ -38,6 +38,16 @@
 namespace oac_tree_gui
 {
 
+namespace
+{
+
+/**
+ * @brief Tick timeouts below this value lead to throttled GUI updates.
+ */
+const std::chrono::milliseconds kGuiThrottleThreshold{5};
+
+}  // namespace
+
 LocalJobHandler::LocalJobHandler(JobItem* job_item, UserContext user_context)
     : AbstractJobHandler(job_item)
 {
@@ -66,7 +76,7 @@ std::unique_ptr<AbstractDomainRunner> LocalJobHandler::CreateDomainRunner(
   // LocalDomainRunner's internals call Setup on the domain procedure
   auto runner = std::make_unique<LocalDomainRunner>(CreateEventDispatcherContext(),
                                                     std::move(user_context), std::move(procedure));
-  runner->SetTickTimeout(std::chrono::milliseconds(GetJobItem()->GetTickTimeout()));
+  ApplyTickTimeout(*runner);
   return runner;
 }
 
@@ -77,10 +87,17 @@ void LocalJobHandler::SetupPropertyListener()
   {
     if (event.name == itemconstants::kTickTimeout)
     {
-      GetDomainRunner()->SetTickTimeout(std::chrono::milliseconds(GetJobItem()->GetTickTimeout()));
+      ApplyTickTimeout(*GetDomainRunner());
     }
   };
   m_property_listener->Connect<mvvm::PropertyChangedEvent>(on_event);
 }
 
+void LocalJobHandler::ApplyTickTimeout(AbstractDomainRunner& runner)
+{
+  const auto timeout = GetJobItem()->GetTickTimeout();
+  runner.SetTickTimeout(timeout);
+  SetGuiThrottleRequired(timeout < kGuiThrottleThreshold);
+}
+
 }  // namespace oac_tree_gui
@@ -65,6 +65,14 @@ private:
    */
   void SetupPropertyListener();
 
+  /**
+   * @brief Propagates the tick timeout of the job item to the given domain runner.
+   *
+   * Job running at full, or almost full, speed requires throttled GUI updates, so the flood of
+   * events doesn't freeze the GUI.
+   */
+  void ApplyTickTimeout(AbstractDomainRunner& runner);
+
   //!< dedicated listener to provide communication between domain/GUI workspace variables
   std::unique_ptr<WorkspaceItemListener> m_workspace_item_listener;
 
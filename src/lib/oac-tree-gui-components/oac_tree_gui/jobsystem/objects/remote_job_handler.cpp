@@ -41,20 +41,28 @@ RemoteJobHandler::RemoteJobHandler(JobItem* job_item, sup::oac_tree_server::IJob
                                              std::move(user_context), manager, job_index));
 }
 
+RemoteJobHandler::RemoteJobHandler(JobItem* job_item, PreparedRemoteJob prepared_job,
+                                   UserContext user_context)
+    : AbstractJobHandler(job_item)
+{
+  Setup(std::make_unique<RemoteDomainRunner>(CreateEventDispatcherContext(),
+                                             std::move(user_context), std::move(prepared_job)));
+}
+
 RemoteJobHandler::~RemoteJobHandler() = default;
 
 void RemoteJobHandler::OnVariableUpdatedEvent(const VariableUpdatedEvent& event)
 {
   if (auto item = GetItemBuilder()->GetVariable(event.index); item)
   {
-    if (event.connected && sup::dto::IsEmptyValue(event.value) && !item->IsAvailable())
+    if (event.connected && sup::dto::IsEmptyValue(event.value.Get()) && !item->IsAvailable())
     {
       item->SetIsAvailable(event.connected);
       return;
     }
 
     item->SetIsAvailable(event.connected);
-    UpdateAnyValue(event.value, *item);
+    UpdateAnyValue(event.value.Get(), *item);
   }
   else
   {
@@ -22,13 +22,9 @@
 #define OAC_TREE_GUI_JOBSYSTEM_OBJECTS_REMOTE_JOB_HANDLER_H_
 
 #include <oac_tree_gui/jobsystem/objects/abstract_job_handler.h>
+#include <oac_tree_gui/jobsystem/remote_domain_runner.h>
 #include <oac_tree_gui/jobsystem/user_context.h>
 
-namespace sup::oac_tree_server
-{
-class IJobManager;
-}
-
 namespace oac_tree_gui
 {
 
@@ -42,6 +38,11 @@ class RemoteJobHandler : public AbstractJobHandler
 public:
   RemoteJobHandler(JobItem* job_item, sup::oac_tree_server::IJobManager& manager,
                    std::size_t job_index, UserContext user_context);
+
+  /**
+   * @brief Creates the handler for the remote job connected in advance, see PrepareRemoteJob.
+   */
+  RemoteJobHandler(JobItem* job_item, PreparedRemoteJob prepared_job, UserContext user_context);
   ~RemoteJobHandler() override;
 
   RemoteJobHandler(const RemoteJobHandler&) = delete;
@@ -0,0 +1,244 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "remote_job_importer.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/background_executor.h>
+#include <oac_tree_gui/jobsystem/i_automation_client.h>
+#include <oac_tree_gui/jobsystem/i_remote_connection_service.h>
+#include <oac_tree_gui/jobsystem/remote_connection_info.h>
+
+#include <QMetaObject>
+
+namespace oac_tree_gui
+{
+
+namespace
+{
+
+/**
+ * @brief Returns the client connected with the server, connecting if necessary.
+ */
+IAutomationClient& GetConnectedClient(IRemoteConnectionService& connection_service,
+                                      const std::string& server_name)
+{
+  if (!connection_service.Connect(server_name))
+  {
+    throw RuntimeException("Can't connect to server [" + server_name + "]");
+  }
+  return connection_service.GetAutomationClient(server_name);
+}
+
+}  // namespace
+
+RemoteJobImporter::RemoteJobImporter(IRemoteConnectionService& connection_service,
+                                     std::size_t max_thread_count, QObject* parent_object)
+    : QObject(parent_object)
+    , m_connection_service(connection_service)
+    , m_executor(std::make_unique<BackgroundExecutor>(max_thread_count))
+{
+}
+
+RemoteJobImporter::~RemoteJobImporter()
+{
+  Cancel();
+  // tasks reference the importer, waiting for those already running
+  m_executor.reset();
+  DiscardUndeliveredResults();
+}
+
+void RemoteJobImporter::Connect(const std::string& server_name)
+{
+  auto task = [this, server_name]() -> TaskResult
+  {
+    try
+    {
+      auto& client = GetConnectedClient(m_connection_service, server_name);
+
+      std::vector<std::string> procedure_names;
+      const auto job_count = client.GetJobCount();
+      procedure_names.reserve(job_count);
+      for (std::size_t job_index = 0; job_index < job_count; ++job_index)
+      {
+        procedure_names.push_back(client.GetProcedureName(static_cast<std::uint32_t>(job_index)));
+      }
+
+      return {[this, server_name, procedure_names]()
+              { emit Connected(server_name, procedure_names); },
+              {}};
+    }
+    catch (const std::exception& ex)
+    {
+      return {[this, server_name, message = std::string(ex.what())]()
+              { emit ConnectionFailed(server_name, message); },
+              {}};
+    }
+  };
+
+  Submit(task, /*is_import*/ false);
+}
+
+void RemoteJobImporter::Import(const RemoteConnectionInfo& connection_info)
+{
+  const auto server_name = connection_info.server_name;
+  for (auto job_index : connection_info.job_indexes)
+  {
+    auto task = [this, server_name, job_index]() -> TaskResult
+    {
+      try
+      {
+        GetConnectedClient(m_connection_service, server_name)
+            .PrepareJob(static_cast<std::uint32_t>(job_index));
+        return {[this, server_name, job_index]() { emit JobPrepared(server_name, job_index); },
+                [this, server_name, job_index]() { DiscardJob(server_name, job_index); }};
+      }
+      catch (const std::exception& ex)
+      {
+        return {[this, server_name, job_index, message = std::string(ex.what())]()
+                { emit JobPreparationFailed(server_name, job_index, message); },
+                {}};
+      }
+    };
+
+    Submit(task, /*is_import*/ true);
+  }
+
+  if (!connection_info.job_indexes.empty())
+  {
+    emit ProgressChanged(m_completed_count, m_total_count);
+  }
+}
+
+void RemoteJobImporter::Cancel()
+{
+  ++m_generation;
+  (void)m_executor->CancelPending();
+  m_total_count = 0;
+  m_completed_count = 0;
+}
+
+bool RemoteJobImporter::IsBusy() const
+{
+  return m_completed_count < m_total_count;
+}
+
+void RemoteJobImporter::DiscardJob(const std::string& server_name, std::size_t job_index)
+{
+  if (m_connection_service.HasClient(server_name))
+  {
+    m_connection_service.GetAutomationClient(server_name)
+        .DiscardPreparedJob(static_cast<std::uint32_t>(job_index));
+  }
+}
+
+void RemoteJobImporter::Submit(std::function<TaskResult()> task, bool is_import)
+{
+  if (is_import)
+  {
+    ++m_total_count;
+  }
+  const auto generation = m_generation.load();
+
+  auto background_task = [this, generation, is_import, task = std::move(task)]()
+  {
+    if (generation != m_generation.load())
+    {
+      return;  // cancelled before start
+    }
+
+    auto result = task();
+    if (generation != m_generation.load())
+    {
+      // cancelled while running, the importer might be already waiting for the task in d-tor
+      if (result.discard)
+      {
+        result.discard();
+      }
+      return;
+    }
+
+    // reporting in the thread of the importer, the cancellation is checked there once again
+    const auto result_id = result.discard ? AddUndeliveredResult(result.discard) : 0;
+    auto on_result = [this, generation, is_import, result_id, result = std::move(result)]()
+    {
+      RemoveUndeliveredResult(result_id);
+      if (generation != m_generation.load())
+      {
+        if (result.discard)
+        {
+          result.discard();
+        }
+        return;
+      }
+      result.report();
+      if (is_import)
+      {
+        OnJobCompleted();
+      }
+    };
+    (void)QMetaObject::invokeMethod(this, on_result, Qt::QueuedConnection);
+  };
+
+  m_executor->Submit(background_task);
+}
+
+void RemoteJobImporter::OnJobCompleted()
+{
+  ++m_completed_count;
+  emit ProgressChanged(m_completed_count, m_total_count);
+
+  if (m_completed_count == m_total_count)
+  {
+    m_total_count = 0;
+    m_completed_count = 0;
+    emit ImportFinished();
+  }
+}
+
+std::uint64_t RemoteJobImporter::AddUndeliveredResult(std::function<void()> discard)
+{
+  const std::scoped_lock lock{m_undelivered_mutex};
+  const auto result_id = ++m_last_result_id;
+  (void)m_undelivered_results.emplace(result_id, std::move(discard));
+  return result_id;
+}
+
+void RemoteJobImporter::RemoveUndeliveredResult(std::uint64_t result_id)
+{
+  const std::scoped_lock lock{m_undelivered_mutex};
+  (void)m_undelivered_results.erase(result_id);
+}
+
+void RemoteJobImporter::DiscardUndeliveredResults()
+{
+  std::map<std::uint64_t, std::function<void()>> results;
+  {
+    const std::scoped_lock lock{m_undelivered_mutex};
+    results.swap(m_undelivered_results);
+  }
+
+  for (const auto& [result_id, discard] : results)
+  {
+    discard();
+  }
+}
+
+}  // namespace oac_tree_gui
@@ -0,0 +1,175 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_OBJECTS_REMOTE_JOB_IMPORTER_H_
+#define OAC_TREE_GUI_JOBSYSTEM_OBJECTS_REMOTE_JOB_IMPORTER_H_
+
+#include <QObject>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+class BackgroundExecutor;
+class IRemoteConnectionService;
+struct RemoteConnectionInfo;
+
+/**
+ * @brief The RemoteJobImporter class connects with automation servers and prepares remote jobs on
+ * background threads, so the GUI stays responsive while servers are slow or unreachable.
+ *
+ * Jobs are prepared on several background threads, the client might serialize preparation of jobs
+ * of the same server, see IAutomationClient::PrepareJob. Once a job is prepared, the creation of
+ * its job handler in the GUI thread doesn't block.
+ *
+ * Results are reported by signals emitted in the thread of the importer. Several operations can
+ * run at the same time, the progress is reported for all imports together. Cancel discards all
+ * operations: tasks which haven't started yet are dropped, results of running tasks are ignored
+ * and prepared jobs are discarded.
+ */
+class RemoteJobImporter : public QObject
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @brief Main c-tor.
+   *
+   * @param connection_service The service holding connections, should outlive the importer.
+   * @param max_thread_count Maximum number of jobs prepared in parallel.
+   */
+  explicit RemoteJobImporter(IRemoteConnectionService& connection_service,
+                             std::size_t max_thread_count, QObject* parent_object = nullptr);
+
+  /**
+   * @brief Destroys the importer, waiting for tasks which are running at the moment.
+   */
+  ~RemoteJobImporter() override;
+
+  RemoteJobImporter(const RemoteJobImporter&) = delete;
+  RemoteJobImporter& operator=(const RemoteJobImporter&) = delete;
+  RemoteJobImporter(RemoteJobImporter&&) = delete;
+  RemoteJobImporter& operator=(RemoteJobImporter&&) = delete;
+
+  /**
+   * @brief Connects with the server, and fetches names of procedures of its jobs.
+   *
+   * Emits Connected, or ConnectionFailed.
+   */
+  void Connect(const std::string& server_name);
+
+  /**
+   * @brief Prepares given remote jobs.
+   *
+   * Emits ProgressChanged when jobs are scheduled, JobPrepared, or JobPreparationFailed, for every
+   * job, ProgressChanged after every job, and ImportFinished when all jobs of all imports are done.
+   */
+  void Import(const RemoteConnectionInfo& connection_info);
+
+  /**
+   * @brief Discards all running operations.
+   *
+   * Jobs which get prepared after the cancellation are discarded too.
+   */
+  void Cancel();
+
+  /**
+   * @brief Discards the job prepared for the given remote job, which will not be used for the job
+   * handler.
+   */
+  void DiscardJob(const std::string& server_name, std::size_t job_index);
+
+  /**
+   * @brief Checks if there are imports in progress.
+   */
+  bool IsBusy() const;
+
+signals:
+  void Connected(const std::string& server_name, const std::vector<std::string>& procedure_names);
+  void ConnectionFailed(const std::string& server_name, const std::string& message);
+  void JobPrepared(const std::string& server_name, std::size_t job_index);
+  void JobPreparationFailed(const std::string& server_name, std::size_t job_index,
+                            const std::string& message);
+  void ProgressChanged(std::size_t completed_count, std::size_t total_count);
+  void ImportFinished();
+
+private:
+  /**
+   * @brief The TaskResult struct holds functions handling the result of the background task.
+   */
+  struct TaskResult
+  {
+    std::function<void()> report;   //!< reports the result in the thread of the importer
+    std::function<void()> discard;  //!< releases the result of cancelled operation, optional
+  };
+
+  /**
+   * @brief Runs the task on the background thread. The result is reported in the thread of the
+   * importer, unless the operation was cancelled. The result of cancelled operation is discarded.
+   *
+   * @param task The task to run.
+   * @param is_import The task prepares a job and counts in the import progress.
+   */
+  void Submit(std::function<TaskResult()> task, bool is_import);
+
+  /**
+   * @brief Counts the prepared job, and reports the progress.
+   */
+  void OnJobCompleted();
+
+  /**
+   * @brief Keeps the discard function of the result posted to the thread of the importer, and
+   * returns its id.
+   */
+  std::uint64_t AddUndeliveredResult(std::function<void()> discard);
+
+  /**
+   * @brief Forgets the result, once it is handled in the thread of the importer.
+   */
+  void RemoveUndeliveredResult(std::uint64_t result_id);
+
+  /**
+   * @brief Discards results which were posted, but never handled.
+   *
+   * Posted calls are dropped when the importer is destroyed, their prepared jobs would stay in the
+   * client otherwise.
+   */
+  void DiscardUndeliveredResults();
+
+  IRemoteConnectionService& m_connection_service;
+  std::atomic<std::uint64_t> m_generation{0};  //!< incremented on every cancellation
+  std::size_t m_total_count{0};                //!< number of jobs of current imports
+  std::size_t m_completed_count{0};            //!< number of jobs done, prepared or failed
+  std::mutex m_undelivered_mutex;
+  std::uint64_t m_last_result_id{0};  //!< last id of posted result, guarded by the mutex above
+  std::map<std::uint64_t, std::function<void()>> m_undelivered_results;  //!< id to discard
+  std::unique_ptr<BackgroundExecutor> m_executor;
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_OBJECTS_REMOTE_JOB_IMPORTER_H_
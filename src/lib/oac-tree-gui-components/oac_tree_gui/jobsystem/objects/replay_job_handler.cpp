@@ -0,0 +1,62 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "replay_job_handler.h"
+
+#include <oac_tree_gui/jobsystem/domain_event_dispatcher_context.h>  // IWYU pragma: keep
+#include <oac_tree_gui/jobsystem/replay_domain_runner.h>
+#include <oac_tree_gui/model/variable_item.h>
+#include <oac_tree_gui/transform/anyvalue_item_transform_helper.h>
+#include <oac_tree_gui/transform/procedure_item_job_info_builder.h>
+
+namespace oac_tree_gui
+{
+
+ReplayJobHandler::ReplayJobHandler(JobItem* job_item, DomainEventTrace trace)
+    : AbstractJobHandler(job_item)
+{
+  auto runner = std::make_unique<ReplayDomainRunner>(CreateEventDispatcherContext(),
+                                                     std::move(trace));
+  m_replay_runner = runner.get();
+  Setup(std::move(runner));
+}
+
+ReplayJobHandler::~ReplayJobHandler() = default;
+
+void ReplayJobHandler::SetReplaySpeed(double speed)
+{
+  m_replay_runner->SetReplaySpeed(speed);
+}
+
+void ReplayJobHandler::OnVariableUpdatedEvent(const VariableUpdatedEvent& event)
+{
+  if (auto item = GetItemBuilder()->GetVariable(event.index); item)
+  {
+    item->SetIsAvailable(event.connected);
+
+    // remote jobs report empty values for disconnected variables
+    if (!sup::dto::IsEmptyValue(event.value.Get()))
+    {
+      UpdateAnyValue(event.value.Get(), *item);
+    }
+  }
+}
+
+}  // namespace oac_tree_gui
@@ -0,0 +1,64 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_OBJECTS_REPLAY_JOB_HANDLER_H_
+#define OAC_TREE_GUI_JOBSYSTEM_OBJECTS_REPLAY_JOB_HANDLER_H_
+
+#include <oac_tree_gui/jobsystem/objects/abstract_job_handler.h>
+
+namespace oac_tree_gui
+{
+
+struct DomainEventTrace;
+class ReplayDomainRunner;
+
+/**
+ * @brief The ReplayJobHandler class shows in the JobItem the replay of domain events recorded
+ * during an earlier run.
+ *
+ * The expanded procedure is built from the job info stored in the trace.
+ */
+class ReplayJobHandler : public AbstractJobHandler
+{
+  Q_OBJECT
+
+public:
+  ReplayJobHandler(JobItem* job_item, DomainEventTrace trace);
+  ~ReplayJobHandler() override;
+
+  ReplayJobHandler(const ReplayJobHandler&) = delete;
+  ReplayJobHandler& operator=(const ReplayJobHandler&) = delete;
+  ReplayJobHandler(ReplayJobHandler&&) = delete;
+  ReplayJobHandler& operator=(ReplayJobHandler&&) = delete;
+
+  /**
+   * @brief Sets the replay speed, 1.0 for the original timing, 0 to replay as fast as possible.
+   */
+  void SetReplaySpeed(double speed);
+
+private:
+  void OnVariableUpdatedEvent(const VariableUpdatedEvent& event) override;
+
+  ReplayDomainRunner* m_replay_runner{nullptr};
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_OBJECTS_REPLAY_JOB_HANDLER_H_
@@ -29,10 +29,40 @@ UserChoiceProvider::UserChoiceProvider(provider_callback_t callback) : m_request
           Qt::QueuedConnection);
 }
 
-UserChoiceResult UserChoiceProvider::GetUserChoice(const UserChoiceArgs& args)
+UserChoiceResult UserChoiceProvider::GetUserChoice(std::uint64_t id, const UserChoiceArgs& args)
 {
   auto queued_request_for_data = [this]() { emit ChoiceRequest(); };
-  return m_request_queue.GetData(args, queued_request_for_data);
+  return m_request_queue.GetData(id, args, queued_request_for_data);
+}
+
+bool UserChoiceProvider::SendUserChoice(std::uint64_t id, const UserChoiceResult& result)
+{
+  return m_request_queue.SendData(id, result);
+}
+
+bool UserChoiceProvider::Interrupt(std::uint64_t id)
+{
+  return m_request_queue.Interrupt(id);
+}
+
+void UserChoiceProvider::InterruptAll()
+{
+  m_request_queue.InterruptAll();
+}
+
+void UserChoiceProvider::SetTimeout(std::chrono::milliseconds timeout)
+{
+  m_request_queue.SetTimeout(timeout);
+}
+
+std::vector<PendingRequest<UserChoiceArgs>> UserChoiceProvider::GetPendingRequests() const
+{
+  return m_request_queue.GetPendingRequests();
+}
+
+std::size_t UserChoiceProvider::GetDuplicateRequestCount() const
+{
+  return m_request_queue.GetDuplicateRequestCount();
 }
 
 //! Processes the request and sends the data to the waiting thread.
@@ -29,10 +29,40 @@ UserInputProvider::UserInputProvider(provider_callback_t callback) : m_request_q
           Qt::QueuedConnection);
 }
 
-UserInputResult UserInputProvider::GetUserInput(const UserInputArgs& args)
+UserInputResult UserInputProvider::GetUserInput(std::uint64_t id, const UserInputArgs& args)
 {
   auto queued_request_for_data = [this]() { emit InputRequest(); };
-  return m_request_queue.GetData(args, queued_request_for_data);
+  return m_request_queue.GetData(id, args, queued_request_for_data);
+}
+
+bool UserInputProvider::SendUserInput(std::uint64_t id, const UserInputResult& result)
+{
+  return m_request_queue.SendData(id, result);
+}
+
+bool UserInputProvider::Interrupt(std::uint64_t id)
+{
+  return m_request_queue.Interrupt(id);
+}
+
+void UserInputProvider::InterruptAll()
+{
+  m_request_queue.InterruptAll();
+}
+
+void UserInputProvider::SetTimeout(std::chrono::milliseconds timeout)
+{
+  m_request_queue.SetTimeout(timeout);
+}
+
+std::vector<PendingRequest<UserInputArgs>> UserInputProvider::GetPendingRequests() const
+{
+  return m_request_queue.GetPendingRequests();
+}
+
+std::size_t UserInputProvider::GetDuplicateRequestCount() const
+{
+  return m_request_queue.GetDuplicateRequestCount();
 }
 
 //! Processes the request and sends the data to the waiting thread.
@@ -35,6 +35,9 @@ namespace oac_tree_gui
  * @details The request for user input (issued from sequencer thread, for example) and actual answer
  * (provided by the GUI thread via callbacks) is disentangled via a queued connection. That allows
  * having consumer thread waiting for input, and GUI thread responsive.
+ *
+ * Requests are identified by ids given by the domain job. They can be answered in any order,
+ * interrupted by the job, or expire, so no consumer waits forever.
  */
 
 class UserInputProvider : public QObject
@@ -50,13 +53,47 @@ public:
    * @brief Returns result of user input.
    *
    * @details The call is blocking and it is intended for call from consumer thread. Thread
-   * will be released when the result is available.
+   * will be released when the result is available, when the request is interrupted, or when the
+   * timeout expires.
    *
+   * @param id Unique id of the request.
    * @param args Arguments to provide.
    *
-   * @return Results of the user input.
+   * @return Results of the user input, not processed if there was no answer.
+   */
+  UserInputResult GetUserInput(std::uint64_t id, const UserInputArgs& args);
+
+  /**
+   * @brief Answers the pending request with the given id, bypassing the provider callback.
+   *
+   * @return True if the request was waiting for the answer.
+   */
+  bool SendUserInput(std::uint64_t id, const UserInputResult& result);
+
+  /**
+   * @brief Releases the consumer waiting for the request with the given id without an answer.
+   */
+  bool Interrupt(std::uint64_t id);
+
+  /**
+   * @brief Releases all waiting consumers without an answer.
+   */
+  void InterruptAll();
+
+  /**
+   * @brief Sets the time to wait for the answer to each request, zero means no timeout.
+   */
+  void SetTimeout(std::chrono::milliseconds timeout);
+
+  /**
+   * @brief Returns requests waiting for the answer, in the order of their arrival.
+   */
+  std::vector<PendingRequest<UserInputArgs>> GetPendingRequests() const;
+
+  /**
+   * @brief Returns number of requests rejected, since the request with the same id was pending.
    */
-  UserInputResult GetUserInput(const UserInputArgs& args);
+  std::size_t GetDuplicateRequestCount() const;
 
 private slots:
   void OnInputRequest();
@@ -57,12 +57,18 @@ bool RemoteConnectionService::Connect(const std::string& server_name)
     return false;
   }
 
-  m_clients.push_back(std::move(client));
+  const std::scoped_lock lock{m_mutex};
+  // another thread might have connected meanwhile, the first client wins
+  if (FindClient(server_name) == nullptr)
+  {
+    m_clients.push_back(std::move(client));
+  }
   return true;
 }
 
 void RemoteConnectionService::Disconnect(const std::string& server_name)
 {
+  const std::scoped_lock lock{m_mutex};
   auto on_element = [&server_name](auto& element)
   { return element->GetServerName() == server_name; };
   (void)m_clients.erase(std::remove_if(m_clients.begin(), m_clients.end(), on_element),
@@ -77,14 +83,13 @@ bool RemoteConnectionService::IsConnected(const std::string& server_name) const
 
 bool RemoteConnectionService::HasClient(const std::string& server_name) const
 {
-  auto on_element = [&server_name](auto& element)
-  { return element->GetServerName() == server_name; };
-  auto pos = std::find_if(m_clients.begin(), m_clients.end(), on_element);
-  return pos != m_clients.end();
+  const std::scoped_lock lock{m_mutex};
+  return FindClient(server_name) != nullptr;
 }
 
 std::vector<std::string> RemoteConnectionService::GetServerNames() const
 {
+  const std::scoped_lock lock{m_mutex};
   std::vector<std::string> result;
   auto on_element = [](const auto& element) { return element->GetServerName(); };
   (void)std::transform(m_clients.begin(), m_clients.end(), std::back_inserter(result), on_element);
@@ -93,16 +98,13 @@ std::vector<std::string> RemoteConnectionService::GetServerNames() const
 
 IAutomationClient& RemoteConnectionService::GetAutomationClient(const std::string& server_name)
 {
-  auto on_element = [&server_name](auto& element)
-  { return element->GetServerName() == server_name; };
-  auto pos = std::find_if(m_clients.begin(), m_clients.end(), on_element);
-
-  if (pos == m_clients.end())
+  const std::scoped_lock lock{m_mutex};
+  auto client = FindClient(server_name);
+  if (client == nullptr)
   {
     throw RuntimeException("No client for server [" + server_name + "]");
   }
 
-  IAutomationClient* client = pos->get();
   return *client;
 }
 
@@ -123,4 +125,12 @@ std::unique_ptr<AbstractJobHandler> RemoteConnectionService::CreateJobHandler(
   return GetAutomationClient(server_name).CreateJobHandler(job_item, user_context);
 }
 
+IAutomationClient* RemoteConnectionService::FindClient(const std::string& server_name) const
+{
+  auto on_element = [&server_name](auto& element)
+  { return element->GetServerName() == server_name; };
+  auto pos = std::find_if(m_clients.begin(), m_clients.end(), on_element);
+  return pos == m_clients.end() ? nullptr : pos->get();
+}
+
 }  // namespace oac_tree_gui
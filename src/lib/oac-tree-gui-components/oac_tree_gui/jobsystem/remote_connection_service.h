@@ -24,6 +24,7 @@
 #include <oac_tree_gui/jobsystem/i_remote_connection_service.h>
 
 #include <functional>
+#include <mutex>
 
 namespace oac_tree_gui
 {
@@ -31,6 +32,10 @@ namespace oac_tree_gui
 /**
  * @brief The RemoteConnectionService is a defaut implementation of service to connect with remote
  * automation jobs.
+ *
+ * Methods are thread-safe, so connections can be established on a background thread. Clients are
+ * created outside of the lock, a slow server doesn't block access to others. The client returned
+ * by GetAutomationClient stays valid till the server is disconnected.
  */
 class RemoteConnectionService : public IRemoteConnectionService
 {
@@ -54,6 +59,13 @@ public:
                                                        const UserContext& user_context) override;
 
 private:
+  /**
+   * @brief Returns the client for the given server, or nullptr. Should be called under the lock.
+   */
+  IAutomationClient* FindClient(const std::string& server_name) const;
+
+  mutable std::mutex m_mutex;
+
   //!< collection of remote clients, one client per server name
   std::vector<std::unique_ptr<IAutomationClient>> m_clients;
 
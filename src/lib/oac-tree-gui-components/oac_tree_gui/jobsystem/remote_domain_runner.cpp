@@ -21,14 +21,27 @@
 #include "remote_domain_runner.h"
 
 #include "domain_event_dispatcher_context.h"
+#include "job_info_io_forwarder.h"
 #include "user_context.h"
 
+#include <oac_tree_gui/core/exceptions.h>
+
 #include <sup/oac-tree-server/client_job.h>
 #include <sup/oac-tree-server/epics_config_utils.h>
 
 namespace oac_tree_gui
 {
 
+PreparedRemoteJob PrepareRemoteJob(sup::oac_tree_server::IJobManager& manager,
+                                   std::uint32_t job_index)
+{
+  PreparedRemoteJob result;
+  result.job_io = std::make_shared<JobInfoIOForwarder>();
+  result.job = sup::oac_tree_server::CreateClientJob(
+      manager, job_index, sup::oac_tree_server::utils::CreateEPICSIOClient, *result.job_io);
+  return result;
+}
+
 RemoteDomainRunner::RemoteDomainRunner(DomainEventDispatcherContext dispatcher_context,
                                        UserContext user_context,
                                        sup::oac_tree_server::IJobManager& manager,
@@ -41,4 +54,30 @@ RemoteDomainRunner::RemoteDomainRunner(DomainEventDispatcherContext dispatcher_c
   SetDomainJob(std::move(remote_job));
 }
 
+RemoteDomainRunner::RemoteDomainRunner(DomainEventDispatcherContext dispatcher_context,
+                                       UserContext user_context, PreparedRemoteJob prepared_job)
+    : AbstractDomainRunner(std::move(dispatcher_context), std::move(user_context))
+    , m_job_io(std::move(prepared_job.job_io))
+{
+  if (!m_job_io || !prepared_job.job)
+  {
+    throw RuntimeException("Remote job is not prepared");
+  }
+
+  m_job_io->SetTarget(GetJobInfoIO());
+  SetDomainJob(std::move(prepared_job.job));
+}
+
+RemoteDomainRunner::~RemoteDomainRunner()
+{
+  // the job reports to the forwarder till the end, so it is destroyed before the forwarder
+  ResetDomainJob();
+
+  // the event queue is closed by now, the replay of stored reports can't wait for the GUI thread
+  if (m_job_io)
+  {
+    m_job_io->Close();
+  }
+}
+
 }  // namespace oac_tree_gui
@@ -25,10 +25,35 @@
 #include <oac_tree_gui/jobsystem/abstract_domain_runner.h>
 
 #include <sup/oac-tree-server/i_job_manager.h>
+#include <sup/oac-tree/i_job.h>
 
 namespace oac_tree_gui
 {
 
+class JobInfoIOForwarder;
+
+/**
+ * @brief The PreparedRemoteJob struct holds the remote job connected in advance, before the GUI
+ * machinery to run it was created.
+ */
+struct PreparedRemoteJob
+{
+  //!< collects reports of the job until they can be passed to the runner
+  std::shared_ptr<JobInfoIOForwarder> job_io;
+
+  //!< the job, declared after its listener to be destroyed first
+  std::unique_ptr<sup::oac_tree::IJob> job;
+};
+
+/**
+ * @brief Connects with the remote job.
+ *
+ * This is the lengthy part of the remote job setup, which doesn't touch GUI objects and can be
+ * executed on any thread.
+ */
+PreparedRemoteJob PrepareRemoteJob(sup::oac_tree_server::IJobManager& manager,
+                                   std::uint32_t job_index);
+
 /**
  * @brief The RemoteDomainRunner class runs remotely the sequencer domain procedure.
  */
@@ -37,6 +62,23 @@ class RemoteDomainRunner : public AbstractDomainRunner
 public:
   RemoteDomainRunner(DomainEventDispatcherContext dispatcher_context, UserContext user_context,
                      sup::oac_tree_server::IJobManager& manager, std::uint32_t job_index);
+
+  /**
+   * @brief Creates the runner for the remote job connected in advance.
+   */
+  RemoteDomainRunner(DomainEventDispatcherContext dispatcher_context, UserContext user_context,
+                     PreparedRemoteJob prepared_job);
+
+  ~RemoteDomainRunner() override;
+
+  RemoteDomainRunner(const RemoteDomainRunner&) = delete;
+  RemoteDomainRunner& operator=(const RemoteDomainRunner&) = delete;
+  RemoteDomainRunner(RemoteDomainRunner&&) = delete;
+  RemoteDomainRunner& operator=(RemoteDomainRunner&&) = delete;
+
+private:
+  //!< forwards reports of the prepared job, should outlive the job
+  std::shared_ptr<JobInfoIOForwarder> m_job_io;
 };
 
 }  // namespace oac_tree_gui
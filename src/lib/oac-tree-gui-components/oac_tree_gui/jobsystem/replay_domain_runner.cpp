@@ -0,0 +1,64 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "replay_domain_runner.h"
+
+#include "domain_event_dispatcher_context.h"
+#include "replay_job.h"
+#include "user_context.h"
+
+namespace oac_tree_gui
+{
+
+namespace
+{
+
+/**
+ * @brief Returns options of the event queue, all events are posted by the replay thread.
+ */
+DomainEventQueueOptions CreateQueueOptions()
+{
+  DomainEventQueueOptions result;
+  result.producer_mode = ProducerMode::kSingle;
+  return result;
+}
+
+}  // namespace
+
+ReplayDomainRunner::ReplayDomainRunner(DomainEventDispatcherContext dispatcher_context,
+                                       DomainEventTrace trace)
+    : AbstractDomainRunner(std::move(dispatcher_context), UserContext{}, CreateQueueOptions())
+{
+  auto replay_job = std::make_unique<ReplayJob>(std::move(trace), *GetJobInfoIO());
+  m_replay_job = replay_job.get();
+  SetDomainJob(std::move(replay_job));
+}
+
+void ReplayDomainRunner::SetReplaySpeed(double speed)
+{
+  m_replay_job->SetReplaySpeed(speed);
+}
+
+double ReplayDomainRunner::GetReplaySpeed() const
+{
+  return m_replay_job->GetReplaySpeed();
+}
+
+}  // namespace oac_tree_gui
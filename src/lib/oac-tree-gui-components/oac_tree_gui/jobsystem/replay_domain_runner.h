@@ -0,0 +1,60 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_REPLAY_DOMAIN_RUNNER_H_
+#define OAC_TREE_GUI_JOBSYSTEM_REPLAY_DOMAIN_RUNNER_H_
+
+#include <oac_tree_gui/jobsystem/abstract_domain_runner.h>
+#include <oac_tree_gui/jobsystem/domain_event_trace.h>
+
+namespace oac_tree_gui
+{
+
+class ReplayJob;
+
+/**
+ * @brief The ReplayDomainRunner class replays domain events recorded by
+ * AbstractDomainRunner::StartEventRecording.
+ *
+ * Events go through the same observer and event queue as events of the real job, so the GUI
+ * can't see the difference. Neither the sequencer procedure, nor plugins are created.
+ */
+class ReplayDomainRunner : public AbstractDomainRunner
+{
+public:
+  ReplayDomainRunner(DomainEventDispatcherContext dispatcher_context, DomainEventTrace trace);
+
+  /**
+   * @brief Sets the replay speed, 1.0 for the original timing, 0 to replay as fast as possible.
+   */
+  void SetReplaySpeed(double speed);
+
+  /**
+   * @brief Returns the replay speed.
+   */
+  double GetReplaySpeed() const;
+
+private:
+  ReplayJob* m_replay_job{nullptr};
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_REPLAY_DOMAIN_RUNNER_H_
@@ -0,0 +1,329 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "replay_job.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+
+#include <sup/oac-tree/i_job_info_io.h>
+#include <sup/oac-tree/job_info_utils.h>
+
+namespace oac_tree_gui
+{
+
+namespace
+{
+
+/**
+ * @brief Checks if the event reports the end of the instruction execution.
+ */
+bool IsInstructionFinishedEvent(const domain_event_t& event)
+{
+  using sup::oac_tree::ExecutionStatus;
+  if (const auto* instruction_event = std::get_if<InstructionStateUpdatedEvent>(&event))
+  {
+    const auto status = instruction_event->state.m_execution_status;
+    return status == ExecutionStatus::SUCCESS || status == ExecutionStatus::FAILURE;
+  }
+  return false;
+}
+
+}  // namespace
+
+ReplayJob::ReplayJob(DomainEventTrace trace, sup::oac_tree::IJobInfoIO& job_info_io)
+    : m_trace(std::move(trace))
+    , m_job_info(sup::oac_tree::utils::ToJobInfo(m_trace.job_info))
+    , m_job_info_io(job_info_io)
+{
+  m_replay_thread = std::thread([this]() { Run(); });
+}
+
+ReplayJob::~ReplayJob()
+{
+  {
+    const std::scoped_lock lock{m_mutex};
+    m_exit_requested = true;
+    ++m_generation;
+  }
+  m_cv.notify_one();
+  m_replay_thread.join();
+}
+
+void ReplayJob::SetReplaySpeed(double speed)
+{
+  if (speed < 0.0)
+  {
+    throw RuntimeException("Replay speed can't be negative");
+  }
+
+  const std::scoped_lock lock{m_mutex};
+  const auto now = std::chrono::steady_clock::now();
+  m_start_trace_time = GetTraceTime(now);
+  m_start_time = now;
+  m_speed = speed;
+  SetMode(m_mode);
+}
+
+double ReplayJob::GetReplaySpeed() const
+{
+  const std::scoped_lock lock{m_mutex};
+  return m_speed;
+}
+
+std::size_t ReplayJob::GetReplayedEventCount() const
+{
+  const std::scoped_lock lock{m_mutex};
+  return m_position;
+}
+
+const sup::oac_tree::JobInfo& ReplayJob::GetInfo() const
+{
+  return m_job_info;
+}
+
+void ReplayJob::SetBreakpoint(sup::dto::uint32 instr_idx)
+{
+  const std::scoped_lock lock{m_mutex};
+  (void)m_breakpoints.insert(instr_idx);
+}
+
+void ReplayJob::RemoveBreakpoint(sup::dto::uint32 instr_idx)
+{
+  const std::scoped_lock lock{m_mutex};
+  (void)m_breakpoints.erase(instr_idx);
+}
+
+void ReplayJob::Start()
+{
+  const std::scoped_lock lock{m_mutex};
+  if (m_mode == Mode::kRunning || m_position >= m_trace.records.size())
+  {
+    return;
+  }
+
+  m_start_time = std::chrono::steady_clock::now();
+  m_start_trace_time = m_position > 0 ? m_trace.records[m_position - 1].time_offset
+                                      : m_trace.records.front().time_offset;
+  if (m_position > 0)
+  {
+    // on the very first start the running state comes from the trace itself
+    ScheduleJobState(sup::oac_tree::JobState::kRunning);
+  }
+  SetMode(Mode::kRunning);
+}
+
+void ReplayJob::Step()
+{
+  const std::scoped_lock lock{m_mutex};
+  if (m_position >= m_trace.records.size())
+  {
+    return;
+  }
+
+  ScheduleJobState(sup::oac_tree::JobState::kStepping);
+  SetMode(Mode::kStepping);
+}
+
+void ReplayJob::Pause()
+{
+  const std::scoped_lock lock{m_mutex};
+  if (m_mode == Mode::kIdle)
+  {
+    return;
+  }
+
+  ScheduleJobState(sup::oac_tree::JobState::kPaused);
+  SetMode(Mode::kIdle);
+}
+
+void ReplayJob::Reset()
+{
+  const std::scoped_lock lock{m_mutex};
+  for (auto index : m_replayed_instructions)
+  {
+    const sup::oac_tree::InstructionState state{
+        m_breakpoints.find(static_cast<sup::dto::uint32>(index)) != m_breakpoints.end(),
+        sup::oac_tree::ExecutionStatus::NOT_STARTED};
+    m_pending_events.emplace_back(InstructionStateUpdatedEvent{index, state});
+  }
+  m_replayed_instructions.clear();
+
+  m_position = 0;
+  m_breakpoint_hit = false;
+  ScheduleJobState(sup::oac_tree::JobState::kInitial);
+  SetMode(Mode::kIdle);
+}
+
+void ReplayJob::Halt()
+{
+  const std::scoped_lock lock{m_mutex};
+  m_position = m_trace.records.size();
+  ScheduleJobState(sup::oac_tree::JobState::kHalted);
+  SetMode(Mode::kIdle);
+}
+
+void ReplayJob::Run()
+{
+  std::unique_lock<std::mutex> lock{m_mutex};
+  while (!m_exit_requested)
+  {
+    if (!m_pending_events.empty())
+    {
+      auto pending_events = std::move(m_pending_events);
+      m_pending_events.clear();
+      lock.unlock();
+      for (const auto& event : pending_events)
+      {
+        ReplayEvent(event);
+      }
+      lock.lock();
+      continue;
+    }
+
+    const auto generation = m_generation;
+    auto is_interrupted = [this, generation]()
+    { return m_exit_requested || m_generation != generation; };
+
+    if (m_mode == Mode::kIdle || m_position >= m_trace.records.size())
+    {
+      m_mode = Mode::kIdle;  // the end of the trace
+      m_cv.wait(lock, is_interrupted);
+      continue;
+    }
+
+    auto event = m_trace.records[m_position].event;
+    if (m_mode == Mode::kRunning && m_speed > 0.0)
+    {
+      const std::chrono::duration<double, std::micro> trace_delay(
+          m_trace.records[m_position].time_offset - m_start_trace_time);
+      const auto due_time =
+          m_start_time
+          + std::chrono::duration_cast<std::chrono::steady_clock::duration>(trace_delay / m_speed);
+      if (m_cv.wait_until(lock, due_time, is_interrupted))
+      {
+        continue;  // control request has arrived, the replay state has to be re-evaluated
+      }
+    }
+
+    if (IsBreakpointHit(event))
+    {
+      m_breakpoint_hit = true;
+      m_breakpoint_position = m_position;
+      const auto& instruction_event = std::get<InstructionStateUpdatedEvent>(event);
+      m_pending_events.emplace_back(BreakpointHitEvent{instruction_event.index});
+      ScheduleJobState(sup::oac_tree::JobState::kPaused);
+      SetMode(Mode::kIdle);
+      continue;
+    }
+
+    if (auto* instruction_event = std::get_if<InstructionStateUpdatedEvent>(&event))
+    {
+      // breakpoint flags of the original run are replaced with the current ones
+      instruction_event->state.m_breakpoint_set =
+          m_breakpoints.find(static_cast<sup::dto::uint32>(instruction_event->index))
+          != m_breakpoints.end();
+      (void)m_replayed_instructions.insert(instruction_event->index);
+    }
+
+    ++m_position;
+    if (m_mode == Mode::kStepping && IsInstructionFinishedEvent(event))
+    {
+      ScheduleJobState(sup::oac_tree::JobState::kPaused);
+      SetMode(Mode::kIdle);
+    }
+
+    lock.unlock();
+    ReplayEvent(event);
+    lock.lock();
+  }
+}
+
+void ReplayJob::SetMode(Mode mode)
+{
+  m_mode = mode;
+  ++m_generation;
+  m_cv.notify_one();
+}
+
+void ReplayJob::ScheduleJobState(sup::oac_tree::JobState state)
+{
+  m_pending_events.emplace_back(JobStateChangedEvent{state});
+}
+
+std::chrono::microseconds ReplayJob::GetTraceTime(std::chrono::steady_clock::time_point now) const
+{
+  if (m_mode != Mode::kRunning || m_speed <= 0.0)
+  {
+    return m_position > 0 ? m_trace.records[m_position - 1].time_offset : m_start_trace_time;
+  }
+
+  const std::chrono::duration<double, std::micro> elapsed(now - m_start_time);
+  return m_start_trace_time
+         + std::chrono::duration_cast<std::chrono::microseconds>(elapsed * m_speed);
+}
+
+bool ReplayJob::IsBreakpointHit(const domain_event_t& event) const
+{
+  const auto* instruction_event = std::get_if<InstructionStateUpdatedEvent>(&event);
+  if (instruction_event == nullptr
+      || instruction_event->state.m_execution_status
+             != sup::oac_tree::ExecutionStatus::NOT_FINISHED)
+  {
+    return false;
+  }
+
+  if (m_breakpoint_hit && m_breakpoint_position == m_position)
+  {
+    return false;  // the replay has been resumed after this breakpoint
+  }
+
+  return m_breakpoints.find(static_cast<sup::dto::uint32>(instruction_event->index))
+         != m_breakpoints.end();
+}
+
+void ReplayJob::ReplayEvent(const domain_event_t& event)
+{
+  if (const auto* instruction_event = std::get_if<InstructionStateUpdatedEvent>(&event))
+  {
+    m_job_info_io.InstructionStateUpdated(static_cast<sup::dto::uint32>(instruction_event->index),
+                                          instruction_event->state);
+  }
+  else if (const auto* variable_event = std::get_if<VariableUpdatedEvent>(&event))
+  {
+    m_job_info_io.VariableUpdated(static_cast<sup::dto::uint32>(variable_event->index),
+                                  variable_event->value.Get(), variable_event->connected);
+  }
+  else if (const auto* state_event = std::get_if<JobStateChangedEvent>(&event))
+  {
+    m_job_info_io.JobStateUpdated(state_event->state);
+  }
+  else if (const auto* log_event = std::get_if<LogEvent>(&event))
+  {
+    m_job_info_io.Log(static_cast<int>(log_event->severity), log_event->message);
+  }
+  else if (const auto* breakpoint_event = std::get_if<BreakpointHitEvent>(&event))
+  {
+    m_job_info_io.BreakpointInstructionUpdated(
+        static_cast<sup::dto::uint32>(breakpoint_event->index));
+  }
+  // active instruction events are derived by the observer from instruction states
+}
+
+}  // namespace oac_tree_gui
@@ -0,0 +1,192 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_REPLAY_JOB_H_
+#define OAC_TREE_GUI_JOBSYSTEM_REPLAY_JOB_H_
+
+#include <oac_tree_gui/jobsystem/domain_event_trace.h>
+
+#include <sup/oac-tree/i_job.h>
+#include <sup/oac-tree/job_info.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace sup::oac_tree
+{
+class IJobInfoIO;
+}
+
+namespace oac_tree_gui
+{
+
+/**
+ * @brief The ReplayJob class imitates the domain job by replaying events recorded in the trace.
+ *
+ * Events are reported to IJobInfoIO in a separate thread, with the original timing scaled by the
+ * replay speed. No procedure is created, so neither the sequencer nor the plugins are required.
+ * Active instruction events of the trace are skipped, since the observer derives them from
+ * instruction states itself.
+ *
+ * Start, Pause, Step and Halt control the replay position. Breakpoints pause the replay, when the
+ * instruction with the breakpoint is about to be executed. Reset rewinds the trace and reports
+ * the initial status for all instructions replayed so far, variables keep their last values.
+ */
+class ReplayJob : public sup::oac_tree::IJob
+{
+public:
+  /**
+   * @brief Main c-tor.
+   *
+   * @param trace Recorded domain events with the job info.
+   * @param job_info_io The receiver of replayed events.
+   */
+  ReplayJob(DomainEventTrace trace, sup::oac_tree::IJobInfoIO& job_info_io);
+  ~ReplayJob() override;
+
+  ReplayJob(const ReplayJob&) = delete;
+  ReplayJob& operator=(const ReplayJob&) = delete;
+  ReplayJob(ReplayJob&&) = delete;
+  ReplayJob& operator=(ReplayJob&&) = delete;
+
+  /**
+   * @brief Sets the replay speed.
+   *
+   * @param speed The factor to scale the original timing, 1.0 corresponds to the original
+   * timing, 0 means to replay as fast as possible.
+   */
+  void SetReplaySpeed(double speed);
+
+  /**
+   * @brief Returns the replay speed.
+   */
+  double GetReplaySpeed() const;
+
+  /**
+   * @brief Returns number of events replayed since the last reset.
+   */
+  std::size_t GetReplayedEventCount() const;
+
+  const sup::oac_tree::JobInfo& GetInfo() const override;
+
+  void SetBreakpoint(sup::dto::uint32 instr_idx) override;
+
+  void RemoveBreakpoint(sup::dto::uint32 instr_idx) override;
+
+  void Start() override;
+
+  void Step() override;
+
+  void Pause() override;
+
+  void Reset() override;
+
+  void Halt() override;
+
+private:
+  enum class Mode : std::uint8_t
+  {
+    kIdle,
+    kRunning,
+    kStepping
+  };
+
+  /**
+   * @brief Main loop of the replay thread.
+   */
+  void Run();
+
+  /**
+   * @brief Changes the replay mode and wakes up the replay thread.
+   *
+   * Should be called under the lock.
+   */
+  void SetMode(Mode mode);
+
+  /**
+   * @brief Schedules the job state to be reported by the replay thread.
+   *
+   * Should be called under the lock.
+   */
+  void ScheduleJobState(sup::oac_tree::JobState state);
+
+  /**
+   * @brief Returns the position on the original time scale reached by the replay.
+   *
+   * Should be called under the lock.
+   */
+  std::chrono::microseconds GetTraceTime(std::chrono::steady_clock::time_point now) const;
+
+  /**
+   * @brief Checks if the replay should pause before the given event because of the breakpoint.
+   *
+   * Should be called under the lock.
+   */
+  bool IsBreakpointHit(const domain_event_t& event) const;
+
+  /**
+   * @brief Reports the event to IJobInfoIO.
+   */
+  void ReplayEvent(const domain_event_t& event);
+
+  DomainEventTrace m_trace;
+  sup::oac_tree::JobInfo m_job_info;
+  sup::oac_tree::IJobInfoIO& m_job_info_io;
+
+  //!< protects all replay state below, never held while reporting to IJobInfoIO
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cv;
+
+  Mode m_mode{Mode::kIdle};
+  double m_speed{1.0};
+  bool m_exit_requested{false};
+
+  //!< increased on every control request to wake up the replay thread
+  std::size_t m_generation{0};
+
+  //!< index of the next record to replay
+  std::size_t m_position{0};
+
+  //!< position of the last record which has paused the replay because of the breakpoint
+  std::size_t m_breakpoint_position{0};
+  bool m_breakpoint_hit{false};
+
+  //!< the moment when the replay was (re)started, and the trace time at that moment
+  std::chrono::steady_clock::time_point m_start_time{};
+  std::chrono::microseconds m_start_trace_time{0};
+
+  std::set<sup::dto::uint32> m_breakpoints;
+
+  //!< instructions which have reported their state since the last reset
+  std::set<std::size_t> m_replayed_instructions;
+
+  //!< events scheduled by control requests, reported by the replay thread before the trace
+  std::vector<domain_event_t> m_pending_events;
+
+  std::thread m_replay_thread;
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_REPLAY_JOB_H_
@@ -21,106 +21,376 @@
 #ifndef OAC_TREE_GUI_JOBSYSTEM_REQUEST_HANDLER_QUEUE_H_
 #define OAC_TREE_GUI_JOBSYSTEM_REQUEST_HANDLER_QUEUE_H_
 
-#include <oac_tree_gui/jobsystem/request_handler.h>
-
-#include <cassert>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <functional>
+#include <map>
 #include <mutex>
-#include <queue>
+#include <set>
+#include <vector>
 
 namespace oac_tree_gui
 {
 
 /**
- * @brief The RequestHandlerQueue class provides consumer thread with the result of user input.
- * There can be more than one thread asking for input.
+ * @brief The PendingRequest struct describes a request waiting for the user's answer.
+ */
+template <typename ArgT>
+struct PendingRequest
+{
+  std::uint64_t id{0};  //!< request id, as given by the domain job
+  ArgT args;            //!< arguments to show to the user
+};
+
+/**
+ * @brief The RequestHandlerQueue class provides consumer threads with the result of user input.
+ *
+ * Requests are identified by the id given by the consumer. Pending requests can be answered in
+ * any order, either by the provider callback, or directly via SendData. The waiting consumer is
+ * released with the default-constructed result, when the request is interrupted, or when its
+ * timeout expires. An interruption arriving before the consumer has asked for the data is
+ * remembered, and the consumer asking later is released immediately.
  *
- * @tparam DataT Type of input expected from the user.
+ * @tparam DataT Type of input expected from the user, default-constructed value means no answer.
  * @tparam ArgT Arguments that should be given to the user.
  */
-
 template <typename DataT, typename ArgT>
 class RequestHandlerQueue
 {
 public:
   using provider_callback_t = std::function<DataT(ArgT)>;
-  using request_handler_t = RequestHandler<DataT>;
+  using request_t = PendingRequest<ArgT>;
+
+  explicit RequestHandlerQueue(provider_callback_t callback = {})
+      : m_provider_callback(std::move(callback))
+  {
+  }
 
-  explicit RequestHandlerQueue(provider_callback_t callback) : m_provider_callback(callback) {}
+  ~RequestHandlerQueue() { Close(); }
+
+  RequestHandlerQueue(const RequestHandlerQueue&) = delete;
+  RequestHandlerQueue& operator=(const RequestHandlerQueue&) = delete;
+  RequestHandlerQueue(RequestHandlerQueue&&) = delete;
+  RequestHandlerQueue& operator=(RequestHandlerQueue&&) = delete;
+
+  /**
+   * @brief Sets the time to wait for the answer to each of the following requests.
+   *
+   * Zero timeout means waiting till the answer, or the interruption.
+   */
+  void SetTimeout(std::chrono::milliseconds timeout)
+  {
+    const std::scoped_lock lock{m_mutex};
+    m_timeout = timeout;
+  }
 
   /**
-   * @brief Returns the data .
+   * @brief Returns the data.
    *
    * @details The call is blocking and it is intended for call from consumer thread. Thread
-   * will be released when the result is available. The method can be used from more than one
-   * thread.
+   * will be released when the result is available, when the request is interrupted, or when it
+   * times out. The method can be used from more than one thread.
    *
+   * @param id Unique id of the request.
    * @param args Arguments to provide.
    * @param notify_callback Special non-blocking callback that will notify the GUI that we need
    * data.
    *
-   * @return Results of the user choice.
+   * @return Results of the user choice, or default-constructed result if there is no answer, or
+   * if the request with the same id is already pending.
    */
-  DataT GetData(const ArgT& args, std::function<void(void)> notify_callback)
+  DataT GetData(std::uint64_t id, const ArgT& args,
+                const std::function<void(void)>& notify_callback)
   {
-    RequestPack request_data;
-    request_data.args = args;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_closed)
+    {
+      return DataT{};
+    }
+
+    if (m_early_interrupts.erase(id) > 0)
+    {
+      return DataT{};
+    }
 
+    if (m_requests.find(id) != m_requests.end())
     {
-      std::unique_lock<std::mutex> lock(m_mutex);
-      m_stack.push(&request_data);
+      // the consumer is the sequencer thread, which shouldn't get exceptions from the GUI
+      ++m_duplicate_request_count;
+      return DataT{};
     }
 
+    auto& request = m_requests[id];
+    request.args = args;
+    request.sequence_number = m_sequence_number++;
+    const auto timeout = m_timeout;
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    lock.unlock();
+
     // asking the GUI for a data via queued connection
-    notify_callback();
+    if (notify_callback)
+    {
+      notify_callback();
+    }
 
-    // waiting for data to become available
-    return request_data.request_handler.GetData();
+    lock.lock();
+    auto is_done = [&request]() { return request.status != Status::kPending; };
+    if (timeout.count() > 0)
+    {
+      (void)m_cv.wait_until(lock, deadline, is_done);
+    }
+    else
+    {
+      m_cv.wait(lock, is_done);
+    }
+
+    auto result = request.status == Status::kAnswered ? request.data : DataT{};
+    (void)m_requests.erase(id);
+    m_cv.notify_all();  // Close might wait for the last request to leave
+    return result;
   }
 
   /**
-   * @brief Will call provider callback to get the data and will send the data to the consumer
-   * thread. As a result of the call, consumer thread wating in ::GetData will be released.
+   * @brief Calls provider callback to get the data for the oldest request, and sends the data to
+   * the consumer thread.
+   *
+   * The request is skipped, if it was answered, or interrupted, while the provider was busy.
    */
   void OnDataRequest()
   {
-    RequestPack* request_data{nullptr};
+    if (!m_provider_callback)
+    {
+      return;
+    }
+
+    std::uint64_t id{0};
+    ArgT args;
+    {
+      const std::scoped_lock lock{m_mutex};
+      auto iter = FindNextRequest();
+      if (iter == m_requests.end())
+      {
+        return;
+      }
+      iter->second.dispatched = true;
+      id = iter->first;
+      args = iter->second.args;
+    }
+
+    // get the data from the provider callback, without a lock, since it may take a while
+    (void)SendData(id, m_provider_callback(args));
+  }
+
+  /**
+   * @brief Sends the data to the consumer waiting for the request with the given id.
+   *
+   * @return True if the request was pending, false if it is unknown, already answered, or
+   * interrupted.
+   */
+  bool SendData(std::uint64_t id, const DataT& data)
+  {
+    return Complete(id, Status::kAnswered, data);
+  }
+
+  /**
+   * @brief Releases the consumer waiting for the request with the given id without an answer.
+   *
+   * If the consumer hasn't asked for the data yet, the interruption is remembered till it asks.
+   *
+   * @return True if the request was pending.
+   */
+  bool Interrupt(std::uint64_t id)
+  {
+    {
+      const std::scoped_lock lock{m_mutex};
+      if (!m_closed && m_requests.find(id) == m_requests.end())
+      {
+        RememberEarlyInterrupt(id);
+        return false;
+      }
+    }
+    return Complete(id, Status::kInterrupted, DataT{});
+  }
 
-    // accessing data request in a stack
+  /**
+   * @brief Releases all waiting consumers without an answer.
+   */
+  void InterruptAll()
+  {
     {
-      std::unique_lock<std::mutex> lock(m_mutex);
-      assert(!m_stack.empty());
+      const std::scoped_lock lock{m_mutex};
+      for (auto& [id, request] : m_requests)
+      {
+        if (request.status == Status::kPending)
+        {
+          request.status = Status::kInterrupted;
+        }
+      }
+    }
+    m_cv.notify_all();
+  }
 
-      request_data = m_stack.front();
-      // removing request from a stack before handling it further
-      m_stack.pop();
+  /**
+   * @brief Interrupts all requests, rejects new ones, and waits till all consumers leave.
+   */
+  void Close()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_closed = true;
+    m_early_interrupts.clear();
+    for (auto& [id, request] : m_requests)
+    {
+      if (request.status == Status::kPending)
+      {
+        request.status = Status::kInterrupted;
+      }
     }
+    m_cv.notify_all();
+    m_cv.wait(lock, [this]() { return m_requests.empty(); });
+  }
+
+  /**
+   * @brief Returns number of requests rejected, because the request with the same id was already
+   * pending.
+   */
+  std::size_t GetDuplicateRequestCount() const
+  {
+    const std::scoped_lock lock{m_mutex};
+    return m_duplicate_request_count;
+  }
 
-    // get the data from the provider callback
-    auto args = request_data->args;
-    auto data_to_send = m_provider_callback(args);
+  /**
+   * @brief Returns requests waiting for the answer, in the order of their arrival.
+   */
+  std::vector<request_t> GetPendingRequests() const
+  {
+    const std::scoped_lock lock{m_mutex};
+
+    std::vector<std::pair<std::uint64_t, request_t>> requests;
+    for (const auto& [id, request] : m_requests)
+    {
+      if (request.status == Status::kPending)
+      {
+        requests.push_back({request.sequence_number, request_t{id, request.args}});
+      }
+    }
+    std::sort(requests.begin(), requests.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
 
-    // sending the data to waiting thread
-    request_data->request_handler.SendData(data_to_send);
+    std::vector<request_t> result;
+    result.reserve(requests.size());
+    for (auto& [sequence_number, request] : requests)
+    {
+      result.push_back(std::move(request));
+    }
+    return result;
   }
 
 private:
+  enum class Status
+  {
+    kPending,
+    kAnswered,
+    kInterrupted
+  };
+
   struct RequestPack
   {
     //! Request arguments.
     ArgT args;
 
-    //! Handler who knows how to pass data to the thread.
-    request_handler_t request_handler;
+    //! Data to pass to the waiting thread.
+    DataT data;
+
+    Status status{Status::kPending};
+
+    //! The request was given to the provider callback.
+    bool dispatched{false};
+
+    //! Order of arrival.
+    std::uint64_t sequence_number{0};
   };
 
+  using container_t = std::map<std::uint64_t, RequestPack>;
+
+  //!< Maximum number of remembered interruptions of requests not yet asked for.
+  static constexpr std::size_t kMaxEarlyInterruptCount = 64;
+
+  /**
+   * @brief Remembers the interruption of the request not yet asked for. Should be called under the
+   * lock.
+   *
+   * Interruptions which are never claimed, e.g. of requests which are already finished, are
+   * forgotten starting from the oldest id, so the memory stays bounded.
+   */
+  void RememberEarlyInterrupt(std::uint64_t id)
+  {
+    (void)m_early_interrupts.insert(id);
+    if (m_early_interrupts.size() > kMaxEarlyInterruptCount)
+    {
+      (void)m_early_interrupts.erase(m_early_interrupts.begin());
+    }
+  }
+
+  /**
+   * @brief Returns the oldest pending request not given to the provider yet. Should be called
+   * under the lock.
+   */
+  typename container_t::iterator FindNextRequest()
+  {
+    auto result = m_requests.end();
+    for (auto iter = m_requests.begin(); iter != m_requests.end(); ++iter)
+    {
+      const auto& request = iter->second;
+      if (request.status != Status::kPending || request.dispatched)
+      {
+        continue;
+      }
+      if (result == m_requests.end() || request.sequence_number < result->second.sequence_number)
+      {
+        result = iter;
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief Completes pending request with the given status and data.
+   */
+  bool Complete(std::uint64_t id, Status status, const DataT& data)
+  {
+    {
+      const std::scoped_lock lock{m_mutex};
+      auto iter = m_requests.find(id);
+      if (iter == m_requests.end() || iter->second.status != Status::kPending)
+      {
+        return false;
+      }
+      iter->second.data = data;
+      iter->second.status = status;
+    }
+    m_cv.notify_all();
+    return true;
+  }
+
   mutable std::mutex m_mutex;
+  std::condition_variable m_cv;
 
   //!< External provider which will return requested data for given set of arguments.
   provider_callback_t m_provider_callback;
 
-  //!< Queue of requests from various threads.
-  std::queue<RequestPack*> m_stack;
+  //!< Requests from various threads, waiting for the answer.
+  container_t m_requests;
+
+  //!< Ids of requests interrupted before the consumer has asked for the data.
+  std::set<std::uint64_t> m_early_interrupts;
+
+  std::chrono::milliseconds m_timeout{0};
+  std::uint64_t m_sequence_number{0};
+  std::size_t m_duplicate_request_count{0};
+  bool m_closed{false};
 };
 
 }  // namespace oac_tree_gui
@@ -0,0 +1,233 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "scripted_user_responder.h"
+
+#include "user_context.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+
+#include <sup/gui/model/anyvalue_utils.h>
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+namespace oac_tree_gui
+{
+
+namespace
+{
+
+/**
+ * @brief Returns the JSON representation of the value, which can be a scalar.
+ */
+std::string ToJsonString(const QJsonValue& value)
+{
+  // QJsonDocument doesn't serialize scalars, wrapping the value into the array
+  const auto array_string = QJsonDocument(QJsonArray{value}).toJson(QJsonDocument::Compact);
+  return array_string.mid(1, array_string.size() - 2).toStdString();
+}
+
+ScriptedUserRule CreateRule(const QJsonObject& json, int rule_index)
+{
+  auto error = [rule_index](const std::string& reason)
+  { return RuntimeException("Rule #" + std::to_string(rule_index) + ": " + reason); };
+
+  ScriptedUserRule result;
+
+  const auto type = json["type"].toString();
+  if (type == "input")
+  {
+    result.type = ScriptedUserRule::RequestType::kInput;
+    if (!json.contains("value"))
+    {
+      throw error("input rule should have a value");
+    }
+    result.value = ToJsonString(json["value"]);
+  }
+  else if (type == "choice")
+  {
+    result.type = ScriptedUserRule::RequestType::kChoice;
+    if (json["option"].isString())
+    {
+      result.choice_option = json["option"].toString().toStdString();
+    }
+    else if (json["index"].isDouble())
+    {
+      result.choice_index = json["index"].toInt();
+    }
+    else
+    {
+      throw error("choice rule should have an option, or an index");
+    }
+  }
+  else
+  {
+    throw error("unknown type of the rule [" + type.toStdString() + "]");
+  }
+
+  result.pattern = json["match"].toString().toStdString();
+
+  const auto delay = json["delay"].toInt(0);
+  if (delay < 0)
+  {
+    throw error("delay can't be negative");
+  }
+  result.delay = std::chrono::milliseconds(delay);
+
+  return result;
+}
+
+}  // namespace
+
+ScriptedUserResponder::ScriptedUserResponder(const std::vector<ScriptedUserRule>& rules)
+{
+  m_rules.reserve(rules.size());
+  for (const auto& rule : rules)
+  {
+    try
+    {
+      m_rules.push_back({rule, std::regex(rule.pattern)});
+    }
+    catch (const std::regex_error& ex)
+    {
+      throw RuntimeException("Invalid pattern [" + rule.pattern + "]: " + ex.what());
+    }
+  }
+}
+
+UserInputResult ScriptedUserResponder::GetUserInput(const UserInputArgs& args) const
+{
+  const auto rule = FindRule(ScriptedUserRule::RequestType::kInput, args.description);
+  if (rule == nullptr)
+  {
+    ++m_unanswered_count;
+    return {};
+  }
+
+  std::this_thread::sleep_for(rule->rule.delay);
+
+  try
+  {
+    return {sup::gui::AnyValueFromJSONString(args.value.GetType(), rule->rule.value), true};
+  }
+  catch (const std::exception&)
+  {
+    // the value doesn't fit the type of the requested value
+    ++m_unanswered_count;
+    return {};
+  }
+}
+
+UserChoiceResult ScriptedUserResponder::GetUserChoice(const UserChoiceArgs& args) const
+{
+  const auto rule = FindRule(ScriptedUserRule::RequestType::kChoice,
+                             sup::gui::ValuesToJSONString(args.metadata));
+  if (rule == nullptr)
+  {
+    ++m_unanswered_count;
+    return {};
+  }
+
+  std::this_thread::sleep_for(rule->rule.delay);
+
+  auto index = rule->rule.choice_index;
+  if (!rule->rule.choice_option.empty())
+  {
+    auto iter = std::find(args.options.begin(), args.options.end(), rule->rule.choice_option);
+    index = iter == args.options.end()
+                ? -1
+                : static_cast<std::int32_t>(std::distance(args.options.begin(), iter));
+  }
+
+  if (index < 0 || index >= static_cast<std::int32_t>(args.options.size()))
+  {
+    ++m_unanswered_count;
+    return {};
+  }
+
+  return {index, true};
+}
+
+std::size_t ScriptedUserResponder::GetUnansweredCount() const
+{
+  return m_unanswered_count;
+}
+
+const ScriptedUserResponder::CompiledRule* ScriptedUserResponder::FindRule(
+    ScriptedUserRule::RequestType type, const std::string& text) const
+{
+  auto on_rule = [type, &text](const CompiledRule& rule)
+  { return rule.rule.type == type && std::regex_search(text, rule.regex); };
+  auto iter = std::find_if(m_rules.begin(), m_rules.end(), on_rule);
+  return iter == m_rules.end() ? nullptr : &*iter;
+}
+
+std::vector<ScriptedUserRule> ReadScriptedUserRules(const std::string& file_name)
+{
+  QFile file(QString::fromStdString(file_name));
+  if (!file.open(QIODevice::ReadOnly))
+  {
+    throw RuntimeException("Can't open file [" + file_name + "]");
+  }
+
+  QJsonParseError parse_error;
+  const auto document = QJsonDocument::fromJson(file.readAll(), &parse_error);
+  if (document.isNull())
+  {
+    throw RuntimeException("Can't parse file [" + file_name
+                           + "]: " + parse_error.errorString().toStdString());
+  }
+
+  const auto rules =
+      document.isArray() ? document.array() : document.object()["rules"].toArray();
+
+  std::vector<ScriptedUserRule> result;
+  result.reserve(static_cast<std::size_t>(rules.size()));
+  for (int index = 0; index < rules.size(); ++index)
+  {
+    if (!rules.at(index).isObject())
+    {
+      throw RuntimeException("Rule #" + std::to_string(index) + " is not an object");
+    }
+    result.push_back(CreateRule(rules.at(index).toObject(), index));
+  }
+  return result;
+}
+
+UserContext CreateScriptedUserContext(const std::string& file_name)
+{
+  auto responder = std::make_shared<const ScriptedUserResponder>(ReadScriptedUserRules(file_name));
+
+  UserContext result;
+  result.user_input_callback = [responder](const UserInputArgs& args)
+  { return responder->GetUserInput(args); };
+  result.user_choice_callback = [responder](const UserChoiceArgs& args)
+  { return responder->GetUserChoice(args); };
+  result.answer_on_calling_thread = true;
+  return result;
+}
+
+}  // namespace oac_tree_gui
@@ -0,0 +1,130 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_SCRIPTED_USER_RESPONDER_H_
+#define OAC_TREE_GUI_JOBSYSTEM_SCRIPTED_USER_RESPONDER_H_
+
+#include <oac_tree_gui/jobsystem/request_types.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+struct UserContext;
+
+/**
+ * @brief The ScriptedUserRule struct defines an automatic answer to a user input, or user choice,
+ * request.
+ */
+struct ScriptedUserRule
+{
+  enum class RequestType
+  {
+    kInput,
+    kChoice
+  };
+
+  RequestType type{RequestType::kInput};  //!< type of requests the rule applies to
+
+  //!< regular expression searched in the description of input, or in the JSON representation of
+  //!< the choice metadata, empty pattern matches any request
+  std::string pattern;
+
+  std::string value;  //!< JSON representation of the input value
+
+  std::int32_t choice_index{-1};  //!< index of the option to choose
+  std::string choice_option;      //!< text of the option to choose, takes precedence over index
+
+  std::chrono::milliseconds delay{0};  //!< artificial delay before the answer
+};
+
+/**
+ * @brief The ScriptedUserResponder class answers user input and user choice requests according to
+ * the given rules, without asking the user.
+ *
+ * The first rule matching the request provides the answer. The request without a matching rule,
+ * or with a rule which can't be applied, e.g. the value can't be converted to the type of the
+ * requested value, is reported as not processed.
+ *
+ * All methods are thread-safe and the answer is given on the calling thread, so the responder is
+ * suitable for unattended runs of many jobs.
+ */
+class ScriptedUserResponder
+{
+public:
+  explicit ScriptedUserResponder(const std::vector<ScriptedUserRule>& rules);
+
+  UserInputResult GetUserInput(const UserInputArgs& args) const;
+
+  UserChoiceResult GetUserChoice(const UserChoiceArgs& args) const;
+
+  /**
+   * @brief Returns the number of requests left without an answer.
+   */
+  std::size_t GetUnansweredCount() const;
+
+private:
+  struct CompiledRule
+  {
+    ScriptedUserRule rule;
+    std::regex regex;
+  };
+
+  /**
+   * @brief Returns the first rule of the given type matching the text, or nullptr.
+   */
+  const CompiledRule* FindRule(ScriptedUserRule::RequestType type, const std::string& text) const;
+
+  std::vector<CompiledRule> m_rules;
+  mutable std::atomic<std::size_t> m_unanswered_count{0};
+};
+
+/**
+ * @brief Reads rules of automatic answers from the JSON file.
+ *
+ * The file contains an array of rules, or an object with such array under "rules" key. Every
+ * rule is an object with fields:
+ * - "type": "input" or "choice";
+ * - "match": optional regular expression, see ScriptedUserRule::pattern;
+ * - "value": the input value, e.g. 42, or {"a": 1}, for input requests;
+ * - "index", or "option": the index, or the text, of the option to choose, for choice requests;
+ * - "delay": optional delay of the answer in msec.
+ *
+ * @throws RuntimeException if the file can't be read, or contains an invalid rule.
+ */
+std::vector<ScriptedUserRule> ReadScriptedUserRules(const std::string& file_name);
+
+/**
+ * @brief Creates the user context answering requests according to the rules from the given file,
+ * see ReadScriptedUserRules.
+ *
+ * Answers are given on the thread asking for them, without a round-trip to the GUI thread.
+ */
+UserContext CreateScriptedUserContext(const std::string& file_name);
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_SCRIPTED_USER_RESPONDER_H_
@@ -0,0 +1,62 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "shared_anyvalue.h"
+
+namespace oac_tree_gui
+{
+
+SharedAnyValue::SharedAnyValue(const sup::dto::AnyValue& value)
+    : m_value(std::make_shared<const sup::dto::AnyValue>(value))
+{
+}
+
+SharedAnyValue::SharedAnyValue(sup::dto::AnyValue&& value)
+    : m_value(std::make_shared<const sup::dto::AnyValue>(std::move(value)))
+{
+}
+
+const sup::dto::AnyValue& SharedAnyValue::Get() const
+{
+  static const sup::dto::AnyValue kEmptyValue;
+  return m_value ? *m_value : kEmptyValue;
+}
+
+SharedAnyValue::operator const sup::dto::AnyValue&() const
+{
+  return Get();
+}
+
+bool SharedAnyValue::IsSameInstance(const SharedAnyValue& other) const
+{
+  return m_value == other.m_value;
+}
+
+bool operator==(const SharedAnyValue& lhs, const SharedAnyValue& rhs)
+{
+  return lhs.IsSameInstance(rhs) || lhs.Get() == rhs.Get();
+}
+
+bool operator!=(const SharedAnyValue& lhs, const SharedAnyValue& rhs)
+{
+  return !(lhs == rhs);
+}
+
+}  // namespace oac_tree_gui
@@ -0,0 +1,80 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_SHARED_ANYVALUE_H_
+#define OAC_TREE_GUI_JOBSYSTEM_SHARED_ANYVALUE_H_
+
+#include <sup/dto/anyvalue.h>
+
+#include <memory>
+
+namespace oac_tree_gui
+{
+
+/**
+ * @brief The SharedAnyValue class is an immutable AnyValue shared between the copies.
+ *
+ * It is used as a payload of domain events, so copying an event on its way from the sequencer
+ * thread to the GUI doesn't lead to a deep copy of a possibly large structured value. The value is
+ * copied once, when the payload is created from the const reference.
+ */
+class SharedAnyValue
+{
+public:
+  /**
+   * @brief Creates empty value.
+   */
+  SharedAnyValue() = default;
+
+  /**
+   * @brief Creates payload from a copy of the given value.
+   */
+  SharedAnyValue(const sup::dto::AnyValue& value);
+
+  /**
+   * @brief Creates payload taking the ownership of the given value.
+   */
+  SharedAnyValue(sup::dto::AnyValue&& value);
+
+  /**
+   * @brief Returns the value, empty AnyValue if payload wasn't initialised.
+   */
+  const sup::dto::AnyValue& Get() const;
+
+  /**
+   * @brief Implicit conversion to let events be used as if they would hold AnyValue directly.
+   */
+  operator const sup::dto::AnyValue&() const;
+
+  /**
+   * @brief Checks if both payloads refer to the same value instance.
+   */
+  bool IsSameInstance(const SharedAnyValue& other) const;
+
+private:
+  std::shared_ptr<const sup::dto::AnyValue> m_value;
+};
+
+bool operator==(const SharedAnyValue& lhs, const SharedAnyValue& rhs);
+bool operator!=(const SharedAnyValue& lhs, const SharedAnyValue& rhs);
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_SHARED_ANYVALUE_H_
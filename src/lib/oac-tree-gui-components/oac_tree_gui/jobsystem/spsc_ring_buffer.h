@@ -0,0 +1,135 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_SPSC_RING_BUFFER_H_
+#define OAC_TREE_GUI_JOBSYSTEM_SPSC_RING_BUFFER_H_
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+/**
+ * @brief The SpscRingBuffer class is a bounded lock-free single-producer/single-consumer queue.
+ *
+ * All slots are allocated on construction. TryPush is allowed to be called from a single producer
+ * thread only, TryPop from a single consumer thread only. Neither of them blocks.
+ *
+ * @tparam T Type of the element, must be default constructible and move assignable.
+ */
+template <typename T>
+class SpscRingBuffer
+{
+public:
+  /**
+   * @brief Main c-tor.
+   *
+   * @param capacity Requested capacity, will be rounded up to the nearest power of two.
+   */
+  explicit SpscRingBuffer(std::size_t capacity)
+      : m_buffer(GetRoundedCapacity(capacity)), m_mask(m_buffer.size() - 1)
+  {
+  }
+
+  SpscRingBuffer(const SpscRingBuffer&) = delete;
+  SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+  SpscRingBuffer(SpscRingBuffer&&) = delete;
+  SpscRingBuffer& operator=(SpscRingBuffer&&) = delete;
+
+  /**
+   * @brief Pushes the value in the buffer. Intended for call from the producer thread.
+   *
+   * @return True if value has been moved in the buffer, false if the buffer is full. In the latter
+   * case the value is left untouched.
+   */
+  bool TryPush(T&& value)
+  {
+    const auto head = m_head.load(std::memory_order_relaxed);
+    if (head - m_tail.load(std::memory_order_acquire) == m_buffer.size())
+    {
+      return false;
+    }
+
+    m_buffer[head & m_mask] = std::move(value);
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Pops the value from the buffer. Intended for call from the consumer thread.
+   *
+   * @return True if value has been retrieved, false if the buffer is empty.
+   */
+  bool TryPop(T& value)
+  {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    if (tail == m_head.load(std::memory_order_acquire))
+    {
+      return false;
+    }
+
+    auto& slot = m_buffer[tail & m_mask];
+    value = std::move(slot);
+    slot = T{};  // releasing resources held by the slot
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Returns number of elements in the buffer.
+   *
+   * The value is approximate, when called concurrently with push or pop.
+   */
+  std::size_t GetSize() const
+  {
+    return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Returns buffer capacity.
+   */
+  std::size_t GetCapacity() const { return m_buffer.size(); }
+
+private:
+  static std::size_t GetRoundedCapacity(std::size_t capacity)
+  {
+    std::size_t result{1};
+    while (result < capacity)
+    {
+      result <<= 1;
+    }
+    return result;
+  }
+
+  std::vector<T> m_buffer;
+  std::size_t m_mask{0};
+
+  //!< index of the next slot to write, modified by the producer only
+  alignas(64) std::atomic<std::size_t> m_head{0};
+
+  //!< index of the next slot to read, modified by the consumer only
+  alignas(64) std::atomic<std::size_t> m_tail{0};
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_SPSC_RING_BUFFER_H_
@@ -0,0 +1,151 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "tick_pacer.h"
+
+#include <thread>
+
+namespace oac_tree_gui
+{
+
+namespace
+{
+
+/**
+ * @brief Duration of the window to calculate the tick rate.
+ */
+const std::chrono::seconds kRateWindow{1};
+
+/**
+ * @brief The remaining time to wait, below which the condition variable is not accurate enough.
+ */
+const std::chrono::microseconds kSpinThreshold{200};
+
+/**
+ * @brief Returns number of ticks per second.
+ */
+double GetRate(std::size_t tick_count, std::chrono::steady_clock::duration elapsed)
+{
+  const double seconds = std::chrono::duration<double>(elapsed).count();
+  return seconds > 0.0 ? static_cast<double>(tick_count) / seconds : 0.0;
+}
+
+}  // namespace
+
+void TickPacer::SetTickPeriod(std::chrono::microseconds period)
+{
+  {
+    const std::scoped_lock lock{m_mutex};
+    m_period = period;
+    ++m_generation;
+  }
+  m_cv.notify_all();
+}
+
+std::chrono::microseconds TickPacer::GetTickPeriod() const
+{
+  const std::scoped_lock lock{m_mutex};
+  return m_period;
+}
+
+void TickPacer::Tick()
+{
+  std::unique_lock<std::mutex> lock{m_mutex};
+  auto now = clock_t::now();
+  CountTick(now);
+
+  if (m_previous_tick_time == clock_t::time_point{})
+  {
+    m_previous_tick_time = now;  // the first tick starts the schedule
+  }
+  else if (m_period.count() > 0 && now - m_previous_tick_time > 2 * m_period)
+  {
+    // too late to catch up, restarting the schedule to run the next tick immediately
+    ++m_late_tick_count;
+    m_previous_tick_time = now - m_period;
+  }
+
+  while (m_period.count() > 0)
+  {
+    const auto next_tick_time = m_previous_tick_time + m_period;
+    now = clock_t::now();
+    if (now >= next_tick_time)
+    {
+      m_previous_tick_time = next_tick_time;
+      return;
+    }
+
+    if (next_tick_time - now > kSpinThreshold)
+    {
+      const auto generation = m_generation;
+      (void)m_cv.wait_until(lock, next_tick_time - kSpinThreshold,
+                            [this, generation]() { return m_generation != generation; });
+      continue;  // the period might have been changed
+    }
+
+    lock.unlock();
+    while (clock_t::now() < next_tick_time)
+    {
+      std::this_thread::yield();
+    }
+    lock.lock();
+    m_previous_tick_time = next_tick_time;
+    return;
+  }
+
+  // full speed, the schedule starts anew when the period is set
+  m_previous_tick_time = clock_t::time_point{};
+}
+
+TickStatistics TickPacer::GetStatistics(clock_t::time_point now) const
+{
+  const std::scoped_lock lock{m_mutex};
+
+  TickStatistics result;
+  result.tick_count = m_tick_count;
+  result.late_tick_count = m_late_tick_count;
+
+  // when no ticks have happened for a while, the last completed window is outdated
+  const auto window_duration = now - m_window_start;
+  result.tick_rate =
+      window_duration >= kRateWindow ? GetRate(m_window_tick_count, window_duration) : m_tick_rate;
+
+  if (m_period.count() > 0)
+  {
+    result.target_tick_rate = 1.0 / std::chrono::duration<double>(m_period).count();
+  }
+  return result;
+}
+
+void TickPacer::CountTick(clock_t::time_point now)
+{
+  ++m_tick_count;
+  ++m_window_tick_count;
+
+  const auto window_duration = now - m_window_start;
+  if (window_duration >= kRateWindow)
+  {
+    m_tick_rate = GetRate(m_window_tick_count, window_duration);
+    m_window_tick_count = 0;
+    m_window_start = now;
+  }
+}
+
+}  // namespace oac_tree_gui
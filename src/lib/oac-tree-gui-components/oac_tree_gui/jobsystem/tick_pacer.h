@@ -0,0 +1,99 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_JOBSYSTEM_TICK_PACER_H_
+#define OAC_TREE_GUI_JOBSYSTEM_TICK_PACER_H_
+
+#include <oac_tree_gui/jobsystem/domain_event_statistics.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace oac_tree_gui
+{
+
+/**
+ * @brief The TickPacer class keeps procedure ticks at the target rate.
+ *
+ * Tick is called by the sequencer thread after each tick of the procedure. It waits till the
+ * scheduled moment of the next tick. Moments are counted from the previous schedule rather than
+ * from the end of the wait, so the time spent in the procedure itself, and the inaccuracy of
+ * the wake-up, don't accumulate. When the procedure falls behind the schedule by more than one
+ * period, the schedule is restarted instead of running a burst of ticks to catch up.
+ *
+ * The waiting is done on a condition variable, which is interrupted when the period changes.
+ * The last fraction of a millisecond is spent in a yielding loop to get sub-millisecond
+ * resolution.
+ */
+class TickPacer
+{
+public:
+  using clock_t = std::chrono::steady_clock;
+
+  /**
+   * @brief Sets the target interval between ticks, zero means full speed.
+   *
+   * Interrupts the wait in progress, which continues with the new period counted from the
+   * previous tick.
+   */
+  void SetTickPeriod(std::chrono::microseconds period);
+
+  /**
+   * @brief Returns the target interval between ticks.
+   */
+  std::chrono::microseconds GetTickPeriod() const;
+
+  /**
+   * @brief Registers the tick and waits till the next one is due.
+   */
+  void Tick();
+
+  /**
+   * @brief Returns the number of ticks and the measured tick rate.
+   */
+  TickStatistics GetStatistics(clock_t::time_point now = clock_t::now()) const;
+
+private:
+  /**
+   * @brief Counts the tick in the current rate window. Should be called under the lock.
+   */
+  void CountTick(clock_t::time_point now);
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::chrono::microseconds m_period{0};
+
+  //!< increased on every change of the period to wake up the waiting thread
+  std::size_t m_generation{0};
+
+  //!< scheduled moment of the previous tick, zero when the schedule is not started
+  clock_t::time_point m_previous_tick_time{};
+
+  std::size_t m_tick_count{0};
+  std::size_t m_late_tick_count{0};
+  clock_t::time_point m_window_start{clock_t::now()};
+  std::size_t m_window_tick_count{0};  //!< number of ticks in the current rate window
+  double m_tick_rate{0.0};             //!< rate over the last completed window
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_JOBSYSTEM_TICK_PACER_H_
@@ -38,6 +38,10 @@ struct UserContext
 
   //!< a callback to return user choice
   std::function<UserChoiceResult(const UserChoiceArgs&)> user_choice_callback;
+
+  //!< callbacks are thread-safe and should be called directly on the thread asking for the
+  //!< answer, instead of the GUI thread
+  bool answer_on_calling_thread{false};
 };
 
 }  // namespace oac_tree_gui
@@ -0,0 +1,138 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "instruction_profile_helper.h"
+
+#include <oac_tree_gui/jobsystem/instruction_profiler.h>
+#include <oac_tree_gui/model/instruction_container_item.h>
+#include <oac_tree_gui/model/instruction_item.h>
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <algorithm>
+#include <sstream>
+#include <stack>
+#include <utility>
+
+namespace oac_tree_gui
+{
+
+namespace
+{
+
+/**
+ * @brief Returns instruction name suitable for profile reports.
+ *
+ * Semicolons are reserved by collapsed stack format as frame separators.
+ */
+std::string GetFrameName(const InstructionItem& item)
+{
+  auto result = item.GetName().empty() ? item.GetDisplayName() : item.GetName();
+  std::replace(result.begin(), result.end(), ';', '_');
+  return result;
+}
+
+}  // namespace
+
+std::chrono::microseconds CalculateSelfTime(const InstructionItem& item,
+                                            const profile_provider_t& find_profile)
+{
+  const auto* entry = find_profile(item);
+  if (entry == nullptr)
+  {
+    return std::chrono::microseconds(0);
+  }
+
+  auto result = entry->total_time;
+  for (const auto* child : item.GetInstructions())
+  {
+    if (const auto* child_entry = find_profile(*child); child_entry)
+    {
+      result -= child_entry->total_time;
+    }
+  }
+  return std::max(std::chrono::microseconds(0), result);
+}
+
+std::string CreateCollapsedStackProfile(const InstructionContainerItem& container,
+                                        const profile_provider_t& find_profile)
+{
+  std::ostringstream result;
+
+  std::stack<std::pair<const InstructionItem*, std::string>> stack;
+  auto top_instructions = container.GetInstructions();
+  for (auto it = top_instructions.rbegin(); it != top_instructions.rend(); ++it)
+  {
+    stack.emplace(*it, std::string());
+  }
+
+  while (!stack.empty())
+  {
+    auto [item, parent_frames] = stack.top();
+    stack.pop();
+
+    const auto frames =
+        parent_frames.empty() ? GetFrameName(*item) : parent_frames + ";" + GetFrameName(*item);
+
+    const auto self_time = CalculateSelfTime(*item, find_profile);
+    if (self_time.count() > 0)
+    {
+      result << frames << " " << self_time.count() << "\n";
+    }
+
+    auto children = item->GetInstructions();
+    for (auto it = children.rbegin(); it != children.rend(); ++it)
+    {
+      stack.emplace(*it, frames);
+    }
+  }
+
+  return result.str();
+}
+
+std::string CreateChromeTraceProfile(
+    const std::vector<InstructionCallRecord>& records,
+    const std::function<const InstructionItem*(std::size_t)>& find_instruction)
+{
+  QJsonArray trace_events;
+  for (const auto& record : records)
+  {
+    const auto* item = find_instruction(record.instr_idx);
+
+    QJsonObject event;
+    event["name"] = (item != nullptr) ? QString::fromStdString(GetFrameName(*item))
+                                      : QString("Instruction %1").arg(record.instr_idx);
+    event["ph"] = "X";  // complete event, with the start and the duration
+    event["ts"] = static_cast<qint64>(record.start_time.count());
+    event["dur"] = static_cast<qint64>(record.duration.count());
+    event["pid"] = 1;
+    event["tid"] = 1;
+    event["args"] = QJsonObject{{"index", static_cast<qint64>(record.instr_idx)}};
+    trace_events.append(event);
+  }
+
+  QJsonObject result;
+  result["traceEvents"] = trace_events;
+  result["displayTimeUnit"] = "ms";
+  return QJsonDocument(result).toJson(QJsonDocument::Indented).toStdString();
+}
+
+}  // namespace oac_tree_gui
@@ -0,0 +1,81 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_OPERATION_INSTRUCTION_PROFILE_HELPER_H_
+#define OAC_TREE_GUI_OPERATION_INSTRUCTION_PROFILE_HELPER_H_
+
+//! Collection of helper methods to show and export execution profile of instructions.
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+class InstructionItem;
+class InstructionContainerItem;
+struct InstructionProfileEntry;
+struct InstructionCallRecord;
+
+/**
+ * @brief The ProfileFormat enum lists supported formats of profile export.
+ */
+enum class ProfileFormat : std::uint8_t
+{
+  kCollapsedStack,  //!< one line per call stack, the input of flame graph tools
+  kChromeTrace      //!< trace event JSON, as understood by chrome://tracing and Perfetto
+};
+
+//! Returns execution profile of the instruction, or nullptr if it hasn't been executed.
+using profile_provider_t = std::function<const InstructionProfileEntry*(const InstructionItem&)>;
+
+/**
+ * @brief Returns instruction total time minus total times of its children.
+ *
+ * Children of parallel instructions overlap in time, negative results are reported as zero.
+ */
+std::chrono::microseconds CalculateSelfTime(const InstructionItem& item,
+                                            const profile_provider_t& find_profile);
+
+/**
+ * @brief Creates collapsed stack profile from self times of all instructions in the container.
+ *
+ * Every executed instruction is reported as a single line with semicolon-separated names of its
+ * ancestors, followed by its self time in microseconds.
+ */
+std::string CreateCollapsedStackProfile(const InstructionContainerItem& container,
+                                        const profile_provider_t& find_profile);
+
+/**
+ * @brief Creates Chrome trace profile from recorded instruction calls.
+ *
+ * @param records Recorded instruction executions.
+ * @param find_instruction Returns instruction item for the domain index, or nullptr.
+ */
+std::string CreateChromeTraceProfile(
+    const std::vector<InstructionCallRecord>& records,
+    const std::function<const InstructionItem*(std::size_t)>& find_instruction);
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_OPERATION_INSTRUCTION_PROFILE_HELPER_H_
@@ -32,6 +32,7 @@
 #include <mvvm/viewmodel/viewmodel.h>
 
 #include <QTreeView>
+#include <algorithm>
 
 namespace oac_tree_gui
 {
@@ -57,14 +58,19 @@ void InstructionTreeExpandController::SetInstructionContainer(
 void InstructionTreeExpandController::SaveSelectionRequest(
     const std::vector<InstructionItem*>& instructions)
 {
-  m_selection_preferences = instructions;
+  m_selection_preferences.clear();
+  for (auto item : instructions)
+  {
+    ++m_selection_preferences[item];
+  }
+  m_visible_instruction_count_valid = false;
 }
 
 std::vector<mvvm::SessionItem*> InstructionTreeExpandController::GetInstructionsToSelect() const
 {
   std::vector<mvvm::SessionItem*> result;
   result.reserve(m_selection_preferences.size());
-  for (auto item : m_selection_preferences)
+  for (const auto& [item, count] : m_selection_preferences)
   {
     result.push_back(FindVisibleInstruction(item));
   }
@@ -72,6 +78,54 @@ std::vector<mvvm::SessionItem*> InstructionTreeExpandController::GetInstructions
   return result;
 }
 
+InstructionTreeExpandController::SelectionChange
+InstructionTreeExpandController::UpdateSelectionRequest(
+    const std::vector<InstructionItem*>& added, const std::vector<InstructionItem*>& removed)
+{
+  if (!m_visible_instruction_count_valid)
+  {
+    UpdateVisibleInstructionCount();
+  }
+
+  SelectionChange result;
+
+  // processing added instructions first, so the parent of collapsed branch stays selected when one
+  // of its children replaces another
+  for (auto item : added)
+  {
+    ++m_selection_preferences[item];
+    if (auto visible_item = FindVisibleInstruction(item); visible_item)
+    {
+      if (++m_visible_instruction_count[visible_item] == 1)
+      {
+        result.to_select.push_back(visible_item);
+      }
+    }
+  }
+
+  for (auto item : removed)
+  {
+    auto pos = m_selection_preferences.find(item);
+    if (pos == m_selection_preferences.end())
+    {
+      continue;
+    }
+    if (--pos->second == 0)
+    {
+      m_selection_preferences.erase(pos);
+    }
+
+    auto count_pos = m_visible_instruction_count.find(FindVisibleInstruction(item));
+    if (count_pos != m_visible_instruction_count.end() && --count_pos->second == 0)
+    {
+      result.to_deselect.push_back(count_pos->first);
+      m_visible_instruction_count.erase(count_pos);
+    }
+  }
+
+  return result;
+}
+
 mvvm::SessionItem* InstructionTreeExpandController::FindVisibleInstruction(
     const mvvm::SessionItem* item) const
 {
@@ -126,6 +180,7 @@ void InstructionTreeExpandController::OnTreeCollapsedChange(const QModelIndex& i
     SetCollapsed(!m_tree_view->isExpanded(index), *instruction);
   }
 
+  m_visible_instruction_count_valid = false;
   emit VisibilityHasChanged();
 }
 
@@ -134,4 +189,17 @@ InstructionItem* InstructionTreeExpandController::GetInstruction(const QModelInd
   return mvvm::utils::GetItemFromView<InstructionItem>(GetViewModel()->itemFromIndex(index));
 }
 
+void InstructionTreeExpandController::UpdateVisibleInstructionCount()
+{
+  m_visible_instruction_count.clear();
+  for (const auto& [item, count] : m_selection_preferences)
+  {
+    if (auto visible_item = FindVisibleInstruction(item); visible_item)
+    {
+      m_visible_instruction_count[visible_item] += count;
+    }
+  }
+  m_visible_instruction_count_valid = true;
+}
+
 }  // namespace oac_tree_gui
@@ -22,6 +22,9 @@
 #define OAC_TREE_GUI_OPERATION_OBJECTS_INSTRUCTION_TREE_EXPAND_CONTROLLER_H_
 
 #include <QObject>
+#include <map>
+#include <unordered_map>
+#include <vector>
 
 class QTreeView;
 
@@ -53,6 +56,16 @@ class InstructionTreeExpandController : public QObject
   Q_OBJECT
 
 public:
+  /**
+   * @brief The SelectionChange struct holds visible instructions, which selection state should be
+   * changed.
+   */
+  struct SelectionChange
+  {
+    std::vector<mvvm::SessionItem*> to_select;
+    std::vector<mvvm::SessionItem*> to_deselect;
+  };
+
   explicit InstructionTreeExpandController(QTreeView* tree_view, QObject* parent_object = nullptr);
   ~InstructionTreeExpandController() override;
 
@@ -80,6 +93,17 @@ public:
    */
   std::vector<mvvm::SessionItem*> GetInstructionsToSelect() const;
 
+  /**
+   * @brief Adds and removes instructions to the saved list of instructions to select.
+   *
+   * @details Several instructions inside a collapsed branch are represented by a single visible
+   * parent. The parent is reported for deselection only when the last of them has gone.
+   *
+   * @return Visible instructions which should be added to, or removed from the current selection.
+   */
+  SelectionChange UpdateSelectionRequest(const std::vector<InstructionItem*>& added,
+                                         const std::vector<InstructionItem*>& removed);
+
   /**
    * @brief Finds visible instruction up in the hierarchy located in non-collapsed branch.
    *
@@ -100,10 +124,20 @@ private:
   void OnTreeCollapsedChange(const QModelIndex& index);
   InstructionItem* GetInstruction(const QModelIndex& index);
 
+  /**
+   * @brief Recalculates how many instructions to select are represented by each visible item.
+   */
+  void UpdateVisibleInstructionCount();
+
   QTreeView* m_tree_view{nullptr};
   InstructionContainerItem* m_instruction_container{nullptr};
 
-  std::vector<InstructionItem*> m_selection_preferences;
+  //!< instructions to select, with the number of requests, so every update costs O(delta)
+  std::unordered_map<InstructionItem*, std::size_t> m_selection_preferences;
+
+  //!< number of instructions to select represented by each visible item
+  std::map<mvvm::SessionItem*, std::size_t> m_visible_instruction_count;
+  bool m_visible_instruction_count_valid{false};
 };
 
 }  // namespace oac_tree_gui
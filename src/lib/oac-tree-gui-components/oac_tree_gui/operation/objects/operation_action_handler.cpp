@@ -21,8 +21,10 @@
 #include "operation_action_handler.h"
 
 #include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/objects/abstract_job_handler.h>
 #include <oac_tree_gui/jobsystem/objects/job_manager.h>
 #include <oac_tree_gui/jobsystem/objects/local_job_handler.h>
+#include <oac_tree_gui/jobsystem/objects/remote_job_importer.h>
 #include <oac_tree_gui/jobsystem/remote_connection_info.h>
 #include <oac_tree_gui/model/item_constants.h>
 #include <oac_tree_gui/model/job_item.h>
@@ -32,6 +34,8 @@
 #include <mvvm/model/i_session_model.h>
 #include <mvvm/model/item_utils.h>
 
+#include <fstream>
+
 namespace oac_tree_gui
 {
 
@@ -91,6 +95,26 @@ void OperationActionHandler::SetJobContainer(mvvm::SessionItem* job_container)
   m_job_container = job_container;
 }
 
+void OperationActionHandler::SetRemoteJobImporter(RemoteJobImporter* importer)
+{
+  if (m_remote_job_importer != nullptr)
+  {
+    disconnect(m_remote_job_importer, nullptr, this, nullptr);
+  }
+
+  m_remote_job_importer = importer;
+
+  if (m_remote_job_importer != nullptr)
+  {
+    connect(m_remote_job_importer, &RemoteJobImporter::JobPrepared, this,
+            &OperationActionHandler::OnRemoteJobPrepared);
+    connect(m_remote_job_importer, &RemoteJobImporter::JobPreparationFailed, this,
+            &OperationActionHandler::OnRemoteJobPreparationFailed);
+    connect(m_remote_job_importer, &RemoteJobImporter::ImportFinished, this,
+            &OperationActionHandler::OnRemoteImportFinished);
+  }
+}
+
 bool OperationActionHandler::SubmitLocalJob(ProcedureItem* procedure_item)
 {
   if (procedure_item == nullptr)
@@ -113,19 +137,56 @@ bool OperationActionHandler::OnImportRemoteJobRequest()
     return false;
   }
 
-  bool is_success{false};
-  if (auto user_choice = m_operation_context.get_remote_connection_info(); user_choice.has_value())
+  auto user_choice = m_operation_context.get_remote_connection_info();
+  if (!user_choice.has_value())
   {
-    is_success = true;
-    auto user_choice_value = user_choice.value();
-    for (auto index : user_choice_value.job_indexes)
+    return false;
+  }
+
+  const auto& connection_info = user_choice.value();
+  if (m_remote_job_importer == nullptr)
+  {
+    bool is_success{true};
+    for (auto index : connection_info.job_indexes)
     {
       // all should succeed
-      is_success &= SubmitJob(CreateRemoteJobItem(user_choice_value.server_name, index));
+      is_success &= SubmitJob(CreateRemoteJobItem(connection_info.server_name, index));
     }
+    return is_success;
   }
 
-  return is_success;
+  for (auto index : connection_info.job_indexes)
+  {
+    auto job = InsertJobAfterCurrentSelection(
+        CreateRemoteJobItem(connection_info.server_name, index));
+    (void)m_pending_remote_jobs.insert(
+        {{connection_info.server_name, index}, job->GetIdentifier()});
+    emit MakeJobSelectedRequest(job);
+  }
+  m_remote_job_importer->Import(connection_info);
+
+  return true;
+}
+
+void OperationActionHandler::OnCancelRemoteImportRequest()
+{
+  if (m_remote_job_importer != nullptr)
+  {
+    m_remote_job_importer->Cancel();
+  }
+
+  // jobs still waiting are left without handler
+  for (const auto& [remote_job, identifier] : m_pending_remote_jobs)
+  {
+    auto job = GetModel() ? dynamic_cast<JobItem*>(GetModel()->FindItem(identifier)) : nullptr;
+    if (job != nullptr && m_job_manager->GetJobHandler(job) == nullptr)
+    {
+      job->SetStatus(RunnerStatus::kSubmitFailure);
+    }
+  }
+  m_pending_remote_jobs.clear();
+  m_failed_remote_job_count = 0;
+  m_remote_import_error.clear();
 }
 
 void OperationActionHandler::OnStartJobRequest()
@@ -223,6 +284,39 @@ void OperationActionHandler::OnToggleBreakpoint(InstructionItem* instruction)
   }
 }
 
+bool OperationActionHandler::OnExportProfileRequest(ProfileFormat format)
+{
+  auto job_handler =
+      dynamic_cast<AbstractJobHandler*>(m_job_manager->GetJobHandler(GetSelectedJob()));
+  if (job_handler == nullptr)
+  {
+    SendMessage("Profile export", "No job selected");
+    return false;
+  }
+
+  if (!m_operation_context.get_profile_file_name)
+  {
+    return false;
+  }
+
+  const auto file_name = m_operation_context.get_profile_file_name(format);
+  if (file_name.empty())
+  {
+    return false;
+  }
+
+  std::ofstream file_out(file_name);
+  file_out << job_handler->CreateInstructionProfile(format);
+  file_out.close();
+  if (!file_out)
+  {
+    SendMessage("Profile export", "Can't write file", file_name);
+    return false;
+  }
+
+  return true;
+}
+
 bool OperationActionHandler::SubmitJob(std::unique_ptr<JobItem> job_item)
 {
   auto job = InsertJobAfterCurrentSelection(std::move(job_item));
@@ -241,6 +335,69 @@ bool OperationActionHandler::SubmitJob(std::unique_ptr<JobItem> job_item)
   return result;
 }
 
+void OperationActionHandler::OnRemoteJobPrepared(const std::string& server_name,
+                                                 std::size_t job_index)
+{
+  auto job = TakePendingRemoteJob(server_name, job_index);
+
+  // the job could be removed, or regenerated by the user meanwhile
+  if (job == nullptr || m_job_manager->GetJobHandler(job) != nullptr)
+  {
+    m_remote_job_importer->DiscardJob(server_name, job_index);
+    return;
+  }
+
+  // the handler picks up the prepared remote job, the submission doesn't block
+  auto is_success = InvokeAndCatch([this, job]() { m_job_manager->SubmitJob(job); },
+                                   "Job submission", m_operation_context.send_message);
+  if (!is_success)
+  {
+    job->SetStatus(RunnerStatus::kSubmitFailure);
+  }
+}
+
+void OperationActionHandler::OnRemoteJobPreparationFailed(const std::string& server_name,
+                                                          std::size_t job_index,
+                                                          const std::string& message)
+{
+  if (auto job = TakePendingRemoteJob(server_name, job_index); job)
+  {
+    job->SetStatus(RunnerStatus::kSubmitFailure);
+  }
+
+  // errors are reported once per import, not to flood the user with dialogs
+  if (m_failed_remote_job_count++ == 0)
+  {
+    m_remote_import_error = message;
+  }
+}
+
+void OperationActionHandler::OnRemoteImportFinished()
+{
+  if (m_failed_remote_job_count > 0)
+  {
+    SendMessage("Remote job import failed",
+                std::to_string(m_failed_remote_job_count) + " job(s) can't be imported",
+                m_remote_import_error);
+  }
+  m_failed_remote_job_count = 0;
+  m_remote_import_error.clear();
+}
+
+JobItem* OperationActionHandler::TakePendingRemoteJob(const std::string& server_name,
+                                                      std::size_t job_index)
+{
+  auto pos = m_pending_remote_jobs.find({server_name, job_index});
+  if (pos == m_pending_remote_jobs.end())
+  {
+    return nullptr;
+  }
+
+  const auto identifier = pos->second;
+  (void)m_pending_remote_jobs.erase(pos);
+  return GetModel() ? dynamic_cast<JobItem*>(GetModel()->FindItem(identifier)) : nullptr;
+}
+
 JobItem* OperationActionHandler::InsertJobAfterCurrentSelection(std::unique_ptr<JobItem> job_item)
 {
   if (GetModel() == nullptr)
@@ -24,7 +24,10 @@
 #include <oac_tree_gui/operation/operation_action_context.h>
 
 #include <QObject>
+#include <map>
 #include <memory>
+#include <string>
+#include <utility>
 
 namespace mvvm
 {
@@ -44,6 +47,7 @@ class IJobItemManager;
 class JobItem;
 class ProcedureItem;
 class InstructionItem;
+class RemoteJobImporter;
 
 /**
  * @brief The OperationActionHandler class handles high-level actions of OperationMonitorView
@@ -73,6 +77,13 @@ public:
 
   void SetJobContainer(mvvm::SessionItem* job_container);
 
+  /**
+   * @brief Sets the importer to prepare remote jobs in the background.
+   *
+   * Without the importer remote jobs are submitted one by one in the GUI thread.
+   */
+  void SetRemoteJobImporter(RemoteJobImporter* importer);
+
   /**
    * @brief Submits given procedure for execution as local job.
    *
@@ -87,9 +98,20 @@ public:
 
   /**
    * @brief Invokes dialogs to ask for remote connection info, and submits remote jobs.
+   *
+   * When the remote job importer is set, job items are added at once, while their handlers are
+   * created as soon as remote jobs are prepared by the importer.
    */
   bool OnImportRemoteJobRequest();
 
+  /**
+   * @brief Cancels the preparation of remote jobs.
+   *
+   * Jobs which haven't been prepared yet remain not submitted and marked as failed, they can be
+   * regenerated later.
+   */
+  void OnCancelRemoteImportRequest();
+
   /**
    * @brief Start currently selected job.
    */
@@ -140,6 +162,11 @@ public:
    */
   void OnToggleBreakpoint(InstructionItem* instruction);
 
+  /**
+   * @brief Asks for the file name, and saves execution profile of the currently selected job.
+   */
+  bool OnExportProfileRequest(ProfileFormat format);
+
 signals:
   void MakeJobSelectedRequest(oac_tree_gui::JobItem* item);
 
@@ -172,10 +199,36 @@ private:
 
   JobItem* GetSelectedJob() const;
 
+  /**
+   * @brief Submits remote job, which has been prepared by the importer.
+   */
+  void OnRemoteJobPrepared(const std::string& server_name, std::size_t job_index);
+
+  void OnRemoteJobPreparationFailed(const std::string& server_name, std::size_t job_index,
+                                    const std::string& message);
+
+  /**
+   * @brief Reports failures of the finished import.
+   */
+  void OnRemoteImportFinished();
+
+  /**
+   * @brief Removes the job waiting for the given remote job from the list of pending jobs, and
+   * returns it. Returns nullptr if there is no such job, or it was removed from the model.
+   */
+  JobItem* TakePendingRemoteJob(const std::string& server_name, std::size_t job_index);
+
   mvvm::SessionItem* m_job_container{nullptr};
   IJobItemManager* m_job_manager{nullptr};
   OperationActionContext m_operation_context;
   std::chrono::milliseconds m_tick_timeout{0};
+  RemoteJobImporter* m_remote_job_importer{nullptr};
+
+  //!< identifiers of job items waiting for their remote jobs to be prepared
+  std::multimap<std::pair<std::string, std::size_t>, std::string> m_pending_remote_jobs;
+
+  std::size_t m_failed_remote_job_count{0};  //!< number of jobs failed in the current import
+  std::string m_remote_import_error;          //!< the first error of the current import
 };
 
 }  // namespace oac_tree_gui
@@ -21,10 +21,13 @@
 #ifndef OAC_TREE_GUI_OPERATION_OPERATION_ACTION_CONTEXT_H_
 #define OAC_TREE_GUI_OPERATION_OPERATION_ACTION_CONTEXT_H_
 
+#include <oac_tree_gui/operation/instruction_profile_helper.h>
+
 #include <sup/gui/core/message_event.h>
 
 #include <functional>
 #include <optional>
+#include <string>
 
 namespace oac_tree_gui
 {
@@ -47,6 +50,9 @@ struct OperationActionContext
 
   //!< callback to ask about remote job import information
   std::function<std::optional<RemoteConnectionInfo>()> get_remote_connection_info;
+
+  //!< callback to ask for the name of the file to save instruction profile, empty if cancelled
+  std::function<std::string(ProfileFormat)> get_profile_file_name;
 };
 
 }  // namespace oac_tree_gui
@@ -67,13 +67,21 @@ std::function<std::unique_ptr<IJobHandler>(JobItem&)> GetJobHandlerFactoryFunc(
         || item.GetType() == mvvm::GetTypeName<ImportedJobItem>()
         || item.GetType() == mvvm::GetTypeName<FileBasedJobItem>())
     {
-      return std::make_unique<LocalJobHandler>(&item, user_context_copy);
+      auto handler = std::make_unique<LocalJobHandler>(&item, user_context_copy);
+      handler->SetEventConflationEnabled(true);
+      return handler;
     }
 
     if (item.GetType() == mvvm::GetTypeName<RemoteJobItem>())
     {
       // remote jobs need special RemoteJobHandler generated by the remote connection service
-      return service.CreateJobHandler(dynamic_cast<RemoteJobItem*>(&item), user_context_copy);
+      auto handler =
+          service.CreateJobHandler(dynamic_cast<RemoteJobItem*>(&item), user_context_copy);
+      if (handler)
+      {
+        handler->SetEventConflationEnabled(true);
+      }
+      return handler;
     }
 
     throw RuntimeException("Unknown job type [" + item.GetType() + "]");
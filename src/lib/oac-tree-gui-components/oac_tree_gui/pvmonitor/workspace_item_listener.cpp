@@ -71,7 +71,7 @@ void WorkspaceItemListener::ProcessEventFromDomain(const VariableUpdatedEvent& e
   m_block_update_to_domain[event.index] = true;
 
   auto item = m_index_to_item[event.index];
-  UpdateVariableFromEvent(event.value, event.connected, *item);
+  UpdateVariableFromEvent(event.value.Get(), event.connected, *item);
 
   m_block_update_to_domain[event.index] = false;
 }
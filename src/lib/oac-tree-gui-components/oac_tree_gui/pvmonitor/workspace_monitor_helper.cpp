@@ -116,7 +116,7 @@ bool AreMatchingWorkspaces(const WorkspaceItem& workspace_item,
 
 void UpdateVariableFromEvent(const VariableUpdatedEvent& event, VariableItem& item)
 {
-  UpdateVariableFromEvent(event.value, event.connected, item);
+  UpdateVariableFromEvent(event.value.Get(), event.connected, item);
 }
 
 void UpdateVariableFromEvent(const sup::dto::AnyValue& value, bool connected, VariableItem& item)
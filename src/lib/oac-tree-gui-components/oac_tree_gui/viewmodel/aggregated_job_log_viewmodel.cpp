@@ -0,0 +1,290 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "aggregated_job_log_viewmodel.h"
+
+#include "job_log_viewmodel_helper.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/objects/job_log.h>
+
+#include <algorithm>
+#include <iterator>
+#include <queue>
+
+namespace
+{
+
+const int kColumnCount = 6;  // job, followed by log record columns
+
+}  // namespace
+
+namespace oac_tree_gui
+{
+
+AggregatedJobLogViewModel::AggregatedJobLogViewModel(QObject* parent_object)
+    : QAbstractTableModel(parent_object)
+{
+}
+
+AggregatedJobLogViewModel::~AggregatedJobLogViewModel() = default;
+
+void AggregatedJobLogViewModel::AddLog(JobLog* job_log, const QString& job_name,
+                                       const QColor& color)
+{
+  if (job_log == nullptr)
+  {
+    throw RuntimeException("Attempt to add uninitialised job log");
+  }
+
+  if (FindSource(job_log) != nullptr)
+  {
+    throw RuntimeException("Attempt to add job log twice");
+  }
+
+  m_sources.push_back(LogSource{job_log, job_name, color});
+
+  connect(job_log, &JobLog::LogEventsAppended, this, &AggregatedJobLogViewModel::ScheduleMerge);
+  connect(job_log, &JobLog::LogCleared, this, [this, job_log]() { OnLogCleared(job_log); });
+  connect(job_log, &JobLog::destroyed, this, [this, job_log]() { RemoveLog(job_log); });
+
+  if (job_log->GetSize() > 0)
+  {
+    ScheduleMerge();
+  }
+}
+
+void AggregatedJobLogViewModel::RemoveLog(JobLog* job_log)
+{
+  auto on_source = [job_log](const auto& source) { return source.log == job_log; };
+  auto it = std::find_if(m_sources.begin(), m_sources.end(), on_source);
+  if (it == m_sources.end())
+  {
+    return;
+  }
+
+  disconnect(job_log, nullptr, this, nullptr);
+  m_sources.erase(it);
+  ResetMergeOrder();
+}
+
+int AggregatedJobLogViewModel::GetLogCount() const
+{
+  return static_cast<int>(m_sources.size());
+}
+
+std::vector<JobLog*> AggregatedJobLogViewModel::GetLogs() const
+{
+  std::vector<JobLog*> result;
+  std::transform(m_sources.begin(), m_sources.end(), std::back_inserter(result),
+                 [](const auto& source) { return source.log; });
+  return result;
+}
+
+QString AggregatedJobLogViewModel::GetLogName(JobLog* job_log) const
+{
+  const auto* source = FindSource(job_log);
+  return source ? source->name : QString();
+}
+
+bool AggregatedJobLogViewModel::IsLogVisible(JobLog* job_log) const
+{
+  const auto* source = FindSource(job_log);
+  return source ? source->is_visible : false;
+}
+
+void AggregatedJobLogViewModel::SetLogVisible(JobLog* job_log, bool value)
+{
+  for (auto& source : m_sources)
+  {
+    if (source.log == job_log && source.is_visible != value)
+    {
+      source.is_visible = value;
+      ResetMergeOrder();
+      return;
+    }
+  }
+}
+
+void AggregatedJobLogViewModel::MergePendingRecords()
+{
+  m_merge_scheduled = false;
+
+  auto records = MergeTails();
+  if (records.empty())
+  {
+    return;
+  }
+
+  const int first_row = rowCount(QModelIndex());
+  beginInsertRows(QModelIndex(), first_row, first_row + static_cast<int>(records.size()) - 1);
+  m_merged.insert(m_merged.end(), records.begin(), records.end());
+  endInsertRows();
+}
+
+std::pair<JobLog*, int> AggregatedJobLogViewModel::GetLogRecord(int row) const
+{
+  const auto& record = m_merged.at(static_cast<std::size_t>(row));
+  return {m_sources[record.source].log, record.index};
+}
+
+int AggregatedJobLogViewModel::rowCount(const QModelIndex& parent) const
+{
+  return parent.isValid() ? 0 : static_cast<int>(m_merged.size());
+}
+
+int AggregatedJobLogViewModel::columnCount(const QModelIndex& parent) const
+{
+  return parent.isValid() ? 0 : kColumnCount;
+}
+
+QVariant AggregatedJobLogViewModel::data(const QModelIndex& index, int role) const
+{
+  if (!index.isValid() || index.row() < 0 || index.row() >= rowCount(QModelIndex()))
+  {
+    return {};
+  }
+
+  const auto& merged_record = m_merged[static_cast<std::size_t>(index.row())];
+  const auto& source = m_sources[merged_record.source];
+
+  if (role == Qt::ForegroundRole && source.color.isValid())
+  {
+    return source.color;
+  }
+
+  if (role != Qt::DisplayRole)
+  {
+    return {};
+  }
+
+  if (index.column() == 0)
+  {
+    return source.name;
+  }
+
+  return GetLogRecordDisplayData(source.log->GetRecord(merged_record.index), index.column() - 1);
+}
+
+QVariant AggregatedJobLogViewModel::headerData(int section, Qt::Orientation orientation,
+                                               int role) const
+{
+  static const QStringList column_names = QStringList() << "job" << GetLogRecordColumnNames();
+
+  if (role == Qt::DisplayRole && orientation == Qt::Horizontal)
+  {
+    return column_names.at(section);
+  }
+
+  return {};
+}
+
+std::vector<AggregatedJobLogViewModel::MergedRecord> AggregatedJobLogViewModel::MergeTails()
+{
+  // heap of the next record of every log, the earliest on top, ties are resolved by log order
+  using heap_entry_t = std::pair<std::int64_t, MergedRecord>;
+  auto later = [](const heap_entry_t& lhs, const heap_entry_t& rhs)
+  {
+    return lhs.first != rhs.first ? lhs.first > rhs.first : lhs.second.source > rhs.second.source;
+  };
+  std::priority_queue<heap_entry_t, std::vector<heap_entry_t>, decltype(later)> heap(later);
+
+  auto push_next = [this, &heap](std::uint32_t source_index)
+  {
+    auto& source = m_sources[source_index];
+    if (source.merged_count < source.log->GetSize())
+    {
+      const auto timestamp = source.log->GetRecord(source.merged_count).timestamp;
+      heap.push({timestamp, MergedRecord{source_index, source.merged_count}});
+      ++source.merged_count;
+    }
+  };
+
+  for (std::uint32_t source_index = 0; source_index < m_sources.size(); ++source_index)
+  {
+    if (m_sources[source_index].is_visible)
+    {
+      push_next(source_index);
+    }
+  }
+
+  std::vector<MergedRecord> result;
+  while (!heap.empty())
+  {
+    const auto record = heap.top().second;
+    heap.pop();
+    result.push_back(record);
+    push_next(record.source);
+  }
+
+  return result;
+}
+
+void AggregatedJobLogViewModel::ResetMergeOrder()
+{
+  beginResetModel();
+  for (auto& source : m_sources)
+  {
+    source.merged_count = 0;
+  }
+  m_merged = MergeTails();
+  endResetModel();
+}
+
+void AggregatedJobLogViewModel::OnLogCleared(JobLog* job_log)
+{
+  auto on_source = [job_log](const auto& source) { return source.log == job_log; };
+  auto it = std::find_if(m_sources.begin(), m_sources.end(), on_source);
+  if (it == m_sources.end() || it->merged_count == 0)
+  {
+    return;  // nothing has been shown, as for the log cleared on every job start
+  }
+
+  // records of other logs are not merged again, they might be already spilled to disk
+  const auto source_index = static_cast<std::uint32_t>(std::distance(m_sources.begin(), it));
+  auto on_record = [source_index](const auto& record) { return record.source == source_index; };
+
+  beginResetModel();
+  m_merged.erase(std::remove_if(m_merged.begin(), m_merged.end(), on_record), m_merged.end());
+  it->merged_count = 0;
+  endResetModel();
+}
+
+void AggregatedJobLogViewModel::ScheduleMerge()
+{
+  if (m_merge_scheduled)
+  {
+    return;
+  }
+
+  m_merge_scheduled = true;
+  (void)QMetaObject::invokeMethod(this, &AggregatedJobLogViewModel::MergePendingRecords,
+                                  Qt::QueuedConnection);
+}
+
+const AggregatedJobLogViewModel::LogSource* AggregatedJobLogViewModel::FindSource(
+    JobLog* job_log) const
+{
+  auto on_source = [job_log](const auto& source) { return source.log == job_log; };
+  auto it = std::find_if(m_sources.begin(), m_sources.end(), on_source);
+  return it == m_sources.end() ? nullptr : &*it;
+}
+
+}  // namespace oac_tree_gui
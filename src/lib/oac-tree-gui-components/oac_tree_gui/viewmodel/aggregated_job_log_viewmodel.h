@@ -0,0 +1,154 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_VIEWMODEL_AGGREGATED_JOB_LOG_VIEWMODEL_H_
+#define OAC_TREE_GUI_VIEWMODEL_AGGREGATED_JOB_LOG_VIEWMODEL_H_
+
+#include <QAbstractTableModel>
+#include <QColor>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace oac_tree_gui
+{
+
+class JobLog;
+
+/**
+ * @brief The AggregatedJobLogViewModel class shows records of several job logs in a single table,
+ * ordered by time.
+ *
+ * The model doesn't copy log records. It holds only the merge order, where each row refers to
+ * a record of one of the logs. New records are merged lazily, once per event loop iteration, with
+ * the k-way merge of all log tails by timestamp. Records which arrive later than records of other
+ * logs already shown are placed at the end, so existing rows never move.
+ *
+ * Each job has its own name and colour, and can be hidden from the table.
+ */
+class AggregatedJobLogViewModel : public QAbstractTableModel
+{
+  Q_OBJECT
+
+public:
+  explicit AggregatedJobLogViewModel(QObject* parent_object = nullptr);
+  ~AggregatedJobLogViewModel() override;
+
+  /**
+   * @brief Adds the log of the job with the given name and colour.
+   *
+   * The log is removed automatically when destroyed.
+   */
+  void AddLog(JobLog* job_log, const QString& job_name, const QColor& color = {});
+
+  /**
+   * @brief Removes the log from the model.
+   */
+  void RemoveLog(JobLog* job_log);
+
+  /**
+   * @brief Returns the number of logs shown by the model.
+   */
+  int GetLogCount() const;
+
+  /**
+   * @brief Returns all logs in the order of addition.
+   */
+  std::vector<JobLog*> GetLogs() const;
+
+  /**
+   * @brief Returns the name of the job the log belongs to.
+   */
+  QString GetLogName(JobLog* job_log) const;
+
+  /**
+   * @brief Checks if records of the given log are shown.
+   */
+  bool IsLogVisible(JobLog* job_log) const;
+
+  /**
+   * @brief Shows or hides records of the given log.
+   */
+  void SetLogVisible(JobLog* job_log, bool value);
+
+  /**
+   * @brief Merges records appended to logs since the last merge.
+   *
+   * Normally called automatically on the next event loop iteration after logs have been
+   * appended.
+   */
+  void MergePendingRecords();
+
+  /**
+   * @brief Returns the log and record index shown in the given row.
+   */
+  std::pair<JobLog*, int> GetLogRecord(int row) const;
+
+  int rowCount(const QModelIndex& parent) const override;
+
+  int columnCount(const QModelIndex& parent) const override;
+
+  QVariant data(const QModelIndex& index, int role) const override;
+
+  QVariant headerData(int section, Qt::Orientation orientation, int role) const override;
+
+private:
+  struct LogSource
+  {
+    JobLog* log{nullptr};
+    QString name;
+    QColor color;
+    bool is_visible{true};
+    int merged_count{0};  //!< number of records of the log already merged
+  };
+
+  struct MergedRecord
+  {
+    std::uint32_t source{0};  //!< index of the log source
+    std::int32_t index{0};    //!< index of the record in the log
+  };
+
+  /**
+   * @brief Merges tails of all visible logs and appends them to the merge order.
+   */
+  std::vector<MergedRecord> MergeTails();
+
+  /**
+   * @brief Rebuilds the merge order from scratch.
+   */
+  void ResetMergeOrder();
+
+  /**
+   * @brief Removes records of the cleared log from the merge order, other rows keep their order.
+   */
+  void OnLogCleared(JobLog* job_log);
+
+  void ScheduleMerge();
+
+  const LogSource* FindSource(JobLog* job_log) const;
+
+  std::vector<LogSource> m_sources;
+  std::vector<MergedRecord> m_merged;
+  bool m_merge_scheduled{false};
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_VIEWMODEL_AGGREGATED_JOB_LOG_VIEWMODEL_H_
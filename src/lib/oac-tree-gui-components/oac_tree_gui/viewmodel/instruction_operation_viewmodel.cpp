@@ -20,6 +20,8 @@
 
 #include "instruction_operation_viewmodel.h"
 
+#include <oac_tree_gui/components/custom_presentation_items.h>
+#include <oac_tree_gui/jobsystem/instruction_profiler.h>
 #include <oac_tree_gui/model/sequencer_item_helper.h>
 #include <oac_tree_gui/model/standard_instruction_items.h>
 
@@ -27,11 +29,16 @@
 #include <mvvm/providers/standard_children_strategies.h>
 #include <mvvm/providers/viewitem.h>
 #include <mvvm/providers/viewitem_factory.h>
-#include <mvvm/providers/viewmodel_controller_factory.h>
+#include <mvvm/providers/viewmodel_controller.h>
+#include <mvvm/providers/viewmodel_controller_impl.h>
 
 namespace
 {
 
+const int kBreakpointColumn = 2;
+const int kCallCountColumn = 3;
+const int kMaxTimeColumn = 6;
+
 /**
  * @brief Returns text representing instruction.
  */
@@ -40,6 +47,26 @@ std::string GetText(const oac_tree_gui::InstructionItem& item)
   return item.GetName().empty() ? item.GetDisplayName() : item.GetName();
 }
 
+/**
+ * @brief Returns time in milliseconds, as shown in profile columns.
+ */
+QVariant ToMilliseconds(std::chrono::microseconds value)
+{
+  return std::chrono::duration<double, std::milli>(value).count();
+}
+
+/**
+ * @brief Creates read-only view item showing the value computed by the callback.
+ */
+std::unique_ptr<mvvm::ViewItem> CreateComputedViewItem(
+    oac_tree_gui::InstructionItem* instruction,
+    oac_tree_gui::ComputedPresentationItem::get_value_t get_value)
+{
+  auto presentation =
+      std::make_unique<oac_tree_gui::ComputedPresentationItem>(instruction, std::move(get_value));
+  return std::make_unique<mvvm::ViewItem>(std::move(presentation));
+}
+
 }  // namespace
 
 namespace oac_tree_gui
@@ -48,11 +75,17 @@ namespace oac_tree_gui
 class InstructionOperationRowStrategy : public mvvm::AbstractRowStrategy
 {
 public:
-  std::size_t GetSize() const override { return 3U; }
+  explicit InstructionOperationRowStrategy(std::shared_ptr<profile_provider_t> profile_provider)
+      : m_profile_provider(std::move(profile_provider))
+  {
+  }
+
+  std::size_t GetSize() const override { return 7U; }
 
   QStringList GetHorizontalHeaderLabels() const override
   {
-    static const QStringList result = {"Instruction", "Status", "BP"};
+    static const QStringList result = {"Instruction", "Status",   "BP",     "Calls",
+                                       "Total, ms",   "Self, ms", "Max, ms"};
     return result;
   }
 
@@ -66,29 +99,100 @@ private:
       result.emplace_back(mvvm::CreateLabelViewItem(instruction, GetText(*instruction)));
       result.emplace_back(mvvm::CreateDataViewItem(GetStatusItem(*instruction)));
       result.emplace_back(mvvm::CreateDataViewItem(GetBreakpointItem(*instruction)));
+      AppendProfileItems(instruction, result);
     }
     else
     {
       result.emplace_back(mvvm::CreateDisplayNameViewItem(item));
-      result.emplace_back(mvvm::CreateLabelViewItem(item));
-      result.emplace_back(mvvm::CreateLabelViewItem(item));
+      while (result.size() < GetSize())
+      {
+        result.emplace_back(mvvm::CreateLabelViewItem(item));
+      }
     }
     return result;
   }
+
+  /**
+   * @brief Appends items showing call count, total, self and max time of the instruction.
+   */
+  void AppendProfileItems(InstructionItem* instruction,
+                          std::vector<std::unique_ptr<mvvm::ViewItem>>& row) const
+  {
+    auto provider = m_profile_provider;
+    auto find_profile = [provider, instruction]() -> const InstructionProfileEntry*
+    { return *provider ? (*provider)(*instruction) : nullptr; };
+
+    auto call_count = [find_profile]() -> QVariant
+    {
+      const auto* entry = find_profile();
+      return entry ? QVariant(static_cast<int>(entry->call_count)) : QVariant();
+    };
+    auto total_time = [find_profile]() -> QVariant
+    {
+      const auto* entry = find_profile();
+      return entry ? ToMilliseconds(entry->total_time) : QVariant();
+    };
+    auto self_time = [find_profile, provider, instruction]() -> QVariant
+    {
+      return find_profile() ? ToMilliseconds(CalculateSelfTime(*instruction, *provider))
+                            : QVariant();
+    };
+    auto max_time = [find_profile]() -> QVariant
+    {
+      const auto* entry = find_profile();
+      return entry ? ToMilliseconds(entry->max_time) : QVariant();
+    };
+
+    row.emplace_back(CreateComputedViewItem(instruction, call_count));
+    row.emplace_back(CreateComputedViewItem(instruction, total_time));
+    row.emplace_back(CreateComputedViewItem(instruction, self_time));
+    row.emplace_back(CreateComputedViewItem(instruction, max_time));
+  }
+
+  std::shared_ptr<profile_provider_t> m_profile_provider;
 };
 
 InstructionOperationViewModel::InstructionOperationViewModel(mvvm::ISessionModel* model,
                                                              QObject* parent_object)
-    : ViewModel(parent_object)
+    : ViewModel(parent_object), m_profile_provider(std::make_shared<profile_provider_t>())
 {
-  SetController(
-      mvvm::factory::CreateController<mvvm::TopItemsStrategy, InstructionOperationRowStrategy>(
-          model, this));
+  auto impl = std::make_unique<mvvm::ViewModelControllerImpl>(
+      this, std::make_unique<mvvm::TopItemsStrategy>(),
+      std::make_unique<InstructionOperationRowStrategy>(m_profile_provider));
+  auto controller = std::make_unique<mvvm::ViewModelController>(std::move(impl));
+  controller->SetModel(model);
+  SetController(std::move(controller));
 }
 
 int InstructionOperationViewModel::GetBreakpointColumn()
 {
-  return 2;
+  return kBreakpointColumn;
+}
+
+void InstructionOperationViewModel::SetProfileProvider(profile_provider_t provider)
+{
+  *m_profile_provider = std::move(provider);
+  if (rowCount() > 0)
+  {
+    emit dataChanged(index(0, kCallCountColumn), index(rowCount() - 1, kMaxTimeColumn));
+  }
+}
+
+void InstructionOperationViewModel::UpdateProfile(const std::vector<InstructionItem*>& instructions)
+{
+  for (auto* instruction : instructions)
+  {
+    const auto indexes = GetIndexOfSessionItem(instruction);
+    if (indexes.empty())
+    {
+      continue;  // instruction is not shown
+    }
+
+    const auto row = indexes.front().row();
+    const auto parent_index = indexes.front().parent();
+    emit dataChanged(index(row, kCallCountColumn, parent_index),
+                     index(row, kMaxTimeColumn, parent_index), {Qt::DisplayRole});
+  }
 }
 
 }  // namespace oac_tree_gui
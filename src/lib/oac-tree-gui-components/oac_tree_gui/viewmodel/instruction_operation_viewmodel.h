@@ -21,8 +21,13 @@
 #ifndef OAC_TREE_GUI_VIEWMODEL_INSTRUCTION_OPERATION_VIEWMODEL_H_
 #define OAC_TREE_GUI_VIEWMODEL_INSTRUCTION_OPERATION_VIEWMODEL_H_
 
+#include <oac_tree_gui/operation/instruction_profile_helper.h>
+
 #include <mvvm/viewmodel/viewmodel.h>
 
+#include <memory>
+#include <vector>
+
 namespace mvvm
 {
 class ISessionModel;
@@ -31,7 +36,10 @@ class ISessionModel;
 namespace oac_tree_gui
 {
 
-//! View model to show instruction tree with three columns: display_name, name and status.
+class InstructionItem;
+
+//! View model to show instruction tree with columns: name, status, breakpoint and execution
+//! profile (call count, total, self and max time).
 
 class InstructionOperationViewModel : public mvvm::ViewModel
 {
@@ -45,6 +53,22 @@ public:
    * @brief Returns index of a column used to render breakpoints.
    */
   static int GetBreakpointColumn();
+
+  /**
+   * @brief Sets the callback to get the execution profile of instructions.
+   *
+   * The profile is kept by the job, outside of the model. Profile columns are empty without the
+   * callback.
+   */
+  void SetProfileProvider(profile_provider_t provider);
+
+  /**
+   * @brief Notifies views that the execution profile of given instructions has changed.
+   */
+  void UpdateProfile(const std::vector<InstructionItem*>& instructions);
+
+private:
+  std::shared_ptr<profile_provider_t> m_profile_provider;
 };
 
 }  // namespace oac_tree_gui
@@ -20,22 +20,17 @@
 
 #include "job_log_viewmodel.h"
 
+#include "job_log_viewmodel_helper.h"
+
 #include <oac_tree_gui/core/exceptions.h>
-#include <oac_tree_gui/jobsystem/job_log_severity.h>
 #include <oac_tree_gui/jobsystem/objects/job_log.h>
 
+#include <algorithm>
+
 namespace
 {
 
-const int kColumnCount = 5;  // number of members in LogEvent
-QStringList GetColumnNames()
-{
-  return QStringList() << "date"
-                       << "time"
-                       << "severity"
-                       << "source"
-                       << "message";
-}
+const int kColumnCount = 5;  // date, time, severity, source, message
 
 }  // namespace
 
@@ -45,6 +40,7 @@ namespace oac_tree_gui
 JobLogViewModel::JobLogViewModel(JobLog* job_log, QObject* parent)
     : QAbstractTableModel(parent), m_job_log(job_log)
 {
+  m_severity_enabled.fill(true);
   if (m_job_log != nullptr)
   {
     m_row_count = m_job_log->GetSize();
@@ -67,6 +63,7 @@ void JobLogViewModel::SetLog(JobLog* job_log)
   beginResetModel();
   m_row_count = (job_log != nullptr) ? job_log->GetSize() : 0;
   m_job_log = job_log;
+  m_visible_rows = CollectVisibleIndices(0);
   endResetModel();
 
   if (m_job_log != nullptr)
@@ -77,7 +74,11 @@ void JobLogViewModel::SetLog(JobLog* job_log)
 
 int JobLogViewModel::rowCount(const QModelIndex& parent) const
 {
-  return parent.isValid() ? 0 : m_row_count;
+  if (parent.isValid())
+  {
+    return 0;
+  }
+  return m_filter_active ? static_cast<int>(m_visible_rows.size()) : m_row_count;
 }
 
 int JobLogViewModel::columnCount(const QModelIndex& parent) const
@@ -92,37 +93,23 @@ QVariant JobLogViewModel::data(const QModelIndex& index, int role) const
     return {};
   }
 
-  if (index.row() >= m_job_log->GetSize() || index.row() < 0)
+  if (index.row() >= rowCount(QModelIndex()) || index.row() < 0)
   {
     return {};
   }
 
   if (role == Qt::DisplayRole)
   {
-    const auto& record = m_job_log->At(index.row());
-
-    switch (index.column())
-    {
-    case 0:
-      return QString::fromStdString(record.date);
-    case 1:
-      return QString::fromStdString(record.time);
-    case 2:
-      return QString::fromStdString(ToString(record.severity));
-    case 3:
-      return QString::fromStdString(record.source);
-    case 4:
-      return QString::fromStdString(record.message);
-    default:
-      break;
-    }
+    // date and time are formatted only for rows requested by the view
+    return GetLogRecordDisplayData(m_job_log->GetRecord(GetLogIndex(index.row())),
+                                   index.column());
   }
   return {};
 }
 
 QVariant JobLogViewModel::headerData(int section, Qt::Orientation orientation, int role) const
 {
-  static const QStringList column_names = GetColumnNames();
+  static const QStringList column_names = GetLogRecordColumnNames();
 
   if (role != Qt::DisplayRole)
   {
@@ -147,17 +134,71 @@ Qt::ItemFlags JobLogViewModel::flags(const QModelIndex& index) const
   return QAbstractTableModel::flags(index) | Qt::ItemIsSelectable;
 }
 
-void JobLogViewModel::OnLogEventAppended()
+void JobLogViewModel::SetSeverityFilter(const std::vector<Severity>& severities)
+{
+  beginResetModel();
+  m_severity_enabled.fill(false);
+  for (auto severity : severities)
+  {
+    m_severity_enabled.at(static_cast<std::size_t>(severity)) = true;
+  }
+  m_filter_active = std::find(m_severity_enabled.begin(), m_severity_enabled.end(), false)
+                    != m_severity_enabled.end();
+  m_visible_rows = CollectVisibleIndices(0);
+  endResetModel();
+}
+
+int JobLogViewModel::GetLogIndex(int row) const
+{
+  return m_filter_active ? m_visible_rows.at(static_cast<std::size_t>(row)) : row;
+}
+
+int JobLogViewModel::GetRow(int log_index) const
+{
+  if (!m_filter_active)
+  {
+    return log_index < m_row_count ? log_index : -1;
+  }
+
+  auto it = std::lower_bound(m_visible_rows.begin(), m_visible_rows.end(), log_index);
+  return it != m_visible_rows.end() && *it == log_index
+             ? static_cast<int>(it - m_visible_rows.begin())
+             : -1;
+}
+
+void JobLogViewModel::OnLogEventsAppended(int first, int last)
 {
-  const int current_row_count = rowCount(QModelIndex());
+  const int new_row_count = m_job_log->GetSize();
 
-  if (current_row_count + 1 != m_job_log->GetSize())
+  if (first > last || last >= new_row_count || m_row_count > new_row_count)
   {
     throw LogicErrorException("ViewModel is out-of-sync");
   }
 
-  beginInsertRows(QModelIndex(), current_row_count, current_row_count);
-  m_row_count = m_job_log->GetSize();
+  if (m_row_count == new_row_count)
+  {
+    return;  // already caught up
+  }
+
+  if (!m_filter_active)
+  {
+    beginInsertRows(QModelIndex(), m_row_count, new_row_count - 1);
+    m_row_count = new_row_count;
+    endInsertRows();
+    return;
+  }
+
+  const int first_log_index = m_row_count;
+  m_row_count = new_row_count;
+  auto indices = CollectVisibleIndices(first_log_index);
+  if (indices.empty())
+  {
+    return;
+  }
+
+  const int first_row = static_cast<int>(m_visible_rows.size());
+  beginInsertRows(QModelIndex(), first_row, first_row + static_cast<int>(indices.size()) - 1);
+  m_visible_rows.insert(m_visible_rows.end(), indices.begin(), indices.end());
   endInsertRows();
 }
 
@@ -165,6 +206,7 @@ void JobLogViewModel::OnLogCleared()
 {
   beginResetModel();
   m_row_count = 0;
+  m_visible_rows.clear();
   endResetModel();
 }
 
@@ -174,9 +216,36 @@ void JobLogViewModel::OnLogDestroyed()
   OnLogCleared();
 }
 
+std::vector<int> JobLogViewModel::CollectVisibleIndices(int first_log_index) const
+{
+  std::vector<int> result;
+  if (!m_filter_active || m_job_log == nullptr)
+  {
+    return result;
+  }
+
+  // merging tails of per-severity indices, each of them is already sorted
+  for (std::size_t severity = 0; severity < kSeverityCount; ++severity)
+  {
+    if (!m_severity_enabled[severity])
+    {
+      continue;
+    }
+
+    const auto indices =
+        m_job_log->GetSeverityIndices(static_cast<Severity>(severity), first_log_index);
+    auto tail_end = std::lower_bound(indices.begin(), indices.end(), m_row_count);
+    const auto middle = static_cast<std::ptrdiff_t>(result.size());
+    result.insert(result.end(), indices.begin(), tail_end);
+    std::inplace_merge(result.begin(), result.begin() + middle, result.end());
+  }
+
+  return result;
+}
+
 void JobLogViewModel::SetConnected()
 {
-  connect(m_job_log, &JobLog::LogEventAppended, this, &JobLogViewModel::OnLogEventAppended,
+  connect(m_job_log, &JobLog::LogEventsAppended, this, &JobLogViewModel::OnLogEventsAppended,
           Qt::UniqueConnection);
   connect(m_job_log, &JobLog::LogCleared, this, &JobLogViewModel::OnLogCleared,
           Qt::UniqueConnection);
@@ -186,7 +255,7 @@ void JobLogViewModel::SetConnected()
 
 void JobLogViewModel::SetDisconnected()
 {
-  disconnect(m_job_log, &JobLog::LogEventAppended, this, &JobLogViewModel::OnLogEventAppended);
+  disconnect(m_job_log, &JobLog::LogEventsAppended, this, &JobLogViewModel::OnLogEventsAppended);
   disconnect(m_job_log, &JobLog::LogCleared, this, &JobLogViewModel::OnLogCleared);
   disconnect(m_job_log, &JobLog::destroyed, this, &JobLogViewModel::OnLogDestroyed);
 }
@@ -21,7 +21,11 @@
 #ifndef OAC_TREE_GUI_VIEWMODEL_JOB_LOG_VIEWMODEL_H_
 #define OAC_TREE_GUI_VIEWMODEL_JOB_LOG_VIEWMODEL_H_
 
+#include <oac_tree_gui/jobsystem/job_log_severity.h>
+
 #include <QAbstractTableModel>
+#include <array>
+#include <vector>
 
 namespace oac_tree_gui
 {
@@ -31,6 +35,9 @@ class JobLog;
 /**
  * @brief The JobLogViewModel class is a viewmodel to show JobLog content in the form of the
  * table.
+ *
+ * The model can hide records of certain severities. Visible rows are collected from per-severity
+ * indices of JobLog, so changing the filter doesn't require reading log records.
  */
 class JobLogViewModel : public QAbstractTableModel
 {
@@ -51,13 +58,30 @@ public:
 
   Qt::ItemFlags flags(const QModelIndex& index) const override;
 
+  /**
+   * @brief Shows only records with given severities.
+   */
+  void SetSeverityFilter(const std::vector<Severity>& severities);
+
+  /**
+   * @brief Returns index of the log record shown in the given row.
+   */
+  int GetLogIndex(int row) const;
+
+  /**
+   * @brief Returns the row showing the log record with the given index, or -1 if the record is
+   * filtered out.
+   */
+  int GetRow(int log_index) const;
+
 private:
   /**
-   * @brief Provides necessary view model bookkeeping when a new LogEvent is added to a JobLog.
+   * @brief Provides necessary view model bookkeeping when new LogEvents are added to a JobLog.
    *
-   * This method should be connected with JobLog::LogEventAppended.
+   * This method should be connected with JobLog::LogEventsAppended. All records missing in the
+   * model are inserted at once, the given range is used only for consistency check.
    */
-  void OnLogEventAppended();
+  void OnLogEventsAppended(int first, int last);
 
   /**
    * @brief Clears the model when log is cleared.
@@ -69,6 +93,11 @@ private:
    */
   void OnLogDestroyed();
 
+  /**
+   * @brief Returns indices of visible log records starting from the given log index.
+   */
+  std::vector<int> CollectVisibleIndices(int first_log_index) const;
+
   /**
    * @brief Connect the model to listen JobLog.
    */
@@ -82,9 +111,18 @@ private:
   //!< current container with LogEvents
   JobLog* m_job_log{nullptr};
 
-  //!< Number of rows shown by the table. May differ from the actual number of LogEvents in
+  //!< Number of LogEvents known to the model. May differ from the actual number of LogEvents in
   //!< the container.
   int m_row_count{0};
+
+  //!< severities which are shown by the model
+  std::array<bool, kSeverityCount> m_severity_enabled{};
+
+  //!< true if some severities are hidden, and the row doesn't correspond to the log index
+  bool m_filter_active{false};
+
+  //!< log indices of visible rows, when the filter is active
+  std::vector<int> m_visible_rows;
 };
 
 }  // namespace oac_tree_gui
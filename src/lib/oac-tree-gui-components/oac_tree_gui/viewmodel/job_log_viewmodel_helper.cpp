@@ -0,0 +1,84 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "job_log_viewmodel_helper.h"
+
+#include <oac_tree_gui/jobsystem/job_log_severity.h>
+#include <oac_tree_gui/jobsystem/log_record_storage.h>
+
+#include <QDateTime>
+
+namespace
+{
+
+QString ToQString(std::string_view str)
+{
+  return QString::fromUtf8(str.data(), static_cast<int>(str.size()));
+}
+
+//! Returns explicitly given date/time string, or formats the timestamp using the given format.
+QString FormatDateTime(std::string_view explicit_value, std::int64_t timestamp,
+                       const QString& format)
+{
+  if (!explicit_value.empty())
+  {
+    return ToQString(explicit_value);
+  }
+  return QDateTime::fromMSecsSinceEpoch(timestamp).toString(format);
+}
+
+}  // namespace
+
+namespace oac_tree_gui
+{
+
+QStringList GetLogRecordColumnNames()
+{
+  return QStringList() << "date"
+                       << "time"
+                       << "severity"
+                       << "source"
+                       << "message";
+}
+
+QVariant GetLogRecordDisplayData(const LogRecordView& record, int column)
+{
+  static const QString date_format = QString::fromStdString(GetLogEventDateFormat());
+  static const QString time_format = QString::fromStdString(GetLogEventTimeFormat());
+
+  switch (column)
+  {
+  case 0:
+    return FormatDateTime(record.date, record.timestamp, date_format);
+  case 1:
+    return FormatDateTime(record.time, record.timestamp, time_format);
+  case 2:
+    return QString::fromStdString(ToString(record.severity));
+  case 3:
+    return ToQString(record.source);
+  case 4:
+    return ToQString(record.message);
+  default:
+    break;
+  }
+  return {};
+}
+
+}  // namespace oac_tree_gui
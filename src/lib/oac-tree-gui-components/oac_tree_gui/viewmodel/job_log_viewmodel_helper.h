@@ -0,0 +1,49 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_VIEWMODEL_JOB_LOG_VIEWMODEL_HELPER_H_
+#define OAC_TREE_GUI_VIEWMODEL_JOB_LOG_VIEWMODEL_HELPER_H_
+
+//! @file
+//! Helper functions shared by view models showing job log records.
+
+#include <QStringList>
+#include <QVariant>
+
+namespace oac_tree_gui
+{
+
+struct LogRecordView;
+
+/**
+ * @brief Returns names of log record columns: date, time, severity, source, message.
+ */
+QStringList GetLogRecordColumnNames();
+
+/**
+ * @brief Returns display data of the log record for the given column.
+ *
+ * Date and time are formatted from the timestamp, unless given explicitly.
+ */
+QVariant GetLogRecordDisplayData(const LogRecordView& record, int column);
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_VIEWMODEL_JOB_LOG_VIEWMODEL_HELPER_H_
@@ -46,10 +46,31 @@ constexpr auto kAnyValueDefaultDisplayName = "value";
 
 constexpr auto kDefaultPlaceholderAttributeValue = "$par";
 
-constexpr auto kTickTimeout = "kTickTimeout";
+//! Tick timeout of the job in microseconds. The tag differs from the former "kTickTimeout",
+//! which was stored in milliseconds, so values of older projects aren't read in the wrong unit.
+constexpr auto kTickTimeout = "kTickTimeoutUsec";
 
 constexpr std::int32_t kDefaultTickTimeoutMsec = 20;
 
+constexpr std::int32_t kDefaultTickTimeoutUsec = kDefaultTickTimeoutMsec * 1000;
+
+constexpr auto kLogCapacity = "kLogCapacity";
+
+//! Number of log records kept in memory, older records are moved to disk.
+constexpr std::int32_t kDefaultLogCapacity = 100000;
+
+constexpr auto kLogSeverityThreshold = "kLogSeverityThreshold";
+
+constexpr auto kLogRateLimit = "kLogRateLimit";
+
+//! Number of log messages per second accepted from the running procedure, 0 means no limit.
+//! The limit is opt-in, so by default no message is lost.
+constexpr std::int32_t kDefaultLogRateLimit = 0;
+
+constexpr auto kLogFoldDuplicates = "kLogFoldDuplicates";
+
+constexpr auto kPriority = "kPriority";
+
 constexpr auto kBehaviorTag = "Behavior";
 constexpr auto kNativeBehavior = "Native";
 constexpr auto kHiddenBehavior = "Hidden";
@@ -24,6 +24,7 @@
 #include <oac_tree_gui/model/item_constants.h>
 #include <oac_tree_gui/model/procedure_item.h>
 
+#include <mvvm/model/combo_property.h>
 #include <mvvm/standarditems/linked_item.h>
 
 namespace oac_tree_gui
@@ -31,9 +32,19 @@ namespace oac_tree_gui
 
 namespace
 {
-using timeout_store_t = mvvm::int32;
+using timeout_store_t = mvvm::int32;  // microseconds, enough for timeouts up to half an hour
 constexpr auto kLink = "kLink";
 constexpr auto kExpandedProcedure = "kExpandedProcedure";
+
+mvvm::ComboProperty CreateLogSeverityThresholdProperty()
+{
+  // same names as job log severities
+  mvvm::ComboProperty result({"EMERGENCY", "ALERT", "CRITICAL", "ERROR", "WARNING", "NOTICE",
+                              "INFO", "DEBUG", "TRACE"});
+  result.SetValue("TRACE");
+  return result;
+}
+
 }  // namespace
 
 JobItem::JobItem(const std::string& type) : CompoundItem(type)
@@ -42,8 +53,21 @@ JobItem::JobItem(const std::string& type) : CompoundItem(type)
       .SetDisplayName("Status")
       .SetEditable(false);
   (void)AddProperty<mvvm::LinkedItem>(kLink).SetDisplayName("Link");
-  (void)AddProperty(itemconstants::kTickTimeout, itemconstants::kDefaultTickTimeoutMsec)
-      .SetDisplayName("Tick timeout");
+  (void)AddProperty(itemconstants::kTickTimeout, itemconstants::kDefaultTickTimeoutUsec)
+      .SetDisplayName("Tick timeout, usec");
+  (void)AddProperty(itemconstants::kLogCapacity, itemconstants::kDefaultLogCapacity)
+      .SetDisplayName("Log capacity");
+  (void)AddProperty(itemconstants::kLogSeverityThreshold, CreateLogSeverityThresholdProperty())
+      .SetDisplayName("Log severity threshold")
+      .SetToolTip("Less important log messages are ignored");
+  (void)AddProperty(itemconstants::kLogRateLimit, itemconstants::kDefaultLogRateLimit)
+      .SetDisplayName("Log rate limit")
+      .SetToolTip("Maximum number of log messages per second, 0 means no limit");
+  (void)AddProperty(itemconstants::kLogFoldDuplicates, false)
+      .SetDisplayName("Fold repeated log messages");
+  (void)AddProperty(itemconstants::kPriority, mvvm::int32{0})
+      .SetDisplayName("Priority")
+      .SetToolTip("Queued jobs with higher priority start first");
 
   RegisterTag(mvvm::TagInfo(kExpandedProcedure, 0, 1, {mvvm::GetTypeName<ProcedureItem>()}),
               /*as_default*/ true);
@@ -68,16 +92,68 @@ void JobItem::SetStatus(RunnerStatus status)
   (void)SetProperty(itemconstants::kStatus, ToString(status));
 }
 
-std::chrono::milliseconds JobItem::GetTickTimeout() const
+std::chrono::microseconds JobItem::GetTickTimeout() const
 {
-  return std::chrono::milliseconds(Property<timeout_store_t>(itemconstants::kTickTimeout));
+  return std::chrono::microseconds(Property<timeout_store_t>(itemconstants::kTickTimeout));
 }
 
-void JobItem::SetTickTimeout(std::chrono::milliseconds timeout)
+void JobItem::SetTickTimeout(std::chrono::microseconds timeout)
 {
   (void)SetProperty(itemconstants::kTickTimeout, static_cast<timeout_store_t>(timeout.count()));
 }
 
+std::size_t JobItem::GetLogCapacity() const
+{
+  return static_cast<std::size_t>(Property<mvvm::int32>(itemconstants::kLogCapacity));
+}
+
+void JobItem::SetLogCapacity(std::size_t capacity)
+{
+  (void)SetProperty(itemconstants::kLogCapacity, static_cast<mvvm::int32>(capacity));
+}
+
+std::string JobItem::GetLogSeverityThreshold() const
+{
+  return Property<mvvm::ComboProperty>(itemconstants::kLogSeverityThreshold).GetValue();
+}
+
+void JobItem::SetLogSeverityThreshold(const std::string& severity_name)
+{
+  auto property = Property<mvvm::ComboProperty>(itemconstants::kLogSeverityThreshold);
+  property.SetValue(severity_name);
+  (void)SetProperty(itemconstants::kLogSeverityThreshold, property);
+}
+
+std::size_t JobItem::GetLogRateLimit() const
+{
+  return static_cast<std::size_t>(Property<mvvm::int32>(itemconstants::kLogRateLimit));
+}
+
+void JobItem::SetLogRateLimit(std::size_t message_rate)
+{
+  (void)SetProperty(itemconstants::kLogRateLimit, static_cast<mvvm::int32>(message_rate));
+}
+
+bool JobItem::IsLogFoldDuplicates() const
+{
+  return Property<bool>(itemconstants::kLogFoldDuplicates);
+}
+
+void JobItem::SetLogFoldDuplicates(bool value)
+{
+  (void)SetProperty(itemconstants::kLogFoldDuplicates, value);
+}
+
+int JobItem::GetPriority() const
+{
+  return Property<mvvm::int32>(itemconstants::kPriority);
+}
+
+void JobItem::SetPriority(int priority)
+{
+  (void)SetProperty(itemconstants::kPriority, static_cast<mvvm::int32>(priority));
+}
+
 void JobItem::SetProcedure(const ProcedureItem* item)
 {
   GetItem<mvvm::LinkedItem>(kLink)->SetLink(item);
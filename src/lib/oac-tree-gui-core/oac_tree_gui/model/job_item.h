@@ -26,6 +26,8 @@
 #include <mvvm/model/compound_item.h>
 
 #include <chrono>
+#include <cstddef>
+#include <string>
 
 namespace oac_tree_gui
 {
@@ -56,14 +58,65 @@ public:
   void SetStatus(RunnerStatus status);
 
   /**
-   * @brief Returns the current value of sequencer ticks timeout in msec defined for this job.
+   * @brief Returns the current value of sequencer ticks timeout defined for this job.
    */
-  std::chrono::milliseconds GetTickTimeout() const;
+  std::chrono::microseconds GetTickTimeout() const;
 
   /**
    * @brief Sets the value of sequencer ticks timeout that shall be used for this job execution.
    */
-  void SetTickTimeout(std::chrono::milliseconds timeout);
+  void SetTickTimeout(std::chrono::microseconds timeout);
+
+  /**
+   * @brief Returns the number of log records kept in memory, 0 means no limit.
+   */
+  std::size_t GetLogCapacity() const;
+
+  /**
+   * @brief Sets the number of log records kept in memory, older records are moved to disk.
+   */
+  void SetLogCapacity(std::size_t capacity);
+
+  /**
+   * @brief Returns the name of the least important log severity accepted from the procedure.
+   */
+  std::string GetLogSeverityThreshold() const;
+
+  /**
+   * @brief Sets the name of the least important log severity accepted from the procedure.
+   */
+  void SetLogSeverityThreshold(const std::string& severity_name);
+
+  /**
+   * @brief Returns the number of log messages per second accepted from the procedure, 0 means no
+   * limit.
+   */
+  std::size_t GetLogRateLimit() const;
+
+  /**
+   * @brief Sets the number of log messages per second accepted from the procedure.
+   */
+  void SetLogRateLimit(std::size_t message_rate);
+
+  /**
+   * @brief Checks if consecutive identical log messages are reported once with repetition count.
+   */
+  bool IsLogFoldDuplicates() const;
+
+  /**
+   * @brief Sets the flag to report consecutive identical log messages once.
+   */
+  void SetLogFoldDuplicates(bool value);
+
+  /**
+   * @brief Returns the priority of the job, queued jobs with higher priority start first.
+   */
+  int GetPriority() const;
+
+  /**
+   * @brief Sets the priority of the job.
+   */
+  void SetPriority(int priority);
 
   /**
    * @brief Sets procedure to handle.
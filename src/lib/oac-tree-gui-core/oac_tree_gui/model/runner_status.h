@@ -43,7 +43,8 @@ enum class RunnerStatus : std::uint8_t
   kFailed,
   kHalted,
   kUndefined,     //!< job either wasn't submitted, or does not have domain counterpart yet
-  kSubmitFailure  //!< job submission has failed due to malformed procedure
+  kSubmitFailure,  //!< job submission has failed due to malformed procedure
+  kQueued          //!< job is waiting for a free slot to start, see JobScheduler
 };
 
 /**
@@ -136,7 +136,7 @@ std::vector<std::string> GetJobItemTypes()
 // ------------------------------------------------------------------------------------------------
 
 std::unique_ptr<JobItem> CreateLocalJobItem(ProcedureItem* procedure,
-                                            std::chrono::milliseconds tick_timeout)
+                                            std::chrono::microseconds tick_timeout)
 {
   if (procedure == nullptr)
   {
@@ -150,7 +150,7 @@ std::unique_ptr<JobItem> CreateLocalJobItem(ProcedureItem* procedure,
 }
 
 std::unique_ptr<JobItem> CreateImportedJobItem(std::unique_ptr<ProcedureItem> procedure,
-                                               std::chrono::milliseconds tick_timeout)
+                                               std::chrono::microseconds tick_timeout)
 {
   if (!procedure)
   {
@@ -180,7 +180,7 @@ std::unique_ptr<RemoteJobItem> CreateRemoteJobItem(const std::string& server_nam
 }
 
 std::unique_ptr<JobItem> CreateFileBasedJobItem(const std::string& file_name,
-                                                std::chrono::milliseconds tick_timeout)
+                                                std::chrono::microseconds tick_timeout)
 {
   auto result = std::make_unique<FileBasedJobItem>();
   result->SetFileName(file_name);
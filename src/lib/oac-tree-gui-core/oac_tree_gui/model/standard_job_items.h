@@ -126,7 +126,7 @@ std::vector<std::string> GetJobItemTypes();
  */
 std::unique_ptr<JobItem> CreateLocalJobItem(
     ProcedureItem* procedure,
-    std::chrono::milliseconds tick_timeout = std::chrono::milliseconds{0});
+    std::chrono::microseconds tick_timeout = std::chrono::microseconds{0});
 
 /**
  * @brief Creates job item intended to run ProcedureItem imported from somewhere.
@@ -139,7 +139,7 @@ std::unique_ptr<JobItem> CreateLocalJobItem(
  */
 std::unique_ptr<JobItem> CreateImportedJobItem(
     std::unique_ptr<ProcedureItem> procedure,
-    std::chrono::milliseconds tick_timeout = std::chrono::milliseconds{0});
+    std::chrono::microseconds tick_timeout = std::chrono::microseconds{0});
 
 /**
  * @brief Creates job item intended to control remote procedures.
@@ -160,7 +160,7 @@ std::unique_ptr<RemoteJobItem> CreateRemoteJobItem(const std::string& server_nam
  */
 std::unique_ptr<JobItem> CreateFileBasedJobItem(
     const std::string& file_name,
-    std::chrono::milliseconds tick_timeout = std::chrono::milliseconds{0});
+    std::chrono::microseconds tick_timeout = std::chrono::microseconds{0});
 }  // namespace oac_tree_gui
 
 namespace mvvm
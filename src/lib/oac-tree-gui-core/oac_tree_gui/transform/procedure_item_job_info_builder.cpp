@@ -57,6 +57,14 @@ std::unique_ptr<ProcedureItem> ProcedureItemJobInfoBuilder::CreateProcedureItem(
                               ? CreateInstructionInfoItemTree(*job_info.GetRootInstructionInfo())
                               : CreateInstructionItemTree(*job_info.GetRootInstructionInfo());
   m_index_to_instruction = std::move(instruction_tree.indexes);
+
+  m_instruction_to_index.clear();
+  m_instruction_to_index.reserve(m_index_to_instruction.size());
+  for (std::size_t index = 0; index < m_index_to_instruction.size(); ++index)
+  {
+    (void)m_instruction_to_index.emplace(m_index_to_instruction[index], index);
+  }
+
   (void)result->GetInstructionContainer()->InsertItem(std::move(instruction_tree.root),
                                                       mvvm::TagIndex::Append());
 
@@ -74,13 +82,13 @@ InstructionItem* ProcedureItemJobInfoBuilder::GetInstruction(std::size_t index)
 
 std::size_t ProcedureItemJobInfoBuilder::GetIndex(const InstructionItem* item) const
 {
-  auto pos = std::find(m_index_to_instruction.begin(), m_index_to_instruction.end(), item);
-  if (pos == m_index_to_instruction.end())
+  auto pos = m_instruction_to_index.find(item);
+  if (pos == m_instruction_to_index.end())
   {
     throw RuntimeException("Can't find automation index for given item");
   }
 
-  return std::distance(m_index_to_instruction.begin(), pos);
+  return pos->second;
 }
 
 VariableItem* ProcedureItemJobInfoBuilder::GetVariable(std::size_t index) const
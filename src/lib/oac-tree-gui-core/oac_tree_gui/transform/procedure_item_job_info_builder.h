@@ -25,6 +25,7 @@
 #include <oac_tree_gui/transform/i_procedure_item_builder.h>
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace oac_tree_gui
@@ -39,7 +40,8 @@ class VariableItem;
  * @brief The ProcedureItemJobInfoBuilder class creates ProcedureItem from automation server
  * information.
  *
- * Contains machinery to get instruction and variable pointers from automation indexes.
+ * Contains machinery to get instruction and variable pointers from automation indexes, and
+ * automation indexes from instruction pointers. Both lookups take constant time.
  */
 class ProcedureItemJobInfoBuilder : public IProcedureItemBuilder
 {
@@ -59,6 +61,7 @@ public:
 
 private:
   std::vector<const InstructionItem*> m_index_to_instruction;
+  std::unordered_map<const InstructionItem*, std::size_t> m_instruction_to_index;
   std::vector<const VariableItem*> m_index_to_variable;
 };
 
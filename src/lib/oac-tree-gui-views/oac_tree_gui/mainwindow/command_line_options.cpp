@@ -20,6 +20,8 @@
 
 #include "command_line_options.h"
 
+#include <oac_tree_gui/jobsystem/scripted_user_responder.h>
+
 #include <sup/gui/app/app_helper.h>
 #include <sup/gui/app/main_window_types.h>
 #include <sup/gui/mainwindow/main_window_helper.h>
@@ -41,6 +43,7 @@ const QString kFontOption = "font";
 const QString kStyleOption = "style";
 const QString kFileOption = "file";
 const QString kWindowSizeOption = "size";
+const QString kResponsesOption = "responses";
 
 /**
  * @brief Populates parser with application command line options.
@@ -77,6 +80,12 @@ void PopulateOptions(QCommandLineParser& parser)
   QCommandLineOption window_size_option(kWindowSizeOption, "Initial window size");
   window_size_option.setValueName("1024x768");
   parser.addOption(window_size_option);
+
+  const QCommandLineOption responses_option(
+      kResponsesOption,
+      "Answer user input and choice requests using rules from a JSON file instead of dialogs",
+      "filename");
+  parser.addOption(responses_option);
 }
 
 /**
@@ -117,6 +126,21 @@ Options ParseOptions(QCommandLineParser& parser)
     }
   }
 
+  if (parser.isSet(kResponsesOption))
+  {
+    result.user_response_file = parser.value(kResponsesOption);
+    try
+    {
+      // validating rules upfront, to not fail later on the first submitted job
+      (void)ReadScriptedUserRules(result.user_response_file.toStdString());
+    }
+    catch (const std::exception& ex)
+    {
+      qInfo() << "Can't read user responses:" << ex.what();
+      parser.showHelp(1);
+    }
+  }
+
   return result;
 }
 
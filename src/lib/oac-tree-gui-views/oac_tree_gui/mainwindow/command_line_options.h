@@ -50,6 +50,9 @@ struct Options
 
   //! initial window size
   std::optional<QSize> window_size;
+
+  //! the file with rules to answer user input and choice requests without dialogs
+  QString user_response_file;
 };
 
 /**
@@ -84,7 +84,8 @@ void OperationMainWindow::InitApplication()
           &OperationMainWindow::OnRestartRequest);
 
   m_operation_view = new OperationMonitorView(m_context.GetCommandService(),
-                                              OperationPresentationMode::kOperationMode, this);
+                                              OperationPresentationMode::kOperationMode,
+                                              m_context.GetUserResponseFile(), this);
   m_operation_view->SetModels(m_models.get());
 
   setCentralWidget(m_operation_view);
@@ -77,6 +77,7 @@ int RunApplication(int argc, char** argv)
 
     SequencerMainWindowContext context;
     context.LoadPlugins();
+    context.SetUserResponseFile(options.user_response_file);
     MainWindowT win(context);
 
     if (options.window_size.has_value())
@@ -107,7 +107,8 @@ void SequencerMainWindow::InitComponents()
                           FindIcon("graph-outline", mvvm::ColorFlavor::kForDarkThemes));
 
   m_operation_view =
-      new OperationMonitorView(m_context.GetCommandService(), OperationPresentationMode::kIdeMode);
+      new OperationMonitorView(m_context.GetCommandService(), OperationPresentationMode::kIdeMode,
+                               m_context.GetUserResponseFile());
   m_tab_widget->AddWidget(
       m_operation_view, "Run",
       FindIcon("chevron-right-circle-outline", mvvm::ColorFlavor::kForDarkThemes));
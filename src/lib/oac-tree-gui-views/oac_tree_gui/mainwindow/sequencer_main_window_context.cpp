@@ -79,6 +79,16 @@ IDomainPluginService& SequencerMainWindowContext::GetDomainPluginService()
   return *m_domain_plugin_service;
 }
 
+void SequencerMainWindowContext::SetUserResponseFile(const QString& file_name)
+{
+  m_user_response_file = file_name;
+}
+
+QString SequencerMainWindowContext::GetUserResponseFile() const
+{
+  return m_user_response_file;
+}
+
 std::unique_ptr<DomainObjectTypeRegistry> SequencerMainWindowContext::CreateObjectTypeRegistry()
     const
 {
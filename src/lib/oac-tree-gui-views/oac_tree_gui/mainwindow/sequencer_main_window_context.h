@@ -21,6 +21,7 @@
 #ifndef OAC_TREE_GUI_MAINWINDOW_SEQUENCER_MAIN_WINDOW_CONTEXT_H_
 #define OAC_TREE_GUI_MAINWINDOW_SEQUENCER_MAIN_WINDOW_CONTEXT_H_
 
+#include <QString>
 #include <memory>
 
 namespace sup::gui
@@ -63,6 +64,16 @@ public:
 
   IDomainPluginService& GetDomainPluginService();
 
+  /**
+   * @brief Sets the file with rules to answer user input and choice requests without dialogs.
+   */
+  void SetUserResponseFile(const QString& file_name);
+
+  /**
+   * @brief Returns the file with rules to answer user requests, empty if dialogs should be used.
+   */
+  QString GetUserResponseFile() const;
+
 private:
   std::unique_ptr<DomainObjectTypeRegistry> CreateObjectTypeRegistry() const;
   std::unique_ptr<IDomainPluginService> CreateDomainPluginService() const;
@@ -81,6 +92,9 @@ private:
   //!< knows how to load plugins, and what objects are registered in them
   //! (use loader and registry from above)
   std::unique_ptr<IDomainPluginService> m_domain_plugin_service;
+
+  //!< rules to answer user requests in unattended runs
+  QString m_user_response_file;
 };
 
 /**
@@ -0,0 +1,145 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "aggregated_message_panel.h"
+
+#include <oac_tree_gui/style/style_helper.h>
+#include <oac_tree_gui/viewmodel/aggregated_job_log_viewmodel.h>
+
+#include <sup/gui/widgets/steady_menu.h>
+
+#include <QAction>
+#include <QScrollBar>
+#include <QSortFilterProxyModel>
+#include <QToolButton>
+#include <QTreeView>
+#include <QVBoxLayout>
+#include <QWidgetAction>
+#include <vector>
+
+namespace
+{
+
+/**
+ * @brief Returns the colour for the job with the given ordinal number.
+ */
+QColor GetJobColor(int job_number)
+{
+  static const std::vector<QColor> kJobColors = {
+      QColor("#1f77b4"), QColor("#d62728"), QColor("#2ca02c"), QColor("#9467bd"),
+      QColor("#ff7f0e"), QColor("#8c564b"), QColor("#e377c2"), QColor("#17becf")};
+  return kJobColors[static_cast<std::size_t>(job_number) % kJobColors.size()];
+}
+
+}  // namespace
+
+namespace oac_tree_gui
+{
+
+AggregatedMessagePanel::AggregatedMessagePanel(QWidget* parent_widget)
+    : QWidget(parent_widget)
+    , m_tree_view(new QTreeView)
+    , m_view_model(new AggregatedJobLogViewModel(this))
+    , m_proxy_model(new QSortFilterProxyModel(this))
+    , m_job_selector_action(new QWidgetAction(this))
+{
+  setWindowTitle("ALL JOBS LOG");
+
+  auto layout = new QVBoxLayout(this);
+  layout->setContentsMargins(0, 0, 0, 0);
+  layout->setSpacing(0);
+  layout->addWidget(m_tree_view);
+
+  m_job_selector_action->setDefaultWidget(CreateJobSelectorWidget().release());
+  addAction(m_job_selector_action);
+
+  m_tree_view->setAlternatingRowColors(true);
+  m_tree_view->setRootIsDecorated(false);
+  m_tree_view->setUniformRowHeights(true);
+  m_tree_view->setModel(m_proxy_model);
+  m_tree_view->setSortingEnabled(true);
+  m_tree_view->sortByColumn(-1, Qt::AscendingOrder);  // keep merge order until user clicks
+
+  m_proxy_model->setSourceModel(m_view_model);
+
+  SetupAutoscroll();
+}
+
+AggregatedMessagePanel::~AggregatedMessagePanel() = default;
+
+void AggregatedMessagePanel::AddLog(JobLog* job_log, const QString& job_name)
+{
+  m_view_model->AddLog(job_log, job_name, GetJobColor(m_added_log_count++));
+}
+
+std::unique_ptr<QWidget> AggregatedMessagePanel::CreateJobSelectorWidget()
+{
+  m_job_selector_menu = std::make_unique<sup::gui::SteadyMenu>();
+  connect(m_job_selector_menu.get(), &QMenu::aboutToShow, this,
+          &AggregatedMessagePanel::UpdateJobSelectorMenu);
+
+  auto result = std::make_unique<QToolButton>();
+  result->setText("Jobs");
+  result->setToolTip("Select jobs to show");
+  result->setIcon(FindIcon("cog-outline"));
+  result->setPopupMode(QToolButton::InstantPopup);
+  result->setToolButtonStyle(Qt::ToolButtonIconOnly);
+  result->setMenu(m_job_selector_menu.get());
+
+  return result;
+}
+
+void AggregatedMessagePanel::UpdateJobSelectorMenu()
+{
+  m_job_selector_menu->clear();
+
+  for (auto job_log : m_view_model->GetLogs())
+  {
+    auto action = m_job_selector_menu->addAction(m_view_model->GetLogName(job_log));
+    action->setCheckable(true);
+    action->setChecked(m_view_model->IsLogVisible(job_log));
+
+    auto on_action = [this, job_log, action]()
+    { m_view_model->SetLogVisible(job_log, action->isChecked()); };
+    connect(action, &QAction::triggered, this, on_action);
+  }
+}
+
+void AggregatedMessagePanel::SetupAutoscroll()
+{
+  auto on_row_about_to_be_inserted = [this](auto)
+  {
+    auto bar = m_tree_view->verticalScrollBar();
+    m_tree_at_the_bottom = bar ? (bar->value() == bar->maximum()) : false;
+  };
+  connect(m_tree_view->model(), &QAbstractItemModel::rowsAboutToBeInserted, this,
+          on_row_about_to_be_inserted);
+
+  auto on_row_inserted = [this](auto)
+  {
+    if (m_tree_at_the_bottom)
+    {
+      m_tree_view->scrollToBottom();
+    }
+  };
+  connect(m_tree_view->model(), &QAbstractItemModel::rowsInserted, this, on_row_inserted);
+}
+
+}  // namespace oac_tree_gui
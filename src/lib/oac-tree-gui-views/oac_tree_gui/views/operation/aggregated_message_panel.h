@@ -0,0 +1,92 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_VIEWS_OPERATION_AGGREGATED_MESSAGE_PANEL_H_
+#define OAC_TREE_GUI_VIEWS_OPERATION_AGGREGATED_MESSAGE_PANEL_H_
+
+#include <QWidget>
+#include <memory>
+
+class QTreeView;
+class QSortFilterProxyModel;
+class QWidgetAction;
+
+namespace sup::gui
+{
+class SteadyMenu;
+}  // namespace sup::gui
+
+namespace oac_tree_gui
+{
+
+class JobLog;
+class AggregatedJobLogViewModel;
+
+/**
+ * @brief The AggregatedMessagePanel class shows log records of all submitted jobs in a single
+ * table ordered by time.
+ *
+ * Every job gets its own colour, jobs can be hidden using the job selector menu.
+ */
+class AggregatedMessagePanel : public QWidget
+{
+  Q_OBJECT
+
+public:
+  explicit AggregatedMessagePanel(QWidget* parent_widget = nullptr);
+  ~AggregatedMessagePanel() override;
+
+  AggregatedMessagePanel(const AggregatedMessagePanel&) = delete;
+  AggregatedMessagePanel& operator=(const AggregatedMessagePanel&) = delete;
+  AggregatedMessagePanel(AggregatedMessagePanel&&) = delete;
+  AggregatedMessagePanel& operator=(AggregatedMessagePanel&&) = delete;
+
+  /**
+   * @brief Adds the log of the job with the given name to the table.
+   */
+  void AddLog(JobLog* job_log, const QString& job_name);
+
+private:
+  std::unique_ptr<QWidget> CreateJobSelectorWidget();
+
+  /**
+   * @brief Rebuilds the job selector menu to reflect the current list of jobs.
+   */
+  void UpdateJobSelectorMenu();
+
+  /**
+   * @brief Setup tree view autoscroll, same as in MessagePanel.
+   */
+  void SetupAutoscroll();
+
+  QTreeView* m_tree_view{nullptr};
+  AggregatedJobLogViewModel* m_view_model{nullptr};
+  QSortFilterProxyModel* m_proxy_model{nullptr};
+  QWidgetAction* m_job_selector_action{nullptr};
+  std::unique_ptr<sup::gui::SteadyMenu> m_job_selector_menu;
+
+  //! controls if the tree was scrolled to the bottom to make auto scroll
+  bool m_tree_at_the_bottom{false};
+  int m_added_log_count{0};  //!< number of logs added so far, used to pick the next colour
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_VIEWS_OPERATION_AGGREGATED_MESSAGE_PANEL_H_
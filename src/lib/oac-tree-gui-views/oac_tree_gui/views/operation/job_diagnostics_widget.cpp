@@ -0,0 +1,133 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "job_diagnostics_widget.h"
+
+#include <QTimer>
+#include <QTreeWidget>
+#include <QVBoxLayout>
+
+namespace oac_tree_gui
+{
+
+namespace
+{
+
+const int kUpdateIntervalMsec = 1000;
+
+//! Returns string representing given duration in milliseconds.
+QString ToMillisecondsString(std::chrono::microseconds value)
+{
+  const double kMicrosecondsPerMillisecond = 1000.0;
+  return QString("%1 ms").arg(static_cast<double>(value.count()) / kMicrosecondsPerMillisecond, 0,
+                              'f', 2);
+}
+
+//! Adds a row with the name and the value to the given parent.
+void AddRow(QTreeWidgetItem* parent, const QString& name, const QString& value)
+{
+  (void)new QTreeWidgetItem(parent, {name, value});
+}
+
+}  // namespace
+
+JobDiagnosticsWidget::JobDiagnosticsWidget(QWidget* parent_widget)
+    : QWidget(parent_widget), m_tree_widget(new QTreeWidget), m_update_timer(new QTimer(this))
+{
+  setWindowTitle("JOB DIAGNOSTICS");
+  setToolTip("Delivery of domain events of currently selected job to the GUI");
+
+  m_tree_widget->setColumnCount(2);
+  m_tree_widget->setHeaderLabels({"Metric", "Value"});
+  m_tree_widget->setAlternatingRowColors(true);
+
+  auto layout = new QVBoxLayout(this);
+  layout->setContentsMargins(0, 0, 0, 0);
+  layout->setSpacing(0);
+  layout->addWidget(m_tree_widget);
+
+  connect(m_update_timer, &QTimer::timeout, this, &JobDiagnosticsWidget::UpdateStatistics);
+  m_update_timer->start(kUpdateIntervalMsec);
+}
+
+void JobDiagnosticsWidget::SetStatisticsProvider(statistics_provider_t provider)
+{
+  m_statistics_provider = std::move(provider);
+  UpdateStatistics();
+}
+
+void JobDiagnosticsWidget::UpdateStatistics()
+{
+  // collecting statistics is not free, there is no need to do it for the hidden widget
+  if (!m_statistics_provider || !isVisible())
+  {
+    return;
+  }
+
+  const auto statistics = m_statistics_provider();
+
+  m_tree_widget->clear();
+
+  auto queue = new QTreeWidgetItem(m_tree_widget, {"Queue", ""});
+  AddRow(queue, "Depth", QString::number(statistics.queue_depth));
+  AddRow(queue, "High-water mark", QString::number(statistics.queue_high_water_mark));
+  AddRow(queue, "Dropped", QString::number(statistics.dropped_event_count));
+  AddRow(queue, "Conflated", QString::number(statistics.conflated_event_count));
+
+  auto log = new QTreeWidgetItem(m_tree_widget, {"Suppressed log messages", ""});
+  AddRow(log, "Below threshold", QString::number(statistics.log_below_threshold_count));
+  AddRow(log, "Rate limited", QString::number(statistics.log_rate_limited_count));
+  AddRow(log, "Folded duplicates", QString::number(statistics.log_folded_duplicate_count));
+
+  auto requests = new QTreeWidgetItem(m_tree_widget, {"User requests", ""});
+  AddRow(requests, "Rejected duplicates",
+         QString::number(statistics.duplicate_user_request_count));
+
+  auto latency = new QTreeWidgetItem(m_tree_widget, {"Latency", ""});
+  AddRow(latency, "p50", ToMillisecondsString(statistics.latency_p50));
+  AddRow(latency, "p90", ToMillisecondsString(statistics.latency_p90));
+  AddRow(latency, "p99", ToMillisecondsString(statistics.latency_p99));
+  AddRow(latency, "max", ToMillisecondsString(statistics.latency_max));
+
+  auto ticks = new QTreeWidgetItem(m_tree_widget, {"Ticks", ""});
+  AddRow(ticks, "Rate", QString("%1 ticks/s").arg(statistics.ticks.tick_rate, 0, 'f', 1));
+  const auto target_rate = statistics.ticks.target_tick_rate > 0.0
+                               ? QString("%1 ticks/s").arg(statistics.ticks.target_tick_rate, 0,
+                                                           'f', 1)
+                               : QString("full speed");
+  AddRow(ticks, "Target rate", target_rate);
+  AddRow(ticks, "Total", QString::number(statistics.ticks.tick_count));
+  AddRow(ticks, "Late", QString::number(statistics.ticks.late_tick_count));
+
+  auto events = new QTreeWidgetItem(m_tree_widget, {"Events", ""});
+  for (const auto& event_type : statistics.event_types)
+  {
+    const auto value = QString("%1 ev/s, total %2, in handler %3 (max %4)")
+                           .arg(event_type.event_rate, 0, 'f', 1)
+                           .arg(event_type.event_count)
+                           .arg(ToMillisecondsString(event_type.handler_time))
+                           .arg(ToMillisecondsString(event_type.max_handler_time));
+    AddRow(events, QString::fromStdString(event_type.name), value);
+  }
+
+  m_tree_widget->expandAll();
+}
+
+}  // namespace oac_tree_gui
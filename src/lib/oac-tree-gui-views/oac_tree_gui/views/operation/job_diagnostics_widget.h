@@ -0,0 +1,61 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_VIEWS_OPERATION_JOB_DIAGNOSTICS_WIDGET_H_
+#define OAC_TREE_GUI_VIEWS_OPERATION_JOB_DIAGNOSTICS_WIDGET_H_
+
+#include <oac_tree_gui/jobsystem/domain_event_statistics.h>
+
+#include <QWidget>
+#include <functional>
+
+class QTimer;
+class QTreeWidget;
+
+namespace oac_tree_gui
+{
+
+//! Shows how far behind the real procedure the GUI of the currently selected job is. Populates
+//! lower left corner of OperationMonitorView, next to JobPropertyWidget.
+
+class JobDiagnosticsWidget : public QWidget
+{
+  Q_OBJECT
+
+public:
+  using statistics_provider_t = std::function<DomainEventStatistics()>;
+
+  explicit JobDiagnosticsWidget(QWidget* parent_widget = nullptr);
+
+  //! Sets the function returning statistics of the currently selected job.
+  void SetStatisticsProvider(statistics_provider_t provider);
+
+  //! Reads statistics from the provider and shows them.
+  void UpdateStatistics();
+
+private:
+  QTreeWidget* m_tree_widget{nullptr};
+  QTimer* m_update_timer{nullptr};
+  statistics_provider_t m_statistics_provider;
+};
+
+}  // namespace oac_tree_gui
+
+#endif  // OAC_TREE_GUI_VIEWS_OPERATION_JOB_DIAGNOSTICS_WIDGET_H_
@@ -21,7 +21,7 @@
 #include "message_panel.h"
 
 #include <oac_tree_gui/jobsystem/job_log_severity.h>
-#include <oac_tree_gui/jobsystem/job_utils.h>
+#include <oac_tree_gui/jobsystem/objects/job_log.h>
 #include <oac_tree_gui/style/style_helper.h>
 #include <oac_tree_gui/viewmodel/job_log_viewmodel.h>
 
@@ -31,10 +31,13 @@
 #include <mvvm/editors/selectable_combobox_editor.h>
 
 #include <QAction>
-#include <QRegularExpression>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QLineEdit>
 #include <QScrollBar>
 #include <QSettings>
 #include <QSortFilterProxyModel>
+#include <QTimer>
 #include <QToolButton>
 #include <QTreeView>
 #include <QVBoxLayout>
@@ -54,6 +57,10 @@ std::vector<oac_tree_gui::Severity> kSeveritiesToSelect = {
     oac_tree_gui::Severity::kTrace};
 
 const std::vector<int> kDefaultColumnStretch({2, 2, 2, 1, 6});
+const int kMessageColumn = 4;
+
+//! Delay after the last keystroke in the search bar before the log is searched.
+const int kSearchDelayMsec = 300;
 }  // namespace
 
 namespace oac_tree_gui
@@ -67,6 +74,7 @@ MessagePanel::MessagePanel(QWidget* parent_widget)
     , m_view_model(new JobLogViewModel(nullptr, this))
     , m_proxy_model(new QSortFilterProxyModel(this))
     , m_severity_selector_action(new QWidgetAction(this))
+    , m_search_timer(new QTimer(this))
 {
   setWindowTitle("LOG");
   ReadSettings();
@@ -75,6 +83,7 @@ MessagePanel::MessagePanel(QWidget* parent_widget)
   layout->setContentsMargins(0, 0, 0, 0);
   layout->setSpacing(0);
   layout->addWidget(m_tree_view);
+  layout->addWidget(CreateSearchBar().release());
 
   m_severity_selector_action->setDefaultWidget(CreateSeveritySelectorWidget().release());
   addAction(m_severity_selector_action);
@@ -85,8 +94,8 @@ MessagePanel::MessagePanel(QWidget* parent_widget)
   m_tree_view->setModel(m_proxy_model);
   m_tree_view->setSortingEnabled(true);
 
+  // proxy model is used for sorting only, severity filtering is done by the view model itself
   m_proxy_model->setSourceModel(m_view_model);
-  m_proxy_model->setFilterKeyColumn(2);
 
   SetupAutoscroll();
   UpdateSeverityFilter();
@@ -99,7 +108,57 @@ MessagePanel::~MessagePanel()
 
 void MessagePanel::SetLog(JobLog* job_log)
 {
+  if (m_job_log)
+  {
+    disconnect(m_job_log, nullptr, this, nullptr);
+  }
+
   m_view_model->SetLog(job_log);
+  m_job_log = job_log;
+
+  if (m_job_log)
+  {
+    // the log is gone together with the removed job, the view model takes care of itself
+    auto on_log_reset = [this]()
+    {
+      ResetSearch();
+      UpdateSearchLabel();
+    };
+    connect(m_job_log, &QObject::destroyed, this, on_log_reset);
+    connect(m_job_log, &JobLog::LogCleared, this, on_log_reset);
+  }
+
+  ResetSearch();
+  UpdateSearchMatches();
+  UpdateSearchLabel();
+}
+
+void MessagePanel::SetSearchText(const QString& text)
+{
+  m_search_edit->setText(text);
+  RestartSearch();
+}
+
+void MessagePanel::FindNext()
+{
+  if (m_search_timer->isActive())
+  {
+    RestartSearch();  // the text has been changed, but not searched yet
+    return;
+  }
+
+  GoToMatch(1);
+}
+
+void MessagePanel::FindPrevious()
+{
+  if (m_search_timer->isActive())
+  {
+    m_search_timer->stop();
+    ResetSearch();
+  }
+
+  GoToMatch(-1);
 }
 
 void MessagePanel::ReadSettings()
@@ -194,18 +253,121 @@ void MessagePanel::SetupAutoscroll()
 
 void MessagePanel::UpdateSeverityFilter()
 {
-  std::vector<std::string> names;
+  std::vector<Severity> severities;
 
   for (const auto& [severity, flag] : m_show_severity_flag)
   {
     if (flag)
     {
-      names.push_back(ToString(severity));
+      severities.push_back(severity);
+    }
+  }
+
+  m_view_model->SetSeverityFilter(severities);
+}
+
+std::unique_ptr<QWidget> MessagePanel::CreateSearchBar()
+{
+  auto result = std::make_unique<QWidget>();
+  auto layout = new QHBoxLayout(result.get());
+  layout->setContentsMargins(0, 0, 0, 0);
+
+  m_search_edit = new QLineEdit;
+  m_search_edit->setClearButtonEnabled(true);
+  m_search_edit->setPlaceholderText("Find in log");
+  m_search_timer->setSingleShot(true);
+  m_search_timer->setInterval(kSearchDelayMsec);
+  connect(m_search_timer, &QTimer::timeout, this, &MessagePanel::RestartSearch);
+  connect(m_search_edit, &QLineEdit::textChanged, m_search_timer, qOverload<>(&QTimer::start));
+  connect(m_search_edit, &QLineEdit::returnPressed, this, &MessagePanel::FindNext);
+  layout->addWidget(m_search_edit);
+
+  m_search_label = new QLabel;
+  layout->addWidget(m_search_label);
+
+  auto previous_button = new QToolButton;
+  previous_button->setIcon(FindIcon("arrow-up-thin-circle-outline"));
+  previous_button->setToolTip("Find previous message containing the text");
+  connect(previous_button, &QToolButton::clicked, this, &MessagePanel::FindPrevious);
+  layout->addWidget(previous_button);
+
+  auto next_button = new QToolButton;
+  next_button->setIcon(FindIcon("arrow-down-thin-circle-outline"));
+  next_button->setToolTip("Find next message containing the text");
+  connect(next_button, &QToolButton::clicked, this, &MessagePanel::FindNext);
+  layout->addWidget(next_button);
+
+  return result;
+}
+
+void MessagePanel::ResetSearch()
+{
+  m_search_matches.clear();
+  m_searched_size = 0;
+  m_current_match = -1;
+}
+
+void MessagePanel::RestartSearch()
+{
+  m_search_timer->stop();
+  ResetSearch();
+  GoToMatch(1);
+}
+
+void MessagePanel::UpdateSearchMatches()
+{
+  const auto text = m_search_edit->text().toStdString();
+  if (m_job_log == nullptr || text.empty())
+  {
+    return;
+  }
+
+  if (m_searched_size == m_job_log->GetSize())
+  {
+    return;
+  }
+
+  const auto matches = m_job_log->FindRecords(text, m_searched_size);
+  m_search_matches.insert(m_search_matches.end(), matches.begin(), matches.end());
+  m_searched_size = m_job_log->GetSize();
+}
+
+void MessagePanel::GoToMatch(int step)
+{
+  UpdateSearchMatches();
+
+  const auto match_count = static_cast<int>(m_search_matches.size());
+  int position = (m_current_match < 0 && step < 0) ? match_count : m_current_match;
+  for (int attempt = 0; attempt < match_count; ++attempt)
+  {
+    position = (position + step + match_count) % match_count;
+    const int row = m_view_model->GetRow(m_search_matches[position]);
+    if (row >= 0)
+    {
+      m_current_match = position;
+      const auto index = m_proxy_model->mapFromSource(m_view_model->index(row, kMessageColumn));
+      m_tree_view->setCurrentIndex(index);
+      m_tree_view->scrollTo(index, QAbstractItemView::PositionAtCenter);
+      break;
     }
   }
 
-  const QRegularExpression regexp(QString::fromStdString(GetRegExpPattern(names)));
-  m_proxy_model->setFilterRegularExpression(regexp);
+  UpdateSearchLabel();
+}
+
+void MessagePanel::UpdateSearchLabel()
+{
+  if (m_search_edit->text().isEmpty())
+  {
+    m_search_label->clear();
+    return;
+  }
+
+  const auto match_count = static_cast<int>(m_search_matches.size());
+  m_search_label->setText(match_count == 0 ? QString("No matches")
+                                           : QString("%1 of %2")
+                                                 .arg(m_current_match + 1)
+                                                 .arg(match_count));
 }
 
 }  // namespace oac_tree_gui
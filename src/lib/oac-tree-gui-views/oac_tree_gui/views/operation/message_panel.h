@@ -23,14 +23,19 @@
 
 #include <oac_tree_gui/jobsystem/log_event.h>
 
+#include <QPointer>
 #include <QStringList>
 #include <QWidget>
 #include <map>
 #include <memory>
+#include <vector>
 
 class QAction;
+class QLabel;
+class QLineEdit;
 class QTreeView;
 class QSortFilterProxyModel;
+class QTimer;
 class QToolButton;
 class QWidgetAction;
 
@@ -50,7 +55,8 @@ class JobLogViewModel;
  * @brief The MessagePanel class shows JobLog information in a log table.
  *
  * The table is implemented as a tree view  with columns: date, time, severity, source
- * and the message. It has a selector to filter out certain severity levels.
+ * and the message. It has a selector to filter out certain severity levels, and a search bar to
+ * jump between messages containing the given text.
  */
 class MessagePanel : public QWidget
 {
@@ -67,6 +73,23 @@ public:
 
   void SetLog(JobLog* job_log);
 
+  /**
+   * @brief Searches for messages containing the given text and selects the first one.
+   *
+   * Unlike typing in the search bar, the search is done immediately.
+   */
+  void SetSearchText(const QString& text);
+
+  /**
+   * @brief Selects the next message matching the search text.
+   */
+  void FindNext();
+
+  /**
+   * @brief Selects the previous message matching the search text.
+   */
+  void FindPrevious();
+
 private:
   void ReadSettings();
   void WriteSettings();
@@ -81,10 +104,42 @@ private:
   void SetupAutoscroll();
 
   /**
-   * @brief Update regexp severity filter on board of proxy model.
+   * @brief Update severity filter on board of the view model.
    */
   void UpdateSeverityFilter();
 
+  /**
+   * @brief Creates a search bar with a text field and buttons to navigate between matches.
+   */
+  std::unique_ptr<QWidget> CreateSearchBar();
+
+  /**
+   * @brief Forgets all matches, the log will be searched from the beginning.
+   */
+  void ResetSearch();
+
+  /**
+   * @brief Searches the log for the current text from the beginning, and selects the first match.
+   */
+  void RestartSearch();
+
+  /**
+   * @brief Updates the list of matching records, takes into account records appended since the
+   * last update.
+   */
+  void UpdateSearchMatches();
+
+  /**
+   * @brief Selects the match next to the current one in the given direction, skipping records
+   * hidden by the severity filter.
+   */
+  void GoToMatch(int step);
+
+  /**
+   * @brief Updates the label showing the current match number.
+   */
+  void UpdateSearchLabel();
+
   QTreeView* m_tree_view{nullptr};
   sup::gui::CustomHeaderView* m_custom_header{nullptr};
   JobLogViewModel* m_view_model{nullptr};
@@ -96,6 +151,14 @@ private:
   //! controls if the tree was scrolled to the bottom to make auto scroll
   bool m_tree_at_the_bottom{false};
   QStringList m_unchecked_severitites;
+
+  QPointer<JobLog> m_job_log;  //!< becomes null when the log is destroyed together with its job
+  QLineEdit* m_search_edit{nullptr};
+  QLabel* m_search_label{nullptr};
+  QTimer* m_search_timer{nullptr};    //!< delays the search until the user stops typing
+  std::vector<int> m_search_matches;  //!< log indices of records matching the search text
+  int m_searched_size{0};             //!< number of log records covered by the search
+  int m_current_match{-1};            //!< position of the selected record in the match list
 };
 }  // namespace oac_tree_gui
 
@@ -39,6 +39,10 @@ const QString kTickTimeOutSettingName = kGroupName + "/" + "tick_timeout";
 
 QString GetDelayText(int delay)
 {
+  if (delay == 0)
+  {
+    return QString("Full speed");
+  }
   QString name = delay < 1000 ? QString("%1 msec").arg(delay) : QString("%1 sec").arg(delay / 1000);
   return name;
 }
@@ -94,9 +98,9 @@ MonitorRealTimeActions::MonitorRealTimeActions(QObject* parent_object)
   m_delay_button->setIcon(FindIcon("speedometer-slow"));
   m_delay_button->setToolButtonStyle(Qt::ToolButtonTextBesideIcon);
   m_delay_button->setToolTip(
-      "Artificial delay after each change of instruction status.\n"
-      "Delays < 5msec might make the GUI hang for procedures with tight\n"
-      "sequence loops and/or frequent variable updates");
+      "Target interval between procedure ticks, the time spent in the tick itself\n"
+      "is compensated. At full speed, and with delays < 5msec, the GUI is updated\n"
+      "at a fixed rate, while the procedure runs as fast as requested");
   m_delay_button->setMenu(m_delay_menu.get());
   m_delay_button->setPopupMode(QToolButton::InstantPopup);
   m_delay_action->setDefaultWidget(m_delay_button);
@@ -148,7 +152,7 @@ std::unique_ptr<QMenu> MonitorRealTimeActions::CreateDelayMenu()
   const std::vector<int> delay_values = {0,   2,   5,    10,   20,   50,   100,
                                          200, 500, 1000, 2000, 5000, 10000};
 
-  // small delays < 5msec might make the GUI hang for procedures with lots of instruction
+  // GUI updates of jobs with delays < 5msec are throttled to the background refresh rate
 
   auto result = std::make_unique<QMenu>();
   result->setToolTipsVisible(true);
@@ -20,6 +20,7 @@
 
 #include "operation_job_panel.h"
 
+#include "job_diagnostics_widget.h"
 #include "job_list_widget.h"
 #include "job_property_widget.h"
 #include "operation_job_actions.h"
@@ -41,6 +42,7 @@ OperationJobPanel::OperationJobPanel(QWidget* parent_widget)
     , m_collapsible_list(new sup::gui::CollapsibleListView)
     , m_job_list_widget(new JobListWidget)
     , m_job_property_widget(new JobPropertyWidget)
+    , m_job_diagnostics_widget(new JobDiagnosticsWidget)
     , m_job_actions(new OperationJobActions(this))
 {
   setWindowTitle("Procedures");
@@ -52,6 +54,7 @@ OperationJobPanel::OperationJobPanel(QWidget* parent_widget)
 
   m_collapsible_list->AddWidget(m_job_list_widget);
   // m_collapsible_list->AddCollapsibleWidget(m_job_property_widget, {});
+  m_collapsible_list->AddCollapsibleWidget(m_job_diagnostics_widget, {});
 
   SetupConnections();
 
@@ -91,6 +94,11 @@ QList<QAction*> OperationJobPanel::GetOperationMonitorViewActions()
                                     ActionKey::kRegenerateJob, ActionKey::kRemoveJob});
 }
 
+void OperationJobPanel::SetStatisticsProvider(std::function<DomainEventStatistics()> provider)
+{
+  m_job_diagnostics_widget->SetStatisticsProvider(std::move(provider));
+}
+
 void OperationJobPanel::SetupConnections()
 {
   connect(m_job_list_widget, &JobListWidget::JobSelected, this,
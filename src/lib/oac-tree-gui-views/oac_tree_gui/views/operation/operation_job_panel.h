@@ -21,7 +21,10 @@
 #ifndef OAC_TREE_GUI_VIEWS_OPERATION_OPERATION_JOB_PANEL_H_
 #define OAC_TREE_GUI_VIEWS_OPERATION_OPERATION_JOB_PANEL_H_
 
+#include <oac_tree_gui/jobsystem/domain_event_statistics.h>
+
 #include <QWidget>
+#include <functional>
 
 namespace sup::gui
 {
@@ -35,6 +38,7 @@ class JobListWidget;
 class JobItem;
 class ProcedureItem;
 class JobPropertyWidget;
+class JobDiagnosticsWidget;
 class ApplicationModels;
 class OperationJobActions;
 
@@ -65,6 +69,11 @@ public:
 
   QList<QAction*> GetOperationMonitorViewActions();
 
+  /**
+   * @brief Sets the function returning event statistics of the currently selected job.
+   */
+  void SetStatisticsProvider(std::function<DomainEventStatistics()> provider);
+
 signals:
   void JobSelected(oac_tree_gui::JobItem* item);
   void SubmitProcedureRequest(oac_tree_gui::ProcedureItem* item);
@@ -80,6 +89,7 @@ private:
   sup::gui::CollapsibleListView* m_collapsible_list{nullptr};
   JobListWidget* m_job_list_widget{nullptr};
   JobPropertyWidget* m_job_property_widget{nullptr};
+  JobDiagnosticsWidget* m_job_diagnostics_widget{nullptr};
   OperationJobActions* m_job_actions{nullptr};
 
   ApplicationModels* m_models{nullptr};
@@ -27,8 +27,11 @@
 #include <oac_tree_gui/jobsystem/automation_client.h>
 #include <oac_tree_gui/jobsystem/objects/job_manager.h>
 #include <oac_tree_gui/jobsystem/objects/local_job_handler.h>
+#include <oac_tree_gui/jobsystem/objects/remote_job_importer.h>
 #include <oac_tree_gui/jobsystem/remote_connection_info.h>
 #include <oac_tree_gui/jobsystem/remote_connection_service.h>
+#include <oac_tree_gui/jobsystem/scripted_user_responder.h>
+#include <oac_tree_gui/jobsystem/user_context.h>
 #include <oac_tree_gui/mainwindow/main_window_helper.h>
 #include <oac_tree_gui/model/application_models.h>
 #include <oac_tree_gui/model/instruction_item.h>
@@ -52,6 +55,8 @@
 #include <mvvm/model/model_utils.h>
 #include <mvvm/standarditems/container_item.h>
 
+#include <QFileDialog>
+#include <QProgressDialog>
 #include <QToolBar>
 #include <QVBoxLayout>
 
@@ -65,6 +70,26 @@ const QString kGroupName("OperationMonitorView");
 const QString kSplitterSettingName = kGroupName + "/" + "splitter";
 const QString kWorkdirSettingName = kGroupName + "/" + "workdir";
 
+/**
+ * @brief Number of GUI updates per second for the job the user is looking at.
+ */
+const int kActiveJobRefreshRate = 30;
+
+/**
+ * @brief Number of GUI updates per second for all other jobs.
+ */
+const int kBackgroundJobRefreshRate = 5;
+
+/**
+ * @brief Maximum number of remote jobs prepared in parallel.
+ */
+const std::size_t kRemoteImportThreadCount = 8;
+
+/**
+ * @brief Remote job import shorter than this doesn't show the progress dialog.
+ */
+const int kRemoteImportProgressDelay = 500;
+
 /**
  * @brief Creates factory function to create clients to talk with remote server.
  */
@@ -82,10 +107,23 @@ std::unique_ptr<RemoteConnectionService> CreateRemoteConnectionService()
   return std::make_unique<RemoteConnectionService>(GetClientFactoryFunc());
 }
 
+/**
+ * @brief Creates the context to answer user requests, either with scripted rules from the given
+ * file, or with interactive dialogs.
+ */
+UserContext CreateUserContext(const QString& user_response_file, QWidget* parent)
+{
+  return user_response_file.isEmpty()
+             ? CreateDefaultUserContext(parent)
+             : CreateScriptedUserContext(user_response_file.toStdString());
+}
+
 }  // namespace
 
 OperationMonitorView::OperationMonitorView(sup::gui::IAppCommandService& command_service,
-                                           OperationPresentationMode mode, QWidget* parent_widget)
+                                           OperationPresentationMode mode,
+                                           const QString& user_response_file,
+                                           QWidget* parent_widget)
     : QWidget(parent_widget)
     , m_command_service(command_service)
     , m_presentation_mode(mode)
@@ -95,10 +133,23 @@ OperationMonitorView::OperationMonitorView(sup::gui::IAppCommandService& command
     , m_workspace_panel{new OperationWorkspacePanel(command_service)}
     , m_splitter(new sup::gui::CustomSplitter(kSplitterSettingName))
     , m_connection_service(CreateRemoteConnectionService())
+    , m_remote_job_importer(
+          std::make_unique<RemoteJobImporter>(*m_connection_service, kRemoteImportThreadCount))
     , m_job_manager(new JobManager(
-          GetJobHandlerFactoryFunc(CreateDefaultUserContext(this), *m_connection_service), this))
+          GetJobHandlerFactoryFunc(CreateUserContext(user_response_file, this),
+                                   *m_connection_service),
+          this))
     , m_action_handler(new OperationActionHandler(m_job_manager, CreateOperationContext(), this))
 {
+  m_job_manager->SetGuiRefreshRate(kActiveJobRefreshRate, kBackgroundJobRefreshRate);
+  m_action_handler->SetRemoteJobImporter(m_remote_job_importer.get());
+  m_job_panel->SetStatisticsProvider(
+      [this]()
+      {
+        auto handler = m_job_manager->GetJobHandler(m_job_panel->GetSelectedJob());
+        return handler ? handler->GetEventStatistics() : DomainEventStatistics{};
+      });
+
   auto layout = new QVBoxLayout(this);
   layout->setContentsMargins(4, 1, 4, 4);
 
@@ -225,6 +276,25 @@ void OperationMonitorView::SetupConnections()
   // instruction next leave request from JobManager to OperationRealTimePanel
   connect(m_job_manager, &JobManager::ActiveInstructionChanged, m_realtime_panel,
           &OperationRealTimePanel::SetSelectedInstructions);
+  connect(m_job_manager, &JobManager::ActiveInstructionUpdated, m_realtime_panel,
+          &OperationRealTimePanel::UpdateSelectedInstructions);
+
+  // execution profile of the active job, shown in the instruction tree
+  m_realtime_panel->SetInstructionProfileProvider(
+      [this](const InstructionItem& item) { return m_job_manager->FindInstructionProfile(item); });
+  connect(m_job_manager, &JobManager::InstructionProfileUpdated, m_realtime_panel,
+          &OperationRealTimePanel::UpdateInstructionProfile);
+
+  // every submitted job contributes to the log of all jobs
+  auto on_job_submitted = [this](JobItem* item)
+  {
+    if (auto handler = m_job_manager->GetJobHandler(item); handler)
+    {
+      m_realtime_panel->AddAggregatedJobLog(handler->GetJobLog(),
+                                            QString::fromStdString(item->GetDisplayName()));
+    }
+  };
+  connect(m_job_manager, &JobManager::JobSubmitted, this, on_job_submitted);
 
   // job selection request from MonitorPanel
   connect(m_job_panel, &OperationJobPanel::JobSelected, this, &OperationMonitorView::OnJobSelected);
@@ -241,6 +311,12 @@ void OperationMonitorView::SetupConnections()
   connect(m_job_panel, &OperationJobPanel::ConnectRequest, m_action_handler,
           &OperationActionHandler::OnImportRemoteJobRequest);
 
+  // remote jobs are prepared in the background
+  connect(m_remote_job_importer.get(), &RemoteJobImporter::ProgressChanged, this,
+          &OperationMonitorView::OnRemoteImportProgress);
+  connect(m_remote_job_importer.get(), &RemoteJobImporter::ImportFinished, this,
+          &OperationMonitorView::CloseRemoteImportProgress);
+
   // remove job request
   connect(m_job_panel, &OperationJobPanel::RemoveJobRequest, m_action_handler,
           &OperationActionHandler::OnRemoveJobRequest);
@@ -255,6 +331,8 @@ void OperationMonitorView::SetupConnections()
 
   connect(m_realtime_panel, &OperationRealTimePanel::ToggleBreakpointRequest, m_action_handler,
           &OperationActionHandler::OnToggleBreakpoint);
+  connect(m_realtime_panel, &OperationRealTimePanel::ExportProfileRequest, m_action_handler,
+          &OperationActionHandler::OnExportProfileRequest);
 }
 
 void OperationMonitorView::SetupWidgetActions()
@@ -275,8 +353,9 @@ void OperationMonitorView::SetupWidgetActions()
 //! Setup widgets to show currently selected job.
 void OperationMonitorView::OnJobSelected(JobItem* item)
 {
-  m_job_manager->SetActiveJob(item);
+  // the panel has to show the job before JobManager reports its active instructions
   m_realtime_panel->SetCurrentJob(item);
+  m_job_manager->SetActiveJob(item);
 
   if (auto handler = m_job_manager->GetJobHandler(item); handler)
   {
@@ -292,10 +371,51 @@ OperationActionContext OperationMonitorView::CreateOperationContext()
   result.selected_job = [this] { return m_job_panel->GetSelectedJob(); };
   result.send_message = [](const auto& event) { sup::gui::SendWarningMessage(event); };
   result.get_remote_connection_info = [this]()
-  { return GetDialogRemoteConnectionInfo(*m_connection_service, this); };
+  { return GetDialogRemoteConnectionInfo(*m_remote_job_importer, this); };
+  result.get_profile_file_name = [this](ProfileFormat format)
+  {
+    const bool is_trace = format == ProfileFormat::kChromeTrace;
+    const auto file_name = QFileDialog::getSaveFileName(
+        this, "Export Profile", is_trace ? "profile.json" : "profile.folded",
+        is_trace ? "Chrome trace (*.json)" : "Collapsed stacks (*.folded *.txt)");
+    return file_name.toStdString();
+  };
   return result;
 }
 
+void OperationMonitorView::OnRemoteImportProgress(std::size_t completed_count,
+                                                  std::size_t total_count)
+{
+  if (m_remote_import_progress == nullptr)
+  {
+    auto dialog = new QProgressDialog("Importing remote jobs...", "Cancel", 0, 0, this);
+    dialog->setWindowModality(Qt::NonModal);
+    dialog->setMinimumDuration(kRemoteImportProgressDelay);
+    dialog->setAutoClose(false);
+    dialog->setAutoReset(false);
+
+    auto on_cancel = [this]()
+    {
+      m_action_handler->OnCancelRemoteImportRequest();
+      CloseRemoteImportProgress();
+    };
+    connect(dialog, &QProgressDialog::canceled, this, on_cancel);
+    m_remote_import_progress = dialog;
+  }
+
+  m_remote_import_progress->setMaximum(static_cast<int>(total_count));
+  m_remote_import_progress->setValue(static_cast<int>(completed_count));
+}
+
+void OperationMonitorView::CloseRemoteImportProgress()
+{
+  if (m_remote_import_progress != nullptr)
+  {
+    m_remote_import_progress->deleteLater();
+    m_remote_import_progress = nullptr;
+  }
+}
+
 QWidget* OperationMonitorView::CreateLeftPanel()
 {
   auto result = new sup::gui::ItemStackWidget;
@@ -24,7 +24,10 @@
 #include <oac_tree_gui/components/component_types.h>
 
 #include <QWidget>
+#include <cstddef>
+#include <memory>
 
+class QProgressDialog;
 class QSplitter;
 class QShowEvent;
 
@@ -48,6 +51,7 @@ class ProcedureItem;
 class OperationActionHandler;
 class OperationActionContext;
 class IRemoteConnectionService;
+class RemoteJobImporter;
 
 /**
  * @brief The OperationMonitorView class is the main window component to run sequences and monitor
@@ -59,8 +63,19 @@ class OperationMonitorView : public QWidget
   Q_OBJECT
 
 public:
+  /**
+   * @brief Main c-tor.
+   *
+   * @param command_service Service of global application commands.
+   * @param mode Presentation mode.
+   * @param user_response_file The file with rules to answer user input and choice requests
+   * without dialogs, empty name means interactive dialogs.
+   * @param parent_widget The parent widget.
+   */
   explicit OperationMonitorView(sup::gui::IAppCommandService& command_service,
-                                OperationPresentationMode mode, QWidget* parent_widget = nullptr);
+                                OperationPresentationMode mode,
+                                const QString& user_response_file = {},
+                                QWidget* parent_widget = nullptr);
   ~OperationMonitorView() override;
 
   OperationMonitorView(const OperationMonitorView&) = delete;
@@ -99,6 +114,16 @@ private:
   void OnJobSelected(oac_tree_gui::JobItem* item);
   OperationActionContext CreateOperationContext();
 
+  /**
+   * @brief Shows the progress of remote job import, the dialog is closed when import is over.
+   */
+  void OnRemoteImportProgress(std::size_t completed_count, std::size_t total_count);
+
+  /**
+   * @brief Closes the dialog with remote job import progress.
+   */
+  void CloseRemoteImportProgress();
+
   sup::gui::IAppCommandService& m_command_service;
 
   OperationPresentationMode m_presentation_mode;
@@ -118,6 +143,9 @@ private:
   ApplicationModels* m_models{nullptr};
 
   std::unique_ptr<IRemoteConnectionService> m_connection_service;
+  //! declared after the service, so its background tasks are over before the service is gone
+  std::unique_ptr<RemoteJobImporter> m_remote_job_importer;
+  QProgressDialog* m_remote_import_progress{nullptr};
   JobManager* m_job_manager{nullptr};
   OperationActionHandler* m_action_handler{nullptr};
 };
@@ -20,6 +20,7 @@
 
 #include "operation_realtime_panel.h"
 
+#include "aggregated_message_panel.h"
 #include "message_panel.h"
 #include "monitor_realtime_actions.h"
 #include "realtime_instruction_tree_widget.h"
@@ -56,6 +57,7 @@ OperationRealTimePanel::OperationRealTimePanel(QWidget* parent_widget)
     , m_collapsible_list(new sup::gui::CollapsibleListView(kCollapsibleListSettingName))
     , m_realtime_instruction_tree(new RealTimeInstructionTreeWidget)
     , m_message_panel(new MessagePanel)
+    , m_aggregated_message_panel(new AggregatedMessagePanel)
 {
   setWindowTitle("Operations");
 
@@ -67,6 +69,9 @@ OperationRealTimePanel::OperationRealTimePanel(QWidget* parent_widget)
 
   m_collapsible_list->AddCollapsibleWidget(m_message_panel, m_message_panel->actions());
 
+  m_collapsible_list->AddCollapsibleWidget(m_aggregated_message_panel,
+                                           m_aggregated_message_panel->actions());
+
   layout->addWidget(m_collapsible_list);
 
   SetupConnections();
@@ -85,7 +90,9 @@ void OperationRealTimePanel::SetCurrentJob(JobItem* job_item)
   if (job_item != nullptr)
   {
     m_realtime_instruction_tree->SetProcedure(job_item->GetExpandedProcedure());
-    m_actions->SetCurrentTickTimeout(job_item->GetTickTimeout().count());
+    const auto tick_timeout =
+        std::chrono::duration_cast<std::chrono::milliseconds>(job_item->GetTickTimeout());
+    m_actions->SetCurrentTickTimeout(static_cast<int>(tick_timeout.count()));
   }
   else
   {
@@ -98,11 +105,33 @@ void OperationRealTimePanel::SetSelectedInstructions(std::vector<InstructionItem
   m_realtime_instruction_tree->SetSelectedInstructions(items);
 }
 
+void OperationRealTimePanel::UpdateSelectedInstructions(
+    const std::vector<InstructionItem*>& added, const std::vector<InstructionItem*>& removed)
+{
+  m_realtime_instruction_tree->UpdateSelectedInstructions(added, removed);
+}
+
+void OperationRealTimePanel::SetInstructionProfileProvider(profile_provider_t provider)
+{
+  m_realtime_instruction_tree->SetInstructionProfileProvider(std::move(provider));
+}
+
+void OperationRealTimePanel::UpdateInstructionProfile(
+    const std::vector<InstructionItem*>& instructions)
+{
+  m_realtime_instruction_tree->UpdateInstructionProfile(instructions);
+}
+
 void OperationRealTimePanel::SetJobLog(JobLog* job_log)
 {
   m_message_panel->SetLog(job_log);
 }
 
+void OperationRealTimePanel::AddAggregatedJobLog(JobLog* job_log, const QString& job_name)
+{
+  m_aggregated_message_panel->AddLog(job_log, job_name);
+}
+
 int OperationRealTimePanel::GetCurrentTickTimeout()
 {
   return m_actions->GetCurrentTickTimeout();
@@ -136,6 +165,8 @@ void OperationRealTimePanel::SetupConnections()
 
   connect(m_realtime_instruction_tree, &RealTimeInstructionTreeWidget::ToggleBreakpointRequest,
           this, &OperationRealTimePanel::ToggleBreakpointRequest);
+  connect(m_realtime_instruction_tree, &RealTimeInstructionTreeWidget::ExportProfileRequest, this,
+          &OperationRealTimePanel::ExportProfileRequest);
   connect(m_actions, &MonitorRealTimeActions::ScrollToSelectionRequest, m_realtime_instruction_tree,
           &RealTimeInstructionTreeWidget::SetViewportFollowsSelectionFlag);
 }
@@ -21,6 +21,8 @@
 #ifndef OAC_TREE_GUI_VIEWS_OPERATION_OPERATION_REALTIME_PANEL_H_
 #define OAC_TREE_GUI_VIEWS_OPERATION_OPERATION_REALTIME_PANEL_H_
 
+#include <oac_tree_gui/operation/instruction_profile_helper.h>
+
 #include <QWidget>
 
 class QToolBar;
@@ -33,6 +35,7 @@ class CollapsibleListView;
 namespace oac_tree_gui
 {
 
+class AggregatedMessagePanel;
 class InstructionItem;
 class JobItem;
 class JobLog;
@@ -44,8 +47,8 @@ class SequencerModel;
 /**
  * @brief The OperationRealTimePanel class is a central panel of the OperationMonitorView.
  *
- * Contains a real-time instruction tree with start/step/stop control elements on the top, and log
- * panel at the bottom.
+ * Contains a real-time instruction tree with start/step/stop control elements on the top, log
+ * panel of the current job, and the log panel of all jobs at the bottom.
  */
 class OperationRealTimePanel : public QWidget
 {
@@ -64,8 +67,20 @@ public:
 
   void SetSelectedInstructions(std::vector<InstructionItem*> items);
 
+  void UpdateSelectedInstructions(const std::vector<InstructionItem*>& added,
+                                  const std::vector<InstructionItem*>& removed);
+
+  void SetInstructionProfileProvider(profile_provider_t provider);
+
+  void UpdateInstructionProfile(const std::vector<InstructionItem*>& instructions);
+
   void SetJobLog(JobLog* job_log);
 
+  /**
+   * @brief Adds the log of the job to the panel showing records of all jobs.
+   */
+  void AddAggregatedJobLog(JobLog* job_log, const QString& job_name);
+
   int GetCurrentTickTimeout();
 
 signals:
@@ -76,6 +91,7 @@ signals:
   void ResetRequest();
   void ChangeDelayRequest(int msec);
   void ToggleBreakpointRequest(oac_tree_gui::InstructionItem* instruction);
+  void ExportProfileRequest(oac_tree_gui::ProfileFormat format);
 
 private:
   void ReadSettings();
@@ -87,6 +103,7 @@ private:
   sup::gui::CollapsibleListView* m_collapsible_list{nullptr};
   RealTimeInstructionTreeWidget* m_realtime_instruction_tree{nullptr};
   MessagePanel* m_message_panel{nullptr};
+  AggregatedMessagePanel* m_aggregated_message_panel{nullptr};
 };
 
 }  // namespace oac_tree_gui
@@ -40,6 +40,7 @@
 
 #include <QEvent>
 #include <QHelpEvent>
+#include <QItemSelectionModel>
 #include <QMenu>
 #include <QSettings>
 #include <QToolTip>
@@ -49,7 +50,7 @@
 namespace
 {
 const QString kHeaderStateSettingName("RealTimeInstructionTreeWidget/header_state");
-const std::vector<int> kDefaultColumnStretch({15, 5, 1});
+const std::vector<int> kDefaultColumnStretch({15, 5, 1, 2, 2, 2, 2});
 
 QString GetCustomToolTipStyle()
 {
@@ -118,6 +119,7 @@ void RealTimeInstructionTreeWidget::SetProcedure(ProcedureItem* procedure_item)
 
   m_component_provider->SetItem(container);
   m_expand_controller->SetInstructionContainer(container);
+  m_expand_controller->SaveSelectionRequest({});
 
   if (procedure_item != nullptr)
   {
@@ -133,12 +135,32 @@ void RealTimeInstructionTreeWidget::SetSelectedInstructions(std::vector<Instruct
   ScrollViewportToSelection();
 }
 
+void RealTimeInstructionTreeWidget::UpdateSelectedInstructions(
+    const std::vector<InstructionItem*>& added, const std::vector<InstructionItem*>& removed)
+{
+  const auto change = m_expand_controller->UpdateSelectionRequest(added, removed);
+  ChangeSelection(change.to_deselect, false);
+  ChangeSelection(change.to_select, true);
+  ScrollViewportToItems(change.to_select);
+}
+
 void RealTimeInstructionTreeWidget::SetViewportFollowsSelectionFlag(bool value)
 {
   m_viewport_follows_selection = value;
   ScrollViewportToSelection();
 }
 
+void RealTimeInstructionTreeWidget::SetInstructionProfileProvider(profile_provider_t provider)
+{
+  GetViewModel()->SetProfileProvider(std::move(provider));
+}
+
+void RealTimeInstructionTreeWidget::UpdateInstructionProfile(
+    const std::vector<InstructionItem*>& instructions)
+{
+  GetViewModel()->UpdateProfile(instructions);
+}
+
 bool RealTimeInstructionTreeWidget::event(QEvent* event)
 {
   if (event->type() == QEvent::ToolTip)
@@ -191,18 +213,39 @@ void RealTimeInstructionTreeWidget::OnCustomContextMenuRequested(const QPoint& p
 
   auto on_action = [this]() { m_expand_controller->SetTreeViewToInstructionExpandState(); };
   QObject::connect(selective_expand_action, &QAction::triggered, this, on_action);
+  menu.addSeparator();
+
+  // setting menu to export execution times of instructions
+  auto collapsed_stack_action = menu.addAction("Export profile as collapsed stacks...");
+  collapsed_stack_action->setToolTip("Save self times of instructions for flame graph tools");
+  collapsed_stack_action->setEnabled(m_procedure != nullptr);
+  QObject::connect(collapsed_stack_action, &QAction::triggered, this,
+                   [this]() { emit ExportProfileRequest(ProfileFormat::kCollapsedStack); });
+
+  auto chrome_trace_action = menu.addAction("Export profile as Chrome trace...");
+  chrome_trace_action->setToolTip(
+      "Save timeline of instruction executions for chrome://tracing and Perfetto");
+  chrome_trace_action->setEnabled(m_procedure != nullptr);
+  QObject::connect(chrome_trace_action, &QAction::triggered, this,
+                   [this]() { emit ExportProfileRequest(ProfileFormat::kChromeTrace); });
 
   menu.exec(m_tree_view->mapToGlobal(pos));
 }
 
 void RealTimeInstructionTreeWidget::ScrollViewportToSelection()
 {
-  if (!m_viewport_follows_selection)
+  ScrollViewportToItems(m_component_provider->GetSelectedItems());
+}
+
+void RealTimeInstructionTreeWidget::ScrollViewportToItems(
+    const std::vector<mvvm::SessionItem*>& items)
+{
+  if (!m_viewport_follows_selection || items.empty())
   {
     return;
   }
 
-  auto filtered = sup::gui::GetBottomLevelSelection(m_component_provider->GetSelectedItems());
+  auto filtered = sup::gui::GetBottomLevelSelection(items);
   if (!filtered.empty())
   {
     auto indexes = m_component_provider->GetViewIndexes(filtered.front());
@@ -210,4 +253,30 @@ void RealTimeInstructionTreeWidget::ScrollViewportToSelection()
   }
 }
 
+void RealTimeInstructionTreeWidget::ChangeSelection(const std::vector<mvvm::SessionItem*>& items,
+                                                    bool is_selected)
+{
+  if (items.empty())
+  {
+    return;
+  }
+
+  QItemSelection selection;
+  for (auto item : items)
+  {
+    for (const auto& index : m_component_provider->GetViewIndexes(item))
+    {
+      selection.select(index, index);
+    }
+  }
+
+  const auto flags = is_selected ? QItemSelectionModel::Select : QItemSelectionModel::Deselect;
+  m_tree_view->selectionModel()->select(selection, flags);
+}
+
+InstructionOperationViewModel* RealTimeInstructionTreeWidget::GetViewModel() const
+{
+  return static_cast<InstructionOperationViewModel*>(m_component_provider->GetViewModel());
+}
+
 }  // namespace oac_tree_gui
@@ -21,6 +21,8 @@
 #ifndef OAC_TREE_GUI_VIEWS_OPERATION_REALTIME_INSTRUCTION_TREE_WIDGET_H_
 #define OAC_TREE_GUI_VIEWS_OPERATION_REALTIME_INSTRUCTION_TREE_WIDGET_H_
 
+#include <oac_tree_gui/operation/instruction_profile_helper.h>
+
 #include <QWidget>
 #include <memory>
 
@@ -30,7 +32,8 @@ class QAction;
 namespace mvvm
 {
 class ItemViewComponentProvider;
-}
+class SessionItem;
+}  // namespace mvvm
 
 namespace sup::gui
 {
@@ -44,6 +47,7 @@ class ProcedureItem;
 class InstructionItem;
 class BreakpointModelDelegate;
 class InstructionTreeExpandController;
+class InstructionOperationViewModel;
 
 //! Widget with expanded instruction tree for realtime job execution.
 //! Located at the central panel of SequencerMonitorView.
@@ -65,13 +69,32 @@ public:
 
   void SetSelectedInstructions(std::vector<InstructionItem*> items);
 
+  /**
+   * @brief Updates current selection with instructions which became active, or stopped being
+   * active.
+   */
+  void UpdateSelectedInstructions(const std::vector<InstructionItem*>& added,
+                                  const std::vector<InstructionItem*>& removed);
+
   /**
    * @brief Makes tree viewport follow currently selected instruction.
    */
   void SetViewportFollowsSelectionFlag(bool value);
 
+  /**
+   * @brief Sets the callback to find execution profile of the instruction, shown in profile
+   * columns.
+   */
+  void SetInstructionProfileProvider(profile_provider_t provider);
+
+  /**
+   * @brief Refreshes profile columns of given instructions.
+   */
+  void UpdateInstructionProfile(const std::vector<InstructionItem*>& instructions);
+
 signals:
   void ToggleBreakpointRequest(oac_tree_gui::InstructionItem* instruction);
+  void ExportProfileRequest(oac_tree_gui::ProfileFormat format);
 
 protected:
   bool event(QEvent* event) override;
@@ -86,6 +109,18 @@ private:
    */
   void ScrollViewportToSelection();
 
+  /**
+   * @brief Scrolls tree viewport to the bottom-most of the given items.
+   */
+  void ScrollViewportToItems(const std::vector<mvvm::SessionItem*>& items);
+
+  /**
+   * @brief Selects or deselects given items in the tree, leaving other items as they are.
+   */
+  void ChangeSelection(const std::vector<mvvm::SessionItem*>& items, bool is_selected);
+
+  InstructionOperationViewModel* GetViewModel() const;
+
   QTreeView* m_tree_view{nullptr};
   std::unique_ptr<mvvm::ItemViewComponentProvider> m_component_provider;
   sup::gui::CustomHeaderView* m_custom_header{nullptr};
@@ -21,15 +21,13 @@
 #include "remote_connection_dialog.h"
 
 #include <oac_tree_gui/core/exceptions.h>
-#include <oac_tree_gui/jobsystem/i_automation_client.h>
+#include <oac_tree_gui/jobsystem/objects/remote_job_importer.h>
 #include <oac_tree_gui/jobsystem/remote_connection_info.h>
-#include <oac_tree_gui/jobsystem/remote_connection_service.h>
 
 #include <sup/gui/widgets/dialog_helper.h>
 
 #include <mvvm/style/mvvm_style_helper.h>
 
-#include <QApplication>
 #include <QDebug>
 #include <QHBoxLayout>
 #include <QItemSelectionModel>
@@ -63,18 +61,18 @@ std::unique_ptr<QStandardItem> CreateItem(const std::string& name)
 
 }  // namespace
 
-RemoteConnectionDialog::RemoteConnectionDialog(IRemoteConnectionService* connection_service,
+RemoteConnectionDialog::RemoteConnectionDialog(RemoteJobImporter* importer,
                                                QWidget* parent_widget)
     : QDialog(parent_widget)
     , m_server_name_line_edit(new QLineEdit)
     , m_connect_button(new QPushButton("Connect"))
     , m_job_list_view(new QListView)
     , m_job_info_model(new QStandardItemModel(this))
-    , m_connection_service(connection_service)
+    , m_importer(importer)
 {
-  if (m_connection_service == nullptr)
+  if (m_importer == nullptr)
   {
-    throw RuntimeException("Uninitialized server");
+    throw RuntimeException("Uninitialized importer");
   }
 
   setWindowTitle("Connect to server");
@@ -98,6 +96,10 @@ RemoteConnectionDialog::RemoteConnectionDialog(IRemoteConnectionService* connect
   connect(m_server_name_line_edit, &QLineEdit::returnPressed, this,
           &RemoteConnectionDialog::OnConnectRequest);
 
+  connect(m_importer, &RemoteJobImporter::Connected, this, &RemoteConnectionDialog::OnConnected);
+  connect(m_importer, &RemoteJobImporter::ConnectionFailed, this,
+          &RemoteConnectionDialog::OnConnectionFailed);
+
   ReadSettings();
 }
 
@@ -133,19 +135,59 @@ void RemoteConnectionDialog::keyPressEvent(QKeyEvent* event)
 
 void RemoteConnectionDialog::OnConnectRequest()
 {
-  setCursor(Qt::WaitCursor);
-  QApplication::processEvents();
-
-  // TODO establish connection in a thread with possibility to cancel hanging
   const auto server_name = m_server_name_line_edit->text().toStdString();
-  if (auto is_connected = m_connection_service->Connect(server_name); is_connected)
+  if (server_name.empty() || !m_requested_server_name.empty())
+  {
+    return;
+  }
+
+  // the result arrives via Connected or ConnectionFailed signals
+  m_requested_server_name = server_name;
+  SetConnectionInProgress(true);
+  m_importer->Connect(server_name);
+}
+
+void RemoteConnectionDialog::OnConnected(const std::string& server_name,
+                                         const std::vector<std::string>& procedure_names)
+{
+  if (server_name != m_requested_server_name)
+  {
+    return;  // connection requested by somebody else
+  }
+
+  PopulateJobInfoModel(procedure_names);
+  m_current_server_name = server_name;
+  SetConnectionInProgress(false);
+}
+
+void RemoteConnectionDialog::OnConnectionFailed(const std::string& server_name,
+                                                const std::string& message)
+{
+  if (server_name != m_requested_server_name)
   {
-    PopulateJobInfoModel(server_name);
-    m_current_server_name = server_name;
+    return;
   }
 
-  unsetCursor();
-  QApplication::processEvents();
+  qWarning() << "Can't connect to" << QString::fromStdString(server_name)
+             << QString::fromStdString(message);
+  m_job_info_model->clear();
+  m_current_server_name.clear();
+  SetConnectionInProgress(false);
+}
+
+void RemoteConnectionDialog::SetConnectionInProgress(bool value)
+{
+  if (value)
+  {
+    setCursor(Qt::BusyCursor);
+  }
+  else
+  {
+    m_requested_server_name.clear();
+    unsetCursor();
+  }
+  m_connect_button->setEnabled(!value);
+  m_server_name_line_edit->setReadOnly(value);
 }
 
 std::unique_ptr<QHBoxLayout> RemoteConnectionDialog::CreateConnectLayout()
@@ -169,23 +211,21 @@ void RemoteConnectionDialog::WriteSettings()
   settings.setValue(kWindowSizeSettingName, size());
 }
 
-void RemoteConnectionDialog::PopulateJobInfoModel(const std::string& server_name)
+void RemoteConnectionDialog::PopulateJobInfoModel(const std::vector<std::string>& procedure_names)
 {
   m_job_info_model->clear();
 
   auto parent_item = m_job_info_model->invisibleRootItem();
-  auto& client = m_connection_service->GetAutomationClient(server_name);
-  for (std::size_t job_index = 0; job_index < client.GetJobCount(); ++job_index)
+  for (const auto& procedure_name : procedure_names)
   {
-    auto procedure_name = client.GetProcedureName(job_index);
     parent_item->appendRow(CreateItem(procedure_name).release());
   }
 }
 
-std::optional<RemoteConnectionInfo> GetDialogRemoteConnectionInfo(
-    IRemoteConnectionService& connection_service, QWidget* parent)
+std::optional<RemoteConnectionInfo> GetDialogRemoteConnectionInfo(RemoteJobImporter& importer,
+                                                                  QWidget* parent)
 {
-  RemoteConnectionDialog dialog(&connection_service, parent);
+  RemoteConnectionDialog dialog(&importer, parent);
 
   if (dialog.exec() == QDialog::Accepted)
   {
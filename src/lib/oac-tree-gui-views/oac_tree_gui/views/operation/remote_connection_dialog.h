@@ -24,6 +24,8 @@
 #include <QDialog>
 #include <memory>
 #include <optional>
+#include <string>
+#include <vector>
 
 class QListView;
 class QLineEdit;
@@ -34,20 +36,22 @@ class QHBoxLayout;
 namespace oac_tree_gui
 {
 
-class IRemoteConnectionService;
+class RemoteJobImporter;
 struct RemoteConnectionInfo;
 
 /**
  * @brief The RemoteConnectionDialog class is a modal dialog to connect with remote server and
  * import jobs.
+ *
+ * The connection is established by the importer in the background, the dialog stays responsive
+ * while the server is slow or unreachable.
  */
 class RemoteConnectionDialog : public QDialog
 {
   Q_OBJECT
 
 public:
-  explicit RemoteConnectionDialog(IRemoteConnectionService* connection_service,
-                                  QWidget* parent_widget = nullptr);
+  explicit RemoteConnectionDialog(RemoteJobImporter* importer, QWidget* parent_widget = nullptr);
   ~RemoteConnectionDialog() override;
 
   RemoteConnectionDialog(const RemoteConnectionDialog&) = delete;
@@ -65,10 +69,26 @@ protected:
 
 private:
   /**
-   * @brief Connect to the server as specified in server name field and show existing jobs.
+   * @brief Starts connection to the server as specified in server name field.
    */
   void OnConnectRequest();
 
+  /**
+   * @brief Shows jobs of the connected server.
+   */
+  void OnConnected(const std::string& server_name,
+                   const std::vector<std::string>& procedure_names);
+
+  /**
+   * @brief Shows the reason of the failed connection.
+   */
+  void OnConnectionFailed(const std::string& server_name, const std::string& message);
+
+  /**
+   * @brief Disables connection controls while the connection is in progress.
+   */
+  void SetConnectionInProgress(bool value);
+
   /**
    * @brief Creates layout with server name field and connect button.
    */
@@ -87,15 +107,16 @@ private:
   /**
    * @brief Populates the model with information about remote jobs.
    */
-  void PopulateJobInfoModel(const std::string& server_name);
+  void PopulateJobInfoModel(const std::vector<std::string>& procedure_names);
 
   QLineEdit* m_server_name_line_edit{nullptr};
   QPushButton* m_connect_button{nullptr};
   QListView* m_job_list_view{nullptr};
   QStandardItemModel* m_job_info_model{nullptr};
 
-  IRemoteConnectionService* m_connection_service{nullptr};
+  RemoteJobImporter* m_importer{nullptr};
   std::string m_current_server_name;
+  std::string m_requested_server_name;  //!< server name of the connection in progress
 };
 
 /**
@@ -103,11 +124,11 @@ private:
  *
  * The optional result can be empty, if dialog was canceled by the user.
  *
- * @param connection_service The main service to use fo connection.
+ * @param importer The importer to use for connection.
  * @return Optional result of the user choice.
  */
-std::optional<RemoteConnectionInfo> GetDialogRemoteConnectionInfo(
-    IRemoteConnectionService& connection_service, QWidget* parent = nullptr);
+std::optional<RemoteConnectionInfo> GetDialogRemoteConnectionInfo(RemoteJobImporter& importer,
+                                                                  QWidget* parent = nullptr);
 
 }  // namespace oac_tree_gui
 
@@ -45,6 +45,16 @@ std::string AutomationClientDecorator::GetProcedureName(std::uint32_t job_index)
   return m_decoratee.GetProcedureName(job_index);
 }
 
+void AutomationClientDecorator::PrepareJob(std::uint32_t job_index)
+{
+  m_decoratee.PrepareJob(job_index);
+}
+
+void AutomationClientDecorator::DiscardPreparedJob(std::uint32_t job_index)
+{
+  m_decoratee.DiscardPreparedJob(job_index);
+}
+
 std::unique_ptr<oac_tree_gui::AbstractJobHandler> AutomationClientDecorator::CreateJobHandler(
     oac_tree_gui::RemoteJobItem *job_item, const oac_tree_gui::UserContext &user_context)
 {
@@ -39,6 +39,8 @@ public:
   MOCK_METHOD(std::string, GetServerName, (), (const, override));
   MOCK_METHOD(std::size_t, GetJobCount, (), (const, override));
   MOCK_METHOD(std::string, GetProcedureName, (std::uint32_t), (const, override));
+  MOCK_METHOD(void, PrepareJob, (std::uint32_t), (override));
+  MOCK_METHOD(void, DiscardPreparedJob, (std::uint32_t), (override));
   MOCK_METHOD(std::unique_ptr<oac_tree_gui::AbstractJobHandler>, CreateJobHandler,
               (oac_tree_gui::RemoteJobItem*, const oac_tree_gui::UserContext&), (override));
 };
@@ -61,6 +63,10 @@ public:
 
   std::string GetProcedureName(std::uint32_t job_index) const override;
 
+  void PrepareJob(std::uint32_t job_index) override;
+
+  void DiscardPreparedJob(std::uint32_t job_index) override;
+
   std::unique_ptr<oac_tree_gui::AbstractJobHandler> CreateJobHandler(
       oac_tree_gui::RemoteJobItem* job_item,
       const oac_tree_gui::UserContext& user_context) override;
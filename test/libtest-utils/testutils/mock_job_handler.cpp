@@ -78,4 +78,9 @@ oac_tree_gui::ProcedureItem *MockJobHandler::GetExpandedProcedure() const
   return m_listener.GetExpandedProcedure(this);
 }
 
+oac_tree_gui::DomainEventStatistics MockJobHandler::GetEventStatistics() const
+{
+  return m_listener.GetEventStatistics(this);
+}
+
 }  // namespace oac_tree_gui::test
@@ -53,6 +53,8 @@ public:
               (oac_tree_gui::InstructionItem*, const oac_tree_gui::IJobHandler*), ());
   MOCK_METHOD(oac_tree_gui::ProcedureItem*, GetExpandedProcedure,
               (const oac_tree_gui::IJobHandler*), (const));
+  MOCK_METHOD(oac_tree_gui::DomainEventStatistics, GetEventStatistics,
+              (const oac_tree_gui::IJobHandler*), (const));
 };
 
 /**
@@ -92,6 +94,8 @@ public:
 
   oac_tree_gui::ProcedureItem* GetExpandedProcedure() const override;
 
+  oac_tree_gui::DomainEventStatistics GetEventStatistics() const override;
+
   MockJobHandlerListener& m_listener;
   oac_tree_gui::JobItem* m_job_item{nullptr};
 };
@@ -29,6 +29,7 @@ OperationActionContext MockOperationActionContext::CreateContext()
   result.selected_job = [this]() { return OnSelectedJob(); };
   result.send_message = [this](const auto& message) { OnMessage(message); };
   result.get_remote_connection_info = [this]() { return OnGetRemoteConnectionInfo(); };
+  result.get_profile_file_name = [this](auto format) { return OnGetProfileFileName(format); };
   return result;
 }
 
@@ -0,0 +1,163 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "benchmark_utils.h"
+
+#include <oac_tree_gui/domain/domain_constants.h>
+#include <oac_tree_gui/model/instruction_container_item.h>
+#include <oac_tree_gui/model/procedure_item.h>
+#include <oac_tree_gui/model/standard_instruction_items.h>
+#include <oac_tree_gui/model/standard_variable_items.h>
+#include <oac_tree_gui/model/universal_item_helper.h>
+#include <oac_tree_gui/model/workspace_item.h>
+#include <oac_tree_gui/transform/anyvalue_item_transform_helper.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+namespace oac_tree_gui::test
+{
+
+std::size_t GetResidentMemoryKb()
+{
+  // second field of statm is the number of resident pages
+  std::ifstream statm("/proc/self/statm");
+  std::size_t total_pages{0};
+  std::size_t resident_pages{0};
+  if (!(statm >> total_pages >> resident_pages))
+  {
+    return 0;
+  }
+
+  const auto kBytesPerKb = 1024;
+  return resident_pages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE)) / kBytesPerKb;
+}
+
+std::vector<domain_event_t> CreateSyntheticEvents(std::size_t event_count,
+                                                  std::size_t instruction_count,
+                                                  std::size_t variable_count)
+{
+  using sup::oac_tree::ExecutionStatus;
+  using sup::oac_tree::InstructionState;
+
+  std::vector<domain_event_t> result;
+  result.reserve(event_count);
+
+  std::size_t step{0};
+  while (result.size() < event_count)
+  {
+    const std::size_t instruction_index = step % instruction_count;
+    result.emplace_back(InstructionStateUpdatedEvent{
+        instruction_index, InstructionState{false, ExecutionStatus::NOT_FINISHED}});
+
+    if (variable_count > 0 && step % 2 == 0)
+    {
+      const auto value = sup::dto::AnyValue{sup::dto::SignedInteger32Type, static_cast<int>(step)};
+      result.emplace_back(VariableUpdatedEvent{step % variable_count, value, true});
+    }
+
+    if (step % 10 == 0)
+    {
+      result.emplace_back(CreateLogEvent(Severity::kInfo, "Synthetic message"));
+    }
+
+    result.emplace_back(InstructionStateUpdatedEvent{
+        instruction_index, InstructionState{false, ExecutionStatus::SUCCESS}});
+    ++step;
+  }
+
+  result.resize(event_count);
+  return result;
+}
+
+std::unique_ptr<ProcedureItem> CreateSequenceProcedureItem(std::size_t instruction_count,
+                                                           bool with_variables)
+{
+  auto result = std::make_unique<ProcedureItem>();
+  auto sequence =
+      result->GetInstructionContainer()->InsertItem<SequenceItem>(mvvm::TagIndex::Append());
+  for (std::size_t index = 0; index < instruction_count; ++index)
+  {
+    if (with_variables && index % 2 == 1)
+    {
+      auto copy = InsertInstruction(domainconstants::kCopyInstructionType, sequence);
+      SetInput("var0", copy);
+      SetOutput("var1", copy);
+    }
+    else
+    {
+      auto wait = sequence->InsertItem<WaitItem>(mvvm::TagIndex::Append());
+      wait->SetTimeout(0.0);
+    }
+  }
+
+  if (with_variables)
+  {
+    for (const auto* name : {"var0", "var1"})
+    {
+      auto variable =
+          result->GetWorkspace()->InsertItem<LocalVariableItem>(mvvm::TagIndex::Append());
+      variable->SetName(name);
+      SetAnyValue(sup::dto::AnyValue{sup::dto::SignedInteger32Type, 42}, *variable);
+    }
+  }
+
+  return result;
+}
+
+RateLimiter::RateLimiter(std::size_t events_per_second)
+    : m_events_per_second(events_per_second), m_start_time(std::chrono::steady_clock::now())
+{
+}
+
+void RateLimiter::Wait(std::size_t produced_event_count)
+{
+  if (m_events_per_second == 0)
+  {
+    return;
+  }
+
+  const std::chrono::duration<double> offset(static_cast<double>(produced_event_count)
+                                             / static_cast<double>(m_events_per_second));
+  std::this_thread::sleep_until(
+      m_start_time + std::chrono::duration_cast<std::chrono::steady_clock::duration>(offset));
+}
+
+void SetEventCounters(benchmark::State& state, std::size_t event_count,
+                      std::size_t initial_memory_kb)
+{
+  state.SetItemsProcessed(static_cast<std::int64_t>(event_count));
+
+  // average time per event, reported in seconds
+  state.counters["time_per_event"] =
+      benchmark::Counter(static_cast<double>(event_count),
+                         benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+
+  const auto memory_kb = GetResidentMemoryKb();
+  state.counters["memory_growth_kb"] =
+      memory_kb > initial_memory_kb ? static_cast<double>(memory_kb - initial_memory_kb) : 0.0;
+}
+
+}  // namespace oac_tree_gui::test
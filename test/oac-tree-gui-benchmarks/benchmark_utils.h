@@ -0,0 +1,109 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#ifndef OAC_TREE_GUI_BENCHMARKS_BENCHMARK_UTILS_H_
+#define OAC_TREE_GUI_BENCHMARKS_BENCHMARK_UTILS_H_
+
+//! @file
+//! Collection of utilities to generate synthetic load for job event pipeline benchmarks.
+
+#include <oac_tree_gui/jobsystem/domain_events.h>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace oac_tree_gui
+{
+class ProcedureItem;
+}
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Returns resident set size of the current process in kilobytes, or 0 if unknown.
+ */
+std::size_t GetResidentMemoryKb();
+
+/**
+ * @brief Creates a sequence of synthetic domain events, as they would come from a running
+ * procedure.
+ *
+ * Each instruction reports NOT_FINISHED and SUCCESS states, every second instruction updates one
+ * of the variables, every tenth instruction reports a log message.
+ *
+ * @param event_count Total number of events.
+ * @param instruction_count Number of instructions in the procedure.
+ * @param variable_count Number of variables in the workspace.
+ */
+std::vector<domain_event_t> CreateSyntheticEvents(std::size_t event_count,
+                                                  std::size_t instruction_count,
+                                                  std::size_t variable_count);
+
+/**
+ * @brief Creates procedure with a sequence of the given number of zero-timeout instructions.
+ *
+ * @param instruction_count Number of instructions in the sequence.
+ * @param with_variables Every second wait is replaced with a copy between two local variables.
+ */
+std::unique_ptr<ProcedureItem> CreateSequenceProcedureItem(std::size_t instruction_count,
+                                                           bool with_variables);
+
+/**
+ * @brief The RateLimiter class helps synthetic producer to keep the given rate.
+ */
+class RateLimiter
+{
+public:
+  /**
+   * @brief Main c-tor.
+   *
+   * @param events_per_second Required rate, 0 means no limit.
+   */
+  explicit RateLimiter(std::size_t events_per_second);
+
+  /**
+   * @brief Waits if the producer is ahead of the schedule.
+   */
+  void Wait(std::size_t produced_event_count);
+
+private:
+  std::size_t m_events_per_second{0};
+  std::chrono::steady_clock::time_point m_start_time;
+};
+
+/**
+ * @brief Sets standard counters describing throughput and memory growth.
+ *
+ * @param state Benchmark state.
+ * @param event_count Number of events processed in all iterations.
+ * @param initial_memory_kb Resident memory at the start of the benchmark.
+ */
+void SetEventCounters(benchmark::State& state, std::size_t event_count,
+                      std::size_t initial_memory_kb);
+
+}  // namespace oac_tree_gui::test
+
+#endif  // OAC_TREE_GUI_BENCHMARKS_BENCHMARK_UTILS_H_
@@ -0,0 +1,93 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+
+#include "benchmark_utils.h"
+
+#include <oac_tree_gui/jobsystem/domain_event_dispatcher_context.h>
+#include <oac_tree_gui/jobsystem/objects/domain_event_dispatcher.h>
+
+#include <benchmark/benchmark.h>
+
+namespace oac_tree_gui::test
+{
+
+namespace
+{
+
+const std::size_t kVariableCount = 10;
+
+/**
+ * @brief Creates dispatcher context with handlers counting processed events.
+ */
+DomainEventDispatcherContext CreateCountingContext(std::size_t& counter)
+{
+  DomainEventDispatcherContext result;
+  result.process_instruction_state_updated = [&counter](const auto&) { ++counter; };
+  result.process_variable_updated = [&counter](const auto&) { ++counter; };
+  result.process_job_state_changed = [&counter](const auto&) { ++counter; };
+  result.process_log_event = [&counter](const auto&) { ++counter; };
+  result.active_instruction_changed_event = [&counter](const auto&) { ++counter; };
+  result.breakpoint_hit_updated = [&counter](const auto&) { ++counter; };
+  return result;
+}
+
+}  // namespace
+
+/**
+ * @brief Dispatches a batch of synthetic events through no-op handlers.
+ *
+ * Measures the cost of the GUI side of the pipeline: fetching, optional conflation and dispatch.
+ * Arguments: number of instructions in the procedure, conflation enabled.
+ */
+void BM_EventDispatcher(benchmark::State& state)
+{
+  const auto instruction_count = static_cast<std::size_t>(state.range(0));
+  const bool conflation_enabled = state.range(1) != 0;
+  const std::size_t batch_size = 10000;
+  const auto events = CreateSyntheticEvents(batch_size, instruction_count, kVariableCount);
+  const auto initial_memory_kb = GetResidentMemoryKb();
+
+  std::size_t position{0};
+  auto get_event = [&events, &position]() -> domain_event_t
+  { return position < events.size() ? events[position++] : domain_event_t{}; };
+
+  std::size_t applied_event_count{0};
+  DomainEventDispatcher dispatcher(get_event, CreateCountingContext(applied_event_count));
+  dispatcher.SetConflationEnabled(conflation_enabled);
+  dispatcher.SetDispatchBudget(0, std::chrono::milliseconds(0));
+
+  std::size_t event_count{0};
+  for (auto _ : state)
+  {
+    position = 0;
+    dispatcher.ProcessEvents();
+    event_count += events.size();
+  }
+
+  SetEventCounters(state, event_count, initial_memory_kb);
+  state.counters["applied_events"] = benchmark::Counter(static_cast<double>(applied_event_count),
+                                                       benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_EventDispatcher)
+    ->ArgNames({"instructions", "conflation"})
+    ->ArgsProduct({{10, 100, 1000}, {0, 1}});
+
+}  // namespace oac_tree_gui::test
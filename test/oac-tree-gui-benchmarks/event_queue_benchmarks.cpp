@@ -0,0 +1,152 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "benchmark_utils.h"
+
+#include <oac_tree_gui/jobsystem/objects/domain_event_queue.h>
+
+#include <benchmark/benchmark.h>
+
+#include <thread>
+
+namespace oac_tree_gui::test
+{
+
+namespace
+{
+
+const std::size_t kInstructionCount = 100;
+const std::size_t kVariableCount = 10;
+
+/**
+ * @brief Returns queue options for the given overflow policy index.
+ */
+DomainEventQueueOptions CreateOptions(std::int64_t policy_index, ProducerMode producer_mode)
+{
+  DomainEventQueueOptions result;
+  result.producer_mode = producer_mode;
+  result.overflow_policy = static_cast<OverflowPolicy>(policy_index);
+  return result;
+}
+
+}  // namespace
+
+/**
+ * @brief Pushes a batch of events and pops them back in the same thread.
+ *
+ * Measures the bare cost of the transport.
+ */
+void BM_EventQueuePushPop(benchmark::State& state)
+{
+  const auto batch_size = static_cast<std::size_t>(state.range(0));
+  const auto events = CreateSyntheticEvents(batch_size, kInstructionCount, kVariableCount);
+  const auto initial_memory_kb = GetResidentMemoryKb();
+
+  DomainEventQueue queue(CreateOptions(static_cast<std::int64_t>(OverflowPolicy::kConflate),
+                                       ProducerMode::kSingle));
+
+  std::size_t event_count{0};
+  for (auto _ : state)
+  {
+    for (const auto& event : events)
+    {
+      queue.PushEvent(event);
+    }
+    while (queue.GetEventCount() > 0)
+    {
+      benchmark::DoNotOptimize(queue.TryPopEvent());
+    }
+    event_count += events.size();
+  }
+
+  SetEventCounters(state, event_count, initial_memory_kb);
+}
+BENCHMARK(BM_EventQueuePushPop)->Arg(1024)->Arg(4096);
+
+/**
+ * @brief Sequencer thread produces events with the given rate while the benchmark thread plays the
+ * role of the GUI thread and consumes them.
+ *
+ * Arguments: overflow policy, events per second (0 means as fast as possible).
+ */
+void BM_EventQueueProducerConsumer(benchmark::State& state)
+{
+  const auto policy_index = state.range(0);
+  const auto events_per_second = static_cast<std::size_t>(state.range(1));
+  const std::size_t batch_size = 10000;
+  const auto events = CreateSyntheticEvents(batch_size, kInstructionCount, kVariableCount);
+  const auto initial_memory_kb = GetResidentMemoryKb();
+
+  std::size_t consumed_event_count{0};
+  std::size_t dropped_event_count{0};
+  for (auto _ : state)
+  {
+    DomainEventQueue queue(CreateOptions(policy_index, ProducerMode::kSingle));
+
+    std::thread producer(
+        [&queue, &events, events_per_second]()
+        {
+          RateLimiter limiter(events_per_second);
+          std::size_t produced_event_count{0};
+          for (const auto& event : events)
+          {
+            limiter.Wait(produced_event_count++);
+            queue.PushEvent(event);
+          }
+          queue.PushEvent(JobStateChangedEvent{sup::oac_tree::JobState::kSucceeded});
+        });
+
+    // consume until the terminal event
+    bool is_finished{false};
+    while (!is_finished)
+    {
+      auto event = queue.TryPopEvent();
+      if (!IsValid(event))
+      {
+        std::this_thread::yield();
+        continue;
+      }
+      is_finished = std::holds_alternative<JobStateChangedEvent>(event);
+      ++consumed_event_count;
+    }
+
+    producer.join();
+
+    // conflating policy may keep a few events in the queue
+    while (IsValid(queue.TryPopEvent()))
+    {
+      ++consumed_event_count;
+    }
+    dropped_event_count += queue.GetDroppedEventCount();
+  }
+
+  SetEventCounters(state, consumed_event_count, initial_memory_kb);
+  state.counters["dropped_events"] = static_cast<double>(dropped_event_count);
+}
+BENCHMARK(BM_EventQueueProducerConsumer)
+    ->ArgNames({"policy", "rate"})
+    ->ArgsProduct({{static_cast<std::int64_t>(OverflowPolicy::kBlock),
+                    static_cast<std::int64_t>(OverflowPolicy::kDropOldest),
+                    static_cast<std::int64_t>(OverflowPolicy::kConflate)},
+                   {0, 100000}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace oac_tree_gui::test
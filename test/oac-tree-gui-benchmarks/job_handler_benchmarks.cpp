@@ -0,0 +1,119 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+
+#include "benchmark_utils.h"
+
+#include <oac_tree_gui/jobsystem/domain_event_statistics.h>
+#include <oac_tree_gui/jobsystem/objects/local_job_handler.h>
+#include <oac_tree_gui/jobsystem/user_context.h>
+#include <oac_tree_gui/model/application_models.h>
+#include <oac_tree_gui/model/job_model.h>
+#include <oac_tree_gui/model/procedure_item.h>
+#include <oac_tree_gui/model/runner_status.h>
+#include <oac_tree_gui/model/sequencer_model.h>
+#include <oac_tree_gui/model/standard_job_items.h>
+
+#include <mvvm/standarditems/container_item.h>
+
+#include <benchmark/benchmark.h>
+
+#include <QTest>
+
+namespace oac_tree_gui::test
+{
+
+namespace
+{
+
+/**
+ * @brief Returns total number of events applied by the job handler.
+ */
+std::size_t GetAppliedEventCount(const DomainEventStatistics& statistics)
+{
+  std::size_t result{0};
+  for (const auto& event_type : statistics.event_types)
+  {
+    result += event_type.event_count;
+  }
+  return result;
+}
+
+}  // namespace
+
+/**
+ * @brief Runs a procedure end-to-end with LocalJobHandler, from the sequencer thread to the GUI
+ * models.
+ *
+ * Iteration completes when the procedure has finished and all its events were applied to the
+ * JobItem. Arguments: number of instructions in the procedure, variable updates enabled.
+ */
+void BM_LocalJobHandlerRun(benchmark::State& state)
+{
+  const auto instruction_count = static_cast<std::size_t>(state.range(0));
+  const bool with_variables = state.range(1) != 0;
+  const std::chrono::seconds timeout(60);
+  const auto initial_memory_kb = GetResidentMemoryKb();
+
+  std::size_t event_count{0};
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    ApplicationModels models;
+    models.CreateEmpty();
+    auto sequencer_model = models.GetSequencerModel();
+    auto procedure = CreateSequenceProcedureItem(instruction_count, with_variables);
+    auto procedure_ptr = procedure.get();
+    sequencer_model->InsertItem(std::move(procedure), sequencer_model->GetProcedureContainer(),
+                                mvvm::TagIndex::Append());
+    auto job_item = models.GetJobModel()->InsertItem<LocalJobItem>();
+    job_item->SetProcedure(procedure_ptr);
+    job_item->SetTickTimeout(std::chrono::milliseconds(0));
+    LocalJobHandler job_handler(job_item, UserContext{});
+    state.ResumeTiming();
+
+    job_handler.Start();
+    const bool is_completed = QTest::qWaitFor(
+        [&job_handler]()
+        {
+          return job_handler.GetRunnerStatus() == RunnerStatus::kSucceeded
+                 && job_handler.GetEventStatistics().queue_depth == 0;
+        },
+        static_cast<int>(std::chrono::milliseconds(timeout).count()));
+
+    state.PauseTiming();
+    if (!is_completed)
+    {
+      state.SkipWithError("Procedure didn't finish in time");
+      break;
+    }
+    event_count += GetAppliedEventCount(job_handler.GetEventStatistics());
+    state.ResumeTiming();
+  }
+
+  SetEventCounters(state, event_count, initial_memory_kb);
+}
+BENCHMARK(BM_LocalJobHandlerRun)
+    ->ArgNames({"instructions", "variables"})
+    ->ArgsProduct({{10, 100, 1000}, {0, 1}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace oac_tree_gui::test
@@ -0,0 +1,116 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+
+#include "benchmark_utils.h"
+
+#include <oac_tree_gui/jobsystem/domain_job_observer.h>
+#include <oac_tree_gui/jobsystem/objects/domain_event_queue.h>
+#include <oac_tree_gui/jobsystem/user_context.h>
+
+#include <benchmark/benchmark.h>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Reports instruction state changes through DomainJobObserver into the event queue.
+ *
+ * Measures the cost paid by the sequencer thread for every notification. Queue is drained after
+ * each batch, outside of the measured region.
+ */
+void BM_JobObserverInstructionState(benchmark::State& state)
+{
+  using sup::oac_tree::ExecutionStatus;
+  using sup::oac_tree::InstructionState;
+
+  const auto batch_size = static_cast<std::size_t>(state.range(0));
+  const std::size_t instruction_count = 100;
+  const auto initial_memory_kb = GetResidentMemoryKb();
+
+  DomainEventQueueOptions options;
+  options.capacity = batch_size;
+  options.producer_mode = ProducerMode::kSingle;
+  DomainEventQueue queue(options);
+
+  DomainJobObserver observer([&queue](const domain_event_t& event) { queue.PushEvent(event); },
+                             UserContext{});
+
+  std::size_t event_count{0};
+  for (auto _ : state)
+  {
+    for (std::size_t index = 0; index < batch_size; ++index)
+    {
+      const auto status = index % 2 == 0 ? ExecutionStatus::NOT_FINISHED : ExecutionStatus::SUCCESS;
+      observer.InstructionStateUpdated(static_cast<sup::dto::uint32>(index % instruction_count),
+                                       InstructionState{false, status});
+    }
+    event_count += batch_size;
+
+    state.PauseTiming();
+    while (IsValid(queue.TryPopEvent()))
+    {
+    }
+    state.ResumeTiming();
+  }
+
+  SetEventCounters(state, event_count, initial_memory_kb);
+}
+BENCHMARK(BM_JobObserverInstructionState)->Arg(1024)->Arg(4096);
+
+/**
+ * @brief Reports log messages through DomainJobObserver into the event queue.
+ */
+void BM_JobObserverLog(benchmark::State& state)
+{
+  const std::size_t batch_size = 1024;
+  const auto initial_memory_kb = GetResidentMemoryKb();
+
+  DomainEventQueueOptions options;
+  options.capacity = batch_size;
+  options.producer_mode = ProducerMode::kSingle;
+  DomainEventQueue queue(options);
+
+  DomainJobObserver observer([&queue](const domain_event_t& event) { queue.PushEvent(event); },
+                             UserContext{});
+
+  const std::string message("Message reported by the instruction during procedure execution");
+
+  std::size_t event_count{0};
+  for (auto _ : state)
+  {
+    for (std::size_t index = 0; index < batch_size; ++index)
+    {
+      observer.Log(static_cast<int>(Severity::kInfo), message);
+    }
+    event_count += batch_size;
+
+    state.PauseTiming();
+    while (IsValid(queue.TryPopEvent()))
+    {
+    }
+    state.ResumeTiming();
+  }
+
+  SetEventCounters(state, event_count, initial_memory_kb);
+}
+BENCHMARK(BM_JobObserverLog);
+
+}  // namespace oac_tree_gui::test
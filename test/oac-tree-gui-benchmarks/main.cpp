@@ -0,0 +1,52 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <oac_tree_gui/components/load_resources.h>
+#include <oac_tree_gui/domain/domain_helper.h>
+#include <oac_tree_gui/domain/domain_library_loader.h>
+
+#include <benchmark/benchmark.h>
+
+#include <QApplication>
+
+int main(int argc, char** argv)
+{
+  // benchmarks are expected to run on build servers without display
+  if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+  {
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+  }
+
+  oac_tree_gui::RegisterCustomMetaTypes();
+  const oac_tree_gui::DomainLibraryLoader loader(oac_tree_gui::GetBasicPluginFileNames());
+  oac_tree_gui::LoadOacTreeItems();
+
+  const QApplication app(argc, argv);
+  Q_UNUSED(app)
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+  {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
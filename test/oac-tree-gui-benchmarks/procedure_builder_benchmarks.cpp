@@ -0,0 +1,93 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include <oac_tree_gui/model/instruction_container_item.h>
+#include <oac_tree_gui/model/instruction_item.h>
+#include <oac_tree_gui/model/iterate_helper.h>
+#include <oac_tree_gui/model/procedure_item.h>
+#include <oac_tree_gui/transform/procedure_item_job_info_builder.h>
+
+#include <sup/oac-tree/job_info.h>
+
+#include <benchmark/benchmark.h>
+#include <testutils/sequencer_test_utils.h>
+
+#include <cstdint>
+#include <string>
+
+namespace oac_tree_gui::test
+{
+
+namespace
+{
+
+/**
+ * @brief Returns procedure body with a sequence of the given number of waits.
+ */
+std::string CreateSequenceBody(std::size_t wait_count)
+{
+  std::string result = R"(<Sequence>)";
+  for (std::size_t index = 0; index < wait_count; ++index)
+  {
+    result += R"(<Wait timeout="0"/>)";
+  }
+  result += R"(</Sequence><Workspace/>)";
+  return result;
+}
+
+}  // namespace
+
+/**
+ * @brief Looks up automation indexes of all instructions of the expanded procedure, as it is done
+ * when propagating breakpoints to the domain.
+ *
+ * Argument: number of instructions in the procedure. The time per instruction should stay
+ * constant with the growing procedure.
+ */
+void BM_InstructionIndexLookup(benchmark::State& state)
+{
+  const auto instruction_count = static_cast<std::size_t>(state.range(0));
+  const auto job_info = CreateJobInfo(CreateSequenceBody(instruction_count));
+
+  ProcedureItemJobInfoBuilder builder;
+  auto procedure_item = builder.CreateProcedureItem(job_info);
+  const auto instructions = procedure_item->GetInstructionContainer()->GetInstructions();
+
+  std::size_t lookup_count{0};
+  for (auto _ : state)
+  {
+    std::size_t index_sum{0};
+    auto func = [&builder, &index_sum](const InstructionItem* item)
+    { index_sum += builder.GetIndex(item); };
+    IterateInstructionContainer<const InstructionItem*>(instructions, func);
+    benchmark::DoNotOptimize(index_sum);
+    lookup_count += instruction_count + 1;  // waits and the sequence
+  }
+
+  state.SetItemsProcessed(static_cast<std::int64_t>(lookup_count));
+}
+BENCHMARK(BM_InstructionIndexLookup)
+    ->ArgName("instructions")
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(50000)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace oac_tree_gui::test
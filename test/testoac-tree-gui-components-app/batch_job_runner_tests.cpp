@@ -0,0 +1,170 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/batch_job_runner.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+
+#include <mvvm/test/test_helper.h>
+
+#include <gtest/gtest.h>
+#include <testutils/folder_test.h>
+#include <testutils/test_utils.h>
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <algorithm>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for BatchJobRunner class.
+ */
+class BatchJobRunnerTest : public test::FolderTest
+{
+public:
+  BatchJobRunnerTest() : FolderTest("BatchJobRunnerTest") {}
+
+  /**
+   * @brief Creates procedure file with the given body and returns its full path.
+   */
+  std::string CreateProcedureFile(const std::string& name, const std::string& body) const
+  {
+    const auto file_name = GetFilePath(name);
+    mvvm::test::CreateTextFile(file_name, test::CreateProcedureString(body));
+    return file_name;
+  }
+};
+
+TEST_F(BatchJobRunnerTest, InitialState)
+{
+  EXPECT_THROW(BatchJobRunner(BatchJobOptions{0}), RuntimeException);
+
+  BatchJobRunner runner(BatchJobOptions{});
+  EXPECT_TRUE(runner.Run({}).empty());
+}
+
+TEST_F(BatchJobRunnerTest, RunProcedures)
+{
+  const auto message_file = CreateProcedureFile("message.xml", R"(<Message text="Hello"/>)");
+  const auto failing_file =
+      CreateProcedureFile("failing.xml", R"(<Inverter><Wait timeout="0.0"/></Inverter>)");
+  const auto missing_file = GetFilePath("missing.xml");
+
+  std::vector<std::size_t> reported_jobs;
+  auto on_result = [&reported_jobs](const BatchJobResult& result)
+  { reported_jobs.push_back(result.job_index); };
+
+  BatchJobOptions options;
+  options.worker_count = 2;
+  BatchJobRunner runner(options, on_result);
+
+  const auto results = runner.Run({message_file, failing_file, missing_file, message_file});
+  ASSERT_EQ(results.size(), 4);
+  EXPECT_EQ(reported_jobs.size(), 4);
+
+  EXPECT_EQ(results.at(0).job_index, 0);
+  EXPECT_EQ(results.at(0).file_name, message_file);
+  EXPECT_EQ(results.at(0).status, RunnerStatus::kSucceeded);
+  EXPECT_TRUE(IsSucceeded(results.at(0)));
+  EXPECT_TRUE(results.at(0).error.empty());
+  EXPECT_GT(results.at(0).event_count, 0);
+  const auto& logs = results.at(0).logs;
+  EXPECT_TRUE(std::any_of(logs.begin(), logs.end(),
+                          [](const auto& log_event) { return log_event.message == "Hello"; }));
+
+  EXPECT_EQ(results.at(1).status, RunnerStatus::kFailed);
+  EXPECT_FALSE(IsSucceeded(results.at(1)));
+
+  // import error is reported as submission failure, the job doesn't run
+  EXPECT_EQ(results.at(2).status, RunnerStatus::kSubmitFailure);
+  EXPECT_FALSE(results.at(2).error.empty());
+  EXPECT_EQ(results.at(2).event_count, 0);
+
+  EXPECT_EQ(results.at(3).job_index, 3);
+  EXPECT_EQ(results.at(3).status, RunnerStatus::kSucceeded);
+}
+
+TEST_F(BatchJobRunnerTest, JobTimeout)
+{
+  const auto file_name = CreateProcedureFile("long.xml", R"(<Wait timeout="10.0"/>)");
+
+  BatchJobOptions options;
+  options.job_timeout = std::chrono::milliseconds(50);
+  BatchJobRunner runner(options);
+
+  const auto results = runner.Run({file_name});
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_TRUE(results.at(0).timed_out);
+  EXPECT_EQ(results.at(0).status, RunnerStatus::kHalted);
+  EXPECT_LT(results.at(0).run_time, std::chrono::seconds(5));
+}
+
+//! Only the most recent log messages are kept, older ones are counted.
+TEST_F(BatchJobRunnerTest, MaxLogCount)
+{
+  const auto file_name = CreateProcedureFile(
+      "messages.xml",
+      R"(<Sequence><Message text="a"/><Message text="b"/><Message text="c"/></Sequence>)");
+
+  BatchJobOptions options;
+  options.max_log_count = 2;
+  BatchJobRunner runner(options);
+
+  const auto results = runner.Run({file_name});
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_EQ(results.at(0).status, RunnerStatus::kSucceeded);
+  ASSERT_EQ(results.at(0).logs.size(), 2);
+  EXPECT_EQ(results.at(0).logs.back().message, std::string("c"));
+  EXPECT_GE(results.at(0).dropped_log_count, 1);
+}
+
+TEST_F(BatchJobRunnerTest, ToJsonLine)
+{
+  BatchJobResult result;
+  result.job_index = 1;
+  result.file_name = "procedure.xml";
+  result.status = RunnerStatus::kSucceeded;
+  result.run_time = std::chrono::milliseconds(2);
+  auto log_event = CreateLogEvent(Severity::kWarning, "text");
+  log_event.source = "source";
+  result.logs.push_back(log_event);
+  result.dropped_log_count = 3;
+
+  const auto line = ToJsonLine(result);
+  EXPECT_EQ(line.find('\n'), std::string::npos);
+
+  const auto json = QJsonDocument::fromJson(QByteArray::fromStdString(line)).object();
+  EXPECT_EQ(json["job"].toInt(), 1);
+  EXPECT_EQ(json["file"].toString(), QString("procedure.xml"));
+  EXPECT_EQ(json["status"].toString(), QString::fromStdString(ToString(RunnerStatus::kSucceeded)));
+  EXPECT_FALSE(json.contains("error"));
+  EXPECT_DOUBLE_EQ(json["run_ms"].toDouble(), 2.0);
+
+  const auto logs = json["logs"].toArray();
+  ASSERT_EQ(logs.size(), 1);
+  EXPECT_EQ(logs.at(0).toObject()["severity"].toString(), QString("WARNING"));
+  EXPECT_EQ(logs.at(0).toObject()["message"].toString(), QString("text"));
+  EXPECT_EQ(json["dropped_log_count"].toInt(), 3);
+}
+
+}  // namespace oac_tree_gui::test
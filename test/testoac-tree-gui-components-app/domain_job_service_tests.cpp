@@ -31,6 +31,7 @@
 
 #include <QTest>
 #include <future>
+#include <thread>
 
 namespace oac_tree_gui::test
 {
@@ -223,6 +224,57 @@ TEST_F(DomainJobServiceTest, GetUserChoice)
   EXPECT_EQ(future_result.get(), user_index_choice);
 }
 
+//! Job interrupts the request for user input before the GUI answers.
+TEST_F(DomainJobServiceTest, InterruptUserValue)
+{
+  const sup::dto::uint64 request_id{42};
+  sup::dto::AnyValue value{sup::dto::SignedInteger32Type, 41};
+
+  auto runner = [this, &value, request_id]()
+  { return m_service->GetJobInfoIO()->GetUserValue(request_id, value, "description"); };
+  std::future<bool> future_result = std::async(std::launch::async, runner);
+
+  // not processing the event loop, so the GUI doesn't get the request
+  while (m_service->GetPendingUserInputRequests().empty())
+  {
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(m_service->GetPendingUserInputRequests().at(0).id, request_id);
+
+  m_service->GetJobInfoIO()->Interrupt(request_id);
+  EXPECT_FALSE(future_result.get());
+  EXPECT_TRUE(m_service->GetPendingUserInputRequests().empty());
+}
+
+//! Pending user choice is answered directly, bypassing the user context.
+TEST_F(DomainJobServiceTest, SendUserChoice)
+{
+  const sup::dto::uint64 request_id{42};
+  const std::vector<std::string> options({"option0", "option1"});
+
+  auto runner = [this, &options, request_id]()
+  { return m_service->GetJobInfoIO()->GetUserChoice(request_id, options, {}); };
+  std::future<int> future_result = std::async(std::launch::async, runner);
+
+  while (m_service->GetPendingUserChoiceRequests().empty())
+  {
+    std::this_thread::yield();
+  }
+
+  EXPECT_FALSE(m_service->SendUserChoice(request_id + 1, UserChoiceResult{1, true}));
+  EXPECT_TRUE(m_service->SendUserChoice(request_id, UserChoiceResult{1, true}));
+  EXPECT_EQ(future_result.get(), 1);
+}
+
+//! Request without an answer expires.
+TEST_F(DomainJobServiceTest, UserChoiceTimeout)
+{
+  m_service->SetUserRequestTimeout(msec(20));
+
+  const std::vector<std::string> options({"option0"});
+  EXPECT_EQ(m_service->GetJobInfoIO()->GetUserChoice(1, options, {}), -1);
+}
+
 TEST_F(DomainJobServiceTest, Message)
 {
   const std::string message("mesage");
@@ -247,4 +299,18 @@ TEST_F(DomainJobServiceTest, Log)
   EXPECT_TRUE(WaitForEmptyQueue(*m_service, msec(50)));
 }
 
+TEST_F(DomainJobServiceTest, TickStatistics)
+{
+  m_service->SetTickTimeout(std::chrono::microseconds(500));
+
+  for (int index = 0; index < 10; ++index)
+  {
+    m_service->GetJobInfoIO()->ProcedureTicked();
+  }
+
+  const auto statistics = m_service->GetEventStatistics();
+  EXPECT_EQ(statistics.ticks.tick_count, 10);
+  EXPECT_DOUBLE_EQ(statistics.ticks.target_tick_rate, 2000.0);
+}
+
 }  // namespace oac_tree_gui::test
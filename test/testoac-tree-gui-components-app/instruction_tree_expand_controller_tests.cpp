@@ -107,6 +107,64 @@ TEST_F(InstructionTreeExpandControllerTest, SelectWaitInCollapsedBranch)
   EXPECT_EQ(controller.GetInstructionsToSelect(), std::vector<mvvm::SessionItem*>({sequence1}));
 }
 
+//! Incremental update of selection, when two instructions share the same collapsed parent.
+TEST_F(InstructionTreeExpandControllerTest, UpdateSelectionRequest)
+{
+  auto sequence0 = m_model.InsertItem<SequenceItem>();
+  auto sequence1 = m_model.InsertItem<SequenceItem>(sequence0);
+  auto wait0 = m_model.InsertItem<WaitItem>(sequence1);
+  auto wait1 = m_model.InsertItem<WaitItem>(sequence1);
+  auto wait2 = m_model.InsertItem<WaitItem>(sequence0);
+
+  QTreeView tree;
+  tree.setModel(&m_viewmodel);
+  InstructionTreeExpandController controller(&tree);
+
+  // collapsing sequence1 branch
+  tree.expandAll();
+  tree.setExpanded(m_viewmodel.GetIndexOfSessionItem(sequence1).at(0), false);
+
+  controller.SaveSelectionRequest({wait0});
+
+  // wait1 is represented by already selected sequence1
+  auto change = controller.UpdateSelectionRequest({wait1, wait2}, {});
+  EXPECT_EQ(change.to_select, std::vector<mvvm::SessionItem*>({wait2}));
+  EXPECT_TRUE(change.to_deselect.empty());
+
+  // sequence1 still represents wait1
+  change = controller.UpdateSelectionRequest({}, {wait0});
+  EXPECT_TRUE(change.to_select.empty());
+  EXPECT_TRUE(change.to_deselect.empty());
+
+  change = controller.UpdateSelectionRequest({}, {wait1, wait2});
+  EXPECT_TRUE(change.to_select.empty());
+  EXPECT_EQ(change.to_deselect, std::vector<mvvm::SessionItem*>({sequence1, wait2}));
+  EXPECT_TRUE(controller.GetInstructionsToSelect().empty());
+}
+
+//! The same instruction requested twice stays selected till both requests are removed.
+TEST_F(InstructionTreeExpandControllerTest, UpdateSelectionRequestTwice)
+{
+  auto sequence = m_model.InsertItem<SequenceItem>();
+  auto wait = m_model.InsertItem<WaitItem>(sequence);
+
+  QTreeView tree;
+  tree.setModel(&m_viewmodel);
+  tree.expandAll();
+  InstructionTreeExpandController controller(&tree);
+
+  auto change = controller.UpdateSelectionRequest({wait, wait}, {});
+  EXPECT_EQ(change.to_select, std::vector<mvvm::SessionItem*>({wait}));
+
+  change = controller.UpdateSelectionRequest({}, {wait, sequence});
+  EXPECT_TRUE(change.to_deselect.empty());
+  EXPECT_EQ(controller.GetInstructionsToSelect(), std::vector<mvvm::SessionItem*>({wait}));
+
+  change = controller.UpdateSelectionRequest({}, {wait});
+  EXPECT_EQ(change.to_deselect, std::vector<mvvm::SessionItem*>({wait}));
+  EXPECT_TRUE(controller.GetInstructionsToSelect().empty());
+}
+
 TEST_F(InstructionTreeExpandControllerTest, SetTreeViewToInstructionExpandState)
 {
   auto container = m_model.InsertItem<InstructionContainerItem>();
@@ -266,4 +266,76 @@ TEST_F(JobManagerExtendedTest, StopAllJobs)
   EXPECT_FALSE(manager.HasRunningJobs());
 }
 
+//! Jobs above the limit of running jobs are queued, and start when running jobs finish.
+TEST_F(JobManagerExtendedTest, QueuedJobs)
+{
+  auto long_procedure = test::CreateSingleWaitProcedureItem(GetSequencerModel(), msec(10000));
+  auto short_procedure = test::CreateSingleWaitProcedureItem(GetSequencerModel(), msec(10));
+
+  auto job_item0 = m_job_item;
+  job_item0->SetProcedure(long_procedure);
+  auto job_item1 = m_models.GetJobModel()->InsertItem<LocalJobItem>();
+  job_item1->SetProcedure(short_procedure);
+  auto job_item2 = m_models.GetJobModel()->InsertItem<LocalJobItem>();
+  job_item2->SetProcedure(short_procedure);
+
+  JobManager manager(GetContext());
+  manager.SetMaxRunningJobCount(1);
+  EXPECT_EQ(manager.GetMaxRunningJobCount(), 1);
+
+  manager.SubmitJob(job_item0);
+  manager.SubmitJob(job_item1);
+  manager.SubmitJob(job_item2);
+  manager.StartJobs({job_item0, job_item1, job_item2});
+
+  EXPECT_EQ(manager.GetQueuedJobCount(), 2);
+  EXPECT_EQ(job_item1->GetStatus(), RunnerStatus::kQueued);
+  EXPECT_EQ(job_item2->GetStatus(), RunnerStatus::kQueued);
+  EXPECT_TRUE(manager.HasRunningJobs());
+
+  // stopping the queued job removes it from the queue
+  manager.Stop(job_item2);
+  EXPECT_EQ(manager.GetQueuedJobCount(), 1);
+  EXPECT_EQ(job_item2->GetStatus(), RunnerStatus::kInitial);
+
+  // the long job gives its slot to the queued one
+  manager.Stop(job_item0);
+  EXPECT_TRUE(QTest::qWaitFor(
+      [job_item1]() { return job_item1->GetStatus() == RunnerStatus::kSucceeded; }, 1000));
+  EXPECT_EQ(job_item0->GetStatus(), RunnerStatus::kHalted);
+  EXPECT_EQ(manager.GetQueuedJobCount(), 0);
+  EXPECT_EQ(job_item2->GetStatus(), RunnerStatus::kInitial);
+}
+
+//! Raising the limit of running jobs starts queued jobs.
+TEST_F(JobManagerExtendedTest, RaiseRunningJobLimit)
+{
+  auto procedure = test::CreateSingleWaitProcedureItem(GetSequencerModel(), msec(10));
+
+  auto job_item0 = m_job_item;
+  job_item0->SetProcedure(procedure);
+  auto job_item1 = m_models.GetJobModel()->InsertItem<LocalJobItem>();
+  job_item1->SetProcedure(procedure);
+
+  JobManager manager(GetContext());
+  manager.SetMaxRunningJobCount(1);
+  manager.SubmitJob(job_item0);
+  manager.SubmitJob(job_item1);
+
+  manager.Start(job_item0);
+  manager.Start(job_item1);
+  EXPECT_EQ(job_item1->GetStatus(), RunnerStatus::kQueued);
+
+  manager.SetMaxRunningJobCount(0);
+  EXPECT_EQ(manager.GetQueuedJobCount(), 0);
+
+  auto is_finished = [job_item0, job_item1]()
+  {
+    return job_item0->GetStatus() == RunnerStatus::kSucceeded
+           && job_item1->GetStatus() == RunnerStatus::kSucceeded;
+  };
+  EXPECT_TRUE(QTest::qWaitFor(is_finished, 1000));
+  EXPECT_FALSE(manager.HasRunningJobs());
+}
+
 }  // namespace oac_tree_gui::test
@@ -104,6 +104,27 @@ TEST_F(LocalJobHandlerTest, JobItemWithProcedure)
   EXPECT_EQ(job_handler.GetRunnerStatus(), RunnerStatus::kInitial);
 }
 
+//! Job running at full speed requires throttled GUI updates.
+TEST_F(LocalJobHandlerTest, GuiThrottleRequired)
+{
+  auto procedure = test::CreateSingleWaitProcedureItem(m_models.GetSequencerModel(), msec(10));
+  m_job_item->SetProcedure(procedure);
+  m_job_item->SetTickTimeout(msec(20));
+
+  LocalJobHandler job_handler(m_job_item, UserContext{});
+  EXPECT_FALSE(job_handler.IsGuiThrottleRequired());
+
+  const QSignalSpy spy_throttle(&job_handler, &LocalJobHandler::GuiThrottleRequiredChanged);
+
+  m_job_item->SetTickTimeout(std::chrono::microseconds(500));
+  EXPECT_TRUE(job_handler.IsGuiThrottleRequired());
+  EXPECT_EQ(spy_throttle.count(), 1);
+
+  m_job_item->SetTickTimeout(msec(10));
+  EXPECT_FALSE(job_handler.IsGuiThrottleRequired());
+  EXPECT_EQ(spy_throttle.count(), 2);
+}
+
 //! Creating expanded procedure upfront and populating it with breakpoints. JobItem should preserve
 //! breakpoints after initial setup.
 TEST_F(LocalJobHandlerTest, PrepareJobRequestBreakpoints)
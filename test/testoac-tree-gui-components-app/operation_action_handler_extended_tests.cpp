@@ -21,11 +21,14 @@
 #include "oac_tree_gui/operation/objects/operation_action_handler.h"
 
 #include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/instruction_profiler.h>
 #include <oac_tree_gui/jobsystem/job_utils.h>
 #include <oac_tree_gui/jobsystem/objects/job_manager.h>
 #include <oac_tree_gui/jobsystem/objects/local_job_handler.h>
 #include <oac_tree_gui/jobsystem/user_context.h>
 #include <oac_tree_gui/model/application_models.h>
+#include <oac_tree_gui/model/instruction_container_item.h>
+#include <oac_tree_gui/model/instruction_item.h>
 #include <oac_tree_gui/model/job_item.h>
 #include <oac_tree_gui/model/job_model.h>
 #include <oac_tree_gui/model/procedure_item.h>
@@ -45,6 +48,7 @@
 
 #include <QSignalSpy>
 #include <QTest>
+#include <fstream>
 
 Q_DECLARE_METATYPE(oac_tree_gui::JobItem*)
 
@@ -447,4 +451,56 @@ TEST_F(OperationActionHandlerExtendedTest, SubmitMalFormedFileBasedJobThenResubm
   EXPECT_EQ(job_item->GetStatus(), RunnerStatus::kSucceeded);
 }
 
+//! Running the job and exporting its execution profile.
+TEST_F(OperationActionHandlerExtendedTest, OnExportProfileRequest)
+{
+  auto procedure = test::CreateMessageProcedureItem(GetSequencerModel(), "text");
+  auto handler = CreateOperationHandler();
+
+  EXPECT_CALL(m_mock_context, OnSelectedJob()).Times(1);
+  handler->SubmitLocalJob(procedure);
+  ASSERT_EQ(GetJobItems().size(), 1);
+  auto job_item = GetJobItems().at(0);
+
+  // attempt to export when no job is selected
+  EXPECT_CALL(m_mock_context, OnSelectedJob()).Times(1);
+  EXPECT_CALL(m_mock_context, OnMessage(::testing::_)).Times(1);
+  EXPECT_FALSE(handler->OnExportProfileRequest(ProfileFormat::kChromeTrace));
+
+  ON_CALL(m_mock_context, OnSelectedJob()).WillByDefault(::testing::Return(job_item));
+
+  EXPECT_CALL(m_mock_context, OnSelectedJob()).Times(1);
+  handler->OnStartJobRequest();
+  EXPECT_TRUE(QTest::qWaitFor([this, job_item]() { return IsCompleted(job_item); }, 200));
+
+  // executed instruction has its profile
+  auto container = job_item->GetExpandedProcedure()->GetInstructionContainer();
+  auto instructions = container->GetInstructions();
+  ASSERT_EQ(instructions.size(), 1);
+  auto has_profile = [this, &instructions]()
+  {
+    const auto* entry = m_job_manager.FindInstructionProfile(*instructions.at(0));
+    return entry != nullptr && entry->call_count == 1;
+  };
+  EXPECT_TRUE(QTest::qWaitFor(has_profile, 100));
+
+  // user cancels file selection
+  EXPECT_CALL(m_mock_context, OnSelectedJob()).Times(1);
+  EXPECT_CALL(m_mock_context, OnGetProfileFileName(ProfileFormat::kChromeTrace))
+      .WillOnce(::testing::Return(std::string()));
+  EXPECT_FALSE(handler->OnExportProfileRequest(ProfileFormat::kChromeTrace));
+
+  const auto file_name = GetFilePath("profile.json");
+  EXPECT_CALL(m_mock_context, OnSelectedJob()).Times(1);
+  EXPECT_CALL(m_mock_context, OnGetProfileFileName(ProfileFormat::kChromeTrace))
+      .WillOnce(::testing::Return(file_name));
+  EXPECT_TRUE(handler->OnExportProfileRequest(ProfileFormat::kChromeTrace));
+
+  std::ifstream file_in(file_name);
+  const std::string content((std::istreambuf_iterator<char>(file_in)),
+                            std::istreambuf_iterator<char>());
+  EXPECT_NE(content.find("traceEvents"), std::string::npos);
+  EXPECT_NE(content.find("Message"), std::string::npos);
+}
+
 }  // namespace oac_tree_gui
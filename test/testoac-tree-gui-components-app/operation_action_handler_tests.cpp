@@ -22,6 +22,7 @@
 
 #include <oac_tree_gui/core/exceptions.h>
 #include <oac_tree_gui/jobsystem/objects/abstract_job_handler.h>
+#include <oac_tree_gui/jobsystem/objects/remote_job_importer.h>
 #include <oac_tree_gui/model/procedure_item.h>
 #include <oac_tree_gui/model/standard_job_items.h>
 
@@ -31,11 +32,14 @@
 #include <mvvm/test/test_helper.h>
 
 #include <gtest/gtest.h>
+#include <testutils/mock_automation_client.h>
 #include <testutils/mock_job_manager.h>
 #include <testutils/mock_operation_action_context.h>
 #include <testutils/mock_remote_connection_service.h>
 
 #include <QSignalSpy>
+#include <QTest>
+#include <future>
 
 Q_DECLARE_METATYPE(oac_tree_gui::JobItem*)
 
@@ -266,6 +270,91 @@ TEST_F(OperationActionHandlerTest, ImportTwoRemoteJobs)
   EXPECT_EQ(GetJobs<JobItem>(), expected_items);
 }
 
+//! Cancelling the import while the remote job is being prepared. The job item is marked as failed,
+//! the job prepared after cancellation is discarded.
+TEST_F(OperationActionHandlerTest, CancelRemoteImport)
+{
+  const std::string server_name("abc");
+  const std::size_t job_index{42};
+  const RemoteConnectionInfo connection_context{server_name, {job_index}};
+
+  ON_CALL(m_mock_operation_context, OnGetRemoteConnectionInfo())
+      .WillByDefault(::testing::Return(std::optional<RemoteConnectionInfo>(connection_context)));
+
+  ::testing::NiceMock<test::MockAutomationClient> client;
+  ON_CALL(m_mock_connection_service, Connect(server_name)).WillByDefault(::testing::Return(true));
+  ON_CALL(m_mock_connection_service, HasClient(server_name))
+      .WillByDefault(::testing::Return(true));
+  ON_CALL(m_mock_connection_service, GetAutomationClient(server_name))
+      .WillByDefault(::testing::ReturnRef(client));
+
+  std::promise<void> started;
+  std::promise<void> release;
+  auto release_future = release.get_future().share();
+  EXPECT_CALL(client, PrepareJob(job_index))
+      .WillOnce(
+          [&started, release_future](std::uint32_t)
+          {
+            started.set_value();
+            release_future.wait();
+          });
+  EXPECT_CALL(client, DiscardPreparedJob(job_index));
+  EXPECT_CALL(m_mock_job_manager, SubmitJob(::testing::_)).Times(0);
+
+  RemoteJobImporter importer(m_mock_connection_service, 1);
+  auto operation_handler = CreateOperationHandler();
+  operation_handler->SetRemoteJobImporter(&importer);
+
+  EXPECT_TRUE(operation_handler->OnImportRemoteJobRequest());
+  auto job_items = GetJobs<RemoteJobItem>();
+  ASSERT_EQ(job_items.size(), 1);
+  started.get_future().wait();
+
+  operation_handler->OnCancelRemoteImportRequest();
+  EXPECT_EQ(job_items.at(0)->GetStatus(), RunnerStatus::kSubmitFailure);
+
+  release.set_value();
+  QTest::qWait(50);
+}
+
+//! The job item is removed before its remote job is prepared, the prepared job is discarded.
+TEST_F(OperationActionHandlerTest, RemoveJobDuringRemoteImport)
+{
+  const std::string server_name("abc");
+  const std::size_t job_index{42};
+  const RemoteConnectionInfo connection_context{server_name, {job_index}};
+
+  ON_CALL(m_mock_operation_context, OnGetRemoteConnectionInfo())
+      .WillByDefault(::testing::Return(std::optional<RemoteConnectionInfo>(connection_context)));
+
+  ::testing::NiceMock<test::MockAutomationClient> client;
+  ON_CALL(m_mock_connection_service, Connect(server_name)).WillByDefault(::testing::Return(true));
+  ON_CALL(m_mock_connection_service, HasClient(server_name))
+      .WillByDefault(::testing::Return(true));
+  ON_CALL(m_mock_connection_service, GetAutomationClient(server_name))
+      .WillByDefault(::testing::ReturnRef(client));
+
+  EXPECT_CALL(client, PrepareJob(job_index));
+  EXPECT_CALL(client, DiscardPreparedJob(job_index));
+  EXPECT_CALL(m_mock_job_manager, SubmitJob(::testing::_)).Times(0);
+
+  RemoteJobImporter importer(m_mock_connection_service, 1);
+  auto operation_handler = CreateOperationHandler();
+  operation_handler->SetRemoteJobImporter(&importer);
+
+  bool is_finished{false};
+  QObject::connect(&importer, &RemoteJobImporter::ImportFinished,
+                   [&is_finished]() { is_finished = true; });
+
+  // the report about prepared job is queued, the item is gone before it is processed
+  EXPECT_TRUE(operation_handler->OnImportRemoteJobRequest());
+  auto job_items = GetJobs<RemoteJobItem>();
+  ASSERT_EQ(job_items.size(), 1);
+  m_model.RemoveItem(job_items.at(0));
+
+  EXPECT_TRUE(QTest::qWaitFor([&is_finished]() { return is_finished; }, 1000));
+}
+
 TEST_F(OperationActionHandlerTest, RemoveLocalJob)
 {
   auto operation_handler = CreateOperationHandler();
@@ -0,0 +1,126 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/objects/replay_job_handler.h"
+
+#include <oac_tree_gui/domain/domain_constants.h>
+#include <oac_tree_gui/jobsystem/domain_event_trace.h>
+#include <oac_tree_gui/jobsystem/objects/local_job_handler.h>
+#include <oac_tree_gui/jobsystem/user_context.h>
+#include <oac_tree_gui/model/application_models.h>
+#include <oac_tree_gui/model/job_model.h>
+#include <oac_tree_gui/model/procedure_item.h>
+#include <oac_tree_gui/model/sequencer_model.h>
+#include <oac_tree_gui/model/standard_job_items.h>
+#include <oac_tree_gui/model/variable_item.h>
+#include <oac_tree_gui/model/workspace_item.h>
+
+#include <gtest/gtest.h>
+#include <testutils/sequencer_test_utils.h>
+#include <testutils/standard_procedure_items.h>
+
+#include <QDir>
+#include <QTemporaryDir>
+#include <QTest>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for ReplayJobHandler class.
+ */
+class ReplayJobHandlerTest : public ::testing::Test
+{
+public:
+  ReplayJobHandlerTest() { m_models.CreateEmpty(); }
+
+  std::string GetFilePath(const std::string& name) const
+  {
+    return m_dir.filePath(QString::fromStdString(name)).toStdString();
+  }
+
+  /**
+   * @brief Runs the procedure with a variable copy as a local job and records its events.
+   */
+  DomainEventTrace RecordCopyProcedure()
+  {
+    auto procedure = test::CreateCopyProcedureItem(m_models.GetSequencerModel());
+    auto job_item = m_models.GetJobModel()->InsertItem<LocalJobItem>();
+    job_item->SetProcedure(procedure);
+
+    const auto file_name = GetFilePath("copy.trace");
+    LocalJobHandler job_handler(job_item, UserContext{});
+    job_handler.StartEventRecording(file_name);
+    job_handler.Start();
+
+    auto predicate = [&job_handler]()
+    { return job_handler.GetRunnerStatus() == RunnerStatus::kSucceeded; };
+    EXPECT_TRUE(QTest::qWaitFor(predicate, 200));
+    job_handler.StopEventRecording();
+
+    return ReadDomainEventTrace(file_name);
+  }
+
+  ApplicationModels m_models;
+  QTemporaryDir m_dir{QDir::tempPath() + "/replay-job-handler-tests-XXXXXX"};
+};
+
+//! Recording a local job and replaying it in another JobItem.
+TEST_F(ReplayJobHandlerTest, RecordAndReplay)
+{
+  const sup::dto::AnyValue anyvalue0{sup::dto::SignedInteger32Type, 42};
+
+  auto trace = RecordCopyProcedure();
+  EXPECT_FALSE(trace.records.empty());
+
+  auto job_item = m_models.GetJobModel()->InsertItem<LocalJobItem>();
+  ReplayJobHandler job_handler(job_item, std::move(trace));
+  job_handler.SetReplaySpeed(0.0);
+
+  // expanded procedure is built from the job info stored in the trace
+  ASSERT_NE(job_handler.GetExpandedProcedure(), nullptr);
+  auto vars = job_handler.GetExpandedProcedure()->GetWorkspace()->GetVariables();
+  ASSERT_EQ(vars.size(), 2);
+
+  job_handler.Start();
+
+  auto predicate = [&job_handler]()
+  { return job_handler.GetRunnerStatus() == RunnerStatus::kSucceeded; };
+  EXPECT_TRUE(QTest::qWaitFor(predicate, 200));
+
+  auto instructions = test::FindInstructions(*m_models.GetJobModel(),
+                                             domainconstants::kCopyInstructionType);
+  ASSERT_EQ(instructions.size(), 2);  // from recorded and from replayed jobs
+  EXPECT_EQ(instructions.at(1)->GetStatus(), InstructionStatus::kSuccess);
+  EXPECT_TRUE(test::IsEqual(*vars.at(1), anyvalue0));  // value was changed
+
+  // replay can be repeated after reset
+  job_handler.Reset();
+  auto reset_predicate = [&job_handler]()
+  { return job_handler.GetRunnerStatus() == RunnerStatus::kInitial; };
+  EXPECT_TRUE(QTest::qWaitFor(reset_predicate, 200));
+  EXPECT_EQ(instructions.at(1)->GetStatus(), InstructionStatus::kNotStarted);
+
+  job_handler.Start();
+  EXPECT_TRUE(QTest::qWaitFor(predicate, 200));
+  EXPECT_EQ(instructions.at(1)->GetStatus(), InstructionStatus::kSuccess);
+}
+
+}  // namespace oac_tree_gui::test
@@ -54,7 +54,7 @@ TEST_F(UserChoiceProviderTest, SingleThreadAsksForUserChoice)
   auto runner = [&provider, &ready_for_test, &args]()
   {
     ready_for_test.set_value();
-    return provider.GetUserChoice(args);
+    return provider.GetUserChoice(1, args);
   };
 
   // launching runner in a thread
@@ -93,7 +93,7 @@ TEST_F(UserChoiceProviderTest, TwoThreadsAskForUserChoice)
   auto consumer1 = [&provider, &ready_for_test1, &args]()
   {
     ready_for_test1.set_value();
-    return provider.GetUserChoice(args);
+    return provider.GetUserChoice(1, args);
   };
 
   std::promise<void> ready_for_test2;
@@ -101,7 +101,7 @@ TEST_F(UserChoiceProviderTest, TwoThreadsAskForUserChoice)
   auto consumer2 = [&provider, &ready_for_test2, &args]()
   {
     ready_for_test2.set_value();
-    return provider.GetUserChoice(args);
+    return provider.GetUserChoice(2, args);
   };
 
   // launching runner in a thread
@@ -62,7 +62,7 @@ TEST_F(UserInputProviderTest, SingleThreadAsksForUserInput)
   auto runner = [&provider, &ready_for_test, &args]()
   {
     ready_for_test.set_value();
-    return provider.GetUserInput(args);
+    return provider.GetUserInput(1, args);
   };
 
   // launching runner in a thread
@@ -0,0 +1,213 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/viewmodel/aggregated_job_log_viewmodel.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/objects/job_log.h>
+
+#include <gtest/gtest.h>
+
+#include <QSignalSpy>
+#include <memory>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for AggregatedJobLogViewModel class.
+ */
+class AggregatedJobLogViewModelTest : public ::testing::Test
+{
+public:
+  /**
+   * @brief Creates log event with the given message and timestamp.
+   */
+  static LogEvent CreateEvent(const std::string& message, std::int64_t timestamp)
+  {
+    return LogEvent{"", "", Severity::kInfo, "", message, timestamp};
+  }
+
+  /**
+   * @brief Returns messages shown by the model, from top to bottom.
+   */
+  static std::vector<std::string> GetMessages(const AggregatedJobLogViewModel& view_model)
+  {
+    const int message_column = 5;
+    std::vector<std::string> result;
+    for (int row = 0; row < view_model.rowCount(QModelIndex()); ++row)
+    {
+      result.push_back(view_model.data(view_model.index(row, message_column), Qt::DisplayRole)
+                           .toString()
+                           .toStdString());
+    }
+    return result;
+  }
+};
+
+TEST_F(AggregatedJobLogViewModelTest, InitialState)
+{
+  AggregatedJobLogViewModel view_model;
+  EXPECT_EQ(view_model.rowCount(QModelIndex()), 0);
+  EXPECT_EQ(view_model.columnCount(QModelIndex()), 6);  // job followed by log record columns
+  EXPECT_EQ(view_model.GetLogCount(), 0);
+  EXPECT_EQ(view_model.headerData(0, Qt::Horizontal, Qt::DisplayRole), QString("job"));
+
+  EXPECT_THROW(view_model.AddLog(nullptr, "job"), RuntimeException);
+
+  JobLog job_log;
+  view_model.AddLog(&job_log, "job");
+  EXPECT_THROW(view_model.AddLog(&job_log, "job"), RuntimeException);
+  EXPECT_EQ(view_model.GetLogCount(), 1);
+}
+
+//! Records of two logs are merged by timestamp, job name and colour are shown.
+
+TEST_F(AggregatedJobLogViewModelTest, MergeByTimestamp)
+{
+  JobLog log0;
+  log0.Append(CreateEvent("a", 1));
+  log0.Append(CreateEvent("c", 3));
+  log0.Append(CreateEvent("e", 5));
+
+  JobLog log1;
+  log1.Append(CreateEvent("b", 2));
+  log1.Append(CreateEvent("d", 3));
+
+  AggregatedJobLogViewModel view_model;
+  view_model.AddLog(&log0, "job0", QColor(Qt::red));
+  view_model.AddLog(&log1, "job1");
+  view_model.MergePendingRecords();
+
+  // records with equal timestamps are ordered by log
+  EXPECT_EQ(GetMessages(view_model), std::vector<std::string>({"a", "b", "c", "d", "e"}));
+
+  EXPECT_EQ(view_model.data(view_model.index(0, 0), Qt::DisplayRole), QString("job0"));
+  EXPECT_EQ(view_model.data(view_model.index(1, 0), Qt::DisplayRole), QString("job1"));
+  EXPECT_EQ(view_model.data(view_model.index(0, 0), Qt::ForegroundRole), QColor(Qt::red));
+  EXPECT_FALSE(view_model.data(view_model.index(1, 0), Qt::ForegroundRole).isValid());
+
+  EXPECT_EQ(view_model.GetLogRecord(1), std::make_pair(&log1, 0));
+  EXPECT_EQ(view_model.GetLogRecord(4), std::make_pair(&log0, 2));
+}
+
+//! Records appended later are merged in a single insertion at the end of the table.
+
+TEST_F(AggregatedJobLogViewModelTest, AppendRecords)
+{
+  JobLog log0;
+  JobLog log1;
+  AggregatedJobLogViewModel view_model;
+  view_model.AddLog(&log0, "job0");
+  view_model.AddLog(&log1, "job1");
+
+  log0.Append(CreateEvent("a", 10));
+  view_model.MergePendingRecords();
+  EXPECT_EQ(GetMessages(view_model), std::vector<std::string>({"a"}));
+
+  const QSignalSpy spy_insert(&view_model, &AggregatedJobLogViewModel::rowsInserted);
+
+  // the record of the second log is older than the one shown, it goes to the end anyway
+  log0.Append(CreateEvent("d", 30));
+  log1.Append(std::vector<LogEvent>{CreateEvent("b", 5), CreateEvent("c", 20)});
+  view_model.MergePendingRecords();
+
+  EXPECT_EQ(GetMessages(view_model), std::vector<std::string>({"a", "b", "c", "d"}));
+  ASSERT_EQ(spy_insert.count(), 1);
+  EXPECT_EQ(spy_insert.at(0).at(1).toInt(), 1);
+  EXPECT_EQ(spy_insert.at(0).at(2).toInt(), 3);
+
+  // nothing new to merge
+  view_model.MergePendingRecords();
+  EXPECT_EQ(spy_insert.count(), 1);
+}
+
+TEST_F(AggregatedJobLogViewModelTest, SetLogVisible)
+{
+  JobLog log0;
+  log0.Append(CreateEvent("a", 1));
+  JobLog log1;
+  log1.Append(CreateEvent("b", 2));
+
+  AggregatedJobLogViewModel view_model;
+  view_model.AddLog(&log0, "job0");
+  view_model.AddLog(&log1, "job1");
+  view_model.MergePendingRecords();
+
+  view_model.SetLogVisible(&log0, false);
+  EXPECT_FALSE(view_model.IsLogVisible(&log0));
+  EXPECT_EQ(GetMessages(view_model), std::vector<std::string>({"b"}));
+
+  // records of the hidden log are not merged
+  log0.Append(CreateEvent("c", 3));
+  view_model.MergePendingRecords();
+  EXPECT_EQ(GetMessages(view_model), std::vector<std::string>({"b"}));
+
+  view_model.SetLogVisible(&log0, true);
+  EXPECT_EQ(GetMessages(view_model), std::vector<std::string>({"a", "b", "c"}));
+}
+
+TEST_F(AggregatedJobLogViewModelTest, ClearAndDestroyLog)
+{
+  JobLog log0;
+  log0.Append(CreateEvent("a", 1));
+  auto log1 = std::make_unique<JobLog>();
+  log1->Append(CreateEvent("b", 2));
+
+  AggregatedJobLogViewModel view_model;
+  view_model.AddLog(&log0, "job0");
+  view_model.AddLog(log1.get(), "job1");
+  view_model.MergePendingRecords();
+  EXPECT_EQ(view_model.rowCount(QModelIndex()), 2);
+
+  log0.ClearLog();
+  EXPECT_EQ(GetMessages(view_model), std::vector<std::string>({"b"}));
+
+  log1.reset();
+  EXPECT_EQ(view_model.GetLogCount(), 1);
+  EXPECT_EQ(view_model.rowCount(QModelIndex()), 0);
+  EXPECT_EQ(view_model.GetLogs(), std::vector<JobLog*>({&log0}));
+}
+
+//! Clearing one log doesn't merge records of other logs again. New records of the cleared log are
+//! appended after existing rows.
+TEST_F(AggregatedJobLogViewModelTest, ClearLogKeepsOtherRows)
+{
+  JobLog log0;
+  log0.Append(CreateEvent("a", 1));
+  log0.Append(CreateEvent("c", 3));
+  JobLog log1;
+  log1.Append(CreateEvent("b", 2));
+
+  AggregatedJobLogViewModel view_model;
+  view_model.AddLog(&log0, "job0");
+  view_model.AddLog(&log1, "job1");
+  view_model.MergePendingRecords();
+  EXPECT_EQ(GetMessages(view_model), std::vector<std::string>({"a", "b", "c"}));
+
+  log0.ClearLog();
+  EXPECT_EQ(GetMessages(view_model), std::vector<std::string>({"b"}));
+
+  log0.Append(CreateEvent("d", 0));
+  view_model.MergePendingRecords();
+  EXPECT_EQ(GetMessages(view_model), std::vector<std::string>({"b", "d"}));
+}
+
+}  // namespace oac_tree_gui::test
@@ -0,0 +1,168 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/background_executor.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <thread>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for BackgroundExecutor class.
+ */
+class BackgroundExecutorTest : public ::testing::Test
+{
+};
+
+TEST_F(BackgroundExecutorTest, InitialState)
+{
+  EXPECT_THROW(BackgroundExecutor(0), RuntimeException);
+
+  BackgroundExecutor executor(2);
+  EXPECT_EQ(executor.GetMaxThreadCount(), 2);
+  EXPECT_EQ(executor.GetPendingCount(), 0);
+  EXPECT_EQ(executor.GetRunningCount(), 0);
+  EXPECT_THROW(executor.Submit({}), RuntimeException);
+
+  // nothing to wait for
+  executor.WaitForIdle();
+}
+
+TEST_F(BackgroundExecutorTest, RunTasks)
+{
+  BackgroundExecutor executor(4);
+
+  std::atomic<int> counter{0};
+  for (int index = 0; index < 100; ++index)
+  {
+    executor.Submit([&counter]() { ++counter; });
+  }
+
+  // exception doesn't stop the worker
+  executor.Submit([]() { throw RuntimeException("Task failure"); });
+  executor.Submit([&counter]() { ++counter; });
+
+  executor.WaitForIdle();
+  EXPECT_EQ(counter.load(), 101);
+  EXPECT_EQ(executor.GetPendingCount(), 0);
+  EXPECT_EQ(executor.GetRunningCount(), 0);
+}
+
+TEST_F(BackgroundExecutorTest, ParallelTasks)
+{
+  const std::size_t thread_count = 4;
+  BackgroundExecutor executor(thread_count);
+
+  // every task waits for the others, it completes only if all of them run in parallel
+  std::promise<void> all_started;
+  auto all_started_future = all_started.get_future().share();
+  std::atomic<std::size_t> started_count{0};
+
+  for (std::size_t index = 0; index < thread_count; ++index)
+  {
+    executor.Submit(
+        [&started_count, &all_started, all_started_future]()
+        {
+          if (++started_count == thread_count)
+          {
+            all_started.set_value();
+          }
+          all_started_future.wait();
+        });
+  }
+
+  EXPECT_EQ(all_started_future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  executor.WaitForIdle();
+}
+
+TEST_F(BackgroundExecutorTest, CancelPending)
+{
+  BackgroundExecutor executor(1);
+
+  // the first task blocks the only thread
+  std::promise<void> release;
+  auto release_future = release.get_future();
+  std::promise<void> started;
+  executor.Submit(
+      [&started, &release_future]()
+      {
+        started.set_value();
+        release_future.wait();
+      });
+  started.get_future().wait();
+
+  std::atomic<int> counter{0};
+  for (int index = 0; index < 10; ++index)
+  {
+    executor.Submit([&counter]() { ++counter; });
+  }
+  EXPECT_EQ(executor.GetRunningCount(), 1);
+  EXPECT_EQ(executor.GetPendingCount(), 10);
+
+  EXPECT_EQ(executor.CancelPending(), 10);
+  EXPECT_EQ(executor.GetPendingCount(), 0);
+
+  release.set_value();
+  executor.WaitForIdle();
+  EXPECT_EQ(counter.load(), 0);
+}
+
+TEST_F(BackgroundExecutorTest, DestroyWithPendingTasks)
+{
+  std::atomic<int> counter{0};
+  std::promise<void> release;
+  auto release_future = release.get_future().share();
+  std::thread releaser;
+
+  {
+    BackgroundExecutor executor(1);
+    std::promise<void> started;
+    executor.Submit(
+        [&started, &counter, release_future]()
+        {
+          started.set_value();
+          release_future.wait();
+          ++counter;
+        });
+    started.get_future().wait();
+    executor.Submit([&counter]() { ++counter; });
+
+    // releasing the running task while the destructor is waiting for it
+    releaser = std::thread(
+        [&release]()
+        {
+          std::this_thread::sleep_for(std::chrono::milliseconds(50));
+          release.set_value();
+        });
+  }
+  releaser.join();
+
+  // the running task has completed, the pending one was discarded
+  EXPECT_EQ(counter.load(), 1);
+}
+
+}  // namespace oac_tree_gui::test
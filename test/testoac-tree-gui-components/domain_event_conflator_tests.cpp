@@ -0,0 +1,120 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/domain_event_conflator.h"
+
+#include <gtest/gtest.h>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for DomainEventConflator class.
+ */
+class DomainEventConflatorTest : public ::testing::Test
+{
+public:
+  static InstructionStateUpdatedEvent CreateInstructionEvent(std::size_t index,
+                                                             sup::oac_tree::ExecutionStatus status)
+  {
+    return {index, sup::oac_tree::InstructionState{false, status}};
+  }
+};
+
+TEST_F(DomainEventConflatorTest, InitialState)
+{
+  DomainEventConflator conflator;
+  EXPECT_EQ(conflator.GetConflatedInstructionStateCount(), 0);
+  EXPECT_EQ(conflator.GetConflatedVariableCount(), 0);
+  EXPECT_TRUE(conflator.Conflate({}).empty());
+}
+
+TEST_F(DomainEventConflatorTest, InstructionStateUpdates)
+{
+  using sup::oac_tree::ExecutionStatus;
+
+  const auto event1 = CreateInstructionEvent(0, ExecutionStatus::NOT_FINISHED);
+  const auto event2 = CreateInstructionEvent(1, ExecutionStatus::NOT_FINISHED);
+  const auto event3 = CreateInstructionEvent(0, ExecutionStatus::SUCCESS);
+  const auto event4 = CreateInstructionEvent(0, ExecutionStatus::NOT_FINISHED);
+
+  DomainEventConflator conflator;
+  auto result = conflator.Conflate({event1, event2, event3, event4});
+
+  // the latest state of instruction 0 is reported after instruction 1
+  const std::vector<domain_event_t> expected({event2, event4});
+  EXPECT_EQ(result, expected);
+  EXPECT_EQ(conflator.GetConflatedInstructionStateCount(), 2);
+  EXPECT_EQ(conflator.GetConflatedVariableCount(), 0);
+}
+
+TEST_F(DomainEventConflatorTest, VariableUpdates)
+{
+  const VariableUpdatedEvent event1{0, sup::dto::AnyValue{sup::dto::SignedInteger32Type, 1}, true};
+  const VariableUpdatedEvent event2{1, sup::dto::AnyValue{sup::dto::SignedInteger32Type, 2}, true};
+  const VariableUpdatedEvent event3{0, sup::dto::AnyValue{sup::dto::SignedInteger32Type, 3}, true};
+
+  DomainEventConflator conflator;
+  auto result = conflator.Conflate({event1, event2, event3});
+
+  const std::vector<domain_event_t> expected({event2, event3});
+  EXPECT_EQ(result, expected);
+  EXPECT_EQ(conflator.GetConflatedInstructionStateCount(), 0);
+  EXPECT_EQ(conflator.GetConflatedVariableCount(), 1);
+}
+
+TEST_F(DomainEventConflatorTest, UpdatesAreNotConflatedAcrossBarriers)
+{
+  using sup::oac_tree::ExecutionStatus;
+  using sup::oac_tree::JobState;
+
+  const auto event1 = CreateInstructionEvent(0, ExecutionStatus::NOT_FINISHED);
+  const JobStateChangedEvent event2{JobState::kPaused};
+  const auto event3 = CreateInstructionEvent(0, ExecutionStatus::SUCCESS);
+  const BreakpointHitEvent event4{0};
+  const auto event5 = CreateInstructionEvent(0, ExecutionStatus::NOT_FINISHED);
+  const auto event6 = CreateInstructionEvent(0, ExecutionStatus::SUCCESS);
+
+  DomainEventConflator conflator;
+  auto result = conflator.Conflate({event1, event2, event3, event4, event5, event6});
+
+  const std::vector<domain_event_t> expected({event1, event2, event3, event4, event6});
+  EXPECT_EQ(result, expected);
+  EXPECT_EQ(conflator.GetConflatedInstructionStateCount(), 1);
+}
+
+TEST_F(DomainEventConflatorTest, OtherEventsArePassedAsTheyAre)
+{
+  using sup::oac_tree::ExecutionStatus;
+
+  const auto event1 = CreateInstructionEvent(0, ExecutionStatus::NOT_FINISHED);
+  const ActiveInstructionChangedEvent event2{{0}};
+  const auto event3 = CreateInstructionEvent(0, ExecutionStatus::SUCCESS);
+  const ActiveInstructionChangedEvent event4{{}};
+
+  DomainEventConflator conflator;
+  auto result = conflator.Conflate({event1, event2, event3, event4});
+
+  const std::vector<domain_event_t> expected({event2, event3, event4});
+  EXPECT_EQ(result, expected);
+  EXPECT_EQ(conflator.GetConflatedInstructionStateCount(), 1);
+}
+
+}  // namespace oac_tree_gui::test
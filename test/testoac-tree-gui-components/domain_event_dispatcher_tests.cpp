@@ -25,6 +25,10 @@
 #include <gtest/gtest.h>
 #include <testutils/mock_domain_event_listener.h>
 
+#include <QTest>
+#include <deque>
+#include <thread>
+
 namespace oac_tree_gui::test
 {
 
@@ -51,6 +55,26 @@ public:
                                                    m_listener.CreateDispatcherContext());
   }
 
+  /**
+   * @brief Test helper method to create a dispatcher taking events from the given container.
+   *
+   * Empty event is returned when container is exhausted.
+   */
+  std::unique_ptr<DomainEventDispatcher> CreateDispatcher(std::deque<domain_event_t>& events)
+  {
+    auto get_event = [&events]() -> domain_event_t
+    {
+      if (events.empty())
+      {
+        return {};
+      }
+      auto result = events.front();
+      events.pop_front();
+      return result;
+    };
+    return std::make_unique<DomainEventDispatcher>(get_event, m_listener.CreateDispatcherContext());
+  }
+
   test::MockDomainEventListener m_listener;
 };
 
@@ -99,4 +123,187 @@ TEST_F(DomainEventDispatcherTest, BreakpointHitChanged)
   dispatcher->OnNewEvent();
 }
 
+TEST_F(DomainEventDispatcherTest, ProcessAllEventsInOnePass)
+{
+  const JobStateChangedEvent event1{::sup::oac_tree::JobState::kRunning};
+  const BreakpointHitEvent event2{42U};
+  const JobStateChangedEvent event3{::sup::oac_tree::JobState::kSucceeded};
+  std::deque<domain_event_t> events({event1, event2, event3});
+
+  auto dispatcher = CreateDispatcher(events);
+
+  {
+    const ::testing::InSequence seq;
+    EXPECT_CALL(m_listener, OnJobStateChanged(event1)).Times(1);
+    EXPECT_CALL(m_listener, OnBreakpointHitEvent(event2)).Times(1);
+    EXPECT_CALL(m_listener, OnJobStateChanged(event3)).Times(1);
+  }
+
+  dispatcher->OnNewEvents();
+  EXPECT_TRUE(events.empty());
+}
+
+TEST_F(DomainEventDispatcherTest, ProcessEventsWithCountBudget)
+{
+  const int event_count{5};
+  std::deque<domain_event_t> events;
+  for (int index = 0; index < event_count; ++index)
+  {
+    events.emplace_back(BreakpointHitEvent{static_cast<std::size_t>(index)});
+  }
+
+  auto dispatcher = CreateDispatcher(events);
+  dispatcher->SetDispatchBudget(2, std::chrono::milliseconds(0));
+
+  EXPECT_CALL(m_listener, OnBreakpointHitEvent(::testing::_)).Times(2);
+  dispatcher->OnNewEvents();
+  EXPECT_EQ(events.size(), 3);
+  ::testing::Mock::VerifyAndClearExpectations(&m_listener);
+
+  // remaining events are processed on the next event loop iterations
+  EXPECT_CALL(m_listener, OnBreakpointHitEvent(::testing::_)).Times(3);
+  EXPECT_TRUE(QTest::qWaitFor([&events]() { return events.empty(); }, 100));
+}
+
+//! Without explicit budget, a pass over slow events stops after the default time budget.
+TEST_F(DomainEventDispatcherTest, ProcessEventsWithDefaultBudget)
+{
+  const int event_count{10};
+  std::deque<domain_event_t> events;
+  for (int index = 0; index < event_count; ++index)
+  {
+    events.emplace_back(BreakpointHitEvent{static_cast<std::size_t>(index)});
+  }
+
+  auto dispatcher = CreateDispatcher(events);
+
+  auto slow_handler = [](const BreakpointHitEvent&)
+  { std::this_thread::sleep_for(DomainEventDispatcher::kDefaultMaxDuration / 2); };
+  EXPECT_CALL(m_listener, OnBreakpointHitEvent(::testing::_))
+      .Times(::testing::Between(2, event_count - 1))
+      .WillRepeatedly(slow_handler);
+
+  EXPECT_TRUE(dispatcher->ProcessEvents());
+  EXPECT_FALSE(events.empty());
+}
+
+//! A pass stops at the given deadline, after processing at least one event.
+TEST_F(DomainEventDispatcherTest, ProcessEventsWithDeadline)
+{
+  const int event_count{5};
+  std::deque<domain_event_t> events;
+  for (int index = 0; index < event_count; ++index)
+  {
+    events.emplace_back(BreakpointHitEvent{static_cast<std::size_t>(index)});
+  }
+
+  auto dispatcher = CreateDispatcher(events);
+
+  EXPECT_CALL(m_listener, OnBreakpointHitEvent(::testing::_)).Times(1);
+  EXPECT_TRUE(dispatcher->ProcessEvents(std::chrono::steady_clock::now()));
+  ::testing::Mock::VerifyAndClearExpectations(&m_listener);
+
+  EXPECT_CALL(m_listener, OnBreakpointHitEvent(::testing::_)).Times(event_count - 1);
+  EXPECT_FALSE(dispatcher->ProcessEvents());
+}
+
+TEST_F(DomainEventDispatcherTest, ProcessEventsWithConflation)
+{
+  using ::sup::oac_tree::ExecutionStatus;
+  using ::sup::oac_tree::InstructionState;
+
+  const InstructionStateUpdatedEvent event1{0, InstructionState{false, ExecutionStatus::RUNNING}};
+  const InstructionStateUpdatedEvent event2{0, InstructionState{false, ExecutionStatus::SUCCESS}};
+  const JobStateChangedEvent event3{::sup::oac_tree::JobState::kSucceeded};
+  std::deque<domain_event_t> events({event1, event2, event3});
+
+  auto dispatcher = CreateDispatcher(events);
+  dispatcher->SetConflationEnabled(true);
+
+  {
+    const ::testing::InSequence seq;
+    EXPECT_CALL(m_listener, OnInstructionStateUpdated(event2)).Times(1);
+    EXPECT_CALL(m_listener, OnJobStateChanged(event3)).Times(1);
+  }
+
+  dispatcher->OnNewEvents();
+  EXPECT_TRUE(events.empty());
+  EXPECT_EQ(dispatcher->GetConflatedInstructionStateCount(), 1);
+  EXPECT_EQ(dispatcher->GetConflatedVariableCount(), 0);
+}
+
+//! Events taken from the queue are reported before the conflation.
+TEST_F(DomainEventDispatcherTest, EventsFetchedBeforeConflation)
+{
+  using ::sup::oac_tree::ExecutionStatus;
+  using ::sup::oac_tree::InstructionState;
+
+  const InstructionStateUpdatedEvent event1{0, InstructionState{false, ExecutionStatus::RUNNING}};
+  const InstructionStateUpdatedEvent event2{0, InstructionState{false, ExecutionStatus::SUCCESS}};
+  std::deque<domain_event_t> events({event1, event2});
+
+  std::vector<domain_event_t> fetched_events;
+  auto context = m_listener.CreateDispatcherContext();
+  context.events_fetched = [&fetched_events](const std::vector<domain_event_t>& window)
+  { fetched_events.insert(fetched_events.end(), window.begin(), window.end()); };
+
+  auto get_event = [&events]() -> domain_event_t
+  {
+    if (events.empty())
+    {
+      return {};
+    }
+    auto result = events.front();
+    events.pop_front();
+    return result;
+  };
+  DomainEventDispatcher dispatcher(get_event, context);
+  dispatcher.SetConflationEnabled(true);
+
+  EXPECT_CALL(m_listener, OnInstructionStateUpdated(event2)).Times(1);
+
+  dispatcher.OnNewEvents();
+  ASSERT_EQ(fetched_events.size(), 2);
+  EXPECT_EQ(std::get<InstructionStateUpdatedEvent>(fetched_events.at(0)), event1);
+  EXPECT_EQ(std::get<InstructionStateUpdatedEvent>(fetched_events.at(1)), event2);
+}
+
+//! Context is notified once per processing pass, after all events of the pass are dispatched.
+TEST_F(DomainEventDispatcherTest, BatchProcessedNotification)
+{
+  std::deque<domain_event_t> events;
+  for (int index = 0; index < 5; ++index)
+  {
+    events.emplace_back(CreateLogEvent(Severity::kInfo, std::to_string(index)));
+  }
+
+  int log_event_count{0};
+  std::vector<int> batch_sizes;
+
+  auto context = m_listener.CreateDispatcherContext();
+  context.process_log_event = [&log_event_count](const LogEvent&) { ++log_event_count; };
+  context.batch_processed = [&log_event_count, &batch_sizes]()
+  {
+    batch_sizes.push_back(log_event_count);
+    log_event_count = 0;
+  };
+
+  auto get_event = [&events]() -> domain_event_t
+  {
+    if (events.empty())
+    {
+      return {};
+    }
+    auto result = events.front();
+    events.pop_front();
+    return result;
+  };
+  DomainEventDispatcher dispatcher(get_event, context);
+  dispatcher.SetDispatchBudget(3, std::chrono::milliseconds(0));
+
+  EXPECT_TRUE(dispatcher.ProcessEvents());
+  EXPECT_FALSE(dispatcher.ProcessEvents());
+  EXPECT_EQ(batch_sizes, std::vector<int>({3, 2}));
+}
+
 }  // namespace oac_tree_gui::test
@@ -0,0 +1,158 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/domain_event_metrics.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/domain_event_helper.h>
+
+#include <gtest/gtest.h>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for DomainEventMetrics class.
+ */
+class DomainEventMetricsTest : public ::testing::Test
+{
+public:
+  using time_point_t = DomainEventMetrics::time_point_t;
+
+  /**
+   * @brief Returns statistics of the event type with the given name.
+   */
+  static EventTypeStatistics GetTypeStatistics(const DomainEventStatistics& statistics,
+                                               const std::string& name)
+  {
+    for (const auto& event_type : statistics.event_types)
+    {
+      if (event_type.name == name)
+      {
+        return event_type;
+      }
+    }
+    return {};
+  }
+};
+
+TEST_F(DomainEventMetricsTest, InitialState)
+{
+  EXPECT_THROW(DomainEventMetrics(0), RuntimeException);
+
+  const DomainEventMetrics metrics;
+  const auto statistics = metrics.GetStatistics();
+
+  EXPECT_EQ(statistics.queue_depth, 0);
+  EXPECT_EQ(statistics.latency_sample_count, 0);
+  EXPECT_EQ(statistics.latency_max.count(), 0);
+
+  // all event types except empty one
+  ASSERT_EQ(statistics.event_types.size(), 6);
+  EXPECT_EQ(statistics.event_types.at(0).name, std::string("InstructionState"));
+  EXPECT_EQ(statistics.event_types.at(0).event_count, 0);
+}
+
+TEST_F(DomainEventMetricsTest, PostTime)
+{
+  const time_point_t post_time = std::chrono::steady_clock::now();
+
+  domain_event_t event = BreakpointHitEvent{42};
+  EXPECT_EQ(GetPostTime(event), time_point_t{});
+
+  SetPostTime(event, post_time);
+  EXPECT_EQ(GetPostTime(event), post_time);
+
+  // the timestamp doesn't participate in comparison
+  EXPECT_EQ(event, domain_event_t(BreakpointHitEvent{42}));
+
+  domain_event_t empty_event;
+  SetPostTime(empty_event, post_time);
+  EXPECT_EQ(GetPostTime(empty_event), time_point_t{});
+}
+
+TEST_F(DomainEventMetricsTest, HandlerTimeAndCount)
+{
+  DomainEventMetrics metrics;
+
+  const time_point_t start = std::chrono::steady_clock::now();
+  const domain_event_t event = BreakpointHitEvent{0};
+  metrics.RecordEvent(event, start, start + std::chrono::microseconds(100));
+  metrics.RecordEvent(event, start, start + std::chrono::microseconds(300));
+
+  const auto statistics = GetTypeStatistics(metrics.GetStatistics(), "BreakpointHit");
+  EXPECT_EQ(statistics.event_count, 2);
+  EXPECT_EQ(statistics.handler_time, std::chrono::microseconds(400));
+  EXPECT_EQ(statistics.max_handler_time, std::chrono::microseconds(300));
+
+  // event without timestamp doesn't contribute to latency
+  EXPECT_EQ(metrics.GetStatistics().latency_sample_count, 0);
+}
+
+TEST_F(DomainEventMetricsTest, LatencyPercentiles)
+{
+  const std::size_t sample_count = 10;
+  DomainEventMetrics metrics(sample_count);
+
+  const time_point_t post_time = std::chrono::steady_clock::now();
+
+  // first ten events are overwritten by the last ten
+  for (int latency = 1; latency <= 20; ++latency)
+  {
+    domain_event_t event = JobStateChangedEvent{sup::oac_tree::JobState::kRunning};
+    SetPostTime(event, post_time);
+    const auto apply_time = post_time + std::chrono::milliseconds(latency);
+    metrics.RecordEvent(event, apply_time, apply_time);
+  }
+
+  const auto statistics = metrics.GetStatistics();
+  EXPECT_EQ(statistics.latency_sample_count, sample_count);
+  EXPECT_EQ(statistics.latency_p50, std::chrono::milliseconds(15));
+  EXPECT_EQ(statistics.latency_p90, std::chrono::milliseconds(19));
+  EXPECT_EQ(statistics.latency_max, std::chrono::milliseconds(20));
+}
+
+TEST_F(DomainEventMetricsTest, EventRate)
+{
+  DomainEventMetrics metrics;
+
+  const time_point_t start = std::chrono::steady_clock::now();
+  const domain_event_t event = BreakpointHitEvent{0};
+
+  // ten events within the first second
+  for (int index = 0; index < 10; ++index)
+  {
+    metrics.RecordEvent(event, start, start);
+  }
+
+  // the event after the second completes the window
+  const auto next_window = start + std::chrono::seconds(1);
+  metrics.RecordEvent(event, next_window, next_window);
+
+  auto statistics = GetTypeStatistics(metrics.GetStatistics(next_window), "BreakpointHit");
+  EXPECT_NEAR(statistics.event_rate, 10.0, 0.5);
+
+  // nothing has happened for a long time, rate is going down
+  statistics = GetTypeStatistics(metrics.GetStatistics(next_window + std::chrono::seconds(10)),
+                                 "BreakpointHit");
+  EXPECT_LT(statistics.event_rate, 1.0);
+}
+
+}  // namespace oac_tree_gui::test
@@ -25,6 +25,7 @@
 #include <gtest/gtest.h>
 
 #include <QSignalSpy>
+#include <future>
 
 namespace oac_tree_gui::test
 {
@@ -33,6 +34,12 @@ namespace oac_tree_gui::test
 
 class DomainEventQueueTest : public ::testing::Test
 {
+public:
+  static domain_event_t CreateInstructionEvent(std::size_t index,
+                                               sup::oac_tree::ExecutionStatus status)
+  {
+    return InstructionStateUpdatedEvent{index, sup::oac_tree::InstructionState{false, status}};
+  }
 };
 
 TEST_F(DomainEventQueueTest, InitialState)
@@ -56,7 +63,8 @@ TEST_F(DomainEventQueueTest, PushAndPop)
   queue.PushEvent(event1);
   queue.PushEvent(event2);
 
-  EXPECT_EQ(spy_queue.count(), 2);
+  // single notification per burst of events
+  EXPECT_EQ(spy_queue.count(), 1);
 
   EXPECT_EQ(queue.GetEventCount(), 2);
   EXPECT_EQ(queue.PopEvent(), event1);
@@ -65,4 +73,211 @@ TEST_F(DomainEventQueueTest, PushAndPop)
   EXPECT_EQ(queue.GetEventCount(), 0);
 }
 
+//! Variable value travels through the queue without being copied.
+TEST_F(DomainEventQueueTest, VariableValueIsShared)
+{
+  DomainEventQueue queue;
+
+  const VariableUpdatedEvent event{0, sup::dto::AnyValue{sup::dto::SignedInteger32Type, 42}, true};
+  const SharedAnyValue payload = event.value;
+
+  queue.PushEvent(domain_event_t(event));
+
+  auto popped_event = queue.PopEvent();
+  const auto* variable_event = std::get_if<VariableUpdatedEvent>(&popped_event);
+  ASSERT_NE(variable_event, nullptr);
+  EXPECT_TRUE(variable_event->value.IsSameInstance(payload));
+  EXPECT_EQ(variable_event->value.Get(), sup::dto::AnyValue(sup::dto::SignedInteger32Type, 42));
+}
+
+TEST_F(DomainEventQueueTest, TryPopEvent)
+{
+  DomainEventQueue queue;
+
+  const QSignalSpy spy_queue(&queue, &DomainEventQueue::NewEvent);
+
+  // empty queue gives empty event
+  EXPECT_FALSE(IsValid(queue.TryPopEvent()));
+
+  const domain_event_t event1(JobStateChangedEvent{::sup::oac_tree::JobState::kInitial});
+  const domain_event_t event2(JobStateChangedEvent{::sup::oac_tree::JobState::kSucceeded});
+
+  queue.PushEvent(event1);
+  queue.PushEvent(event2);
+  EXPECT_EQ(spy_queue.count(), 1);
+
+  EXPECT_EQ(queue.TryPopEvent(), event1);
+  EXPECT_EQ(queue.TryPopEvent(), event2);
+
+  // queue is not yet known to be empty, notification is still pending
+  queue.PushEvent(event1);
+  EXPECT_EQ(spy_queue.count(), 1);
+  EXPECT_EQ(queue.TryPopEvent(), event1);
+
+  // consumer found the queue empty, the next event emits new notification
+  EXPECT_FALSE(IsValid(queue.TryPopEvent()));
+  queue.PushEvent(event2);
+  EXPECT_EQ(spy_queue.count(), 2);
+  EXPECT_EQ(queue.TryPopEvent(), event2);
+}
+
+TEST_F(DomainEventQueueTest, BlockOnOverflow)
+{
+  const DomainEventQueueOptions options{2, ProducerMode::kSingle, OverflowPolicy::kBlock};
+  DomainEventQueue queue(options);
+
+  const domain_event_t event1(BreakpointHitEvent{1});
+  const domain_event_t event2(BreakpointHitEvent{2});
+  const domain_event_t event3(BreakpointHitEvent{3});
+
+  queue.PushEvent(event1);
+  queue.PushEvent(event2);
+
+  // third event is pushed from another thread, it waits for the free space
+  auto future_result =
+      std::async(std::launch::async, [&queue, &event3]() { queue.PushEvent(event3); });
+  EXPECT_EQ(future_result.wait_for(std::chrono::milliseconds(10)), std::future_status::timeout);
+
+  EXPECT_EQ(queue.TryPopEvent(), event1);
+  future_result.wait();
+
+  EXPECT_EQ(queue.TryPopEvent(), event2);
+  EXPECT_EQ(queue.TryPopEvent(), event3);
+  EXPECT_EQ(queue.GetEventCount(), 0);
+  EXPECT_EQ(queue.GetDroppedEventCount(), 0);
+}
+
+TEST_F(DomainEventQueueTest, CloseReleasesBlockedProducer)
+{
+  const DomainEventQueueOptions options{1, ProducerMode::kMultiple, OverflowPolicy::kBlock};
+  DomainEventQueue queue(options);
+
+  const domain_event_t event1(BreakpointHitEvent{1});
+  const domain_event_t event2(BreakpointHitEvent{2});
+
+  queue.PushEvent(event1);
+
+  auto future_result =
+      std::async(std::launch::async, [&queue, &event2]() { queue.PushEvent(event2); });
+  EXPECT_EQ(future_result.wait_for(std::chrono::milliseconds(10)), std::future_status::timeout);
+
+  queue.Close();
+  future_result.wait();
+
+  // second event was discarded
+  EXPECT_EQ(queue.GetEventCount(), 1);
+  EXPECT_EQ(queue.TryPopEvent(), event1);
+  EXPECT_FALSE(IsValid(queue.TryPopEvent()));
+}
+
+TEST_F(DomainEventQueueTest, DropOldestOnOverflow)
+{
+  const DomainEventQueueOptions options{2, ProducerMode::kSingle, OverflowPolicy::kDropOldest};
+  DomainEventQueue queue(options);
+
+  std::vector<domain_event_t> events;
+  for (std::size_t index = 0; index < 5; ++index)
+  {
+    events.emplace_back(BreakpointHitEvent{index});
+    queue.PushEvent(events.back());
+  }
+
+  // two events in the ring buffer, two in the overflow area, one is dropped
+  EXPECT_EQ(queue.GetEventCount(), 4);
+  EXPECT_EQ(queue.GetDroppedEventCount(), 1);
+
+  EXPECT_EQ(queue.TryPopEvent(), events.at(0));
+  EXPECT_EQ(queue.TryPopEvent(), events.at(1));
+  EXPECT_EQ(queue.TryPopEvent(), events.at(3));
+  EXPECT_EQ(queue.TryPopEvent(), events.at(4));
+  EXPECT_FALSE(IsValid(queue.TryPopEvent()));
+}
+
+//! Active instruction changes are never dropped, the oldest of other events is dropped instead.
+TEST_F(DomainEventQueueTest, DropOldestKeepsActiveInstructions)
+{
+  const DomainEventQueueOptions options{2, ProducerMode::kSingle, OverflowPolicy::kDropOldest};
+  DomainEventQueue queue(options);
+
+  const std::vector<domain_event_t> events({BreakpointHitEvent{0}, BreakpointHitEvent{1},
+                                            ActiveInstructionChangedEvent{{}, {1}, {}, true},
+                                            BreakpointHitEvent{3}, BreakpointHitEvent{4}});
+  for (const auto& event : events)
+  {
+    queue.PushEvent(event);
+  }
+
+  EXPECT_EQ(queue.GetDroppedEventCount(), 1);
+  EXPECT_EQ(queue.TryPopEvent(), events.at(0));
+  EXPECT_EQ(queue.TryPopEvent(), events.at(1));
+  EXPECT_EQ(queue.TryPopEvent(), events.at(2));
+  EXPECT_EQ(queue.TryPopEvent(), events.at(4));
+  EXPECT_FALSE(IsValid(queue.TryPopEvent()));
+}
+
+TEST_F(DomainEventQueueTest, ConflateOnOverflow)
+{
+  using sup::oac_tree::ExecutionStatus;
+
+  const DomainEventQueueOptions options{2, ProducerMode::kSingle, OverflowPolicy::kConflate};
+  DomainEventQueue queue(options);
+
+  const auto event1 = CreateInstructionEvent(0, ExecutionStatus::NOT_FINISHED);
+  const auto event2 = CreateInstructionEvent(1, ExecutionStatus::NOT_FINISHED);
+  const auto event3 = CreateInstructionEvent(0, ExecutionStatus::SUCCESS);
+  const auto event4 = CreateInstructionEvent(0, ExecutionStatus::FAILURE);
+  const domain_event_t event5(JobStateChangedEvent{::sup::oac_tree::JobState::kFailed});
+
+  for (const auto& event : {event1, event2, event3, event4, event5})
+  {
+    queue.PushEvent(event);
+  }
+
+  // two events in the ring buffer, two in the overflow area, one is conflated
+  EXPECT_EQ(queue.GetEventCount(), 4);
+
+  EXPECT_EQ(queue.TryPopEvent(), event1);
+  EXPECT_EQ(queue.TryPopEvent(), event2);
+  EXPECT_EQ(queue.TryPopEvent(), event4);
+  EXPECT_EQ(queue.TryPopEvent(), event5);
+  EXPECT_FALSE(IsValid(queue.TryPopEvent()));
+
+  // the ring buffer is used again
+  queue.PushEvent(event1);
+  EXPECT_EQ(queue.TryPopEvent(), event1);
+}
+
+//! Events keep their order, while the producer overflows and the consumer takes events
+//! concurrently.
+TEST_F(DomainEventQueueTest, OverflowWithConcurrentConsumer)
+{
+  const DomainEventQueueOptions options{4, ProducerMode::kSingle, OverflowPolicy::kConflate};
+  DomainEventQueue queue(options);
+
+  const std::size_t event_count{1000};
+  auto producer = [&queue]()
+  {
+    for (std::size_t index = 0; index < event_count; ++index)
+    {
+      queue.PushEvent(BreakpointHitEvent{index});
+    }
+  };
+  auto future_result = std::async(std::launch::async, producer);
+
+  std::size_t expected_index{0};
+  while (expected_index < event_count)
+  {
+    auto event = queue.TryPopEvent();
+    if (const auto* breakpoint_event = std::get_if<BreakpointHitEvent>(&event))
+    {
+      ASSERT_EQ(breakpoint_event->index, expected_index);
+      ++expected_index;
+    }
+  }
+
+  future_result.wait();
+  EXPECT_EQ(queue.GetEventCount(), 0);
+  EXPECT_FALSE(IsValid(queue.TryPopEvent()));
+}
+
 }  // namespace oac_tree_gui::test
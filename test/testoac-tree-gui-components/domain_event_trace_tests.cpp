@@ -0,0 +1,111 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/domain_event_trace.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/domain_event_helper.h>
+
+#include <gtest/gtest.h>
+
+#include <QDir>
+#include <QTemporaryDir>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for DomainEventTraceWriter class and ReadDomainEventTrace function.
+ */
+class DomainEventTraceTest : public ::testing::Test
+{
+public:
+  using time_point_t = std::chrono::steady_clock::time_point;
+
+  std::string GetFilePath(const std::string& name) const
+  {
+    return m_dir.filePath(QString::fromStdString(name)).toStdString();
+  }
+
+  /**
+   * @brief Returns event with the posting time shifted from the given start.
+   */
+  static domain_event_t CreateEvent(domain_event_t event, time_point_t start,
+                                    std::chrono::milliseconds offset)
+  {
+    SetPostTime(event, start + offset);
+    return event;
+  }
+
+  QTemporaryDir m_dir{QDir::tempPath() + "/domain-event-trace-tests-XXXXXX"};
+};
+
+TEST_F(DomainEventTraceTest, WriteAndRead)
+{
+  using sup::oac_tree::ExecutionStatus;
+  using sup::oac_tree::InstructionState;
+  using sup::oac_tree::JobState;
+
+  const sup::dto::AnyValue job_info({{"name", {sup::dto::StringType, "procedure"}}});
+  const sup::dto::AnyValue value0{sup::dto::SignedInteger32Type, 42};
+  const sup::dto::AnyValue value1{sup::dto::SignedInteger32Type, 43};
+
+  const std::vector<domain_event_t> events = {
+      JobStateChangedEvent{JobState::kRunning},
+      InstructionStateUpdatedEvent{1, InstructionState{true, ExecutionStatus::NOT_FINISHED}},
+      VariableUpdatedEvent{0, value0, true},
+      VariableUpdatedEvent{0, value1, true},
+      VariableUpdatedEvent{1, sup::dto::AnyValue{}, false},
+      LogEvent{"", "", Severity::kError, "source", "message", 42},
+      ActiveInstructionChangedEvent{{}, {1, 2}, {3}, true},
+      BreakpointHitEvent{2},
+      InstructionStateUpdatedEvent{1, InstructionState{false, ExecutionStatus::SUCCESS}},
+      JobStateChangedEvent{JobState::kSucceeded}};
+
+  const auto file_name = GetFilePath("job.trace");
+  const auto start = std::chrono::steady_clock::now();
+  {
+    DomainEventTraceWriter writer(file_name, job_info);
+    for (std::size_t index = 0; index < events.size(); ++index)
+    {
+      writer.Record(CreateEvent(events[index], start, std::chrono::milliseconds(10 * index)));
+    }
+    writer.Record(domain_event_t{});  // empty events are ignored
+    EXPECT_EQ(writer.GetRecordCount(), events.size());
+  }
+
+  const auto trace = ReadDomainEventTrace(file_name);
+  EXPECT_EQ(trace.job_info, job_info);
+  ASSERT_EQ(trace.records.size(), events.size());
+  for (std::size_t index = 0; index < events.size(); ++index)
+  {
+    EXPECT_EQ(trace.records[index].event, events[index]);
+    EXPECT_EQ(trace.records[index].time_offset, std::chrono::milliseconds(10 * index));
+  }
+}
+
+TEST_F(DomainEventTraceTest, ReadInvalidFile)
+{
+  EXPECT_THROW(ReadDomainEventTrace(GetFilePath("non-existing.trace")), RuntimeException);
+  EXPECT_THROW(DomainEventTraceWriter(GetFilePath("non-existing/job.trace"), {}),
+               RuntimeException);
+}
+
+}  // namespace oac_tree_gui::test
@@ -164,6 +164,16 @@ TEST_F(DomainEventTest, ActiveInstructionChangedEvent)
     EXPECT_FALSE(event1 == event3);
     EXPECT_TRUE(event1 != event3);
   }
+
+  {  // delta
+    const ActiveInstructionChangedEvent event1{{}, {1}, {2}, true};
+    const ActiveInstructionChangedEvent event2{{}, {1}, {2}, true};
+    const ActiveInstructionChangedEvent event3{{}, {1}, {}, true};
+    const ActiveInstructionChangedEvent event4{{1}};
+    EXPECT_TRUE(event1 == event2);
+    EXPECT_FALSE(event1 == event3);
+    EXPECT_FALSE(event3 == event4);
+  }
 }
 
 TEST_F(DomainEventTest, BreakpointHitEvent)
@@ -22,13 +22,18 @@
 
 #include <oac_tree_gui/core/exceptions.h>
 #include <oac_tree_gui/jobsystem/domain_event_helper.h>
+#include <oac_tree_gui/jobsystem/domain_event_trace.h>
 #include <oac_tree_gui/jobsystem/user_context.h>
 
+#include <sup/dto/anyvalue.h>
 #include <sup/oac-tree/execution_status.h>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <QDir>
+#include <QTemporaryDir>
+
 namespace oac_tree_gui::test
 {
 
@@ -108,4 +113,83 @@ TEST_F(DomainJobObserverTest, ActiveInstructionUpdatedWhenMonitorIsMuted)
   observer.InstructionStateUpdated(0, InstructionState{false, ExecutionStatus::NOT_FINISHED});
 }
 
+//! Delta encoding of active instructions: the first notification carries the full list, next ones
+//! only the difference.
+TEST_F(DomainJobObserverTest, ActiveInstructionDelta)
+{
+  DomainJobObserver observer(m_event_listener.AsStdFunction(), {});
+  observer.SetActiveInstructionDeltaEnabled(true);
+
+  ActiveInstructionChangedEvent expected_event1{{1, 2}};
+
+  ActiveInstructionChangedEvent expected_event2;
+  expected_event2.added = {3};
+  expected_event2.removed = {1};
+  expected_event2.is_delta = true;
+
+  {
+    const ::testing::InSequence seq;
+    EXPECT_CALL(m_event_listener, Call(domain_event_t(expected_event1))).Times(1);
+    EXPECT_CALL(m_event_listener, Call(domain_event_t(expected_event2))).Times(1);
+  }
+
+  observer.NextInstructionsUpdated({1, 2});
+  observer.NextInstructionsUpdated({3, 2});
+
+  // same list doesn't generate notification
+  observer.NextInstructionsUpdated({2, 3});
+}
+
+//! Log messages are filtered by severity and folded before being reported. Folded messages are
+//! reported before the final job state.
+TEST_F(DomainJobObserverTest, LogFloodProtection)
+{
+  std::vector<domain_event_t> events;
+  auto on_event = [&events](domain_event_t&& event) { events.push_back(std::move(event)); };
+  DomainJobObserver observer(on_event, {});
+
+  LogFloodOptions options;
+  options.severity_threshold = Severity::kInfo;
+  options.fold_duplicates = true;
+  observer.SetLogFloodOptions(options);
+
+  observer.Log(static_cast<int>(Severity::kDebug), "debug");
+  observer.Message("abc");
+  observer.Message("abc");
+  observer.JobStateUpdated(sup::oac_tree::JobState::kSucceeded);
+
+  ASSERT_EQ(events.size(), 3);
+  EXPECT_EQ(std::get<LogEvent>(events.at(0)).message, std::string("abc"));
+  EXPECT_EQ(std::get<LogEvent>(events.at(1)).message,
+            std::string("Last message repeated 1 times"));
+  EXPECT_TRUE(std::holds_alternative<JobStateChangedEvent>(events.at(2)));
+
+  const auto statistics = observer.GetLogFloodStatistics();
+  EXPECT_EQ(statistics.below_threshold_count, 1);
+  EXPECT_EQ(statistics.folded_duplicate_count, 1);
+}
+
+//! Posted events are recorded only while the trace writer is set.
+TEST_F(DomainJobObserverTest, EventTrace)
+{
+  EXPECT_CALL(m_event_listener, Call(::testing::_)).Times(3);
+  DomainJobObserver observer(m_event_listener.AsStdFunction(), {});
+
+  const QTemporaryDir dir(QDir::tempPath() + "/domain-job-observer-tests-XXXXXX");
+  const auto file_name = dir.filePath("trace.txt").toStdString();
+  const sup::dto::AnyValue job_info({{"name", {sup::dto::StringType, "procedure"}}});
+  auto writer = std::make_shared<DomainEventTraceWriter>(file_name, job_info);
+
+  observer.Message("abc");
+  EXPECT_EQ(writer->GetRecordCount(), 0);
+
+  observer.SetEventTraceWriter(writer);
+  observer.Message("abc");
+  EXPECT_EQ(writer->GetRecordCount(), 1);
+
+  observer.SetEventTraceWriter({});
+  observer.Message("abc");
+  EXPECT_EQ(writer->GetRecordCount(), 1);
+}
+
 }  // namespace oac_tree_gui::test
@@ -0,0 +1,240 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/objects/gui_update_scheduler.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/model/standard_job_items.h>
+
+#include <gtest/gtest.h>
+
+#include <QTest>
+#include <thread>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for GuiUpdateScheduler class.
+ */
+class GuiUpdateSchedulerTest : public ::testing::Test
+{
+};
+
+TEST_F(GuiUpdateSchedulerTest, InitialState)
+{
+  const GuiUpdateScheduler scheduler;
+  EXPECT_FALSE(scheduler.IsEnabled());
+  EXPECT_EQ(scheduler.GetRefreshRate(), 0);
+  EXPECT_EQ(scheduler.GetBackgroundRefreshRate(), 0);
+  EXPECT_EQ(scheduler.GetJobCount(), 0);
+}
+
+TEST_F(GuiUpdateSchedulerTest, SetRefreshRate)
+{
+  GuiUpdateScheduler scheduler;
+
+  EXPECT_THROW(scheduler.SetRefreshRate(-1, 1), RuntimeException);
+  EXPECT_THROW(scheduler.SetRefreshRate(30, 0), RuntimeException);
+
+  scheduler.SetRefreshRate(30, 5);
+  EXPECT_TRUE(scheduler.IsEnabled());
+  EXPECT_EQ(scheduler.GetRefreshRate(), 30);
+  EXPECT_EQ(scheduler.GetBackgroundRefreshRate(), 5);
+
+  // background rate can't exceed active rate
+  scheduler.SetRefreshRate(10, 20);
+  EXPECT_EQ(scheduler.GetBackgroundRefreshRate(), 10);
+
+  // rates are clamped to one frame per millisecond
+  scheduler.SetRefreshRate(5000, 2000);
+  EXPECT_EQ(scheduler.GetRefreshRate(), 1000);
+  EXPECT_EQ(scheduler.GetBackgroundRefreshRate(), 1000);
+
+  scheduler.SetRefreshRate(0, 0);
+  EXPECT_FALSE(scheduler.IsEnabled());
+}
+
+TEST_F(GuiUpdateSchedulerTest, RegisterJob)
+{
+  LocalJobItem job_item;
+  GuiUpdateScheduler scheduler;
+
+  EXPECT_THROW(scheduler.RegisterJob(nullptr, [](auto) {}), RuntimeException);
+  EXPECT_THROW(scheduler.RegisterJob(&job_item, {}), RuntimeException);
+
+  scheduler.RegisterJob(&job_item, [](auto) {});
+  EXPECT_EQ(scheduler.GetJobCount(), 1);
+  EXPECT_THROW(scheduler.RegisterJob(&job_item, [](auto) {}), RuntimeException);
+
+  scheduler.UnregisterJob(&job_item);
+  EXPECT_EQ(scheduler.GetJobCount(), 0);
+}
+
+//! Active job is flushed on every frame, background job only when its period has passed.
+TEST_F(GuiUpdateSchedulerTest, ActiveAndBackgroundJobs)
+{
+  LocalJobItem active_job;
+  LocalJobItem background_job;
+
+  GuiUpdateScheduler scheduler;
+  scheduler.SetRefreshRate(1000, 1);
+
+  int active_flush_count{0};
+  int background_flush_count{0};
+  scheduler.RegisterJob(&active_job, [&active_flush_count](auto) { ++active_flush_count; });
+  scheduler.RegisterJob(&background_job,
+                        [&background_flush_count](auto) { ++background_flush_count; });
+  scheduler.SetActiveJob(&active_job);
+
+  scheduler.OnFrame();
+  scheduler.OnFrame();
+  EXPECT_EQ(active_flush_count, 2);
+  EXPECT_EQ(background_flush_count, 0);
+}
+
+//! Background jobs share the frame budget, and are flushed in round-robin order.
+TEST_F(GuiUpdateSchedulerTest, BackgroundJobsRoundRobin)
+{
+  LocalJobItem job0;
+  LocalJobItem job1;
+  LocalJobItem job2;
+
+  GuiUpdateScheduler scheduler;
+  scheduler.SetRefreshRate(1000, 1000);
+
+  // every flush exceeds the frame budget of half a millisecond
+  std::vector<JobItem*> flushed_jobs;
+  auto create_callback = [&flushed_jobs](JobItem* job)
+  {
+    return [&flushed_jobs, job](auto deadline)
+    {
+      flushed_jobs.push_back(job);
+      std::this_thread::sleep_until(deadline + std::chrono::milliseconds(1));
+    };
+  };
+  scheduler.RegisterJob(&job0, create_callback(&job0));
+  scheduler.RegisterJob(&job1, create_callback(&job1));
+  scheduler.RegisterJob(&job2, create_callback(&job2));
+  std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+  scheduler.OnFrame();
+  EXPECT_EQ(flushed_jobs, std::vector<JobItem*>({&job0}));
+
+  scheduler.OnFrame();
+  scheduler.OnFrame();
+  scheduler.OnFrame();
+  EXPECT_EQ(flushed_jobs, std::vector<JobItem*>({&job0, &job1, &job2, &job0}));
+}
+
+//! Job unregistering itself from the callback doesn't affect flushing of other jobs.
+TEST_F(GuiUpdateSchedulerTest, UnregisterJobFromCallback)
+{
+  LocalJobItem job0;
+  LocalJobItem job1;
+  LocalJobItem job2;
+
+  GuiUpdateScheduler scheduler;
+  scheduler.SetRefreshRate(100, 100);
+
+  std::vector<JobItem*> flushed_jobs;
+  scheduler.RegisterJob(&job0,
+                        [&flushed_jobs, &scheduler, &job0](auto)
+                        {
+                          flushed_jobs.push_back(&job0);
+                          scheduler.UnregisterJob(&job0);
+                        });
+  scheduler.RegisterJob(&job1, [&flushed_jobs, &job1](auto) { flushed_jobs.push_back(&job1); });
+  scheduler.RegisterJob(&job2, [&flushed_jobs, &job2](auto) { flushed_jobs.push_back(&job2); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+  scheduler.OnFrame();
+  EXPECT_EQ(scheduler.GetJobCount(), 2);
+  EXPECT_EQ(flushed_jobs, std::vector<JobItem*>({&job0, &job1, &job2}));
+}
+
+TEST_F(GuiUpdateSchedulerTest, DisabledScheduler)
+{
+  LocalJobItem job_item;
+  GuiUpdateScheduler scheduler;
+
+  int flush_count{0};
+  scheduler.RegisterJob(&job_item, [&flush_count](auto) { ++flush_count; });
+  scheduler.SetActiveJob(&job_item);
+
+  scheduler.OnFrame();
+  EXPECT_EQ(flush_count, 0);
+}
+
+//! Throttled active job is flushed at the background rate.
+TEST_F(GuiUpdateSchedulerTest, ThrottledJob)
+{
+  LocalJobItem job_item;
+  GuiUpdateScheduler scheduler;
+  scheduler.SetRefreshRate(1000, 1);
+
+  EXPECT_THROW(scheduler.SetJobThrottled(&job_item, true), RuntimeException);
+
+  int flush_count{0};
+  scheduler.RegisterJob(&job_item, [&flush_count](auto) { ++flush_count; });
+  scheduler.SetActiveJob(&job_item);
+  EXPECT_FALSE(scheduler.IsJobThrottled(&job_item));
+
+  scheduler.SetJobThrottled(&job_item, true);
+  EXPECT_TRUE(scheduler.IsJobThrottled(&job_item));
+  EXPECT_EQ(scheduler.GetThrottleRate(), 1);
+
+  scheduler.OnFrame();
+  scheduler.OnFrame();
+  EXPECT_EQ(flush_count, 0);
+
+  scheduler.SetJobThrottled(&job_item, false);
+  scheduler.OnFrame();
+  EXPECT_EQ(flush_count, 1);
+}
+
+//! Throttled job is flushed by the timer, even when the scheduler is disabled.
+TEST_F(GuiUpdateSchedulerTest, ThrottledJobOfDisabledScheduler)
+{
+  LocalJobItem job_item;
+  GuiUpdateScheduler scheduler;
+
+  int flush_count{0};
+  scheduler.RegisterJob(&job_item, [&flush_count](auto) { ++flush_count; });
+  scheduler.SetJobThrottled(&job_item, true);
+  EXPECT_GT(scheduler.GetThrottleRate(), 0);
+
+  EXPECT_TRUE(QTest::qWaitFor([&flush_count]() { return flush_count > 2; }, 1000));
+}
+
+TEST_F(GuiUpdateSchedulerTest, TimerFlushesJobs)
+{
+  LocalJobItem job_item;
+  GuiUpdateScheduler scheduler;
+  scheduler.SetRefreshRate(100, 10);
+
+  int flush_count{0};
+  scheduler.RegisterJob(&job_item, [&flush_count](auto) { ++flush_count; });
+  scheduler.SetActiveJob(&job_item);
+
+  EXPECT_TRUE(QTest::qWaitFor([&flush_count]() { return flush_count > 2; }, 1000));
+}
+
+}  // namespace oac_tree_gui::test
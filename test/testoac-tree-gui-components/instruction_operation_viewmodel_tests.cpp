@@ -22,6 +22,7 @@
 
 #include <oac_tree_gui/domain/domain_automation_helper.h>
 #include <oac_tree_gui/domain/domain_helper.h>
+#include <oac_tree_gui/jobsystem/instruction_profiler.h>
 #include <oac_tree_gui/model/instruction_info_item.h>
 #include <oac_tree_gui/model/sequencer_item_helper.h>
 #include <oac_tree_gui/model/sequencer_model.h>
@@ -38,6 +39,7 @@
 
 #include <QDebug>
 #include <QSignalSpy>
+#include <map>
 
 namespace oac_tree_gui::test
 {
@@ -65,7 +67,7 @@ public:
 };
 
 //! Single instruction in a model.
-//! ViewModel should see single row and 3 columns.
+//! ViewModel should see single row and 7 columns.
 
 TEST_F(InstructionOperationViewModelTest, SingleInstruction)
 {
@@ -78,7 +80,7 @@ TEST_F(InstructionOperationViewModelTest, SingleInstruction)
 
   InstructionOperationViewModel viewmodel(&model);
   EXPECT_EQ(viewmodel.rowCount(), 1);
-  EXPECT_EQ(viewmodel.columnCount(), 3);
+  EXPECT_EQ(viewmodel.columnCount(), 7);
 
   auto sequence_displayname_index = viewmodel.index(0, 0);
   auto sequence_status_index = viewmodel.index(0, 1);
@@ -112,7 +114,7 @@ TEST_F(InstructionOperationViewModelTest, SequenceWithChild)
   InstructionOperationViewModel viewmodel(&model);
   auto sequence_ndex = viewmodel.index(0, 0);
   EXPECT_EQ(viewmodel.rowCount(sequence_ndex), 2);
-  EXPECT_EQ(viewmodel.columnCount(sequence_ndex), 3);
+  EXPECT_EQ(viewmodel.columnCount(sequence_ndex), 7);
 
   auto wait0_displayname_index = viewmodel.index(0, 0, sequence_ndex);
   auto wait1_displayname_index = viewmodel.index(1, 0, sequence_ndex);
@@ -126,6 +128,53 @@ TEST_F(InstructionOperationViewModelTest, SequenceWithChild)
             std::string("Wait"));
 }
 
+TEST_F(InstructionOperationViewModelTest, ExecutionProfileColumns)
+{
+  TestModel model;
+
+  auto sequence = model.InsertItem<SequenceItem>();
+  auto wait = sequence->InsertItem<WaitItem>(mvvm::TagIndex::Append());
+
+  InstructionOperationViewModel viewmodel(&model);
+
+  EXPECT_EQ(viewmodel.headerData(3, Qt::Horizontal).toString(), QString("Calls"));
+  EXPECT_EQ(viewmodel.headerData(5, Qt::Horizontal).toString(), QString("Self, ms"));
+
+  // no profile provider
+  EXPECT_FALSE(viewmodel.data(viewmodel.index(0, 3), Qt::DisplayRole).isValid());
+
+  std::map<const InstructionItem*, InstructionProfileEntry> profile;
+  viewmodel.SetProfileProvider(
+      [&profile](const InstructionItem& item) -> const InstructionProfileEntry*
+      {
+        auto iter = profile.find(&item);
+        return iter == profile.end() ? nullptr : &iter->second;
+      });
+
+  // instruction which hasn't been executed yet
+  EXPECT_FALSE(viewmodel.data(viewmodel.index(0, 3), Qt::DisplayRole).isValid());
+
+  profile[sequence] = {0, 2, std::chrono::microseconds(1500), std::chrono::microseconds(1000)};
+  profile[wait] = {1, 2, std::chrono::microseconds(1000), std::chrono::microseconds(500)};
+
+  EXPECT_EQ(viewmodel.data(viewmodel.index(0, 3), Qt::DisplayRole).toInt(), 2);
+  EXPECT_EQ(viewmodel.data(viewmodel.index(0, 4), Qt::DisplayRole).toDouble(), 1.5);
+  EXPECT_EQ(viewmodel.data(viewmodel.index(0, 5), Qt::DisplayRole).toDouble(), 0.5);
+  EXPECT_EQ(viewmodel.data(viewmodel.index(0, 6), Qt::DisplayRole).toDouble(), 1.0);
+
+  // profile columns are read-only
+  EXPECT_FALSE(viewmodel.setData(viewmodel.index(0, 3), 42, Qt::EditRole));
+
+  QSignalSpy spy_data_changed(&viewmodel, &InstructionOperationViewModel::dataChanged);
+  viewmodel.UpdateProfile({wait});
+  ASSERT_EQ(spy_data_changed.count(), 1);
+
+  const auto wait_index = viewmodel.index(0, 0, viewmodel.index(0, 0));
+  auto arguments = spy_data_changed.takeFirst();
+  EXPECT_EQ(arguments.at(0).value<QModelIndex>(), viewmodel.index(0, 3, wait_index.parent()));
+  EXPECT_EQ(arguments.at(1).value<QModelIndex>(), viewmodel.index(0, 6, wait_index.parent()));
+}
+
 TEST_F(InstructionOperationViewModelTest, NotificationOnStatusChange)
 {
   TestModel model;
@@ -134,7 +183,7 @@ TEST_F(InstructionOperationViewModelTest, NotificationOnStatusChange)
 
   InstructionOperationViewModel viewmodel(&model);
   EXPECT_EQ(viewmodel.rowCount(), 1);
-  EXPECT_EQ(viewmodel.columnCount(), 3);
+  EXPECT_EQ(viewmodel.columnCount(), 7);
 
   QSignalSpy spy_data_changed(&viewmodel, &InstructionOperationViewModel::dataChanged);
 
@@ -163,7 +212,7 @@ TEST_F(InstructionOperationViewModelTest, InfoItemWithChildren)
   InstructionOperationViewModel viewmodel(&model);
   auto sequence_ndex = viewmodel.index(0, 0);
   EXPECT_EQ(viewmodel.rowCount(sequence_ndex), 2);
-  EXPECT_EQ(viewmodel.columnCount(sequence_ndex), 3);
+  EXPECT_EQ(viewmodel.columnCount(sequence_ndex), 7);
 
   auto wait0_displayname_index = viewmodel.index(0, 0, sequence_ndex);
   auto wait1_displayname_index = viewmodel.index(1, 0, sequence_ndex);
@@ -0,0 +1,129 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/operation/instruction_profile_helper.h"
+
+#include <oac_tree_gui/jobsystem/instruction_profiler.h>
+#include <oac_tree_gui/model/instruction_container_item.h>
+#include <oac_tree_gui/model/standard_instruction_items.h>
+
+#include <gtest/gtest.h>
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <map>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for helper methods from instruction_profile_helper.h
+ */
+class InstructionProfileHelperTest : public ::testing::Test
+{
+};
+
+TEST_F(InstructionProfileHelperTest, CalculateSelfTime)
+{
+  InstructionContainerItem container;
+  auto sequence = container.InsertItem<SequenceItem>(mvvm::TagIndex::Append());
+  auto wait0 = sequence->InsertItem<WaitItem>(mvvm::TagIndex::Append());
+  auto wait1 = sequence->InsertItem<WaitItem>(mvvm::TagIndex::Append());
+
+  std::map<const InstructionItem*, InstructionProfileEntry> profile;
+  auto find_profile = [&profile](const InstructionItem& item) -> const InstructionProfileEntry*
+  {
+    auto iter = profile.find(&item);
+    return iter == profile.end() ? nullptr : &iter->second;
+  };
+
+  // no profile yet
+  EXPECT_EQ(CalculateSelfTime(*sequence, find_profile), std::chrono::microseconds(0));
+
+  profile[sequence] = {0, 1, std::chrono::microseconds(10000), std::chrono::microseconds(10000)};
+  profile[wait0] = {1, 1, std::chrono::microseconds(3000), std::chrono::microseconds(3000)};
+  EXPECT_EQ(CalculateSelfTime(*sequence, find_profile), std::chrono::microseconds(7000));
+
+  profile[wait1] = {2, 1, std::chrono::microseconds(4000), std::chrono::microseconds(4000)};
+  EXPECT_EQ(CalculateSelfTime(*sequence, find_profile), std::chrono::microseconds(3000));
+  EXPECT_EQ(CalculateSelfTime(*wait0, find_profile), std::chrono::microseconds(3000));
+
+  // overlapping children of parallel instruction
+  profile[wait1].total_time = std::chrono::microseconds(9000);
+  EXPECT_EQ(CalculateSelfTime(*sequence, find_profile), std::chrono::microseconds(0));
+}
+
+TEST_F(InstructionProfileHelperTest, CreateCollapsedStackProfile)
+{
+  std::map<const InstructionItem*, InstructionProfileEntry> profile;
+  auto find_profile = [&profile](const InstructionItem& item) -> const InstructionProfileEntry*
+  {
+    auto iter = profile.find(&item);
+    return iter == profile.end() ? nullptr : &iter->second;
+  };
+
+  InstructionContainerItem container;
+  EXPECT_TRUE(CreateCollapsedStackProfile(container, find_profile).empty());
+
+  auto sequence = container.InsertItem<SequenceItem>(mvvm::TagIndex::Append());
+  sequence->SetName("Main;Loop");
+  auto wait0 = sequence->InsertItem<WaitItem>(mvvm::TagIndex::Append());
+  auto wait1 = sequence->InsertItem<WaitItem>(mvvm::TagIndex::Append());
+  wait1->SetName("Pause");
+
+  profile[sequence] = {0, 1, std::chrono::microseconds(1750), std::chrono::microseconds(1750)};
+  profile[wait0] = {1, 2, std::chrono::microseconds(1250), std::chrono::microseconds(1000)};
+
+  // wait1 has never been executed
+  const std::string expected("Main_Loop 500\nMain_Loop;Wait 1250\n");
+  EXPECT_EQ(CreateCollapsedStackProfile(container, find_profile), expected);
+}
+
+TEST_F(InstructionProfileHelperTest, CreateChromeTraceProfile)
+{
+  WaitItem wait;
+  wait.SetName("Pause");
+
+  const std::vector<InstructionCallRecord> records{
+      {1, std::chrono::microseconds(10), std::chrono::microseconds(20)},
+      {2, std::chrono::microseconds(40), std::chrono::microseconds(5)}};
+  auto find_instruction = [&wait](std::size_t index) -> const InstructionItem*
+  { return index == 1 ? &wait : nullptr; };
+
+  const auto profile = CreateChromeTraceProfile(records, find_instruction);
+  const auto document = QJsonDocument::fromJson(QByteArray::fromStdString(profile));
+  ASSERT_TRUE(document.isObject());
+
+  const auto events = document.object()["traceEvents"].toArray();
+  ASSERT_EQ(events.size(), 2);
+
+  const auto event0 = events.at(0).toObject();
+  EXPECT_EQ(event0["name"].toString(), QString("Pause"));
+  EXPECT_EQ(event0["ph"].toString(), QString("X"));
+  EXPECT_EQ(event0["ts"].toInt(), 10);
+  EXPECT_EQ(event0["dur"].toInt(), 20);
+  EXPECT_EQ(event0["args"].toObject()["index"].toInt(), 1);
+
+  // instruction without GUI counterpart is reported by its index
+  EXPECT_EQ(events.at(1).toObject()["name"].toString(), QString("Instruction 2"));
+}
+
+}  // namespace oac_tree_gui::test
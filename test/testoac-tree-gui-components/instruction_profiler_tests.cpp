@@ -0,0 +1,168 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/instruction_profiler.h"
+
+#include <gtest/gtest.h>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for InstructionProfiler class.
+ */
+class InstructionProfilerTest : public ::testing::Test
+{
+public:
+  using clock_t = InstructionProfiler::clock_t;
+  using ExecutionStatus = sup::oac_tree::ExecutionStatus;
+  using microseconds = std::chrono::microseconds;
+};
+
+TEST_F(InstructionProfilerTest, InitialState)
+{
+  InstructionProfiler profiler;
+
+  EXPECT_TRUE(profiler.TakeUpdatedEntries().empty());
+  EXPECT_TRUE(profiler.GetEntries().empty());
+  EXPECT_TRUE(profiler.GetCallRecords().empty());
+  EXPECT_EQ(profiler.GetDroppedCallRecordCount(), 0);
+}
+
+TEST_F(InstructionProfilerTest, SingleExecution)
+{
+  InstructionProfiler profiler;
+
+  const auto start = clock_t::now();
+  profiler.InstructionStatusUpdated(1, ExecutionStatus::NOT_FINISHED, start);
+  profiler.InstructionStatusUpdated(1, ExecutionStatus::RUNNING, start + microseconds(10));
+  EXPECT_TRUE(profiler.TakeUpdatedEntries().empty());
+
+  profiler.InstructionStatusUpdated(1, ExecutionStatus::SUCCESS, start + microseconds(100));
+
+  auto entries = profiler.TakeUpdatedEntries();
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_EQ(entries.at(0).instr_idx, 1);
+  EXPECT_EQ(entries.at(0).call_count, 1);
+  EXPECT_EQ(entries.at(0).total_time, microseconds(100));
+  EXPECT_EQ(entries.at(0).max_time, microseconds(100));
+
+  // entries are taken only once
+  EXPECT_TRUE(profiler.TakeUpdatedEntries().empty());
+  EXPECT_EQ(profiler.GetEntries().size(), 1);
+
+  const auto records = profiler.GetCallRecords();
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records.at(0).instr_idx, 1);
+  EXPECT_EQ(records.at(0).start_time, microseconds(0));
+  EXPECT_EQ(records.at(0).duration, microseconds(100));
+}
+
+TEST_F(InstructionProfilerTest, NestedExecutions)
+{
+  InstructionProfiler profiler;
+
+  // sequence 0 runs child 1 twice
+  const auto start = clock_t::now();
+  profiler.InstructionStatusUpdated(0, ExecutionStatus::NOT_FINISHED, start);
+  profiler.InstructionStatusUpdated(1, ExecutionStatus::NOT_FINISHED, start + microseconds(10));
+  profiler.InstructionStatusUpdated(1, ExecutionStatus::SUCCESS, start + microseconds(30));
+  profiler.InstructionStatusUpdated(1, ExecutionStatus::NOT_STARTED, start + microseconds(30));
+  profiler.InstructionStatusUpdated(1, ExecutionStatus::NOT_FINISHED, start + microseconds(40));
+  profiler.InstructionStatusUpdated(1, ExecutionStatus::FAILURE, start + microseconds(90));
+  profiler.InstructionStatusUpdated(0, ExecutionStatus::FAILURE, start + microseconds(100));
+
+  auto entries = profiler.TakeUpdatedEntries();
+  ASSERT_EQ(entries.size(), 2);
+  EXPECT_EQ(entries.at(0).instr_idx, 1);
+  EXPECT_EQ(entries.at(0).call_count, 2);
+  EXPECT_EQ(entries.at(0).total_time, microseconds(70));
+  EXPECT_EQ(entries.at(0).max_time, microseconds(50));
+  EXPECT_EQ(entries.at(1).instr_idx, 0);
+  EXPECT_EQ(entries.at(1).call_count, 1);
+  EXPECT_EQ(entries.at(1).total_time, microseconds(100));
+
+  const auto records = profiler.GetCallRecords();
+  ASSERT_EQ(records.size(), 3);
+  EXPECT_EQ(records.at(1).start_time, microseconds(40));
+  EXPECT_EQ(records.at(1).duration, microseconds(50));
+  EXPECT_EQ(records.at(2).instr_idx, 0);
+}
+
+TEST_F(InstructionProfilerTest, AbandonedExecution)
+{
+  InstructionProfiler profiler;
+
+  const auto start = clock_t::now();
+  profiler.InstructionStatusUpdated(0, ExecutionStatus::NOT_FINISHED, start);
+  profiler.InstructionStatusUpdated(0, ExecutionStatus::NOT_STARTED, start + microseconds(10));
+  EXPECT_TRUE(profiler.TakeUpdatedEntries().empty());
+
+  // finish without a start is counted with zero duration
+  profiler.InstructionStatusUpdated(0, ExecutionStatus::SUCCESS, start + microseconds(20));
+  auto entries = profiler.TakeUpdatedEntries();
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_EQ(entries.at(0).call_count, 1);
+  EXPECT_EQ(entries.at(0).total_time, microseconds(0));
+}
+
+TEST_F(InstructionProfilerTest, CallRecordLimit)
+{
+  InstructionProfiler profiler(2);
+
+  const auto start = clock_t::now();
+  for (int index = 0; index < 5; ++index)
+  {
+    profiler.InstructionStatusUpdated(0, ExecutionStatus::NOT_FINISHED, start);
+    profiler.InstructionStatusUpdated(0, ExecutionStatus::SUCCESS, start + microseconds(10));
+  }
+
+  EXPECT_EQ(profiler.GetCallRecords().size(), 2);
+  EXPECT_EQ(profiler.GetDroppedCallRecordCount(), 3);
+
+  // accumulated times are not affected by the limit
+  auto entries = profiler.TakeUpdatedEntries();
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_EQ(entries.at(0).call_count, 5);
+  EXPECT_EQ(entries.at(0).total_time, microseconds(50));
+}
+
+TEST_F(InstructionProfilerTest, Reset)
+{
+  InstructionProfiler profiler;
+
+  const auto start = clock_t::now();
+  profiler.InstructionStatusUpdated(2, ExecutionStatus::NOT_FINISHED, start);
+  profiler.InstructionStatusUpdated(2, ExecutionStatus::SUCCESS, start + microseconds(10));
+  EXPECT_EQ(profiler.TakeUpdatedEntries().size(), 1);
+
+  profiler.Reset();
+  EXPECT_TRUE(profiler.GetEntries().empty());
+  EXPECT_TRUE(profiler.GetCallRecords().empty());
+
+  // previously reported instruction is updated once more with cleared values
+  auto entries = profiler.TakeUpdatedEntries();
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_EQ(entries.at(0).instr_idx, 2);
+  EXPECT_EQ(entries.at(0).call_count, 0);
+  EXPECT_EQ(entries.at(0).total_time, microseconds(0));
+}
+
+}  // namespace oac_tree_gui::test
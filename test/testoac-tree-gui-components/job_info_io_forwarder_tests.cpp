@@ -0,0 +1,191 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/job_info_io_forwarder.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <future>
+
+using ::testing::_;
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for JobInfoIOForwarder class.
+ */
+class JobInfoIOForwarderTest : public ::testing::Test
+{
+public:
+  class MockJobInfoIO : public sup::oac_tree::IJobInfoIO
+  {
+  public:
+    MOCK_METHOD(void, InitNumberOfInstructions, (sup::dto::uint32), (override));
+    MOCK_METHOD(void, InstructionStateUpdated, (sup::dto::uint32, sup::oac_tree::InstructionState),
+                (override));
+    MOCK_METHOD(void, BreakpointInstructionUpdated, (sup::dto::uint32), (override));
+    MOCK_METHOD(void, VariableUpdated, (sup::dto::uint32, const sup::dto::AnyValue&, bool),
+                (override));
+    MOCK_METHOD(void, JobStateUpdated, (sup::oac_tree::JobState), (override));
+    MOCK_METHOD(void, PutValue, (const sup::dto::AnyValue&, const std::string&), (override));
+    MOCK_METHOD(bool, GetUserValue, (sup::dto::uint64, sup::dto::AnyValue&, const std::string&),
+                (override));
+    MOCK_METHOD(int, GetUserChoice,
+                (sup::dto::uint64, const std::vector<std::string>&, const sup::dto::AnyValue&),
+                (override));
+    MOCK_METHOD(void, Interrupt, (sup::dto::uint64), (override));
+    MOCK_METHOD(void, Message, (const std::string&), (override));
+    MOCK_METHOD(void, Log, (int, const std::string&), (override));
+    MOCK_METHOD(void, ProcedureTicked, (), (override));
+  };
+
+  ::testing::StrictMock<MockJobInfoIO> m_target;
+};
+
+TEST_F(JobInfoIOForwarderTest, SetTarget)
+{
+  JobInfoIOForwarder forwarder;
+  EXPECT_EQ(forwarder.GetPendingCount(), 0);
+  EXPECT_THROW(forwarder.SetTarget(nullptr), RuntimeException);
+
+  forwarder.SetTarget(&m_target);
+  EXPECT_THROW(forwarder.SetTarget(&m_target), RuntimeException);
+
+  // reports are forwarded directly
+  EXPECT_CALL(m_target, JobStateUpdated(sup::oac_tree::JobState::kRunning));
+  EXPECT_CALL(m_target, ProcedureTicked());
+  forwarder.JobStateUpdated(sup::oac_tree::JobState::kRunning);
+  forwarder.ProcedureTicked();
+  EXPECT_EQ(forwarder.GetPendingCount(), 0);
+}
+
+TEST_F(JobInfoIOForwarderTest, ReplayReports)
+{
+  JobInfoIOForwarder forwarder;
+
+  const sup::oac_tree::InstructionState state{false, sup::oac_tree::ExecutionStatus::SUCCESS};
+  forwarder.InitNumberOfInstructions(2);
+  forwarder.InstructionStateUpdated(1, state);
+  forwarder.VariableUpdated(0, sup::dto::AnyValue{}, true);
+  forwarder.Log(3, "log");
+  forwarder.Message("message");
+
+  // ticks before the attachment are not stored
+  forwarder.ProcedureTicked();
+  EXPECT_EQ(forwarder.GetPendingCount(), 5);
+
+  std::promise<void> replayed;
+  {
+    const ::testing::InSequence seq;
+    EXPECT_CALL(m_target, InitNumberOfInstructions(2));
+    EXPECT_CALL(m_target, InstructionStateUpdated(1, _));
+    EXPECT_CALL(m_target, VariableUpdated(0, _, true));
+    EXPECT_CALL(m_target, Log(3, std::string("log")));
+    EXPECT_CALL(m_target, Message(std::string("message")))
+        .WillOnce([&replayed](const std::string&) { replayed.set_value(); });
+  }
+  forwarder.SetTarget(&m_target);
+
+  // replay happens on the dedicated thread
+  replayed.get_future().wait();
+  EXPECT_EQ(forwarder.GetPendingCount(), 0);
+}
+
+//! The target is blocked during the replay, as DomainJobObserver waiting for the GUI thread. The
+//! attaching thread is not blocked, reports coming meanwhile are delivered after stored ones.
+TEST_F(JobInfoIOForwarderTest, ReportsDuringReplay)
+{
+  JobInfoIOForwarder forwarder;
+  forwarder.Message("first");
+
+  std::promise<void> started;
+  std::promise<void> release;
+  auto release_future = release.get_future();
+  {
+    const ::testing::InSequence seq;
+    EXPECT_CALL(m_target, Message(std::string("first")))
+        .WillOnce(
+            [&started, &release_future](const std::string&)
+            {
+              started.set_value();
+              release_future.wait();
+            });
+    EXPECT_CALL(m_target, Message(std::string("second")));
+    EXPECT_CALL(m_target, GetUserChoice(42, _, _)).WillOnce(::testing::Return(1));
+  }
+
+  forwarder.SetTarget(&m_target);
+  started.get_future().wait();
+  forwarder.Message("second");
+  EXPECT_EQ(forwarder.GetPendingCount(), 1);
+
+  // user request waits till the replay is over
+  auto get_choice = [&forwarder]()
+  { return forwarder.GetUserChoice(42, {"a", "b"}, sup::dto::AnyValue{}); };
+  auto future = std::async(std::launch::async, get_choice);
+  EXPECT_EQ(future.wait_for(std::chrono::milliseconds(20)), std::future_status::timeout);
+
+  release.set_value();
+  EXPECT_EQ(future.get(), 1);
+  EXPECT_EQ(forwarder.GetPendingCount(), 0);
+}
+
+TEST_F(JobInfoIOForwarderTest, UserRequestWaitsForTarget)
+{
+  JobInfoIOForwarder forwarder;
+
+  auto get_choice = [&forwarder]()
+  { return forwarder.GetUserChoice(42, {"a", "b"}, sup::dto::AnyValue{}); };
+  auto future = std::async(std::launch::async, get_choice);
+  EXPECT_EQ(future.wait_for(std::chrono::milliseconds(20)), std::future_status::timeout);
+
+  EXPECT_CALL(m_target, GetUserChoice(42, _, _)).WillOnce(::testing::Return(1));
+  forwarder.SetTarget(&m_target);
+  EXPECT_EQ(future.get(), 1);
+}
+
+TEST_F(JobInfoIOForwarderTest, Close)
+{
+  JobInfoIOForwarder forwarder;
+  forwarder.Message("message");
+
+  auto future = std::async(std::launch::async,
+                           [&forwarder]()
+                           {
+                             sup::dto::AnyValue value;
+                             return forwarder.GetUserValue(42, value, "description");
+                           });
+  EXPECT_EQ(future.wait_for(std::chrono::milliseconds(20)), std::future_status::timeout);
+
+  // request is released without an answer, stored reports are dropped
+  forwarder.Close();
+  EXPECT_FALSE(future.get());
+  EXPECT_EQ(forwarder.GetPendingCount(), 0);
+
+  forwarder.Message("message");
+  EXPECT_EQ(forwarder.GetPendingCount(), 0);
+  EXPECT_EQ(forwarder.GetUserChoice(42, {"a"}, sup::dto::AnyValue{}), -1);
+}
+
+}  // namespace oac_tree_gui::test
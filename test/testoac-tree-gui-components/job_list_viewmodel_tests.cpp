@@ -95,6 +95,11 @@ TEST_F(JobListViewModelTest, NotificationOnStatusChange)
 
   procedure0->SetStatus(RunnerStatus::kInitial);
   EXPECT_EQ(spy_data_changed.count(), 1);
+
+  // job waiting for a free slot
+  procedure0->SetStatus(RunnerStatus::kQueued);
+  EXPECT_EQ(spy_data_changed.count(), 2);
+  EXPECT_EQ(viewmodel.data(status_index, Qt::DisplayRole).toString(), QString("Queued"));
 }
 
 }  // namespace oac_tree_gui::test
@@ -20,6 +20,8 @@
 
 #include "oac_tree_gui/jobsystem/job_log_severity.h"
 
+#include <oac_tree_gui/core/exceptions.h>
+
 #include <gtest/gtest.h>
 
 namespace oac_tree_gui::test
@@ -44,4 +46,12 @@ TEST_F(JobLogSeverityTest, SeverityToString)
   EXPECT_EQ(ToString(Severity::kTrace), std::string("TRACE"));
 }
 
+TEST_F(JobLogSeverityTest, GetSeverity)
+{
+  EXPECT_EQ(GetSeverity("EMERGENCY"), Severity::kEmergency);
+  EXPECT_EQ(GetSeverity("WARNING"), Severity::kWarning);
+  EXPECT_EQ(GetSeverity("TRACE"), Severity::kTrace);
+  EXPECT_THROW(GetSeverity("unknown"), RuntimeException);
+}
+
 }  // namespace oac_tree_gui::test
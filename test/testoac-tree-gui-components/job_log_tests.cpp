@@ -20,6 +20,8 @@
 
 #include "oac_tree_gui/jobsystem/objects/job_log.h"
 
+#include <oac_tree_gui/core/exceptions.h>
+
 #include <gtest/gtest.h>
 
 #include <QSignalSpy>
@@ -44,7 +46,7 @@ TEST_F(JobLogTest, Append)
   JobLog job_log;
 
   auto log_event = CreateLogEvent(Severity::kNotice, "abc");
-  QSignalSpy spy_appended(&job_log, &JobLog::LogEventAppended);
+  QSignalSpy spy_appended(&job_log, &JobLog::LogEventsAppended);
   QSignalSpy spy_cleared(&job_log, &JobLog::LogCleared);
 
   job_log.Append(log_event);
@@ -54,6 +56,31 @@ TEST_F(JobLogTest, Append)
 
   EXPECT_EQ(spy_appended.count(), 1);
   EXPECT_EQ(spy_cleared.count(), 0);
+  EXPECT_EQ(spy_appended.takeFirst(), QList<QVariant>({0, 0}));
+}
+
+TEST_F(JobLogTest, AppendRange)
+{
+  JobLog job_log;
+  job_log.Append(CreateLogEvent(Severity::kNotice, "abc"));
+
+  QSignalSpy spy_appended(&job_log, &JobLog::LogEventsAppended);
+
+  const std::vector<LogEvent> events({CreateLogEvent(Severity::kNotice, "a"),
+                                      CreateLogEvent(Severity::kNotice, "b"),
+                                      CreateLogEvent(Severity::kNotice, "c")});
+  job_log.Append(events);
+
+  EXPECT_EQ(job_log.GetSize(), 4);
+  EXPECT_EQ(job_log.At(3), events.back());
+
+  // single notification for the whole range
+  ASSERT_EQ(spy_appended.count(), 1);
+  EXPECT_EQ(spy_appended.takeFirst(), QList<QVariant>({1, 3}));
+
+  // appending an empty range doesn't trigger notifications
+  job_log.Append(std::vector<LogEvent>());
+  EXPECT_EQ(spy_appended.count(), 0);
 }
 
 TEST_F(JobLogTest, ClearLog)
@@ -63,7 +90,7 @@ TEST_F(JobLogTest, ClearLog)
   auto log_event = CreateLogEvent(Severity::kNotice, "abc");
   job_log.Append(log_event);
 
-  QSignalSpy spy_appended(&job_log, &JobLog::LogEventAppended);
+  QSignalSpy spy_appended(&job_log, &JobLog::LogEventsAppended);
   QSignalSpy spy_cleared(&job_log, &JobLog::LogCleared);
 
   job_log.ClearLog();
@@ -74,4 +101,160 @@ TEST_F(JobLogTest, ClearLog)
   EXPECT_EQ(spy_cleared.count(), 1);
 }
 
+TEST_F(JobLogTest, SeverityIndices)
+{
+  JobLog job_log;
+  job_log.Append(CreateLogEvent(Severity::kError, "a"));
+  job_log.Append(CreateLogEvent(Severity::kInfo, "b"));
+  job_log.Append(CreateLogEvent(Severity::kError, "c"));
+
+  EXPECT_EQ(job_log.GetSeverityIndices(Severity::kError), std::vector<int>({0, 2}));
+  EXPECT_EQ(job_log.GetSeverityIndices(Severity::kInfo), std::vector<int>({1}));
+  EXPECT_TRUE(job_log.GetSeverityIndices(Severity::kDebug).empty());
+
+  job_log.ClearLog();
+  EXPECT_TRUE(job_log.GetSeverityIndices(Severity::kError).empty());
+}
+
+TEST_F(JobLogTest, FindRecords)
+{
+  JobLog job_log;
+  job_log.Append(CreateLogEvent(Severity::kInfo, "Instruction Wait started"));
+  job_log.Append(CreateLogEvent(Severity::kInfo, "Variable var0 updated"));
+  job_log.Append(CreateLogEvent(Severity::kInfo, "WAIT finished"));
+
+  EXPECT_EQ(job_log.FindRecords("wait"), std::vector<int>({0, 2}));
+  EXPECT_EQ(job_log.FindRecords("wait", 1), std::vector<int>({2}));
+  EXPECT_EQ(job_log.FindRecords("0"), std::vector<int>({1}));
+  EXPECT_EQ(job_log.FindRecords("ed"), std::vector<int>({0, 1, 2}));
+  EXPECT_TRUE(job_log.FindRecords("waiting").empty());
+  EXPECT_TRUE(job_log.FindRecords("").empty());
+
+  job_log.ClearLog();
+  EXPECT_TRUE(job_log.FindRecords("wait").empty());
+}
+
+//! Log with limited capacity keeps only recent records in memory, the rest is read from disk.
+TEST_F(JobLogTest, SpillToDisk)
+{
+  JobLog job_log;
+  EXPECT_EQ(job_log.GetCapacity(), 0);
+
+  const std::size_t capacity = 100;
+  job_log.SetCapacity(capacity);
+
+  const int record_count = 1000;
+  for (int index = 0; index < record_count; ++index)
+  {
+    job_log.Append(LogEvent{"", "", Severity::kInfo, "source", std::to_string(index), index});
+    EXPECT_LE(job_log.GetInMemorySize(), capacity + capacity / 4);
+  }
+
+  ASSERT_EQ(job_log.GetSize(), record_count);
+
+  // browsing the whole history, from the end to the beginning
+  for (int index = record_count - 1; index >= 0; --index)
+  {
+    const auto record = job_log.GetRecord(index);
+    EXPECT_EQ(record.message, std::to_string(index));
+    EXPECT_EQ(record.timestamp, index);
+    EXPECT_EQ(record.source, std::string_view("source"));
+  }
+
+  const LogEvent expected_event{"", "", Severity::kInfo, "source", "0", 0};
+  EXPECT_EQ(job_log.At(0), expected_event);
+  EXPECT_THROW(job_log.GetRecord(record_count), RuntimeException);
+
+  // once written, records are read back from segment files
+  job_log.WaitForPendingWrites();
+  for (int index = 0; index < record_count; ++index)
+  {
+    EXPECT_EQ(job_log.GetRecord(index).message, std::to_string(index));
+  }
+
+  job_log.ClearLog();
+  EXPECT_EQ(job_log.GetSize(), 0);
+  EXPECT_EQ(job_log.GetInMemorySize(), 0);
+
+  job_log.Append(expected_event);
+  EXPECT_EQ(job_log.At(0), expected_event);
+}
+
+//! Clearing the log while segments are being written.
+TEST_F(JobLogTest, ClearLogWithPendingWrites)
+{
+  JobLog job_log;
+  job_log.SetCapacity(4);
+
+  for (int index = 0; index < 100; ++index)
+  {
+    job_log.Append(CreateLogEvent(Severity::kInfo, std::to_string(index)));
+  }
+  job_log.ClearLog();
+  EXPECT_EQ(job_log.GetSize(), 0);
+
+  for (int index = 0; index < 20; ++index)
+  {
+    job_log.Append(CreateLogEvent(Severity::kInfo, "message" + std::to_string(index)));
+  }
+  job_log.WaitForPendingWrites();
+  EXPECT_EQ(job_log.GetRecord(0).message, std::string_view("message0"));
+  EXPECT_EQ(job_log.FindRecords("message0"), std::vector<int>({0}));
+}
+
+//! Severity and search indices cover only records in memory, spilled records are read back.
+TEST_F(JobLogTest, IndicesOfSpilledRecords)
+{
+  JobLog job_log;
+  job_log.SetCapacity(4);
+
+  const int record_count = 20;
+  for (int index = 0; index < record_count; ++index)
+  {
+    const auto severity = index % 5 == 0 ? Severity::kError : Severity::kInfo;
+    job_log.Append(CreateLogEvent(severity, "message" + std::to_string(index)));
+  }
+  ASSERT_LE(job_log.GetInMemorySize(), 5);
+
+  EXPECT_EQ(job_log.GetSeverityIndices(Severity::kError), std::vector<int>({0, 5, 10, 15}));
+  EXPECT_EQ(job_log.GetSeverityIndices(Severity::kError, 6), std::vector<int>({10, 15}));
+  EXPECT_EQ(job_log.GetSeverityIndices(Severity::kInfo, 17), std::vector<int>({17, 18, 19}));
+  EXPECT_TRUE(job_log.GetSeverityIndices(Severity::kDebug).empty());
+
+  EXPECT_EQ(job_log.FindRecords("message1"),
+            std::vector<int>({1, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19}));
+  EXPECT_EQ(job_log.FindRecords("Message1", 12),
+            std::vector<int>({12, 13, 14, 15, 16, 17, 18, 19}));
+  EXPECT_TRUE(job_log.FindRecords("message20").empty());
+  EXPECT_TRUE(job_log.FindRecords("finished").empty());
+
+  // short queries can't use trigrams, all segments are scanned
+  EXPECT_EQ(job_log.FindRecords("e2"), std::vector<int>({2}));
+  EXPECT_EQ(job_log.FindRecords("9"), std::vector<int>({9, 19}));
+  EXPECT_EQ(job_log.FindRecords("9", 10), std::vector<int>({19}));
+}
+
+//! Search results don't depend on how records are split between segments and memory.
+TEST_F(JobLogTest, FindRecordsAcrossSegments)
+{
+  JobLog spilled_log;
+  spilled_log.SetCapacity(4);
+  JobLog memory_log;
+
+  const int record_count = 50;
+  for (int index = 0; index < record_count; ++index)
+  {
+    const auto message = (index % 7 == 0 ? "Wait " : "Sequence ") + std::to_string(index);
+    spilled_log.Append(CreateLogEvent(Severity::kInfo, message));
+    memory_log.Append(CreateLogEvent(Severity::kInfo, message));
+  }
+  ASSERT_LT(spilled_log.GetInMemorySize(), record_count);
+
+  for (const std::string text : {"wait", "sequence 4", "4", "e 1", "absent"})
+  {
+    EXPECT_EQ(spilled_log.FindRecords(text), memory_log.FindRecords(text)) << text;
+    EXPECT_EQ(spilled_log.FindRecords(text, 13), memory_log.FindRecords(text, 13)) << text;
+  }
+}
+
 }  // namespace oac_tree_gui::test
@@ -24,6 +24,7 @@
 
 #include <gtest/gtest.h>
 
+#include <QSignalBlocker>
 #include <QSignalSpy>
 
 namespace oac_tree_gui::test
@@ -64,6 +65,23 @@ TEST_F(JobLogViewModelTest, SingleRowData)
   EXPECT_EQ(view_model.data(view_model.index(0, 4), Qt::DisplayRole), QString("message"));
 }
 
+//! Date and time of the event created during job execution are formatted from the timestamp.
+
+TEST_F(JobLogViewModelTest, FormattedDateAndTime)
+{
+  JobLog job_log;
+  const auto log_event = CreateLogEvent(Severity::kInfo, "message");
+  job_log.Append(log_event);
+
+  const JobLogViewModel view_model(&job_log);
+
+  EXPECT_EQ(view_model.data(view_model.index(0, 0), Qt::DisplayRole),
+            QString::fromStdString(GetLogEventDate(log_event)));
+  EXPECT_EQ(view_model.data(view_model.index(0, 1), Qt::DisplayRole),
+            QString::fromStdString(GetLogEventTime(log_event)));
+  EXPECT_EQ(view_model.data(view_model.index(0, 4), Qt::DisplayRole), QString("message"));
+}
+
 TEST_F(JobLogViewModelTest, HeaderData)
 {
   JobLog job_log;
@@ -111,6 +129,94 @@ TEST_F(JobLogViewModelTest, AppendRow)
   EXPECT_EQ(arguments.at(2).value<int>(), 0);
 }
 
+//! Appending the range of events results in a single row insertion.
+
+TEST_F(JobLogViewModelTest, AppendRange)
+{
+  JobLog job_log;
+
+  JobLogViewModel view_model(&job_log);
+  QSignalSpy spy_insert(&view_model, &JobLogViewModel::rowsInserted);
+
+  const LogEvent event{"date", "time", Severity::kNotice, "source", "message"};
+  job_log.Append(std::vector<LogEvent>(1000, event));
+
+  EXPECT_EQ(view_model.rowCount(QModelIndex()), 1000);
+  ASSERT_EQ(spy_insert.count(), 1);
+
+  const QList<QVariant> arguments = spy_insert.takeFirst();
+  EXPECT_EQ(arguments.at(1).value<int>(), 0);
+  EXPECT_EQ(arguments.at(2).value<int>(), 999);
+}
+
+//! The model catches up with the log, even if it has missed some notifications.
+
+TEST_F(JobLogViewModelTest, CatchUp)
+{
+  JobLog job_log;
+  JobLogViewModel view_model(&job_log);
+
+  const LogEvent event{"date", "time", Severity::kNotice, "source", "message"};
+  QSignalBlocker blocker(&job_log);
+  job_log.Append(event);
+  job_log.Append(event);
+
+  EXPECT_EQ(view_model.rowCount(QModelIndex()), 0);
+
+  QSignalSpy spy_insert(&view_model, &JobLogViewModel::rowsInserted);
+  blocker.unblock();
+  job_log.Append(event);
+
+  EXPECT_EQ(view_model.rowCount(QModelIndex()), 3);
+  ASSERT_EQ(spy_insert.count(), 1);
+  const QList<QVariant> arguments = spy_insert.takeFirst();
+  EXPECT_EQ(arguments.at(1).value<int>(), 0);
+  EXPECT_EQ(arguments.at(2).value<int>(), 2);
+}
+
+TEST_F(JobLogViewModelTest, SeverityFilter)
+{
+  JobLog job_log;
+  job_log.Append(LogEvent{"", "", Severity::kError, "", "error1"});
+  job_log.Append(LogEvent{"", "", Severity::kDebug, "", "debug1"});
+  job_log.Append(LogEvent{"", "", Severity::kInfo, "", "info1"});
+
+  JobLogViewModel view_model(&job_log);
+  QSignalSpy spy_reset(&view_model, &JobLogViewModel::modelReset);
+
+  view_model.SetSeverityFilter({Severity::kError, Severity::kInfo});
+  EXPECT_EQ(spy_reset.count(), 1);
+  ASSERT_EQ(view_model.rowCount(QModelIndex()), 2);
+  EXPECT_EQ(view_model.data(view_model.index(0, 4), Qt::DisplayRole), QString("error1"));
+  EXPECT_EQ(view_model.data(view_model.index(1, 4), Qt::DisplayRole), QString("info1"));
+  EXPECT_EQ(view_model.GetLogIndex(1), 2);
+  EXPECT_EQ(view_model.GetRow(2), 1);
+  EXPECT_EQ(view_model.GetRow(1), -1);
+
+  // appended records are filtered incrementally
+  QSignalSpy spy_insert(&view_model, &JobLogViewModel::rowsInserted);
+  job_log.Append(std::vector<LogEvent>({LogEvent{"", "", Severity::kDebug, "", "debug2"},
+                                        LogEvent{"", "", Severity::kError, "", "error2"}}));
+  ASSERT_EQ(view_model.rowCount(QModelIndex()), 3);
+  EXPECT_EQ(view_model.data(view_model.index(2, 4), Qt::DisplayRole), QString("error2"));
+  ASSERT_EQ(spy_insert.count(), 1);
+  const QList<QVariant> arguments = spy_insert.takeFirst();
+  EXPECT_EQ(arguments.at(1).value<int>(), 2);
+  EXPECT_EQ(arguments.at(2).value<int>(), 2);
+
+  // appending only hidden records doesn't insert rows
+  job_log.Append(LogEvent{"", "", Severity::kDebug, "", "debug3"});
+  EXPECT_EQ(view_model.rowCount(QModelIndex()), 3);
+  EXPECT_EQ(spy_insert.count(), 0);
+
+  // showing everything again
+  view_model.SetSeverityFilter({Severity::kEmergency, Severity::kAlert, Severity::kCritical,
+                                Severity::kError, Severity::kWarning, Severity::kNotice,
+                                Severity::kInfo, Severity::kDebug, Severity::kTrace});
+  EXPECT_EQ(view_model.rowCount(QModelIndex()), 6);
+  EXPECT_EQ(view_model.data(view_model.index(1, 4), Qt::DisplayRole), QString("debug1"));
+}
+
 TEST_F(JobLogViewModelTest, ResetJobLog)
 {
   JobLog job_log;
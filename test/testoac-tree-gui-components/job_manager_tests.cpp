@@ -138,4 +138,71 @@ TEST_F(JobManagerTest, StepJob)
   }
   manager->Step(&job_item);
 }
+
+//! Only started jobs are asked if they are running.
+TEST_F(JobManagerTest, HasRunningJobs)
+{
+  LocalJobItem job_item1;
+  LocalJobItem job_item2;
+
+  auto manager = CreateJobManager();
+  manager->SubmitJob(&job_item1);
+  manager->SubmitJob(&job_item2);
+  auto handler1 = manager->GetJobHandler(&job_item1);
+
+  EXPECT_CALL(m_mock_job_handler_listener, IsRunning(::testing::_)).Times(0);
+  EXPECT_FALSE(manager->HasRunningJobs());
+  ::testing::Mock::VerifyAndClearExpectations(&m_mock_job_handler_listener);
+
+  ON_CALL(m_mock_job_handler_listener, GetRunnerStatus(::testing::_))
+      .WillByDefault(::testing::Return(RunnerStatus::kInitial));
+  EXPECT_CALL(m_mock_job_handler_listener, Start(handler1));
+  manager->Start(&job_item1);
+
+  EXPECT_CALL(m_mock_job_handler_listener, IsRunning(handler1))
+      .WillOnce(::testing::Return(true));
+  EXPECT_TRUE(manager->HasRunningJobs());
+}
+
+//! Batch operations over several jobs, removal of a job in the middle.
+TEST_F(JobManagerTest, BatchOperations)
+{
+  LocalJobItem job_item1;
+  LocalJobItem job_item2;
+  LocalJobItem job_item3;
+
+  auto manager = CreateJobManager();
+  manager->SubmitJob(&job_item1);
+  manager->SubmitJob(&job_item2);
+  manager->SubmitJob(&job_item3);
+  auto handler1 = manager->GetJobHandler(&job_item1);
+  auto handler3 = manager->GetJobHandler(&job_item3);
+
+  ON_CALL(m_mock_job_handler_listener, GetRunnerStatus(::testing::_))
+      .WillByDefault(::testing::Return(RunnerStatus::kInitial));
+  EXPECT_CALL(m_mock_job_handler_listener, Start(handler1));
+  EXPECT_CALL(m_mock_job_handler_listener, Start(handler3));
+  manager->StartJobs({&job_item1, &job_item3});
+
+  EXPECT_CALL(m_mock_job_handler_listener, Stop(handler1));
+  EXPECT_CALL(m_mock_job_handler_listener, Stop(handler3));
+  manager->StopJobs({&job_item1, &job_item3});
+
+  EXPECT_CALL(m_mock_job_handler_listener, Reset(handler1));
+  manager->ResetJobs({&job_item1});
+
+  ON_CALL(m_mock_job_handler_listener, IsRunning(::testing::_))
+      .WillByDefault(::testing::Return(false));
+  manager->RemoveJobHandler(&job_item2);
+  EXPECT_EQ(manager->GetJobHandler(&job_item2), nullptr);
+  EXPECT_EQ(manager->GetJobHandler(&job_item3), handler3);
+  EXPECT_EQ(manager->GetJobItems(), std::vector<JobItem*>({&job_item1, &job_item3}));
+  EXPECT_EQ(manager->GetJobCount(), 2);
+
+  // job can be submitted again after removal
+  manager->SubmitJob(&job_item2);
+  EXPECT_EQ(manager->GetJobItems(),
+            std::vector<JobItem*>({&job_item1, &job_item3, &job_item2}));
+}
+
 }  // namespace oac_tree_gui
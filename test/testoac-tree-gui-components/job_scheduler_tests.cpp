@@ -0,0 +1,139 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/job_scheduler.h"
+
+#include <gtest/gtest.h>
+#include <testutils/mock_job_handler.h>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for JobScheduler class.
+ */
+class JobSchedulerTest : public ::testing::Test
+{
+public:
+  JobSchedulerTest()
+      : m_job0(m_listener, nullptr), m_job1(m_listener, nullptr), m_job2(m_listener, nullptr)
+  {
+  }
+
+  MockJobHandlerListener m_listener;
+  MockJobHandler m_job0;
+  MockJobHandler m_job1;
+  MockJobHandler m_job2;
+};
+
+TEST_F(JobSchedulerTest, InitialState)
+{
+  EXPECT_GT(GetDefaultMaxRunningJobCount(), 0);
+
+  const JobScheduler scheduler;
+  EXPECT_EQ(scheduler.GetMaxRunningCount(), GetDefaultMaxRunningJobCount());
+  EXPECT_EQ(scheduler.GetRunningCount(), 0);
+  EXPECT_EQ(scheduler.GetQueuedCount(), 0);
+  EXPECT_FALSE(scheduler.IsAdmitted(&m_job0));
+  EXPECT_FALSE(scheduler.IsQueued(&m_job0));
+}
+
+TEST_F(JobSchedulerTest, Unlimited)
+{
+  JobScheduler scheduler(0);
+
+  EXPECT_TRUE(scheduler.RequestStart(&m_job0));
+  EXPECT_TRUE(scheduler.RequestStart(&m_job1));
+  EXPECT_TRUE(scheduler.RequestStart(&m_job2));
+  EXPECT_EQ(scheduler.GetRunningCount(), 3);
+  EXPECT_EQ(scheduler.GetQueuedCount(), 0);
+}
+
+TEST_F(JobSchedulerTest, FifoQueue)
+{
+  JobScheduler scheduler(1);
+
+  EXPECT_TRUE(scheduler.RequestStart(&m_job0));
+  EXPECT_FALSE(scheduler.RequestStart(&m_job1));
+  EXPECT_FALSE(scheduler.RequestStart(&m_job2));
+  EXPECT_TRUE(scheduler.IsAdmitted(&m_job0));
+  EXPECT_TRUE(scheduler.IsQueued(&m_job1));
+  EXPECT_EQ(scheduler.GetRunningCount(), 1);
+  EXPECT_EQ(scheduler.GetQueuedCount(), 2);
+
+  // repeated requests don't change anything
+  EXPECT_TRUE(scheduler.RequestStart(&m_job0));
+  EXPECT_FALSE(scheduler.RequestStart(&m_job1));
+  EXPECT_EQ(scheduler.GetQueuedCount(), 2);
+
+  // no free slots yet
+  EXPECT_TRUE(scheduler.TakeReadyJobs().empty());
+
+  EXPECT_TRUE(scheduler.Release(&m_job0));
+  EXPECT_FALSE(scheduler.Release(&m_job0));
+  EXPECT_EQ(scheduler.TakeReadyJobs(), std::vector<IJobHandler*>({&m_job1}));
+  EXPECT_TRUE(scheduler.IsAdmitted(&m_job1));
+
+  EXPECT_TRUE(scheduler.Release(&m_job1));
+  EXPECT_EQ(scheduler.TakeReadyJobs(), std::vector<IJobHandler*>({&m_job2}));
+  EXPECT_EQ(scheduler.GetQueuedCount(), 0);
+}
+
+TEST_F(JobSchedulerTest, PriorityQueue)
+{
+  JobScheduler scheduler(1);
+
+  EXPECT_TRUE(scheduler.RequestStart(&m_job0));
+  EXPECT_FALSE(scheduler.RequestStart(&m_job1, 0));
+  EXPECT_FALSE(scheduler.RequestStart(&m_job2, 10));
+
+  (void)scheduler.Release(&m_job0);
+  EXPECT_EQ(scheduler.TakeReadyJobs(), std::vector<IJobHandler*>({&m_job2}));
+}
+
+TEST_F(JobSchedulerTest, CancelAndRaiseLimit)
+{
+  JobScheduler scheduler(1);
+
+  EXPECT_TRUE(scheduler.RequestStart(&m_job0));
+  EXPECT_FALSE(scheduler.RequestStart(&m_job1));
+  EXPECT_FALSE(scheduler.RequestStart(&m_job2));
+
+  // cancelling doesn't free the slot
+  EXPECT_TRUE(scheduler.Cancel(&m_job1));
+  EXPECT_FALSE(scheduler.Cancel(&m_job1));
+  EXPECT_FALSE(scheduler.Cancel(&m_job0));
+  EXPECT_FALSE(scheduler.Release(&m_job2));
+  EXPECT_EQ(scheduler.GetQueuedCount(), 0);
+
+  EXPECT_FALSE(scheduler.RequestStart(&m_job1));
+  EXPECT_FALSE(scheduler.RequestStart(&m_job2));
+  scheduler.SetMaxRunningCount(3);
+  EXPECT_EQ(scheduler.TakeReadyJobs(), std::vector<IJobHandler*>({&m_job1, &m_job2}));
+  EXPECT_EQ(scheduler.GetRunningCount(), 3);
+
+  scheduler.SetMaxRunningCount(1);
+  (void)scheduler.Release(&m_job0);
+  EXPECT_FALSE(scheduler.RequestStart(&m_job0));
+  EXPECT_EQ(scheduler.CancelAll(), std::vector<IJobHandler*>({&m_job0}));
+  EXPECT_EQ(scheduler.GetQueuedCount(), 0);
+}
+
+}  // namespace oac_tree_gui::test
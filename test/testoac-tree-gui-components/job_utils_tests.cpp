@@ -20,6 +20,8 @@
 
 #include "oac_tree_gui/jobsystem/job_utils.h"
 
+#include <oac_tree_gui/model/standard_job_items.h>
+
 #include <gtest/gtest.h>
 
 namespace oac_tree_gui::test
@@ -39,4 +41,17 @@ TEST_F(JobUtilsTest, GetRegExpPattern)
             std::string("(INFO|DEBUG)"));
 }
 
+TEST_F(JobUtilsTest, CreateLogFloodOptions)
+{
+  LocalJobItem job_item;
+  job_item.SetLogSeverityThreshold("WARNING");
+  job_item.SetLogRateLimit(42);
+  job_item.SetLogFoldDuplicates(true);
+
+  const auto options = CreateLogFloodOptions(job_item);
+  EXPECT_EQ(options.severity_threshold, Severity::kWarning);
+  EXPECT_EQ(options.max_message_rate, 42);
+  EXPECT_TRUE(options.fold_duplicates);
+}
+
 }  // namespace oac_tree_gui::test
@@ -59,11 +59,25 @@ TEST_F(LogEventTest, CreateLogEvent)
   EXPECT_EQ(event.severity, Severity::kWarning);
   EXPECT_EQ(event.message, std::string("abc"));
 
-  auto date =
-      QDate::fromString(QString::fromStdString(event.date), GetLogEventDateFormat().c_str());
-  auto time =
-      QTime::fromString(QString::fromStdString(event.time), GetLogEventTimeFormat().c_str());
+  // date and time are not formatted on creation
+  EXPECT_TRUE(event.date.empty());
+  EXPECT_TRUE(event.time.empty());
+  EXPECT_GT(event.timestamp, 0);
+
+  auto date = QDate::fromString(QString::fromStdString(GetLogEventDate(event)),
+                                GetLogEventDateFormat().c_str());
+  auto time = QTime::fromString(QString::fromStdString(GetLogEventTime(event)),
+                                GetLogEventTimeFormat().c_str());
   EXPECT_TRUE(QDateTime(date, time).isValid());
 }
 
+TEST_F(LogEventTest, ExplicitDateAndTime)
+{
+  LogEvent event{"2022-12-01", "18:52:01.001", Severity::kWarning, "sup", "message"};
+  event.timestamp = QDateTime::currentMSecsSinceEpoch();
+
+  EXPECT_EQ(GetLogEventDate(event), std::string("2022-12-01"));
+  EXPECT_EQ(GetLogEventTime(event), std::string("18:52:01.001"));
+}
+
 }  // namespace oac_tree_gui::test
@@ -0,0 +1,171 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/log_flood_filter.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for LogFloodFilter class.
+ */
+class LogFloodFilterTest : public ::testing::Test
+{
+public:
+  using message_t = std::pair<Severity, std::string>;
+  using time_point_t = LogFloodFilter::clock_t::time_point;
+
+  LogFloodFilter::post_message_callback_t GetCallback()
+  {
+    return [this](Severity severity, const std::string& message)
+    { m_messages.emplace_back(severity, message); };
+  }
+
+  std::vector<message_t> m_messages;
+  const time_point_t m_start{std::chrono::steady_clock::now()};
+};
+
+TEST_F(LogFloodFilterTest, InitialState)
+{
+  EXPECT_THROW(LogFloodFilter({}), RuntimeException);
+
+  LogFloodFilter filter(GetCallback());
+  EXPECT_EQ(filter.GetOptions().severity_threshold, Severity::kTrace);
+  EXPECT_EQ(filter.GetOptions().max_message_rate, 0);
+  EXPECT_FALSE(filter.GetOptions().fold_duplicates);
+
+  // by default all messages pass as they are
+  EXPECT_TRUE(filter.AcceptSeverity(Severity::kTrace));
+  filter.ProcessMessage(Severity::kInfo, "abc", m_start);
+  filter.ProcessMessage(Severity::kInfo, "abc", m_start);
+  filter.Flush();
+
+  const std::vector<message_t> expected({{Severity::kInfo, "abc"}, {Severity::kInfo, "abc"}});
+  EXPECT_EQ(m_messages, expected);
+  EXPECT_EQ(filter.GetStatistics().folded_duplicate_count, 0);
+}
+
+TEST_F(LogFloodFilterTest, SeverityThreshold)
+{
+  LogFloodFilter filter(GetCallback(), LogFloodOptions{Severity::kWarning});
+
+  EXPECT_TRUE(filter.AcceptSeverity(Severity::kError));
+  EXPECT_TRUE(filter.AcceptSeverity(Severity::kWarning));
+  EXPECT_FALSE(filter.AcceptSeverity(Severity::kInfo));
+  EXPECT_FALSE(filter.AcceptSeverity(Severity::kDebug));
+
+  EXPECT_EQ(filter.GetStatistics().below_threshold_count, 2);
+}
+
+TEST_F(LogFloodFilterTest, FoldDuplicates)
+{
+  LogFloodOptions options;
+  options.fold_duplicates = true;
+  LogFloodFilter filter(GetCallback(), options);
+
+  filter.ProcessMessage(Severity::kInfo, "abc", m_start);
+  filter.ProcessMessage(Severity::kInfo, "abc", m_start);
+  filter.ProcessMessage(Severity::kInfo, "abc", m_start);
+  filter.ProcessMessage(Severity::kError, "abc", m_start);
+  filter.ProcessMessage(Severity::kError, "abc", m_start);
+  filter.Flush();
+
+  const std::vector<message_t> expected({{Severity::kInfo, "abc"},
+                                         {Severity::kInfo, "Last message repeated 2 times"},
+                                         {Severity::kError, "abc"},
+                                         {Severity::kError, "Last message repeated 1 times"}});
+  EXPECT_EQ(m_messages, expected);
+  EXPECT_EQ(filter.GetStatistics().folded_duplicate_count, 3);
+}
+
+//! Endless repetition of the same message is reported periodically.
+
+TEST_F(LogFloodFilterTest, FoldDuplicatesPeriodicReport)
+{
+  LogFloodOptions options;
+  options.fold_duplicates = true;
+  LogFloodFilter filter(GetCallback(), options);
+
+  filter.ProcessMessage(Severity::kInfo, "abc", m_start);
+  filter.ProcessMessage(Severity::kInfo, "abc", m_start + std::chrono::milliseconds(500));
+  EXPECT_EQ(m_messages.size(), 1);
+
+  filter.ProcessMessage(Severity::kInfo, "abc", m_start + std::chrono::milliseconds(1000));
+  ASSERT_EQ(m_messages.size(), 2);
+  EXPECT_EQ(m_messages.back().second, std::string("Last message repeated 2 times"));
+
+  filter.ProcessMessage(Severity::kInfo, "abc", m_start + std::chrono::milliseconds(1500));
+  EXPECT_EQ(m_messages.size(), 2);
+}
+
+TEST_F(LogFloodFilterTest, RateLimit)
+{
+  LogFloodOptions options;
+  options.max_message_rate = 2;
+  LogFloodFilter filter(GetCallback(), options);
+
+  filter.ProcessMessage(Severity::kInfo, "a", m_start);
+  filter.ProcessMessage(Severity::kInfo, "b", m_start + std::chrono::milliseconds(100));
+  filter.ProcessMessage(Severity::kInfo, "c", m_start + std::chrono::milliseconds(200));
+  filter.ProcessMessage(Severity::kInfo, "d", m_start + std::chrono::milliseconds(300));
+  EXPECT_EQ(m_messages.size(), 2);
+  EXPECT_EQ(filter.GetStatistics().rate_limited_count, 2);
+
+  // the next window begins with the report of suppressed messages
+  filter.ProcessMessage(Severity::kInfo, "e", m_start + std::chrono::milliseconds(1000));
+
+  const std::vector<message_t> expected(
+      {{Severity::kInfo, "a"},
+       {Severity::kInfo, "b"},
+       {Severity::kWarning, "2 log messages suppressed by rate limit"},
+       {Severity::kInfo, "e"}});
+  EXPECT_EQ(m_messages, expected);
+}
+
+//! The callback is called outside of the lock, posting might wait for the GUI thread asking for
+//! statistics.
+TEST_F(LogFloodFilterTest, CallbackOutsideOfLock)
+{
+  LogFloodFilter* filter_ptr{nullptr};
+  std::vector<std::size_t> reported_counts;
+  auto on_message = [&filter_ptr, &reported_counts](Severity, const std::string&)
+  { reported_counts.push_back(filter_ptr->GetStatistics().rate_limited_count); };
+
+  LogFloodOptions options;
+  options.max_message_rate = 1;
+  LogFloodFilter filter(on_message, options);
+  filter_ptr = &filter;
+
+  filter.ProcessMessage(Severity::kInfo, "a", m_start);
+  filter.ProcessMessage(Severity::kInfo, "b", m_start);
+  filter.Flush();
+
+  const std::vector<std::size_t> expected({0, 1});
+  EXPECT_EQ(reported_counts, expected);
+}
+
+}  // namespace oac_tree_gui::test
@@ -0,0 +1,104 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/log_record_storage.h"
+
+#include <gtest/gtest.h>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for LogRecordStorage class.
+ */
+class LogRecordStorageTest : public ::testing::Test
+{
+};
+
+TEST_F(LogRecordStorageTest, InitialState)
+{
+  const LogRecordStorage storage;
+  EXPECT_EQ(storage.GetSize(), 0);
+  EXPECT_THROW(storage.GetRecord(0), std::out_of_range);
+}
+
+TEST_F(LogRecordStorageTest, Append)
+{
+  LogRecordStorage storage;
+
+  auto event = CreateLogEvent(Severity::kWarning, "abc");
+  event.source = "sup";
+  storage.Append(event);
+
+  ASSERT_EQ(storage.GetSize(), 1);
+  EXPECT_EQ(storage.GetEvent(0), event);
+
+  const auto record = storage.GetRecord(0);
+  EXPECT_EQ(record.timestamp, event.timestamp);
+  EXPECT_EQ(record.severity, Severity::kWarning);
+  EXPECT_EQ(record.source, std::string_view("sup"));
+  EXPECT_EQ(record.message, std::string_view("abc"));
+  EXPECT_TRUE(record.date.empty());
+  EXPECT_TRUE(record.time.empty());
+}
+
+TEST_F(LogRecordStorageTest, ExplicitDateAndTime)
+{
+  LogRecordStorage storage;
+
+  const LogEvent event{"2022-12-01", "18:52:01.001", Severity::kError, "sup", ""};
+  storage.Append(event);
+
+  EXPECT_EQ(storage.GetEvent(0), event);
+  EXPECT_EQ(storage.GetRecord(0).date, std::string_view("2022-12-01"));
+  EXPECT_EQ(storage.GetRecord(0).time, std::string_view("18:52:01.001"));
+  EXPECT_TRUE(storage.GetRecord(0).message.empty());
+}
+
+//! Many messages with the same source, long message doesn't fit in the arena chunk.
+TEST_F(LogRecordStorageTest, ManyRecords)
+{
+  LogRecordStorage storage;
+
+  const std::string long_message(100000, 'a');
+  const int record_count = 10000;
+  for (int index = 0; index < record_count; ++index)
+  {
+    const auto message = index == 42 ? long_message : "message" + std::to_string(index);
+    storage.Append(LogEvent{"", "", Severity::kInfo, "source", message, index});
+  }
+
+  ASSERT_EQ(storage.GetSize(), record_count);
+  EXPECT_EQ(storage.GetRecord(0).message, std::string_view("message0"));
+  EXPECT_EQ(storage.GetRecord(42).message, std::string_view(long_message));
+  EXPECT_EQ(storage.GetRecord(9999).message, std::string_view("message9999"));
+  EXPECT_EQ(storage.GetRecord(9999).timestamp, 9999);
+
+  // all records refer to the same source string
+  EXPECT_EQ(storage.GetRecord(0).source.data(), storage.GetRecord(9999).source.data());
+
+  storage.Clear();
+  EXPECT_EQ(storage.GetSize(), 0);
+
+  storage.Append(LogEvent{"", "", Severity::kInfo, "source", "abc"});
+  EXPECT_EQ(storage.GetRecord(0).message, std::string_view("abc"));
+}
+
+}  // namespace oac_tree_gui::test
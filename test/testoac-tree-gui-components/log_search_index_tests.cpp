@@ -0,0 +1,128 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/log_search_index.h"
+
+#include <gtest/gtest.h>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for LogSearchIndex class.
+ */
+class LogSearchIndexTest : public ::testing::Test
+{
+};
+
+TEST_F(LogSearchIndexTest, InitialState)
+{
+  const LogSearchIndex index;
+  EXPECT_EQ(index.GetTrigramCount(), 0);
+  EXPECT_TRUE(index.GetCandidates("abc").empty());
+}
+
+TEST_F(LogSearchIndexTest, GetCandidates)
+{
+  LogSearchIndex index;
+  index.AddRecord(0, "Instruction Wait started");
+  index.AddRecord(1, "Variable var0 updated");
+  index.AddRecord(2, "WAIT finished");
+  index.AddRecord(3, "ab");
+
+  EXPECT_EQ(index.GetCandidates("wait"), std::vector<int>({0, 2}));
+  EXPECT_EQ(index.GetCandidates("Var0"), std::vector<int>({1}));
+  EXPECT_TRUE(index.GetCandidates("waiting").empty());
+
+  // too short query can't be narrowed
+  EXPECT_TRUE(index.GetCandidates("ab").empty());
+
+  index.Clear();
+  EXPECT_EQ(index.GetTrigramCount(), 0);
+  EXPECT_TRUE(index.GetCandidates("wait").empty());
+}
+
+TEST_F(LogSearchIndexTest, RemoveRecordsBefore)
+{
+  LogSearchIndex index;
+  index.AddRecord(0, "abc");
+  index.AddRecord(1, "Wait started");
+  index.AddRecord(2, "WAIT finished");
+
+  index.RemoveRecordsBefore(2);
+  EXPECT_EQ(index.GetCandidates("wait"), std::vector<int>({2}));
+  EXPECT_TRUE(index.GetCandidates("abc").empty());
+  EXPECT_TRUE(index.GetCandidates("started").empty());
+
+  index.RemoveRecordsBefore(3);
+  EXPECT_EQ(index.GetTrigramCount(), 0);
+}
+
+//! Candidates are a superset of matching records, order of trigrams isn't taken into account.
+TEST_F(LogSearchIndexTest, FalsePositive)
+{
+  LogSearchIndex index;
+  index.AddRecord(0, "abcd bcde");
+
+  EXPECT_EQ(index.GetCandidates("abcde"), std::vector<int>({0}));
+  EXPECT_FALSE(ContainsIgnoreCase("abcd bcde", "abcde"));
+}
+
+TEST_F(LogSearchIndexTest, LogTrigramFilter)
+{
+  LogTrigramFilter filter;
+  EXPECT_EQ(filter.GetTrigramCount(), 0);
+  EXPECT_FALSE(filter.MayContain("wait"));
+
+  filter.AddText("Wait started");
+  filter.AddText("abc");
+  filter.AddText("abc");
+  EXPECT_EQ(filter.GetTrigramCount(), 11);
+
+  EXPECT_TRUE(filter.MayContain("WAIT"));
+  EXPECT_TRUE(filter.MayContain("abc"));
+  EXPECT_FALSE(filter.MayContain("finished"));
+
+  // short queries can't be filtered
+  EXPECT_TRUE(filter.MayContain("xy"));
+  EXPECT_TRUE(filter.MayContain(""));
+}
+
+TEST_F(LogSearchIndexTest, CreateTrigramFilter)
+{
+  LogSearchIndex index;
+  index.AddRecord(0, "Wait started");
+  index.AddRecord(1, "abc");
+
+  const auto filter = index.CreateTrigramFilter();
+  EXPECT_EQ(filter.GetTrigramCount(), index.GetTrigramCount());
+  EXPECT_TRUE(filter.MayContain("STARTED"));
+  EXPECT_FALSE(filter.MayContain("finished"));
+}
+
+TEST_F(LogSearchIndexTest, ContainsIgnoreCase)
+{
+  EXPECT_TRUE(ContainsIgnoreCase("Instruction Wait", "wait"));
+  EXPECT_TRUE(ContainsIgnoreCase("Instruction Wait", ""));
+  EXPECT_FALSE(ContainsIgnoreCase("Instruction", "wait"));
+  EXPECT_FALSE(ContainsIgnoreCase("", "wait"));
+}
+
+}  // namespace oac_tree_gui::test
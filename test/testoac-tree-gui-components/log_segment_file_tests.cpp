@@ -0,0 +1,71 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/log_segment_file.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/log_record_storage.h>
+
+#include <gtest/gtest.h>
+
+#include <QDir>
+#include <QTemporaryDir>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for helper functions in log_segment_file.h.
+ */
+class LogSegmentFileTest : public ::testing::Test
+{
+public:
+  std::string GetFilePath(const std::string& name) const
+  {
+    return m_dir.filePath(QString::fromStdString(name)).toStdString();
+  }
+
+  QTemporaryDir m_dir{QDir::tempPath() + "/log-segment-file-tests-XXXXXX"};
+};
+
+TEST_F(LogSegmentFileTest, WriteAndRead)
+{
+  LogRecordStorage storage;
+  storage.Append(LogEvent{"", "", Severity::kError, "source", "message", 42});
+  storage.Append(LogEvent{"2022-12-01", "18:52:01.001", Severity::kDebug, "", "", 43});
+
+  const auto file_name = GetFilePath("segment.log");
+  WriteLogSegment(file_name, storage);
+
+  LogRecordStorage result;
+  ReadLogSegment(file_name, result);
+
+  ASSERT_EQ(result.GetSize(), 2);
+  EXPECT_EQ(result.GetEvent(0), storage.GetEvent(0));
+  EXPECT_EQ(result.GetEvent(1), storage.GetEvent(1));
+}
+
+TEST_F(LogSegmentFileTest, ReadNonExistingFile)
+{
+  LogRecordStorage storage;
+  EXPECT_THROW(ReadLogSegment(GetFilePath("non-existing.log"), storage), RuntimeException);
+}
+
+}  // namespace oac_tree_gui::test
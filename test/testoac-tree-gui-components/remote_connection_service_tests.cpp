@@ -50,6 +50,10 @@ public:
       return {};
     }
 
+    void PrepareJob(std::uint32_t job_index) override { (void)job_index; }
+
+    void DiscardPreparedJob(std::uint32_t job_index) override { (void)job_index; }
+
     std::unique_ptr<AbstractJobHandler> CreateJobHandler(RemoteJobItem* job_item,
                                                          const UserContext& user_context) override
     {
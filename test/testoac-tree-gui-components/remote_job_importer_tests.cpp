@@ -0,0 +1,217 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/objects/remote_job_importer.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/remote_connection_info.h>
+
+#include <gtest/gtest.h>
+#include <testutils/mock_automation_client.h>
+#include <testutils/mock_remote_connection_service.h>
+
+#include <QTest>
+#include <future>
+#include <thread>
+
+namespace oac_tree_gui::test
+{
+
+using ::testing::_;
+using ::testing::Return;
+using ::testing::ReturnRef;
+
+/**
+ * @brief Tests for RemoteJobImporter class.
+ */
+class RemoteJobImporterTest : public ::testing::Test
+{
+public:
+  RemoteJobImporterTest()
+  {
+    ON_CALL(m_connection_service, Connect(_)).WillByDefault(Return(true));
+    ON_CALL(m_connection_service, HasClient(_)).WillByDefault(Return(true));
+    ON_CALL(m_connection_service, GetAutomationClient(_)).WillByDefault(ReturnRef(m_client));
+  }
+
+  ::testing::NiceMock<MockRemoteConnectionService> m_connection_service;
+  ::testing::NiceMock<MockAutomationClient> m_client;
+};
+
+TEST_F(RemoteJobImporterTest, InitialState)
+{
+  EXPECT_THROW(RemoteJobImporter(m_connection_service, 0), RuntimeException);
+
+  const RemoteJobImporter importer(m_connection_service, 1);
+  EXPECT_FALSE(importer.IsBusy());
+}
+
+TEST_F(RemoteJobImporterTest, Connect)
+{
+  RemoteJobImporter importer(m_connection_service, 1);
+
+  std::vector<std::string> reported_names;
+  QObject::connect(&importer, &RemoteJobImporter::Connected,
+                   [&reported_names](const std::string& server_name,
+                                     const std::vector<std::string>& procedure_names)
+                   {
+                     EXPECT_EQ(server_name, std::string("server"));
+                     reported_names = procedure_names;
+                   });
+
+  EXPECT_CALL(m_connection_service, Connect(std::string("server"))).WillOnce(Return(true));
+  EXPECT_CALL(m_client, GetJobCount()).WillOnce(Return(2));
+  EXPECT_CALL(m_client, GetProcedureName(0)).WillOnce(Return(std::string("procedure0")));
+  EXPECT_CALL(m_client, GetProcedureName(1)).WillOnce(Return(std::string("procedure1")));
+
+  importer.Connect("server");
+
+  // connection doesn't count as import
+  EXPECT_FALSE(importer.IsBusy());
+
+  const std::vector<std::string> expected_names({"procedure0", "procedure1"});
+  EXPECT_TRUE(
+      QTest::qWaitFor([&reported_names]() { return !reported_names.empty(); }, 1000));
+  EXPECT_EQ(reported_names, expected_names);
+}
+
+TEST_F(RemoteJobImporterTest, ConnectionFailed)
+{
+  RemoteJobImporter importer(m_connection_service, 1);
+
+  std::string reported_message;
+  QObject::connect(&importer, &RemoteJobImporter::ConnectionFailed,
+                   [&reported_message](const std::string&, const std::string& message)
+                   { reported_message = message; });
+
+  EXPECT_CALL(m_connection_service, Connect(std::string("server"))).WillOnce(Return(false));
+  EXPECT_CALL(m_connection_service, GetAutomationClient(_)).Times(0);
+
+  importer.Connect("server");
+
+  EXPECT_TRUE(
+      QTest::qWaitFor([&reported_message]() { return !reported_message.empty(); }, 1000));
+}
+
+TEST_F(RemoteJobImporterTest, Import)
+{
+  RemoteJobImporter importer(m_connection_service, 4);
+
+  std::set<std::size_t> prepared_jobs;
+  std::set<std::size_t> failed_jobs;
+  std::vector<std::pair<std::size_t, std::size_t>> progress;
+  int finished_count{0};
+
+  QObject::connect(&importer, &RemoteJobImporter::JobPrepared,
+                   [&prepared_jobs](const std::string&, std::size_t job_index)
+                   { (void)prepared_jobs.insert(job_index); });
+  QObject::connect(&importer, &RemoteJobImporter::JobPreparationFailed,
+                   [&failed_jobs](const std::string&, std::size_t job_index, const std::string&)
+                   { (void)failed_jobs.insert(job_index); });
+  QObject::connect(&importer, &RemoteJobImporter::ProgressChanged,
+                   [&progress](std::size_t completed_count, std::size_t total_count)
+                   { progress.emplace_back(completed_count, total_count); });
+  QObject::connect(&importer, &RemoteJobImporter::ImportFinished,
+                   [&finished_count]() { ++finished_count; });
+
+  EXPECT_CALL(m_client, PrepareJob(0));
+  EXPECT_CALL(m_client, PrepareJob(1)).WillOnce(::testing::Throw(RuntimeException("error")));
+  EXPECT_CALL(m_client, PrepareJob(2));
+
+  importer.Import(RemoteConnectionInfo{"server", {0, 1, 2}});
+  EXPECT_TRUE(importer.IsBusy());
+
+  // initial progress is reported at once
+  ASSERT_EQ(progress.size(), 1);
+  EXPECT_EQ(progress.back(), std::make_pair(std::size_t{0}, std::size_t{3}));
+
+  EXPECT_TRUE(QTest::qWaitFor([&finished_count]() { return finished_count > 0; }, 1000));
+
+  EXPECT_EQ(prepared_jobs, std::set<std::size_t>({0, 2}));
+  EXPECT_EQ(failed_jobs, std::set<std::size_t>({1}));
+  ASSERT_EQ(progress.size(), 4);
+  EXPECT_EQ(progress.back(), std::make_pair(std::size_t{3}, std::size_t{3}));
+  EXPECT_EQ(finished_count, 1);
+  EXPECT_FALSE(importer.IsBusy());
+}
+
+//! Cancelling the import while the first job is being prepared. The result of the running job is
+//! discarded, the second job is never prepared.
+TEST_F(RemoteJobImporterTest, Cancel)
+{
+  RemoteJobImporter importer(m_connection_service, 1);
+
+  int reported_count{0};
+  QObject::connect(&importer, &RemoteJobImporter::JobPrepared,
+                   [&reported_count](const std::string&, std::size_t) { ++reported_count; });
+  QObject::connect(&importer, &RemoteJobImporter::ImportFinished,
+                   [&reported_count]() { ++reported_count; });
+
+  std::promise<void> started;
+  std::promise<void> release;
+  auto release_future = release.get_future();
+  EXPECT_CALL(m_client, PrepareJob(0))
+      .WillOnce(
+          [&started, &release_future](std::uint32_t)
+          {
+            started.set_value();
+            release_future.wait();
+          });
+  EXPECT_CALL(m_client, PrepareJob(1)).Times(0);
+  EXPECT_CALL(m_client, DiscardPreparedJob(0));
+
+  importer.Import(RemoteConnectionInfo{"server", {0, 1}});
+  started.get_future().wait();
+
+  importer.Cancel();
+  EXPECT_FALSE(importer.IsBusy());
+  release.set_value();
+
+  QTest::qWait(50);
+  EXPECT_EQ(reported_count, 0);
+}
+
+//! Destroying the importer, after the job was prepared, but before the result was reported. The
+//! prepared job is discarded.
+TEST_F(RemoteJobImporterTest, DestroyBeforeReport)
+{
+  auto importer = std::make_unique<RemoteJobImporter>(m_connection_service, 1);
+
+  int reported_count{0};
+  QObject::connect(importer.get(), &RemoteJobImporter::JobPrepared,
+                   [&reported_count](const std::string&, std::size_t) { ++reported_count; });
+
+  std::promise<void> prepared;
+  EXPECT_CALL(m_client, PrepareJob(0))
+      .WillOnce([&prepared](std::uint32_t) { prepared.set_value(); });
+  EXPECT_CALL(m_client, DiscardPreparedJob(0)).Times(1);
+
+  importer->Import(RemoteConnectionInfo{"server", {0}});
+  prepared.get_future().wait();
+
+  // no event processing, the result is posted to the importer, but never reported
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  importer.reset();
+
+  QTest::qWait(50);
+  EXPECT_EQ(reported_count, 0);
+}
+
+}  // namespace oac_tree_gui::test
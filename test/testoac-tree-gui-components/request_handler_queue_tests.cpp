@@ -22,6 +22,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <future>
+#include <thread>
+
 namespace oac_tree_gui::test
 {
 
@@ -30,6 +34,28 @@ namespace oac_tree_gui::test
 class RequestHandlerQueueTest : public ::testing::Test
 {
 public:
+  using queue_t = RequestHandlerQueue<int, std::string>;
+
+  /**
+   * @brief Launches consumer thread asking for data, and waits till the request is pending.
+   */
+  static std::future<int> AskForData(queue_t& queue, std::uint64_t id, const std::string& args)
+  {
+    auto result = std::async(std::launch::async,
+                             [&queue, id, args]() { return queue.GetData(id, args, {}); });
+    while (!HasPendingRequest(queue, id))
+    {
+      std::this_thread::yield();
+    }
+    return result;
+  }
+
+  static bool HasPendingRequest(const queue_t& queue, std::uint64_t id)
+  {
+    const auto requests = queue.GetPendingRequests();
+    return std::any_of(requests.begin(), requests.end(),
+                       [id](const auto& request) { return request.id == id; });
+  }
 };
 
 TEST_F(RequestHandlerQueueTest, SingleThreadAskForData)
@@ -41,7 +67,7 @@ TEST_F(RequestHandlerQueueTest, SingleThreadAskForData)
   auto data_provider = [](const std::string& args) { return static_cast<int>(args.size()); };
 
   // handler will process thread's request (strings) and provide it with answers (integers)
-  RequestHandlerQueue<int, std::string> handler(data_provider);
+  queue_t handler(data_provider);
 
   // callback mimicking queued request for data, will trigger data_provider call
   auto queued_request = [&handler]() { handler.OnDataRequest(); };
@@ -52,7 +78,7 @@ TEST_F(RequestHandlerQueueTest, SingleThreadAskForData)
   auto consumer = [&handler, &ready_for_test, queued_request, request_params]()
   {
     ready_for_test.set_value();
-    return handler.GetData(request_params, queued_request);
+    return handler.GetData(1, request_params, queued_request);
   };
 
   std::future<int> future_result = std::async(std::launch::async, consumer);
@@ -63,6 +89,125 @@ TEST_F(RequestHandlerQueueTest, SingleThreadAskForData)
   // checking result
   auto result = future_result.get();  // making sure thread has finished
   EXPECT_EQ(result, request_params.size());
+  EXPECT_TRUE(handler.GetPendingRequests().empty());
+}
+
+//! Pending requests are answered in the order different from the order of arrival.
+TEST_F(RequestHandlerQueueTest, AnswerInAnyOrder)
+{
+  queue_t queue;
+
+  auto result1 = AskForData(queue, 10, "first");
+  auto result2 = AskForData(queue, 5, "second");
+
+  const auto requests = queue.GetPendingRequests();
+  ASSERT_EQ(requests.size(), 2);
+  EXPECT_EQ(requests.at(0).id, 10);
+  EXPECT_EQ(requests.at(0).args, std::string("first"));
+  EXPECT_EQ(requests.at(1).id, 5);
+
+  EXPECT_FALSE(queue.SendData(42, 1));  // unknown request
+  EXPECT_TRUE(queue.SendData(5, 2));
+  EXPECT_EQ(result2.get(), 2);
+
+  EXPECT_TRUE(queue.SendData(10, 1));
+  EXPECT_EQ(result1.get(), 1);
+  EXPECT_FALSE(queue.SendData(10, 1));  // already answered
+}
+
+//! The duplicate request is rejected without an answer, the original one stays pending.
+TEST_F(RequestHandlerQueueTest, DuplicateId)
+{
+  queue_t queue;
+
+  EXPECT_EQ(queue.GetDuplicateRequestCount(), 0);
+
+  auto result = AskForData(queue, 1, "abc");
+  EXPECT_EQ(queue.GetData(1, "def", {}), 0);
+  EXPECT_EQ(queue.GetPendingRequests().size(), 1);
+  EXPECT_EQ(queue.GetDuplicateRequestCount(), 1);
+
+  EXPECT_TRUE(queue.SendData(1, 42));
+  EXPECT_EQ(result.get(), 42);
+}
+
+TEST_F(RequestHandlerQueueTest, Interrupt)
+{
+  queue_t queue;
+
+  auto result1 = AskForData(queue, 1, "abc");
+  auto result2 = AskForData(queue, 2, "def");
+
+  EXPECT_TRUE(queue.Interrupt(1));
+  EXPECT_EQ(result1.get(), 0);
+  EXPECT_FALSE(queue.SendData(1, 42));
+
+  queue.InterruptAll();
+  EXPECT_EQ(result2.get(), 0);
+  EXPECT_TRUE(queue.GetPendingRequests().empty());
+}
+
+//! Interruption arriving before the request releases the consumer as soon as it asks.
+TEST_F(RequestHandlerQueueTest, InterruptBeforeRequest)
+{
+  queue_t queue;
+
+  EXPECT_FALSE(queue.Interrupt(1));
+
+  int notify_count{0};
+  EXPECT_EQ(queue.GetData(1, "abc", [&notify_count]() { ++notify_count; }), 0);
+  EXPECT_EQ(notify_count, 0);
+  EXPECT_TRUE(queue.GetPendingRequests().empty());
+
+  // the interruption is consumed by the first request
+  auto result = AskForData(queue, 1, "abc");
+  EXPECT_TRUE(queue.SendData(1, 42));
+  EXPECT_EQ(result.get(), 42);
+}
+
+TEST_F(RequestHandlerQueueTest, Timeout)
+{
+  queue_t queue;
+  queue.SetTimeout(std::chrono::milliseconds(20));
+
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(queue.GetData(1, "abc", {}), 0);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+  EXPECT_TRUE(queue.GetPendingRequests().empty());
+}
+
+//! Provider is busy with the first request, when the second one is answered directly.
+TEST_F(RequestHandlerQueueTest, ProviderSkipsAnsweredRequest)
+{
+  std::vector<std::string> provider_requests;
+  queue_t queue(
+      [&provider_requests](const std::string& args)
+      {
+        provider_requests.push_back(args);
+        return 1;
+      });
+
+  auto result1 = AskForData(queue, 1, "abc");
+  auto result2 = AskForData(queue, 2, "def");
+  EXPECT_TRUE(queue.SendData(2, 2));
+  EXPECT_EQ(result2.get(), 2);
+
+  queue.OnDataRequest();
+  queue.OnDataRequest();  // nothing left to ask for
+  EXPECT_EQ(result1.get(), 1);
+  EXPECT_EQ(provider_requests, std::vector<std::string>({"abc"}));
+}
+
+//! Closed queue releases waiting consumers and doesn't accept new requests.
+TEST_F(RequestHandlerQueueTest, Close)
+{
+  queue_t queue;
+
+  auto result = AskForData(queue, 1, "abc");
+  queue.Close();
+  EXPECT_EQ(result.get(), 0);
+
+  EXPECT_EQ(queue.GetData(2, "def", {}), 0);
 }
 
 }  // namespace oac_tree_gui::test
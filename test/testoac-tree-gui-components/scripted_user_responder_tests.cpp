@@ -0,0 +1,208 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/scripted_user_responder.h"
+
+#include <oac_tree_gui/core/exceptions.h>
+#include <oac_tree_gui/jobsystem/user_context.h>
+
+#include <sup/dto/anyvalue.h>
+
+#include <gtest/gtest.h>
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for ScriptedUserResponder class and related helper functions.
+ */
+class ScriptedUserResponderTest : public ::testing::Test
+{
+public:
+  using RequestType = ScriptedUserRule::RequestType;
+
+  /**
+   * @brief Writes the content to the file with the given name and returns full path to it.
+   */
+  std::string WriteFile(const std::string& name, const std::string& content) const
+  {
+    const auto file_path = m_dir.filePath(QString::fromStdString(name));
+    QFile file(file_path);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+      throw RuntimeException("Can't open file for writing");
+    }
+    (void)file.write(QByteArray::fromStdString(content));
+    return file_path.toStdString();
+  }
+
+  static UserChoiceArgs CreateChoiceArgs(const std::string& text)
+  {
+    const sup::dto::AnyValue metadata = {{"text", {sup::dto::StringType, text}}};
+    return UserChoiceArgs{{"Abort", "Retry", "Ignore"}, metadata};
+  }
+
+  QTemporaryDir m_dir{QDir::tempPath() + "/scripted-user-responder-tests-XXXXXX"};
+};
+
+TEST_F(ScriptedUserResponderTest, InvalidPattern)
+{
+  const ScriptedUserRule rule{RequestType::kInput, "[abc", "42"};
+  EXPECT_THROW(ScriptedUserResponder({rule}), RuntimeException);
+}
+
+TEST_F(ScriptedUserResponderTest, UserInput)
+{
+  const std::vector<ScriptedUserRule> rules = {{RequestType::kInput, "^Voltage", "42"},
+                                               {RequestType::kInput, "", "0"}};
+  const ScriptedUserResponder responder(rules);
+
+  const sup::dto::AnyValue initial_value{sup::dto::SignedInteger32Type, 1};
+
+  auto result = responder.GetUserInput({initial_value, "Voltage setpoint"});
+  EXPECT_TRUE(result.processed);
+  EXPECT_EQ(result.value, sup::dto::AnyValue(sup::dto::SignedInteger32Type, 42));
+
+  // the second rule matches any description
+  result = responder.GetUserInput({initial_value, "Current setpoint"});
+  EXPECT_TRUE(result.processed);
+  EXPECT_EQ(result.value, sup::dto::AnyValue(sup::dto::SignedInteger32Type, 0));
+
+  EXPECT_EQ(responder.GetUnansweredCount(), 0);
+}
+
+TEST_F(ScriptedUserResponderTest, UserInputMismatch)
+{
+  const std::vector<ScriptedUserRule> rules = {{RequestType::kInput, "^Voltage", "\"abc\""},
+                                               {RequestType::kChoice, "", "", 0}};
+  const ScriptedUserResponder responder(rules);
+
+  const sup::dto::AnyValue initial_value{sup::dto::SignedInteger32Type, 1};
+
+  // there is no input rule for the description, choice rule doesn't apply
+  EXPECT_FALSE(responder.GetUserInput({initial_value, "Current setpoint"}).processed);
+
+  // the value of the rule can't be converted to the integer
+  EXPECT_FALSE(responder.GetUserInput({initial_value, "Voltage setpoint"}).processed);
+
+  EXPECT_EQ(responder.GetUnansweredCount(), 2);
+}
+
+TEST_F(ScriptedUserResponderTest, UserChoice)
+{
+  const std::vector<ScriptedUserRule> rules = {
+      {RequestType::kChoice, "Confirm", "", -1, "Retry"},
+      {RequestType::kChoice, "Select", "", 2},
+      {RequestType::kChoice, "Unknown", "", -1, "Cancel"},
+      {RequestType::kChoice, "Invalid", "", 3}};
+  const ScriptedUserResponder responder(rules);
+
+  EXPECT_EQ(responder.GetUserChoice(CreateChoiceArgs("Confirm action")),
+            UserChoiceResult({1, true}));
+  EXPECT_EQ(responder.GetUserChoice(CreateChoiceArgs("Select action")),
+            UserChoiceResult({2, true}));
+  EXPECT_EQ(responder.GetUnansweredCount(), 0);
+
+  // the option of the rule is not on the list, index of the rule is out of range
+  EXPECT_FALSE(responder.GetUserChoice(CreateChoiceArgs("Unknown action")).processed);
+  EXPECT_FALSE(responder.GetUserChoice(CreateChoiceArgs("Invalid action")).processed);
+
+  // no matching rule
+  EXPECT_FALSE(responder.GetUserChoice(CreateChoiceArgs("Abort action")).processed);
+
+  EXPECT_EQ(responder.GetUnansweredCount(), 3);
+}
+
+TEST_F(ScriptedUserResponderTest, ReadRules)
+{
+  const auto file_name = WriteFile("rules.json", R"RAW(
+{
+  "rules": [
+    {"type": "input", "match": "Voltage", "value": {"a": 1}, "delay": 10},
+    {"type": "choice", "option": "Retry"},
+    {"type": "choice", "match": "Select", "index": 2}
+  ]
+})RAW");
+
+  const auto rules = ReadScriptedUserRules(file_name);
+  ASSERT_EQ(rules.size(), 3);
+
+  EXPECT_EQ(rules.at(0).type, RequestType::kInput);
+  EXPECT_EQ(rules.at(0).pattern, std::string("Voltage"));
+  EXPECT_EQ(rules.at(0).value, std::string(R"RAW({"a":1})RAW"));
+  EXPECT_EQ(rules.at(0).delay, std::chrono::milliseconds(10));
+
+  EXPECT_EQ(rules.at(1).type, RequestType::kChoice);
+  EXPECT_TRUE(rules.at(1).pattern.empty());
+  EXPECT_EQ(rules.at(1).choice_option, std::string("Retry"));
+  EXPECT_EQ(rules.at(1).delay, std::chrono::milliseconds(0));
+
+  EXPECT_EQ(rules.at(2).choice_index, 2);
+  EXPECT_TRUE(rules.at(2).choice_option.empty());
+
+  // plain array of rules is also accepted
+  const auto array_file_name = WriteFile("array.json", R"RAW([{"type": "input", "value": 42}])RAW");
+  const auto array_rules = ReadScriptedUserRules(array_file_name);
+  ASSERT_EQ(array_rules.size(), 1);
+  EXPECT_EQ(array_rules.at(0).value, std::string("42"));
+}
+
+TEST_F(ScriptedUserResponderTest, ReadInvalidRules)
+{
+  EXPECT_THROW(ReadScriptedUserRules(m_dir.filePath("non-existing.json").toStdString()),
+               RuntimeException);
+  EXPECT_THROW(ReadScriptedUserRules(WriteFile("broken.json", "[{")), RuntimeException);
+  EXPECT_THROW(ReadScriptedUserRules(WriteFile("type.json", R"RAW([{"type": "abc"}])RAW")),
+               RuntimeException);
+  EXPECT_THROW(ReadScriptedUserRules(WriteFile("input.json", R"RAW([{"type": "input"}])RAW")),
+               RuntimeException);
+  EXPECT_THROW(ReadScriptedUserRules(WriteFile("choice.json", R"RAW([{"type": "choice"}])RAW")),
+               RuntimeException);
+  EXPECT_THROW(
+      ReadScriptedUserRules(WriteFile("delay.json", R"RAW([{"type": "input", "value": 1,
+                                                            "delay": -1}])RAW")),
+      RuntimeException);
+}
+
+TEST_F(ScriptedUserResponderTest, CreateScriptedUserContext)
+{
+  const auto file_name = WriteFile(
+      "rules.json",
+      R"RAW([{"type": "input", "value": 42}, {"type": "choice", "option": "Ignore"}])RAW");
+
+  const auto context = CreateScriptedUserContext(file_name);
+  EXPECT_TRUE(context.answer_on_calling_thread);
+
+  const sup::dto::AnyValue initial_value{sup::dto::SignedInteger32Type, 1};
+  const auto input_result = context.user_input_callback({initial_value, "description"});
+  EXPECT_EQ(input_result, UserInputResult({{sup::dto::SignedInteger32Type, 42}, true}));
+
+  const auto choice_result = context.user_choice_callback(CreateChoiceArgs("text"));
+  EXPECT_EQ(choice_result, UserChoiceResult({2, true}));
+
+  EXPECT_THROW(CreateScriptedUserContext(m_dir.filePath("non-existing.json").toStdString()),
+               RuntimeException);
+}
+
+}  // namespace oac_tree_gui::test
@@ -0,0 +1,69 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/shared_anyvalue.h"
+
+#include <gtest/gtest.h>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for SharedAnyValue class.
+ */
+class SharedAnyValueTest : public ::testing::Test
+{
+};
+
+TEST_F(SharedAnyValueTest, InitialState)
+{
+  const SharedAnyValue value;
+  EXPECT_TRUE(sup::dto::IsEmptyValue(value.Get()));
+  EXPECT_EQ(value, SharedAnyValue{});
+}
+
+TEST_F(SharedAnyValueTest, CopyIsShallow)
+{
+  const sup::dto::AnyValue anyvalue{sup::dto::SignedInteger32Type, 42};
+  const SharedAnyValue value(anyvalue);
+  EXPECT_EQ(value.Get(), anyvalue);
+
+  // copy refers to the same instance
+  const SharedAnyValue copy = value;
+  EXPECT_TRUE(copy.IsSameInstance(value));
+  EXPECT_EQ(copy, value);
+
+  // payloads created separately are different instances, but still equal
+  const SharedAnyValue other(anyvalue);
+  EXPECT_FALSE(other.IsSameInstance(value));
+  EXPECT_EQ(other, value);
+  EXPECT_NE(SharedAnyValue(sup::dto::AnyValue{sup::dto::SignedInteger32Type, 43}), value);
+}
+
+TEST_F(SharedAnyValueTest, ImplicitConversion)
+{
+  const SharedAnyValue value(sup::dto::AnyValue{sup::dto::StringType, std::string("abc")});
+
+  const sup::dto::AnyValue& anyvalue = value;
+  EXPECT_EQ(&anyvalue, &value.Get());
+  EXPECT_EQ(anyvalue.As<std::string>(), std::string("abc"));
+}
+
+}  // namespace oac_tree_gui::test
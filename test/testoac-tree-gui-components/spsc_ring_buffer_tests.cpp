@@ -0,0 +1,107 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/spsc_ring_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for SpscRingBuffer class.
+ */
+class SpscRingBufferTest : public ::testing::Test
+{
+};
+
+TEST_F(SpscRingBufferTest, InitialState)
+{
+  SpscRingBuffer<int> buffer(3);
+  EXPECT_EQ(buffer.GetCapacity(), 4);
+  EXPECT_EQ(buffer.GetSize(), 0);
+
+  int value{0};
+  EXPECT_FALSE(buffer.TryPop(value));
+}
+
+TEST_F(SpscRingBufferTest, PushAndPop)
+{
+  SpscRingBuffer<std::string> buffer(2);
+
+  EXPECT_TRUE(buffer.TryPush("a"));
+  EXPECT_TRUE(buffer.TryPush("b"));
+  EXPECT_EQ(buffer.GetSize(), 2);
+
+  // buffer is full, value is left untouched
+  std::string value("c");
+  EXPECT_FALSE(buffer.TryPush(std::move(value)));
+  EXPECT_EQ(value, std::string("c"));
+
+  std::string result;
+  EXPECT_TRUE(buffer.TryPop(result));
+  EXPECT_EQ(result, std::string("a"));
+
+  EXPECT_TRUE(buffer.TryPush(std::move(value)));
+
+  EXPECT_TRUE(buffer.TryPop(result));
+  EXPECT_EQ(result, std::string("b"));
+  EXPECT_TRUE(buffer.TryPop(result));
+  EXPECT_EQ(result, std::string("c"));
+  EXPECT_FALSE(buffer.TryPop(result));
+  EXPECT_EQ(buffer.GetSize(), 0);
+}
+
+TEST_F(SpscRingBufferTest, ProducerAndConsumerThreads)
+{
+  const int kValueCount{100000};
+  SpscRingBuffer<int> buffer(64);
+
+  auto producer = [&buffer, kValueCount]()
+  {
+    for (int value = 0; value < kValueCount; ++value)
+    {
+      while (!buffer.TryPush(int{value}))
+      {
+        std::this_thread::yield();
+      }
+    }
+  };
+  std::thread producer_thread(producer);
+
+  int expected_value{0};
+  while (expected_value < kValueCount)
+  {
+    int value{-1};
+    if (buffer.TryPop(value))
+    {
+      ASSERT_EQ(value, expected_value);
+      ++expected_value;
+    }
+  }
+
+  producer_thread.join();
+  EXPECT_EQ(buffer.GetSize(), 0);
+}
+
+}  // namespace oac_tree_gui::test
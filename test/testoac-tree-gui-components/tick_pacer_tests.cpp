@@ -0,0 +1,162 @@
+/******************************************************************************
+ *
+ * Project       : Graphical User Interface for SUP oac-tree
+ *
+ * Description   : Integrated development environment for oac-tree procedures
+ *
+ * Author        : Gennady Pospelov (IO)
+ *
+ * Copyright (c) : 2010-2026 ITER Organization,
+ *                 CS 90 046
+ *                 13067 St. Paul-lez-Durance Cedex
+ *                 France
+ * SPDX-License-Identifier: MIT
+ *
+ * This file is part of ITER CODAC software.
+ * For the terms and conditions of redistribution or use of this software
+ * refer to the file LICENSE located in the top level directory
+ * of the distribution package.
+ *****************************************************************************/
+
+#include "oac_tree_gui/jobsystem/tick_pacer.h"
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <thread>
+
+namespace oac_tree_gui::test
+{
+
+/**
+ * @brief Tests for TickPacer class.
+ */
+class TickPacerTest : public ::testing::Test
+{
+public:
+  using clock_t = TickPacer::clock_t;
+  using usec = std::chrono::microseconds;
+  using msec = std::chrono::milliseconds;
+
+  /**
+   * @brief Makes the given number of ticks and returns the time spent.
+   */
+  static clock_t::duration MakeTicks(TickPacer& pacer, std::size_t tick_count,
+                                     usec work_time = usec{0})
+  {
+    const auto start = clock_t::now();
+    for (std::size_t index = 0; index < tick_count; ++index)
+    {
+      if (work_time.count() > 0)
+      {
+        std::this_thread::sleep_for(work_time);
+      }
+      pacer.Tick();
+    }
+    return clock_t::now() - start;
+  }
+};
+
+TEST_F(TickPacerTest, InitialState)
+{
+  const TickPacer pacer;
+  EXPECT_EQ(pacer.GetTickPeriod(), usec{0});
+
+  const auto statistics = pacer.GetStatistics();
+  EXPECT_EQ(statistics.tick_count, 0);
+  EXPECT_EQ(statistics.late_tick_count, 0);
+  EXPECT_EQ(statistics.tick_rate, 0.0);
+  EXPECT_EQ(statistics.target_tick_rate, 0.0);
+}
+
+TEST_F(TickPacerTest, FullSpeed)
+{
+  TickPacer pacer;
+
+  const auto elapsed = MakeTicks(pacer, 1000);
+  EXPECT_LT(elapsed, msec(100));
+  EXPECT_EQ(pacer.GetStatistics().tick_count, 1000);
+}
+
+//! Sub-millisecond period is kept on average.
+TEST_F(TickPacerTest, SubMillisecondPeriod)
+{
+  TickPacer pacer;
+  pacer.SetTickPeriod(usec(500));
+  EXPECT_EQ(pacer.GetTickPeriod(), usec(500));
+  EXPECT_DOUBLE_EQ(pacer.GetStatistics().target_tick_rate, 2000.0);
+
+  // the first tick starts the schedule, 100 periods follow
+  const auto elapsed = MakeTicks(pacer, 100);
+  EXPECT_GE(elapsed, msec(50));
+  EXPECT_LT(elapsed, msec(75));
+}
+
+//! The time spent between ticks is subtracted from the wait.
+TEST_F(TickPacerTest, DriftCompensation)
+{
+  TickPacer pacer;
+  pacer.SetTickPeriod(msec(10));
+
+  const auto elapsed = MakeTicks(pacer, 20, msec(5));
+  EXPECT_GE(elapsed, msec(200));
+  EXPECT_LT(elapsed, msec(230));
+  EXPECT_EQ(pacer.GetStatistics().late_tick_count, 0);
+}
+
+//! The tick too late to keep the schedule restarts it, without a burst of fast ticks.
+TEST_F(TickPacerTest, LateTick)
+{
+  TickPacer pacer;
+  pacer.SetTickPeriod(msec(5));
+
+  pacer.Tick();
+  std::this_thread::sleep_for(msec(30));
+  pacer.Tick();
+  EXPECT_EQ(pacer.GetStatistics().late_tick_count, 1);
+
+  const auto elapsed = MakeTicks(pacer, 4);
+  EXPECT_GE(elapsed, msec(15));
+}
+
+//! Change of the period interrupts the wait in progress.
+TEST_F(TickPacerTest, InterruptWait)
+{
+  TickPacer pacer;
+  pacer.SetTickPeriod(std::chrono::seconds(10));
+
+  auto ticks = std::async(std::launch::async, [&pacer]() { return MakeTicks(pacer, 2); });
+
+  std::this_thread::sleep_for(msec(20));
+  pacer.SetTickPeriod(msec(10));
+
+  ASSERT_EQ(ticks.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+  EXPECT_LT(ticks.get(), msec(500));
+
+  // full speed releases the waiting thread immediately
+  pacer.SetTickPeriod(std::chrono::seconds(10));
+  ticks = std::async(std::launch::async, [&pacer]() { return MakeTicks(pacer, 1); });
+  std::this_thread::sleep_for(msec(20));
+  pacer.SetTickPeriod(usec(0));
+  ASSERT_EQ(ticks.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+}
+
+TEST_F(TickPacerTest, MeasuredRate)
+{
+  TickPacer pacer;
+  pacer.SetTickPeriod(msec(10));
+
+  const auto start = clock_t::now();
+  (void)MakeTicks(pacer, 110);
+
+  auto statistics = pacer.GetStatistics();
+  EXPECT_EQ(statistics.tick_count, 110);
+  EXPECT_NEAR(statistics.tick_rate, 100.0, 10.0);
+  EXPECT_DOUBLE_EQ(statistics.target_tick_rate, 100.0);
+
+  // nothing has happened for a long time, rate is going down
+  statistics = pacer.GetStatistics(start + std::chrono::seconds(20));
+  EXPECT_LT(statistics.tick_rate, 10.0);
+}
+
+}  // namespace oac_tree_gui::test
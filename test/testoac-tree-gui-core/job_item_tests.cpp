@@ -64,6 +64,30 @@ TEST_F(JobItemTest, JobItem)
   item.SetTickTimeout(std::chrono::milliseconds{42});
   EXPECT_EQ(item.GetTickTimeout(), std::chrono::milliseconds{42});
 
+  // timeouts below one millisecond are kept
+  item.SetTickTimeout(std::chrono::microseconds{500});
+  EXPECT_EQ(item.GetTickTimeout(), std::chrono::microseconds{500});
+
+  EXPECT_EQ(item.GetLogCapacity(), static_cast<std::size_t>(itemconstants::kDefaultLogCapacity));
+  item.SetLogCapacity(42);
+  EXPECT_EQ(item.GetLogCapacity(), 42);
+
+  EXPECT_EQ(item.GetLogSeverityThreshold(), std::string("TRACE"));
+  item.SetLogSeverityThreshold("ERROR");
+  EXPECT_EQ(item.GetLogSeverityThreshold(), std::string("ERROR"));
+
+  EXPECT_EQ(item.GetLogRateLimit(), 0);
+  item.SetLogRateLimit(42);
+  EXPECT_EQ(item.GetLogRateLimit(), 42);
+
+  EXPECT_FALSE(item.IsLogFoldDuplicates());
+  item.SetLogFoldDuplicates(true);
+  EXPECT_TRUE(item.IsLogFoldDuplicates());
+
+  EXPECT_EQ(item.GetPriority(), 0);
+  item.SetPriority(-2);
+  EXPECT_EQ(item.GetPriority(), -2);
+
   item.SetStatus(RunnerStatus::kInitial);
   EXPECT_EQ(item.GetStatus(), RunnerStatus::kInitial);
 
@@ -121,6 +121,25 @@ TEST_F(ProcedureItemJobInfoBuilderTest, GetInstructionIndex)
   EXPECT_THROW(builder.GetIndex(nullptr), RuntimeException);
 }
 
+//! Building the procedure again replaces the index of instructions.
+TEST_F(ProcedureItemJobInfoBuilderTest, GetInstructionIndexAfterRebuild)
+{
+  auto job_info = test::CreateJobInfo(kSequenceTwoWaitsBody);
+
+  ProcedureItemJobInfoBuilder builder;
+  auto procedure_item0 = builder.CreateProcedureItem(job_info);
+  auto procedure_item1 = builder.CreateProcedureItem(job_info);
+
+  auto sequence0 = procedure_item0->GetInstructionContainer()->GetItem<InstructionInfoItem>(
+      mvvm::TagIndex::Default(0));
+  auto sequence1 = procedure_item1->GetInstructionContainer()->GetItem<InstructionInfoItem>(
+      mvvm::TagIndex::Default(0));
+
+  EXPECT_THROW(builder.GetIndex(sequence0), RuntimeException);
+  EXPECT_EQ(builder.GetIndex(sequence1), 0);
+  EXPECT_EQ(builder.GetInstruction(0), sequence1);
+}
+
 TEST_F(ProcedureItemJobInfoBuilderTest, BuildFromIncludeAfterSteup)
 {
   const std::string kProcedure{
@@ -47,6 +47,7 @@ TEST_F(RunnerStatusTest, ToString)
   EXPECT_EQ(ToString(RunnerStatus::kHalted), "Halted");
   EXPECT_EQ(ToString(RunnerStatus::kUndefined), "");
   EXPECT_EQ(ToString(RunnerStatus::kSubmitFailure), "SubmitFailure");
+  EXPECT_EQ(ToString(RunnerStatus::kQueued), "Queued");
 }
 
 TEST_F(RunnerStatusTest, GetRunnerStatus)
@@ -59,6 +60,7 @@ TEST_F(RunnerStatusTest, GetRunnerStatus)
   EXPECT_EQ(GetRunnerStatus("Failure"), RunnerStatus::kFailed);
   EXPECT_EQ(GetRunnerStatus("Halted"), RunnerStatus::kHalted);
   EXPECT_EQ(GetRunnerStatus("SubmitFailure"), RunnerStatus::kSubmitFailure);
+  EXPECT_EQ(GetRunnerStatus("Queued"), RunnerStatus::kQueued);
   EXPECT_THROW(GetRunnerStatus("abc"), RuntimeException);
 }
 